@@ -112,8 +112,10 @@ class connection
 
   private:
 	//----------------- i_service_endpoint ---------------------
-	virtual bool do_send(const void *ptr, size_t cb);		///< (see do_send from i_service_endpoint)
-	virtual bool do_send_chunk(const void *ptr, size_t cb); ///< will send (or queue) a part of data
+	virtual bool do_send(const void *ptr, size_t cb);									///< (see do_send from i_service_endpoint)
+	virtual bool do_send_message(const void *head, size_t head_cb, const void *body, size_t body_cb, int traffic_class); ///< (see do_send_message from i_service_endpoint)
+	bool queue_message(std::list<send_que_entry> &chunks, size_t cb, int traffic_class); ///< will send (or queue) the chunks of one message
+	void send_que_front_started();														///< account the front of m_send_que before it is written
 	virtual bool close();
 	virtual bool call_run_once_service_io();
 	virtual bool request_callback();
@@ -148,7 +150,6 @@ class connection
 	//typename t_protocol_handler::config_type m_dummy_config;
 	std::list<boost::shared_ptr<connection<t_protocol_handler>>> m_self_refs; // add_ref/release support
 	critical_section m_self_refs_lock;
-	critical_section m_chunking_lock; // held while we add small chunks of the big do_send() to small do_send_chunk()
 
 	t_connection_type m_connection_type;
 
@@ -395,6 +395,12 @@ bool connection<t_protocol_handler>::call_run_once_service_io()
 //---------------------------------------------------------------------------------
 template <class t_protocol_handler>
 bool connection<t_protocol_handler>::do_send(const void *ptr, size_t cb)
+{
+	return do_send_message(ptr, cb, nullptr, 0, traffic_class_other);
+}
+//---------------------------------------------------------------------------------
+template <class t_protocol_handler>
+bool connection<t_protocol_handler>::do_send_message(const void *head, size_t head_cb, const void *body, size_t body_cb, int traffic_class)
 {
 	TRY_ENTRY();
 
@@ -404,95 +410,55 @@ bool connection<t_protocol_handler>::do_send(const void *ptr, size_t cb)
 		return false;
 	if(m_was_shutdown)
 		return false;
-	// TODO avoid copy
 
-	const double factor = 32;			 // TODO config
-	typedef long long signed int t_safe; // my t_size to avoid any overunderflow in arithmetic
-	const t_safe chunksize_good = (t_safe)(1024 * std::max(1.0, factor));
-	const t_safe chunksize_max = chunksize_good * 2;
+	const size_t chunksize_good = 32 * 1024; // TODO config
+	const size_t chunksize_max = chunksize_good * 2;
 	const bool allow_split = (m_connection_type == e_connection_type_RPC) ? false : true; // do not split RPC data
 
-	CHECK_AND_ASSERT_MES(!(chunksize_max < 0), false, "Negative chunksize_max"); // make sure it is unsigned before removin sign with cast:
-	long long unsigned int chunksize_max_unsigned = static_cast<long long unsigned int>(chunksize_max);
-
-	if(allow_split && (cb > chunksize_max_unsigned))
+	// Big messages are queued as small chunks so the out throttle can sleep between them,
+	// all chunks are queued at once so no other message can get in between.
+	// Head and body are copied straight into the chunks, which may straddle the two.
+	const size_t cb = head_cb + body_cb;
+	std::list<send_que_entry> chunks;
+	size_t pos = 0;
+	do
 	{
-		{																					// LOCK: chunking
-			epee::critical_region_t<decltype(m_chunking_lock)> send_guard(m_chunking_lock); // *** critical ***
-
-			MDEBUG("do_send() will SPLIT into small chunks, from packet=" << cb << " B for ptr=" << ptr);
-			t_safe all = cb; // all bytes to send
-			t_safe pos = 0;  // current sending position
-			// 01234567890
-			// ^^^^        (pos=0, len=4)     ;   pos:=pos+len, pos=4
-			//     ^^^^    (pos=4, len=4)     ;   pos:=pos+len, pos=8
-			//         ^^^ (pos=8, len=4)    ;
-
-			// const size_t bufsize = chunksize_good; // TODO safecast
-			// char* buf = new char[ bufsize ];
-
-			bool all_ok = true;
-			while(pos < all)
-			{
-				t_safe lenall = all - pos;					   // length from here to end
-				t_safe len = std::min(chunksize_good, lenall); // take a smaller part
-				CHECK_AND_ASSERT_MES(len <= chunksize_good, false, "len too large");
-				// pos=8; len=4; all=10;	len=3;
-
-				CHECK_AND_ASSERT_MES(!(len < 0), false, "negative len"); // check before we cast away sign:
-				unsigned long long int len_unsigned = static_cast<long long int>(len);
-				CHECK_AND_ASSERT_MES(len > 0, false, "len not strictly positive");										// (redundant)
-				CHECK_AND_ASSERT_MES(len_unsigned < std::numeric_limits<size_t>::max(), false, "Invalid len_unsigned"); // yeap we want strong < then max size, to be sure
-
-				void *chunk_start = ((char *)ptr) + pos;
-				MDEBUG("chunk_start=" << chunk_start << " ptr=" << ptr << " pos=" << pos);
-				CHECK_AND_ASSERT_MES(chunk_start >= ptr, false, "Pointer wraparound"); // not wrapped around address?
-				//std::memcpy( (void*)buf, chunk_start, len);
-
-				MDEBUG("part of " << lenall << ": pos=" << pos << " len=" << len);
-
-				bool ok = do_send_chunk(chunk_start, len); // <====== ***
-
-				all_ok = all_ok && ok;
-				if(!all_ok)
-				{
-					MDEBUG("do_send() DONE ***FAILED*** from packet=" << cb << " B for ptr=" << ptr);
-					MDEBUG("do_send() SEND was aborted in middle of big package - this is mostly harmless "
-						   << " (e.g. peer closed connection) but if it causes trouble tell us at https://github.com/ryo-currency/ryo. " << cb);
-					return false; // partial failure in sending
-				}
-				pos = pos + len;
-				CHECK_AND_ASSERT_MES(pos > 0, false, "pos <= 0");
-
-				// (in catch block, or uniq pointer) delete buf;
-			} // each chunk
-
-			MDEBUG("do_send() DONE SPLIT from packet=" << cb << " B for ptr=" << ptr);
+		size_t len = cb - pos;
+		if(allow_split && cb > chunksize_max)
+			len = std::min(chunksize_good, len);
+		chunks.emplace_back();
+		send_que_entry &chunk = chunks.back();
+		chunk.data.reserve(len);
+		if(pos < head_cb)
+			chunk.data.append((const char *)head + pos, std::min(len, head_cb - pos));
+		if(pos + len > head_cb)
+		{
+			const size_t body_pos = pos > head_cb ? pos - head_cb : 0;
+			chunk.data.append((const char *)body + body_pos, pos + len - head_cb - body_pos);
+		}
+		chunk.traffic_class = traffic_class;
+		chunk.message_start = pos == 0;
+		chunk.finish_tag = 0;
+		chunk.queued_at = 0;
+		pos += len;
+	} while(pos < cb);
 
-			MDEBUG("do_send() m_connection_type = " << m_connection_type);
+	if(chunks.size() > 1)
+		MDEBUG("do_send() will SPLIT into small chunks, from packet=" << cb << " B into " << chunks.size() << " chunks");
 
-			return all_ok; // done - e.g. queued - all the chunks of current do_send call
-		}				   // LOCK: chunking
-	}					   // a big block (to be chunked) - all chunks
-	else
-	{								   // small block
-		return do_send_chunk(ptr, cb); // just send as 1 big chunk
-	}
+	return queue_message(chunks, cb, traffic_class);
 
-	CATCH_ENTRY_L0("connection<t_protocol_handler>::do_send", false);
-} // do_send()
+	CATCH_ENTRY_L0("connection<t_protocol_handler>::do_send_message", false);
+} // do_send_message()
 
 //---------------------------------------------------------------------------------
 template <class t_protocol_handler>
-bool connection<t_protocol_handler>::do_send_chunk(const void *ptr, size_t cb)
+bool connection<t_protocol_handler>::queue_message(std::list<send_que_entry> &chunks, size_t cb, int traffic_class)
 {
 	TRY_ENTRY();
-	// Use safe_shared_from_this, because of this is public method and it can be called on the object being deleted
 	auto self = safe_shared_from_this();
 	if(!self)
 		return false;
-	if(m_was_shutdown)
-		return false;
 	{
 		CRITICAL_REGION_LOCAL(m_throttle_speed_out_mutex);
 		m_throttle_speed_out.handle_trafic_exact(cb);
@@ -512,7 +478,7 @@ bool connection<t_protocol_handler>::do_send_chunk(const void *ptr, size_t cb)
 
 	long int retry = 0;
 	const long int retry_limit = 5 * 4;
-	while(m_send_que.size() > ABSTRACT_SERVER_SEND_QUE_MAX_COUNT)
+	while(m_send_que_messages > ABSTRACT_SERVER_SEND_QUE_MAX_COUNT)
 	{
 		retry++;
 
@@ -536,34 +502,52 @@ bool connection<t_protocol_handler>::do_send_chunk(const void *ptr, size_t cb)
 		}
 	}
 
-	m_send_que.resize(m_send_que.size() + 1);
-	m_send_que.back().assign((const char *)ptr, cb);
+	// Weighted fair queuing: the finish tag of a message grows by its size divided by the weight of its class,
+	// so while several classes have messages waiting each gets a share of the connection proportional to its weight
+	if(traffic_class < 0 || traffic_class >= traffic_class_count)
+		traffic_class = traffic_class_other;
+	const uint64_t finish_tag = std::max(m_send_que_vtime, m_send_que_last_finish[traffic_class]) +
+		(cb + 1) * get_traffic_class_weight(traffic_class_block) / get_traffic_class_weight(traffic_class);
+	m_send_que_last_finish[traffic_class] = finish_tag;
+	chunks.front().finish_tag = finish_tag;
+	chunks.front().queued_at = epee::misc_utils::get_tick_count();
+
+	// The front chunk is being written, only the messages after it can be overtaken
+	const bool send_now = m_send_que.empty();
+	auto insert_at = m_send_que.end();
+	if(!send_now)
+	{
+		for(auto it = std::next(m_send_que.begin()); it != m_send_que.end(); ++it)
+		{
+			if(it->message_start && it->finish_tag > finish_tag)
+			{
+				insert_at = it;
+				break;
+			}
+		}
+	}
+	m_send_que.splice(insert_at, chunks);
+	++m_send_que_messages;
 
-	if(m_send_que.size() > 1)
+	if(!send_now)
 	{ // active operation should be in progress, nothing to do, just wait last operation callback
-		auto size_now = cb;
-		MDEBUG("do_send() NOW just queues: packet=" << size_now << " B, is added to queue-size=" << m_send_que.size());
+		MDEBUG("do_send() NOW just queues: packet=" << cb << " B, class=" << get_traffic_class_name(traffic_class) << ", is added to queue-size=" << m_send_que.size());
 		//do_send_handler_delayed( ptr , size_now ); // (((H))) // empty function
 
-		LOG_TRACE_CC(context, "[sock " << socket_.native_handle() << "] Async send requested " << m_send_que.front().size());
+		LOG_TRACE_CC(context, "[sock " << socket_.native_handle() << "] Async send requested " << m_send_que.front().data.size());
 	}
 	else
 	{ // no active operation
+		send_que_front_started();
 
-		if(m_send_que.size() != 1)
-		{
-			_erro("Looks like no active operations, but send que size != 1!!");
-			return false;
-		}
-
-		auto size_now = m_send_que.front().size();
+		auto size_now = m_send_que.front().data.size();
 		MDEBUG("do_send() NOW SENSD: packet=" << size_now << " B");
 		if(speed_limit_is_enabled())
-			do_send_handler_write(ptr, size_now); // (((H)))
+			do_send_handler_write(m_send_que.front().data.data(), size_now); // (((H)))
 
-		CHECK_AND_ASSERT_MES(size_now == m_send_que.front().size(), false, "Unexpected queue size");
+		CHECK_AND_ASSERT_MES(size_now == m_send_que.front().data.size(), false, "Unexpected queue size");
 		reset_timer(get_default_time(), false);
-		boost::asio::async_write(socket_, boost::asio::buffer(m_send_que.front().data(), size_now),
+		boost::asio::async_write(socket_, boost::asio::buffer(m_send_que.front().data.data(), size_now),
 								 //strand_.wrap(
 								 boost::bind(&connection<t_protocol_handler>::handle_write, self, _1, _2)
 								 //)
@@ -577,8 +561,20 @@ bool connection<t_protocol_handler>::do_send_chunk(const void *ptr, size_t cb)
 
 	return true;
 
-	CATCH_ENTRY_L0("connection<t_protocol_handler>::do_send", false);
-} // do_send_chunk
+	CATCH_ENTRY_L0("connection<t_protocol_handler>::queue_message", false);
+} // queue_message
+//---------------------------------------------------------------------------------
+template <class t_protocol_handler>
+void connection<t_protocol_handler>::send_que_front_started()
+{
+	// called with m_send_que_lock held, when the front chunk is about to be written
+	const send_que_entry &front = m_send_que.front();
+	if(!front.message_start)
+		return;
+	--m_send_que_messages;
+	m_send_que_vtime = front.finish_tag;
+	network_throttle_manager::add_traffic_out(front.traffic_class, 0, true, epee::misc_utils::get_tick_count() - front.queued_at);
+}
 //---------------------------------------------------------------------------------
 template <class t_protocol_handler>
 boost::posix_time::milliseconds connection<t_protocol_handler>::get_default_time() const
@@ -688,6 +684,7 @@ void connection<t_protocol_handler>::handle_write(const boost::system::error_cod
 		return;
 	}
 
+	network_throttle_manager::add_traffic_out(m_send_que.front().traffic_class, cb, false, 0);
 	m_send_que.pop_front();
 	if(m_send_que.empty())
 	{
@@ -700,13 +697,14 @@ void connection<t_protocol_handler>::handle_write(const boost::system::error_cod
 	{
 		//have more data to send
 		reset_timer(get_default_time(), false);
-		auto size_now = m_send_que.front().size();
+		send_que_front_started();
+		auto size_now = m_send_que.front().data.size();
 		MDEBUG("handle_write() NOW SENDS: packet=" << size_now << " B"
 												   << ", from  queue size=" << m_send_que.size());
 		if(speed_limit_is_enabled())
-			do_send_handler_write_from_queue(e, m_send_que.front().size(), m_send_que.size()); // (((H)))
-		CHECK_AND_ASSERT_MES(size_now == m_send_que.front().size(), void(), "Unexpected queue size");
-		boost::asio::async_write(socket_, boost::asio::buffer(m_send_que.front().data(), size_now),
+			do_send_handler_write_from_queue(e, m_send_que.front().data.size(), m_send_que.size()); // (((H)))
+		CHECK_AND_ASSERT_MES(size_now == m_send_que.front().data.size(), void(), "Unexpected queue size");
+		boost::asio::async_write(socket_, boost::asio::buffer(m_send_que.front().data.data(), size_now),
 								 // strand_.wrap(
 								 boost::bind(&connection<t_protocol_handler>::handle_write, connection<t_protocol_handler>::shared_from_this(), _1, _2)
 								 // )
@@ -59,6 +59,7 @@
 #include <memory>
 
 #include "net/net_utils_base.h"
+#include "net/network_throttle.hpp"
 #include "syncobj.h"
 
 namespace epee
@@ -82,6 +83,17 @@ enum t_connection_type
 
 std::string to_string(t_connection_type type);
 
+/// One chunk of an outgoing message. The chunks of a message stay contiguous in the queue,
+/// a new message can only be inserted in front of a message_start entry that is not in flight.
+struct send_que_entry
+{
+	std::string data;
+	int traffic_class;
+	bool message_start;
+	uint64_t finish_tag; // weighted fair queuing order, set on the message_start chunk
+	uint64_t queued_at;  // ms, set on the message_start chunk
+};
+
 class connection_basic
 { // not-templated base class for rapid developmet of some code parts
   public:
@@ -91,7 +103,10 @@ class connection_basic
 	volatile uint32_t m_want_close_connection;
 	std::atomic<bool> m_was_shutdown;
 	critical_section m_send_que_lock;
-	std::list<std::string> m_send_que;
+	std::list<send_que_entry> m_send_que;
+	size_t m_send_que_messages;							  // messages queued that have not started sending yet
+	uint64_t m_send_que_vtime;							  // finish tag of the message being sent
+	uint64_t m_send_que_last_finish[traffic_class_count]; // finish tag of the last queued message of each class
 	volatile bool m_is_multithreaded;
 	double m_start_time;
 	/// Strand to ensure the connection's handlers are not called concurrently.
@@ -36,6 +36,7 @@
 #include "levin_base.h"
 #include "misc_language.h"
 #include "misc_os_dependent.h"
+#include "net/network_throttle.hpp"
 #include "syncobj.h"
 
 #include <chrono>
@@ -352,6 +353,14 @@ class async_protocol_handler
 		m_config.m_pcommands_handler->callback(m_connection_context);
 	}
 
+	// Header and body are sent as one message so the send queue can not put another message in between.
+	// Only notifications are sent with the class of their command, invokes and their responses keep their
+	// order because a response is matched to the oldest pending invoke.
+	bool send_message(const bucket_head2 &head, const std::string &body, int traffic_class)
+	{
+		return m_pservice_endpoint->do_send_message(&head, sizeof(head), body.data(), body.size(), traffic_class);
+	}
+
 	virtual bool handle_recv(const void *ptr, size_t cb)
 	{
 		if(boost::interprocess::ipcdetail::atomic_read32(&m_close_called))
@@ -407,6 +416,9 @@ class async_protocol_handler
 
 					bool is_response = (m_oponent_protocol_ver == LEVIN_PROTOCOL_VER_1 && m_current_head.m_flags & LEVIN_PACKET_RESPONSE);
 
+					net_utils::network_throttle_manager::add_traffic_in(is_response || m_current_head.m_have_to_return_data ? net_utils::traffic_class_other : net_utils::network_throttle_manager::classify_command(m_current_head.m_command),
+																		sizeof(bucket_head2) + m_current_head.m_cb);
+
 					MDEBUG(m_connection_context << "LEVIN_PACKET_RECIEVED. [len=" << m_current_head.m_cb
 												<< ", flags" << m_current_head.m_flags
 												<< ", r?=" << m_current_head.m_have_to_return_data
@@ -571,14 +583,7 @@ class async_protocol_handler
 			boost::interprocess::ipcdetail::atomic_write32(&m_invoke_buf_ready, 0);
 			CRITICAL_REGION_BEGIN(m_send_lock);
 			CRITICAL_REGION_LOCAL1(m_invoke_response_handlers_lock);
-			if(!m_pservice_endpoint->do_send(&head, sizeof(head)))
-			{
-				LOG_ERROR_CC(m_connection_context, "Failed to do_send");
-				err_code = LEVIN_ERROR_CONNECTION;
-				break;
-			}
-
-			if(!m_pservice_endpoint->do_send(in_buff.data(), (int)in_buff.size()))
+			if(!send_message(head, in_buff, net_utils::traffic_class_other))
 			{
 				LOG_ERROR_CC(m_connection_context, "Failed to do_send");
 				err_code = LEVIN_ERROR_CONNECTION;
@@ -628,13 +633,7 @@ class async_protocol_handler
 
 		boost::interprocess::ipcdetail::atomic_write32(&m_invoke_buf_ready, 0);
 		CRITICAL_REGION_BEGIN(m_send_lock);
-		if(!m_pservice_endpoint->do_send(&head, sizeof(head)))
-		{
-			LOG_ERROR_CC(m_connection_context, "Failed to do_send");
-			return LEVIN_ERROR_CONNECTION;
-		}
-
-		if(!m_pservice_endpoint->do_send(in_buff.data(), (int)in_buff.size()))
+		if(!send_message(head, in_buff, net_utils::traffic_class_other))
 		{
 			LOG_ERROR_CC(m_connection_context, "Failed to do_send");
 			return LEVIN_ERROR_CONNECTION;
@@ -700,13 +699,7 @@ class async_protocol_handler
 		head.m_protocol_version = LEVIN_PROTOCOL_VER_1;
 		head.m_flags = LEVIN_PACKET_REQUEST;
 		CRITICAL_REGION_BEGIN(m_send_lock);
-		if(!m_pservice_endpoint->do_send(&head, sizeof(head)))
-		{
-			LOG_ERROR_CC(m_connection_context, "Failed to do_send()");
-			return -1;
-		}
-
-		if(!m_pservice_endpoint->do_send(in_buff.data(), (int)in_buff.size()))
+		if(!send_message(head, in_buff, net_utils::network_throttle_manager::classify_command(command)))
 		{
 			LOG_ERROR_CC(m_connection_context, "Failed to do_send()");
 			return -1;
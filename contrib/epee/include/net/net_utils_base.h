@@ -317,6 +317,15 @@ struct connection_context_base
 struct i_service_endpoint
 {
 	virtual bool do_send(const void *ptr, size_t cb) = 0;
+	//send one whole protocol message made of head followed by body, endpoints with a send queue may order it ahead of queued messages of a lower traffic_class
+	virtual bool do_send_message(const void *head, size_t head_cb, const void *body, size_t body_cb, int traffic_class)
+	{
+		std::string buff;
+		buff.reserve(head_cb + body_cb);
+		buff.append((const char *)head, head_cb);
+		buff.append((const char *)body, body_cb);
+		return do_send(buff.data(), buff.size());
+	}
 	virtual bool close() = 0;
 	virtual bool call_run_once_service_io() = 0;
 	virtual bool request_callback() = 0;
@@ -69,9 +69,11 @@
 #include <iomanip>
 #include <sstream>
 
+#include <atomic>
 #include <fstream>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 namespace epee
 {
@@ -98,6 +100,37 @@ struct calculate_times_struct
 };
 typedef calculate_times_struct calculate_times_struct;
 
+/***
+@brief Classes of outgoing traffic, used to order the per connection send queue
+@details A message of a higher priority class (lower value) is queued ahead of
+messages of lower classes that have not started sending yet, weighted so the
+lower classes are delayed but never starved. The protocol maps its commands to
+a class through network_throttle_manager::set_traffic_classifier.
+*/
+enum traffic_class
+{
+	traffic_class_block = 0, // block propagation
+	traffic_class_sync,		 // chain sync requests and responses
+	traffic_class_relay,	 // transaction relay
+	traffic_class_other,	 // peer lists, pings and anything unclassified
+	traffic_class_count
+};
+
+const char *get_traffic_class_name(int traffic_class);
+uint64_t get_traffic_class_weight(int traffic_class);
+
+/***
+@brief Counters of one traffic class, summed over all connections
+*/
+struct traffic_class_stats
+{
+	uint64_t packets_in;
+	uint64_t bytes_in;
+	uint64_t packets_out;
+	uint64_t bytes_out;
+	uint64_t queued_ms; // time messages waited in send queues before their first byte was written
+};
+
 /*** 
 @brief Access to simple throttles, with singlton to access global network limits
 */
@@ -121,6 +154,20 @@ class network_throttle_manager
 	static i_network_throttle &get_global_throttle_in();	///< singleton ; for friend class ; caller MUST use proper locks! like m_lock_get_global_throttle_in
 	static i_network_throttle &get_global_throttle_inreq(); ///< ditto ; use lock ... use m_lock_get_global_throttle_inreq obviously
 	static i_network_throttle &get_global_throttle_out();   ///< ditto ; use lock ... use m_lock_get_global_throttle_out obviously
+
+	typedef int (*traffic_classifier)(int command);
+	static void set_traffic_classifier(traffic_classifier classifier); ///< maps levin commands to a traffic_class, unset classifies everything as other
+	static int classify_command(int command);
+
+	static void add_traffic_in(int traffic_class, size_t bytes);
+	static void add_traffic_out(int traffic_class, size_t bytes, bool message_start, uint64_t queued_ms);
+	static std::vector<traffic_class_stats> get_traffic_stats(); ///< indexed by traffic_class
+	static uint64_t get_traffic_stats_start_time();
+
+  private:
+	static std::atomic<traffic_classifier> m_traffic_classifier;
+	static std::atomic<uint64_t> m_traffic_stats[traffic_class_count][5];
+	static const uint64_t m_traffic_stats_start_time;
 };
 
 /***
@@ -150,8 +150,11 @@ connection_basic::connection_basic(boost::asio::io_service &io_service, std::ato
 	  socket_(io_service),
 	  m_want_close_connection(false),
 	  m_was_shutdown(false),
+	  m_send_que_messages(0),
+	  m_send_que_vtime(0),
 	  m_ref_sock_count(ref_sock_count)
 {
+	std::fill(std::begin(m_send_que_last_finish), std::end(m_send_que_last_finish), 0);
 	++ref_sock_count;							  // increase the global counter
 	mI->m_peer_number = sock_number.fetch_add(1); // use, and increase the generated number
 
@@ -70,6 +70,48 @@ namespace net_utils
 boost::mutex network_throttle_manager::m_lock_get_global_throttle_in;
 boost::mutex network_throttle_manager::m_lock_get_global_throttle_inreq;
 boost::mutex network_throttle_manager::m_lock_get_global_throttle_out;
+std::atomic<network_throttle_manager::traffic_classifier> network_throttle_manager::m_traffic_classifier(nullptr);
+std::atomic<uint64_t> network_throttle_manager::m_traffic_stats[traffic_class_count][5];
+const uint64_t network_throttle_manager::m_traffic_stats_start_time = time(NULL);
+
+namespace
+{
+enum traffic_stat
+{
+	traffic_stat_packets_in = 0,
+	traffic_stat_bytes_in,
+	traffic_stat_packets_out,
+	traffic_stat_bytes_out,
+	traffic_stat_queued_ms
+};
+
+int clamp_traffic_class(int traffic_class)
+{
+	return traffic_class >= 0 && traffic_class < traffic_class_count ? traffic_class : traffic_class_other;
+}
+}
+
+const char *get_traffic_class_name(int traffic_class)
+{
+	switch(clamp_traffic_class(traffic_class))
+	{
+	case traffic_class_block:
+		return "block";
+	case traffic_class_sync:
+		return "sync";
+	case traffic_class_relay:
+		return "relay";
+	default:
+		return "other";
+	}
+}
+
+uint64_t get_traffic_class_weight(int traffic_class)
+{
+	// share of the send queue each class gets when all of them have messages waiting
+	static const uint64_t weights[traffic_class_count] = {64, 16, 4, 1};
+	return weights[clamp_traffic_class(traffic_class)];
+}
 
 // ================================================================================================
 // methods:
@@ -91,6 +133,54 @@ i_network_throttle &network_throttle_manager::get_global_throttle_out()
 	return obj_get_global_throttle_out;
 }
 
+void network_throttle_manager::set_traffic_classifier(traffic_classifier classifier)
+{
+	m_traffic_classifier = classifier;
+}
+
+int network_throttle_manager::classify_command(int command)
+{
+	traffic_classifier classifier = m_traffic_classifier;
+	return classifier ? clamp_traffic_class(classifier(command)) : traffic_class_other;
+}
+
+void network_throttle_manager::add_traffic_in(int traffic_class, size_t bytes)
+{
+	std::atomic<uint64_t> *stats = m_traffic_stats[clamp_traffic_class(traffic_class)];
+	++stats[traffic_stat_packets_in];
+	stats[traffic_stat_bytes_in] += bytes;
+}
+
+void network_throttle_manager::add_traffic_out(int traffic_class, size_t bytes, bool message_start, uint64_t queued_ms)
+{
+	std::atomic<uint64_t> *stats = m_traffic_stats[clamp_traffic_class(traffic_class)];
+	if(message_start)
+	{
+		++stats[traffic_stat_packets_out];
+		stats[traffic_stat_queued_ms] += queued_ms;
+	}
+	stats[traffic_stat_bytes_out] += bytes;
+}
+
+std::vector<traffic_class_stats> network_throttle_manager::get_traffic_stats()
+{
+	std::vector<traffic_class_stats> res(traffic_class_count);
+	for(int i = 0; i < traffic_class_count; ++i)
+	{
+		res[i].packets_in = m_traffic_stats[i][traffic_stat_packets_in];
+		res[i].bytes_in = m_traffic_stats[i][traffic_stat_bytes_in];
+		res[i].packets_out = m_traffic_stats[i][traffic_stat_packets_out];
+		res[i].bytes_out = m_traffic_stats[i][traffic_stat_bytes_out];
+		res[i].queued_ms = m_traffic_stats[i][traffic_stat_queued_ms];
+	}
+	return res;
+}
+
+uint64_t network_throttle_manager::get_traffic_stats_start_time()
+{
+	return m_traffic_stats_start_time;
+}
+
 network_throttle_bw::network_throttle_bw(const std::string &name1)
 	: m_in("in/" + name1, name1 + "-DOWNLOAD"), m_inreq("inreq/" + name1, name1 + "-DOWNLOAD-REQUESTS"), m_out("out/" + name1, name1 + "-UPLOAD")
 {
@@ -73,7 +73,7 @@ std::string arg_db_type_description = "Specify database type, available: " + cry
 const command_line::arg_descriptor<std::string> arg_db_type = {
 	"db-type", arg_db_type_description.c_str(), DEFAULT_DB_TYPE};
 const command_line::arg_descriptor<std::string> arg_db_sync_mode = {
-	"db-sync-mode", "Specify sync option, using format [safe|fast|fastest]:[sync|async]:[nblocks_per_sync].", "fast:async:1000"};
+	"db-sync-mode", "Specify sync option, using format [safe|fast|fastest]:[sync|async|writebehind]:[nblocks_per_sync].", "fast:async:1000"};
 const command_line::arg_descriptor<bool> arg_db_salvage = {
 	"db-salvage", "Try to salvage a blockchain database if it seems corrupted", false};
 
@@ -142,6 +142,45 @@ struct txpool_tx_meta_t
 	uint8_t padding[76]; // till 192 bytes
 };
 
+/**
+ * @brief storage statistics of one table of the db
+ */
+struct db_table_stats_t
+{
+	std::string name;
+	uint64_t depth;			 //!< depth of the B-tree
+	uint64_t branch_pages;	 //!< number of internal pages
+	uint64_t leaf_pages;	 //!< number of leaf pages
+	uint64_t overflow_pages; //!< number of pages holding values too large for a leaf
+	uint64_t entries;		 //!< number of key/value pairs
+};
+
+/**
+ * @brief a reader of the db and the snapshot it keeps alive
+ */
+struct db_reader_stats_t
+{
+	uint64_t pid;
+	uint64_t thread;
+	uint64_t txn_id;      //!< snapshot read, 0 if the reader is idle
+	uint64_t txns_behind; //!< write txns committed since that snapshot
+};
+
+/**
+ * @brief storage statistics of the db
+ */
+struct db_stats_t
+{
+	uint64_t page_size;
+	uint64_t map_size;		  //!< current size limit of the db
+	uint64_t used_size;		  //!< size in use, including free pages
+	uint64_t last_txn_id;	  //!< id of the last committed write txn
+	uint64_t bytes_per_block; //!< observed growth per block, 0 if unknown
+	uint64_t max_readers;
+	std::vector<db_table_stats_t> tables;
+	std::vector<db_reader_stats_t> readers;
+};
+
 #define DBF_SAFE 1
 #define DBF_FAST 2
 #define DBF_FASTEST 4
@@ -643,6 +682,18 @@ class BlockchainDB
    */
 	virtual std::string get_db_name() const = 0;
 
+	/**
+   * @brief gets storage statistics of the db
+   *
+   * The subclass implementation should report the size of each of its
+   * tables and the readers currently holding a snapshot open, if it can.
+   *
+   * @param stats return-by-reference the statistics
+   *
+   * @return true if the subclass reports statistics, otherwise false
+   */
+	virtual bool get_db_stats(db_stats_t &stats) const { return false; }
+
 	// FIXME: these are just for functionality mocking, need to implement
 	// RAII-friendly and multi-read one-write friendly locking mechanism
 	//
@@ -730,6 +781,57 @@ class BlockchainDB
    */
 	virtual void set_batch_transactions(bool) = 0;
 
+	/**
+   * @brief sets whether or not to defer secondary index writes
+   *
+   * Bulk load mode is meant for importing trusted data inside batch
+   * transactions. While it is enabled, the subclass may buffer index
+   * updates that are not keyed by a monotonically increasing id (spent
+   * key images, per-amount output indices) and write them sorted when the
+   * batch is committed. Lookups against those indices do not see buffered
+   * entries until then.
+   *
+   * Disabling bulk load mode while a batch is in progress writes out the
+   * buffered entries to that batch.
+   *
+   * @param enable whether or not to enable bulk load mode
+   *
+   * @return true if the subclass supports bulk load mode, otherwise false
+   */
+	virtual bool set_bulk_load(bool enable) { return false; }
+
+	/**
+   * @brief sets whether or not to make commits durable in the background
+   *
+   * While write-behind is enabled, committing a write or batch transaction
+   * does not wait for the data to reach disk. Later transactions see the
+   * committed data as usual, and a writer thread owned by the subclass
+   * flushes it when asked to with request_sync(), coalescing commits made
+   * while a flush is in progress. Commits made since the last completed
+   * flush can be lost on power failure, so this is only available when the
+   * db was opened without syncing every commit, and switching to safe sync
+   * mode disables it.
+   *
+   * sync() is the durability barrier: when it returns, everything committed
+   * before the call is on disk. Disabling write-behind, or closing the db,
+   * waits for pending flushes.
+   *
+   * @param enable whether or not to enable write-behind
+   *
+   * @return true if write-behind is now in the requested state, false if the
+   * subclass does not support it or the db syncs every commit
+   */
+	virtual bool set_write_behind(bool enable) { return false; }
+
+	/**
+   * @brief asks the write-behind thread to flush everything committed so far
+   *
+   * Returns without waiting for the flush, unless the one asked for by the
+   * previous call is still in progress.  Does nothing if write-behind is not
+   * enabled.
+   */
+	virtual void request_sync() {}
+
 	virtual void block_txn_start(bool readonly = false) = 0;
 	virtual void block_txn_stop() = 0;
 	virtual void block_txn_abort() = 0;
@@ -17,12 +17,18 @@
 
 #include "db_lmdb.h"
 
+#include <algorithm>
 #include <boost/current_function.hpp>
 #include <boost/filesystem.hpp>
 #include <boost/format.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
 #include <cstring> // memcpy
 #include <memory>  // std::unique_ptr
 #include <random>
+#include <sstream>
+#include <unordered_map>
 
 #include "common/util.h"
 #include "crypto/crypto.h"
@@ -281,6 +287,29 @@ typedef struct outtx
 	uint64_t local_index;
 } outtx;
 
+// Index entries held back while bulk load mode is enabled. They are written
+// in sorted order when the batch txn is committed.
+struct mdb_bulk_load
+{
+	std::vector<crypto::key_image> spent_keys;
+	std::vector<std::pair<uint64_t, outkey>> output_amounts;
+	std::unordered_map<uint64_t, uint64_t> amount_counts; // amount -> number of outputs, buffered included
+};
+
+// Commits are counted as they are made. When asked to, the thread syncs up to
+// the latest one it has seen and records it as durable.
+struct mdb_write_behind
+{
+	boost::thread thread;
+	boost::mutex mutex;
+	boost::condition_variable cond;
+	uint64_t committed = 0;
+	uint64_t target = 0; // commits the thread was asked to make durable
+	uint64_t durable = 0;
+	bool stop = false;
+	std::string error; // set if a background sync failed
+};
+
 std::atomic<uint64_t> mdb_txn_safe::num_active_txns{0};
 std::atomic_flag mdb_txn_safe::creation_gate = ATOMIC_FLAG_INIT;
 
@@ -447,7 +476,11 @@ void BlockchainLMDB::do_resize(uint64_t increase_size)
 {
 	LOG_PRINT_L3("BlockchainLMDB::" << __func__);
 	CRITICAL_REGION_LOCAL(m_synchronization_lock);
-	const uint64_t add_size = 1LL << 30;
+
+	// If given, use increase_size instead of the growth estimate.
+	// This is currently used for increasing by an estimated size at start of new
+	// batch txn.
+	const uint64_t add_size = increase_size > 0 ? increase_size : get_growth_size();
 
 	// check disk capacity
 	try
@@ -474,15 +507,7 @@ void BlockchainLMDB::do_resize(uint64_t increase_size)
 
 	mdb_env_stat(m_env, &mst);
 
-	// add 1Gb per resize, instead of doing a percentage increase
-	uint64_t new_mapsize = (double)mei.me_mapsize + add_size;
-
-	// If given, use increase_size instead of above way of resizing.
-	// This is currently used for increasing by an estimated size at start of new
-	// batch txn.
-	if(increase_size > 0)
-		new_mapsize = mei.me_mapsize + increase_size;
-
+	uint64_t new_mapsize = mei.me_mapsize + add_size;
 	new_mapsize += (new_mapsize % mst.ms_psize);
 
 	mdb_txn_safe::prevent_new_txns();
@@ -507,7 +532,8 @@ void BlockchainLMDB::do_resize(uint64_t increase_size)
 
 	MGINFO("LMDB Mapsize increased."
 		   << "  Old: " << mei.me_mapsize / (1024 * 1024) << "MiB"
-		   << ", New: " << new_mapsize / (1024 * 1024) << "MiB");
+		   << ", New: " << new_mapsize / (1024 * 1024) << "MiB"
+		   << ", growth per block: " << m_bytes_per_block.load() << " bytes");
 
 	mdb_txn_safe::allow_new_txns();
 }
@@ -549,6 +575,18 @@ bool BlockchainLMDB::need_resize(uint64_t threshold_size) const
 			return false;
 	}
 
+	// with a growth estimate, resize when the space left runs low in blocks
+	const uint64_t bytes_per_block = m_bytes_per_block;
+	if(bytes_per_block > 0)
+	{
+		if(mei.me_mapsize - size_used < bytes_per_block * RESIZE_HEADROOM_BLOCKS)
+		{
+			LOG_PRINT_L1("Threshold met (growth-based)");
+			return true;
+		}
+		return false;
+	}
+
 	std::mt19937 engine(std::random_device{}());
 	std::uniform_real_distribution<double> fdis(0.6, 0.9);
 	double resize_percent = fdis(engine);
@@ -567,6 +605,7 @@ bool BlockchainLMDB::need_resize(uint64_t threshold_size) const
 void BlockchainLMDB::check_and_resize_for_batch(uint64_t batch_num_blocks, uint64_t batch_bytes)
 {
 	LOG_PRINT_L3("BlockchainLMDB::" << __func__);
+	update_growth_estimate(height());
 	LOG_PRINT_L1("[" << __func__ << "] "
 					 << "checking DB size");
 	const uint64_t min_increase_size = 512 * (1 << 20);
@@ -584,6 +623,7 @@ void BlockchainLMDB::check_and_resize_for_batch(uint64_t batch_num_blocks, uint6
 		// minimum size increase is used to avoid frequent resizes when the batch
 		// size is set to a very small numbers of blocks.
 		increase_size = (threshold_size > min_increase_size) ? threshold_size : min_increase_size;
+		increase_size = std::max(increase_size, get_growth_size());
 		MDEBUG("increase size: " << increase_size);
 	}
 
@@ -670,6 +710,81 @@ estim:
 	return threshold_size;
 }
 
+void BlockchainLMDB::update_growth_estimate(uint64_t height)
+{
+	// too few blocks since the last sample to average out page reuse
+	const uint64_t min_sample_blocks = 100;
+
+	MDB_envinfo mei;
+	MDB_stat mst;
+	mdb_env_info(m_env, &mei);
+	mdb_env_stat(m_env, &mst);
+	const uint64_t size_used = mst.ms_psize * mei.me_last_pgno;
+
+	if(height < m_growth_height || size_used < m_growth_used || m_growth_height == 0)
+	{
+		// first sample, or blocks were popped
+		m_growth_height = height;
+		m_growth_used = size_used;
+		return;
+	}
+	if(height - m_growth_height < min_sample_blocks)
+		return;
+
+	const uint64_t sample = (size_used - m_growth_used) / (height - m_growth_height);
+	const uint64_t estimate = m_bytes_per_block;
+	m_bytes_per_block = estimate ? (3 * estimate + sample) / 4 : sample;
+	m_growth_height = height;
+	m_growth_used = size_used;
+	MDEBUG("db growth: " << sample << " bytes per block recently, estimate " << m_bytes_per_block.load());
+}
+
+uint64_t BlockchainLMDB::get_growth_size() const
+{
+	return std::max(RESIZE_MIN_INCREASE, m_bytes_per_block * RESIZE_AHEAD_BLOCKS);
+}
+
+// Grow the map up front while no txns are active, so the resizes that stall
+// readers happen rarely once the daemon runs.
+void BlockchainLMDB::preallocate_map(uint64_t height)
+{
+	LOG_PRINT_L3("BlockchainLMDB::" << __func__);
+	MDB_envinfo mei;
+	MDB_stat mst;
+	mdb_env_info(m_env, &mei);
+	mdb_env_stat(m_env, &mst);
+	const uint64_t size_used = mst.ms_psize * mei.me_last_pgno;
+
+	// the chain average, refined by update_growth_estimate as blocks come in
+	if(height > 0)
+		m_bytes_per_block = size_used / height;
+	m_growth_height = height;
+	m_growth_used = size_used;
+
+	uint64_t new_mapsize = size_used + get_growth_size();
+	new_mapsize += mst.ms_psize - new_mapsize % mst.ms_psize;
+	if(new_mapsize <= mei.me_mapsize)
+		return;
+
+	try
+	{
+		boost::filesystem::space_info si = boost::filesystem::space(boost::filesystem::path(m_folder));
+		if(si.available < new_mapsize - mei.me_mapsize)
+		{
+			MWARNING("Not enough free disk space to preallocate the database map, it will be grown as needed");
+			return;
+		}
+	}
+	catch(...)
+	{
+		MWARNING("Unable to query free disk space.");
+	}
+
+	if(auto result = mdb_env_set_mapsize(m_env, new_mapsize))
+		throw0(DB_ERROR(lmdb_error("Failed to set max memory map size: ", result).c_str()));
+	MINFO("LMDB map preallocated to " << new_mapsize / (1024 * 1024) << "MiB, " << m_bytes_per_block.load() << " bytes per block");
+}
+
 void BlockchainLMDB::add_block(const block &blk, const size_t &block_size, const difficulty_type &cumulative_difficulty, const uint64_t &coins_generated,
 							   const crypto::hash &blk_hash)
 {
@@ -899,25 +1014,41 @@ uint64_t BlockchainLMDB::add_output(const crypto::hash &tx_hash,
 	outkey ok;
 	MDB_val data;
 	MDB_val_copy<uint64_t> val_amount(tx_output.amount);
-	result = mdb_cursor_get(m_cur_output_amounts, &val_amount, &data, MDB_SET);
-	if(!result)
+	std::unordered_map<uint64_t, uint64_t>::const_iterator bulk_count;
+	if(m_bulk_load && (bulk_count = m_bulk_load->amount_counts.find(tx_output.amount)) != m_bulk_load->amount_counts.end())
 	{
-		mdb_size_t num_elems = 0;
-		result = mdb_cursor_count(m_cur_output_amounts, &num_elems);
-		if(result)
-			throw0(DB_ERROR(std::string("Failed to get number of outputs for amount: ").append(mdb_strerror(result)).c_str()));
-		ok.amount_index = num_elems;
+		ok.amount_index = bulk_count->second;
 	}
-	else if(result != MDB_NOTFOUND)
-		throw0(DB_ERROR(lmdb_error("Failed to get output amount in db transaction: ", result).c_str()));
 	else
-		ok.amount_index = 0;
+	{
+		result = mdb_cursor_get(m_cur_output_amounts, &val_amount, &data, MDB_SET);
+		if(!result)
+		{
+			mdb_size_t num_elems = 0;
+			result = mdb_cursor_count(m_cur_output_amounts, &num_elems);
+			if(result)
+				throw0(DB_ERROR(std::string("Failed to get number of outputs for amount: ").append(mdb_strerror(result)).c_str()));
+			ok.amount_index = num_elems;
+		}
+		else if(result != MDB_NOTFOUND)
+			throw0(DB_ERROR(lmdb_error("Failed to get output amount in db transaction: ", result).c_str()));
+		else
+			ok.amount_index = 0;
+	}
 
 	ok.output_id = m_num_outputs;
 	ok.data.pubkey = boost::get<txout_to_key>(tx_output.target).key;
 	ok.data.unlock_time = unlock_time;
 	ok.data.height = m_height;
 	ok.data.commitment = *commitment;
+
+	if(m_bulk_load)
+	{
+		m_bulk_load->amount_counts[tx_output.amount] = ok.amount_index + 1;
+		m_bulk_load->output_amounts.emplace_back(tx_output.amount, ok);
+		return ok.amount_index;
+	}
+
 	data.mv_size = sizeof(ok);
 	data.mv_data = &ok;
 
@@ -1015,6 +1146,12 @@ void BlockchainLMDB::add_spent_key(const crypto::key_image &k_image)
 	check_open();
 	mdb_txn_cursors *m_cursors = &m_wcursors;
 
+	if(m_bulk_load)
+	{
+		m_bulk_load->spent_keys.push_back(k_image);
+		return;
+	}
+
 	CURSOR(spent_keys)
 
 	MDB_val k = {sizeof(k_image), (void *)&k_image};
@@ -1033,6 +1170,19 @@ void BlockchainLMDB::remove_spent_key(const crypto::key_image &k_image)
 	check_open();
 	mdb_txn_cursors *m_cursors = &m_wcursors;
 
+	if(m_bulk_load)
+	{
+		// only reached when backing out a tx that failed to be added, so the
+		// key image, if buffered, is near the end
+		auto &keys = m_bulk_load->spent_keys;
+		auto it = std::find(keys.rbegin(), keys.rend(), k_image);
+		if(it != keys.rend())
+		{
+			keys.erase(std::next(it).base());
+			return;
+		}
+	}
+
 	CURSOR(spent_keys)
 
 	MDB_val k = {sizeof(k_image), (void *)&k_image};
@@ -1101,6 +1251,9 @@ BlockchainLMDB::BlockchainLMDB(bool batch_transactions) : BlockchainDB()
 	m_batch_active = false;
 	m_cum_size = 0;
 	m_cum_count = 0;
+	m_growth_height = 0;
+	m_growth_used = 0;
+	m_bytes_per_block = 0;
 
 	m_hardfork = nullptr;
 }
@@ -1318,6 +1471,9 @@ void BlockchainLMDB::open(const std::string &filename, const int db_flags)
 	// commit the transaction
 	txn.commit();
 
+	if(!(mdb_flags & MDB_RDONLY))
+		preallocate_map(m_height);
+
 	m_open = true;
 	// from here, init should be finished
 }
@@ -1330,6 +1486,15 @@ void BlockchainLMDB::close()
 		LOG_PRINT_L3("close() first calling batch_abort() due to active batch transaction");
 		batch_abort();
 	}
+	m_bulk_load.reset();
+	try
+	{
+		set_write_behind(false);
+	}
+	catch(const std::exception &e)
+	{
+		MERROR("Background sync failed: " << e.what());
+	}
 	this->sync();
 	m_tinfo.reset();
 
@@ -1343,17 +1508,38 @@ void BlockchainLMDB::sync()
 	LOG_PRINT_L3("BlockchainLMDB::" << __func__);
 	check_open();
 
+	// With write-behind, sync here rather than waiting for the writer, which
+	// may be idle or in the middle of an older flush.
+	uint64_t committed = 0;
+	if(m_write_behind)
+	{
+		boost::unique_lock<boost::mutex> lock(m_write_behind->mutex);
+		committed = m_write_behind->committed;
+	}
+
 	// Does nothing unless LMDB environment was opened with MDB_NOSYNC or in part
 	// MDB_NOMETASYNC. Force flush to be synchronous.
 	if(auto result = mdb_env_sync(m_env, true))
 	{
 		throw0(DB_ERROR(lmdb_error("Failed to sync database: ", result).c_str()));
 	}
+
+	if(m_write_behind)
+	{
+		boost::unique_lock<boost::mutex> lock(m_write_behind->mutex);
+		if(committed > m_write_behind->durable)
+			m_write_behind->durable = committed;
+		m_write_behind->cond.notify_all();
+	}
 }
 
 void BlockchainLMDB::safesyncmode(const bool onoff)
 {
 	MINFO("switching safe mode " << (onoff ? "on" : "off"));
+	// the writer thread must not be syncing while the flags change, and safe
+	// mode syncs every commit itself
+	if(m_write_behind)
+		set_write_behind(false);
 	mdb_env_set_flags(m_env, MDB_NOSYNC | MDB_MAPASYNC, !onoff);
 }
 
@@ -1399,6 +1585,9 @@ void BlockchainLMDB::reset()
 	txn.commit();
 	m_cum_size = 0;
 	m_cum_count = 0;
+	m_growth_height = 0;
+	m_growth_used = 0;
+	m_bytes_per_block = 0;
 }
 
 std::vector<std::string> BlockchainLMDB::get_filenames() const
@@ -1496,6 +1685,76 @@ void BlockchainLMDB::unlock()
 			auto_txn.commit();              \
 	} while(0)
 
+// one line per reader slot from mdb_reader_list: "pid thread txnid", where
+// txnid is "-" for a slot with no snapshot
+static int add_reader_stats(const char *msg, void *ctx)
+{
+	std::istringstream line(msg);
+	db_reader_stats_t reader = {0, 0, 0, 0};
+	std::string txn_id;
+	if(line >> reader.pid >> std::hex >> reader.thread >> std::dec >> txn_id)
+	{
+		if(txn_id != "-")
+			reader.txn_id = std::stoull(txn_id);
+		static_cast<std::vector<db_reader_stats_t> *>(ctx)->push_back(reader);
+	}
+	return 0;
+}
+
+bool BlockchainLMDB::get_db_stats(db_stats_t &stats) const
+{
+	LOG_PRINT_L3("BlockchainLMDB::" << __func__);
+	check_open();
+
+	MDB_envinfo mei;
+	MDB_stat mst;
+	mdb_env_info(m_env, &mei);
+	mdb_env_stat(m_env, &mst);
+	stats.page_size = mst.ms_psize;
+	stats.map_size = mei.me_mapsize;
+	stats.used_size = mst.ms_psize * mei.me_last_pgno;
+	stats.last_txn_id = mei.me_last_txnid;
+	stats.bytes_per_block = m_bytes_per_block.load();
+	stats.max_readers = mei.me_maxreaders;
+
+	// dbi 0 is LMDB's free page list, pages waiting on old readers show there
+	const std::vector<std::pair<const char *, MDB_dbi>> tables = {
+		{"free_pages", 0},
+		{LMDB_BLOCKS, m_blocks},
+		{LMDB_BLOCK_HEIGHTS, m_block_heights},
+		{LMDB_BLOCK_INFO, m_block_info},
+		{LMDB_TXS, m_txs},
+		{LMDB_TX_INDICES, m_tx_indices},
+		{LMDB_TX_OUTPUTS, m_tx_outputs},
+		{LMDB_OUTPUT_TXS, m_output_txs},
+		{LMDB_OUTPUT_AMOUNTS, m_output_amounts},
+		{LMDB_SPENT_KEYS, m_spent_keys},
+		{LMDB_TXPOOL_META, m_txpool_meta},
+		{LMDB_TXPOOL_BLOB, m_txpool_blob},
+		{LMDB_HF_VERSIONS, m_hf_versions},
+		{LMDB_PROPERTIES, m_properties}};
+
+	stats.tables.clear();
+	{
+		TXN_PREFIX_RDONLY();
+		for(const auto &table : tables)
+		{
+			MDB_stat ts;
+			if(auto result = mdb_stat(m_txn, table.second, &ts))
+				throw0(DB_ERROR(lmdb_error(std::string("Failed to query ") + table.first + ": ", result).c_str()));
+			stats.tables.push_back({table.first, ts.ms_depth, ts.ms_branch_pages, ts.ms_leaf_pages, ts.ms_overflow_pages, ts.ms_entries});
+		}
+		TXN_POSTFIX_RDONLY();
+	}
+
+	stats.readers.clear();
+	if(auto result = mdb_reader_list(m_env, add_reader_stats, &stats.readers))
+		throw0(DB_ERROR(lmdb_error("Failed to list readers: ", result).c_str()));
+	for(auto &reader : stats.readers)
+		reader.txns_behind = reader.txn_id ? stats.last_txn_id - reader.txn_id : 0;
+	return true;
+}
+
 void BlockchainLMDB::add_txpool_tx(const transaction &tx, const txpool_tx_meta_t &meta)
 {
 	LOG_PRINT_L3("BlockchainLMDB::" << __func__);
@@ -2721,6 +2980,8 @@ void BlockchainLMDB::batch_commit()
 
 	check_open();
 
+	bulk_load_flush();
+
 	LOG_PRINT_L3("batch transaction: committing...");
 	TIME_MEASURE_START(time1);
 	m_write_txn->commit();
@@ -2732,6 +2993,7 @@ void BlockchainLMDB::batch_commit()
 	delete m_write_batch_txn;
 	m_write_batch_txn = nullptr;
 	memset(&m_wcursors, 0, sizeof(m_wcursors));
+	write_behind_committed();
 }
 
 void BlockchainLMDB::cleanup_batch()
@@ -2760,6 +3022,7 @@ void BlockchainLMDB::batch_stop()
 	TIME_MEASURE_START(time1);
 	try
 	{
+		bulk_load_flush();
 		m_write_txn->commit();
 		TIME_MEASURE_FINISH(time1);
 		time_commit1 += time1;
@@ -2768,8 +3031,14 @@ void BlockchainLMDB::batch_stop()
 	catch(const std::exception &e)
 	{
 		cleanup_batch();
+		if(m_bulk_load)
+		{
+			// buffered entries belong to the failed txn
+			m_bulk_load.reset(new mdb_bulk_load());
+		}
 		throw;
 	}
+	write_behind_committed();
 	LOG_PRINT_L3("batch transaction: end");
 }
 
@@ -2793,9 +3062,195 @@ void BlockchainLMDB::batch_abort()
 	m_write_batch_txn = nullptr;
 	m_batch_active = false;
 	memset(&m_wcursors, 0, sizeof(m_wcursors));
+	if(m_bulk_load)
+	{
+		// buffered entries belong to the aborted txn
+		m_bulk_load.reset(new mdb_bulk_load());
+	}
 	LOG_PRINT_L3("batch transaction: aborted");
 }
 
+bool BlockchainLMDB::set_bulk_load(bool enable)
+{
+	LOG_PRINT_L3("BlockchainLMDB::" << __func__);
+	check_open();
+	if(enable)
+	{
+		if(!m_bulk_load)
+			m_bulk_load.reset(new mdb_bulk_load());
+		return true;
+	}
+
+	if(m_bulk_load && m_batch_active)
+		bulk_load_flush();
+	else if(m_bulk_load && (!m_bulk_load->spent_keys.empty() || !m_bulk_load->output_amounts.empty()))
+		throw0(DB_ERROR("bulk load mode disabled with index entries pending outside of a batch transaction"));
+	m_bulk_load.reset();
+	return true;
+}
+
+bool BlockchainLMDB::set_write_behind(bool enable)
+{
+	LOG_PRINT_L3("BlockchainLMDB::" << __func__);
+	check_open();
+	unsigned int env_flags;
+	if(auto result = mdb_env_get_flags(m_env, &env_flags))
+		throw0(DB_ERROR(lmdb_error("Failed to get environment flags: ", result).c_str()));
+	if(env_flags & MDB_RDONLY)
+		return false;
+
+	if(enable)
+	{
+		if(m_write_behind)
+			return true;
+		// in safe mode every commit stays synchronous
+		if(!(env_flags & MDB_NOSYNC))
+			return false;
+		m_write_behind.reset(new mdb_write_behind());
+		m_write_behind->thread = boost::thread(&BlockchainLMDB::write_behind_run, this);
+		MINFO("LMDB write-behind enabled");
+		return true;
+	}
+
+	if(!m_write_behind)
+		return true;
+	{
+		boost::unique_lock<boost::mutex> lock(m_write_behind->mutex);
+		m_write_behind->stop = true;
+	}
+	m_write_behind->cond.notify_all();
+	m_write_behind->thread.join();
+	const std::string error = m_write_behind->error;
+	m_write_behind.reset();
+	MINFO("LMDB write-behind disabled");
+	if(!error.empty())
+		throw0(DB_ERROR(error.c_str()));
+	return true;
+}
+
+void BlockchainLMDB::write_behind_committed()
+{
+	if(!m_write_behind)
+		return;
+
+	boost::unique_lock<boost::mutex> lock(m_write_behind->mutex);
+	if(!m_write_behind->error.empty())
+		throw0(DB_ERROR(m_write_behind->error.c_str()));
+	++m_write_behind->committed;
+}
+
+void BlockchainLMDB::request_sync()
+{
+	LOG_PRINT_L3("BlockchainLMDB::" << __func__);
+	if(!m_write_behind)
+		return;
+
+	boost::unique_lock<boost::mutex> lock(m_write_behind->mutex);
+	// at most one requested flush is outstanding, so a crash loses no more
+	// than the commits since the previous request
+	while(m_write_behind->target > m_write_behind->durable && m_write_behind->error.empty())
+		m_write_behind->cond.wait(lock);
+	if(!m_write_behind->error.empty())
+		throw0(DB_ERROR(m_write_behind->error.c_str()));
+	m_write_behind->target = m_write_behind->committed;
+	m_write_behind->cond.notify_all();
+}
+
+void BlockchainLMDB::write_behind_run()
+{
+	mdb_write_behind &wb = *m_write_behind;
+	boost::unique_lock<boost::mutex> lock(wb.mutex);
+	while(true)
+	{
+		while(!wb.stop && wb.target <= wb.durable)
+			wb.cond.wait(lock);
+		// drain on stop, a failed sync is reported to the owner instead
+		if(wb.stop)
+			wb.target = wb.committed;
+		if(wb.target <= wb.durable || !wb.error.empty())
+			break;
+
+		const uint64_t target = wb.committed;
+		lock.unlock();
+		int result;
+		TIME_MEASURE_START(time1);
+		{
+			// resizing remaps the environment and waits for active txns, so
+			// count as one rather than holding m_synchronization_lock
+			mdb_txn_safe resize_guard;
+			result = mdb_env_sync(m_env, true);
+		}
+		TIME_MEASURE_FINISH(time1);
+		lock.lock();
+
+		if(result)
+			wb.error = lmdb_error("Failed to sync database in the background: ", result);
+		else if(target > wb.durable)
+			wb.durable = target;
+		MDEBUG("write-behind sync of " << target << " commits took " << time1 << " ms");
+		wb.cond.notify_all();
+	}
+}
+
+void BlockchainLMDB::bulk_load_flush()
+{
+	LOG_PRINT_L3("BlockchainLMDB::" << __func__);
+	if(!m_bulk_load)
+		return;
+
+	mdb_txn_cursors *m_cursors = &m_wcursors;
+	int result;
+
+	TIME_MEASURE_START(time1);
+
+	// Entries of each amount were buffered in amount index order, so a stable
+	// sort on the amount lets every one of them be appended.
+	auto &outs = m_bulk_load->output_amounts;
+	if(!outs.empty())
+	{
+		CURSOR(output_amounts)
+		std::stable_sort(outs.begin(), outs.end(), [](const std::pair<uint64_t, outkey> &a, const std::pair<uint64_t, outkey> &b) { return a.first < b.first; });
+		for(auto &o : outs)
+		{
+			MDB_val_set(k, o.first);
+			MDB_val_set(v, o.second);
+			if((result = mdb_cursor_put(m_cur_output_amounts, &k, &v, MDB_APPENDDUP)))
+				throw0(DB_ERROR(lmdb_error("Failed to add output pubkey to db transaction: ", result).c_str()));
+		}
+	}
+
+	// Key images are random, sorting them in table order at least keeps the
+	// inserts moving forward through the same pages.
+	auto &keys = m_bulk_load->spent_keys;
+	if(!keys.empty())
+	{
+		CURSOR(spent_keys)
+		std::sort(keys.begin(), keys.end(), [](const crypto::key_image &a, const crypto::key_image &b) {
+			MDB_val va = {sizeof(a), (void *)&a};
+			MDB_val vb = {sizeof(b), (void *)&b};
+			return compare_hash32(&va, &vb) < 0;
+		});
+		for(const auto &k_image : keys)
+		{
+			MDB_val k = {sizeof(k_image), (void *)&k_image};
+			if((result = mdb_cursor_put(m_cur_spent_keys, (MDB_val *)&zerokval, &k, MDB_NODUPDATA)))
+			{
+				if(result == MDB_KEYEXIST)
+					throw1(KEY_IMAGE_EXISTS("Attempting to add spent key image that's already in the db"));
+				else
+					throw1(DB_ERROR(lmdb_error("Error adding spent key image to db transaction: ", result).c_str()));
+			}
+		}
+	}
+
+	TIME_MEASURE_FINISH(time1);
+	LOG_PRINT_L1("bulk load: wrote " << outs.size() << " output indices and " << keys.size() << " key images in " << time1 << " ms");
+
+	outs.clear();
+	keys.clear();
+	m_bulk_load->amount_counts.clear();
+}
+
 void BlockchainLMDB::set_batch_transactions(bool batch_transactions)
 {
 	LOG_PRINT_L3("BlockchainLMDB::" << __func__);
@@ -2911,6 +3366,7 @@ void BlockchainLMDB::block_txn_stop()
 			delete m_write_txn;
 			m_write_txn = nullptr;
 			memset(&m_wcursors, 0, sizeof(m_wcursors));
+			write_behind_committed();
 		}
 	}
 	else if(m_tinfo->m_ti_rtxn)
@@ -2956,6 +3412,7 @@ uint64_t BlockchainLMDB::add_block(const block &blk, const size_t &block_size, c
 
 	if(m_height % 1000 == 0)
 	{
+		update_growth_estimate(m_height);
 		// for batch mode, DB resize check is done at start of batch transaction
 		if(!m_batch_active && need_resize())
 		{
@@ -2985,6 +3442,8 @@ void BlockchainLMDB::pop_block(block &blk, std::vector<transaction> &txs)
 {
 	LOG_PRINT_L3("BlockchainLMDB::" << __func__);
 	check_open();
+	if(m_bulk_load)
+		throw0(DB_ERROR("Attempting to pop a block while bulk load mode is enabled"));
 
 	block_txn_start(false);
 
@@ -3040,11 +3499,29 @@ void BlockchainLMDB::get_output_key(const uint64_t &amount, const std::vector<ui
 	RCURSOR(output_amounts);
 
 	MDB_val_set(k, amount);
+	uint64_t prev_index = 0;
+	bool have_prev = false;
 	for(const uint64_t &index : offsets)
 	{
 		MDB_val_set(v, index);
 
-		auto get_result = mdb_cursor_get(m_cur_output_amounts, &k, &v, MDB_GET_BOTH);
+		// offsets are often sorted with runs of consecutive indices, step to
+		// the next dup then instead of searching the tree again
+		int get_result = MDB_NOTFOUND;
+		bool stepped = false;
+		if(have_prev && index == prev_index + 1)
+		{
+			MDB_val nv;
+			get_result = mdb_cursor_get(m_cur_output_amounts, &k, &nv, MDB_NEXT_DUP);
+			stepped = get_result == 0 && *(const uint64_t *)nv.mv_data == index;
+			if(stepped)
+				v = nv;
+		}
+		if(!stepped)
+			get_result = mdb_cursor_get(m_cur_output_amounts, &k, &v, MDB_GET_BOTH);
+		have_prev = get_result == 0;
+		prev_index = index;
+
 		if(get_result == MDB_NOTFOUND)
 		{
 			if(allow_partial)
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <atomic>
+#include <memory>
 
 #include "blockchain_db/blockchain_db.h"
 #include "cryptonote_basic/blobdatatype.h" // for type blobdata
@@ -30,6 +31,9 @@
 namespace cryptonote
 {
 
+struct mdb_bulk_load;
+struct mdb_write_behind;
+
 typedef struct mdb_txn_cursors
 {
 	MDB_cursor *m_txc_blocks;
@@ -163,6 +167,8 @@ class BlockchainLMDB : public BlockchainDB
 
 	virtual std::string get_db_name() const;
 
+	virtual bool get_db_stats(db_stats_t &stats) const;
+
 	virtual bool lock();
 
 	virtual void unlock();
@@ -255,6 +261,12 @@ class BlockchainLMDB : public BlockchainDB
 	virtual void batch_stop();
 	virtual void batch_abort();
 
+	virtual bool set_bulk_load(bool enable);
+
+	virtual bool set_write_behind(bool enable);
+
+	virtual void request_sync();
+
 	virtual void block_txn_start(bool readonly);
 	virtual void block_txn_stop();
 	virtual void block_txn_abort();
@@ -286,6 +298,11 @@ class BlockchainLMDB : public BlockchainDB
 	void check_and_resize_for_batch(uint64_t batch_num_blocks, uint64_t batch_bytes);
 	uint64_t get_estimated_batch_size(uint64_t batch_num_blocks, uint64_t batch_bytes) const;
 
+	// track the bytes written per block, and the map growth derived from it
+	void update_growth_estimate(uint64_t height);
+	uint64_t get_growth_size() const;
+	void preallocate_map(uint64_t height);
+
 	virtual void add_block(const block &blk, const size_t &block_size, const difficulty_type &cumulative_difficulty, const uint64_t &coins_generated, const crypto::hash &block_hash);
 
 	virtual void remove_block();
@@ -352,6 +369,13 @@ class BlockchainLMDB : public BlockchainDB
 
 	void cleanup_batch();
 
+	// write out the index entries deferred by bulk load mode
+	void bulk_load_flush();
+
+	// hand a commit to the write-behind thread, if enabled
+	void write_behind_committed();
+	void write_behind_run();
+
   private:
 	MDB_env *m_env;
 
@@ -378,6 +402,11 @@ class BlockchainLMDB : public BlockchainDB
 
 	mutable uint64_t m_cum_size; // used in batch size estimation
 	mutable unsigned int m_cum_count;
+
+	// db growth, sampled from the used size as blocks are added
+	uint64_t m_growth_height;
+	uint64_t m_growth_used;
+	std::atomic<uint64_t> m_bytes_per_block; // 0 until there is a sample, also read by get_db_stats
 	std::string m_folder;
 	mdb_txn_safe *m_write_txn;		 // may point to either a short-lived txn or a batch txn
 	mdb_txn_safe *m_write_batch_txn; // persist batch txn outside of BlockchainLMDB
@@ -389,6 +418,9 @@ class BlockchainLMDB : public BlockchainDB
 	mdb_txn_cursors m_wcursors;
 	mutable boost::thread_specific_ptr<mdb_threadinfo> m_tinfo;
 
+	std::unique_ptr<mdb_bulk_load> m_bulk_load; // non-null while bulk load mode is enabled
+	std::unique_ptr<mdb_write_behind> m_write_behind; // non-null while write-behind is enabled
+
 #if defined(__arm__)
 	// force a value so it can compile with 32-bit ARM
 	constexpr static uint64_t DEFAULT_MAPSIZE = 1LL << 31;
@@ -401,6 +433,12 @@ class BlockchainLMDB : public BlockchainDB
 #endif
 
 	constexpr static float RESIZE_PERCENT = 0.8f;
+
+	// once the growth per block is known, resize when fewer than
+	// RESIZE_HEADROOM_BLOCKS blocks fit, by enough for RESIZE_AHEAD_BLOCKS
+	constexpr static uint64_t RESIZE_HEADROOM_BLOCKS = 10000;
+	constexpr static uint64_t RESIZE_AHEAD_BLOCKS = 100000;
+	constexpr static uint64_t RESIZE_MIN_INCREASE = 1LL << 30;
 };
 
 } // namespace cryptonote
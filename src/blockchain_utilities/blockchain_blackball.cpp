@@ -19,14 +19,22 @@
 #include "cryptonote_core/blockchain.h"
 #include "blockchain_db/blockchain_db.h"
 #include "blockchain_db/db_types.h"
+#include "common/boost_serialization_helper.h"
 #include "common/command_line.h"
+#include "common/threadpool.h"
+#include "common/unordered_containers_boost_serialization.h"
+#include "common/util.h"
 #include "common/varint.h"
+#include "cryptonote_basic/cryptonote_boost_serialization.h"
 #include "cryptonote_core/cryptonote_core.h"
 #include "cryptonote_core/tx_pool.h"
 #include "version.h"
 #include "wallet/ringdb.h"
 #include <boost/algorithm/string.hpp>
 #include <boost/range/adaptor/transformed.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/utility.hpp>
+#include <boost/serialization/vector.hpp>
 
 //#undef RYO_DEFAULT_LOG_CATEGORY
 //#define RYO_DEFAULT_LOG_CATEGORY "bcutil"
@@ -35,12 +43,22 @@ namespace po = boost::program_options;
 using namespace epee;
 using namespace cryptonote;
 
+static const size_t BLACKBALL_BATCH_SIZE = 4096;
+
 struct output_data
 {
 	uint64_t amount;
 	uint64_t index;
+	output_data() : amount(0), index(0) {}
 	output_data(uint64_t a, uint64_t i) : amount(a), index(i) {}
 	bool operator==(const output_data &other) const { return other.amount == amount && other.index == index; }
+
+	template <class Archive>
+	void serialize(Archive &a, const unsigned int ver)
+	{
+		a &amount;
+		a &index;
+	}
 };
 namespace std
 {
@@ -57,6 +75,47 @@ struct hash<output_data>
 };
 }
 
+// how far an input database was read
+struct input_state
+{
+	// the index of the next transaction to read
+	uint64_t next_tx = 0;
+	// hashes of the blocks read up to, highest first, as a short chain history
+	std::vector<std::pair<uint64_t, crypto::hash>> blocks;
+
+	template <class Archive>
+	void serialize(Archive &a, const unsigned int ver)
+	{
+		a &next_tx;
+		a &blocks;
+	}
+};
+
+// analysis state kept between --incremental runs
+struct blackball_state
+{
+	bool rct_only = false;
+	// per input database
+	std::unordered_map<std::string, input_state> inputs;
+	std::unordered_map<crypto::key_image, std::vector<uint64_t>> relative_rings;
+	std::unordered_map<output_data, std::unordered_set<crypto::key_image>> outputs;
+	std::unordered_set<output_data> spent;
+	// rings not yet checked against the spent set, with their amount
+	std::unordered_map<crypto::key_image, uint64_t> pending;
+
+	template <class Archive>
+	void serialize(Archive &a, const unsigned int ver)
+	{
+		a &rct_only;
+		a &inputs;
+		a &relative_rings;
+		a &outputs;
+		a &spent;
+		a &pending;
+	}
+};
+BOOST_CLASS_VERSION(blackball_state, 0)
+
 static std::string get_default_db_path()
 {
 	boost::filesystem::path dir = tools::get_default_data_dir();
@@ -66,7 +125,43 @@ static std::string get_default_db_path()
 	return dir.string();
 }
 
-static bool for_all_transactions(const std::string &filename, const std::function<bool(const cryptonote::transaction_prefix &)> &f)
+// the index of the first transaction after those of the block at height
+static uint64_t get_tx_index_after_block(const BlockchainDB &db, uint64_t height)
+{
+	const cryptonote::block b = db.get_block_from_height(height);
+	uint64_t tx_id;
+	if(!db.tx_exists(cryptonote::get_transaction_hash(b.miner_tx), tx_id))
+		throw std::runtime_error("Miner transaction of block " + std::to_string(height) + " not found");
+	return tx_id + 1 + b.tx_hashes.size();
+}
+
+// the top ten blocks, then blocks at doubling distances down to the genesis block
+static std::vector<std::pair<uint64_t, crypto::hash>> get_block_history(const BlockchainDB &db, uint64_t height)
+{
+	std::vector<std::pair<uint64_t, crypto::hash>> blocks;
+	uint64_t step = 1;
+	for(uint64_t h = height; h > 0;)
+	{
+		h = h > step ? h - step : 0;
+		blocks.push_back(std::make_pair(h, db.get_block_hash_from_height(h)));
+		if(blocks.size() >= 10)
+			step *= 2;
+	}
+	return blocks;
+}
+
+// the number of blocks at the bottom of the history that db still has
+static uint64_t get_common_height(const BlockchainDB &db, const std::vector<std::pair<uint64_t, crypto::hash>> &blocks)
+{
+	const uint64_t db_height = db.height();
+	for(const auto &b : blocks)
+		if(b.first < db_height && db.get_block_hash_from_height(b.first) == b.second)
+			return b.first + 1;
+	return 0;
+}
+
+// calls f for each transaction from index start_idx up to end_idx, and leaves start_idx past the last one read
+static bool for_all_transactions(const std::string &filename, uint64_t &start_idx, uint64_t end_idx, const std::function<bool(const cryptonote::transaction_prefix &)> &f)
 {
 	MDB_env *env;
 	MDB_dbi dbi;
@@ -105,7 +200,10 @@ static bool for_all_transactions(const std::string &filename, const std::functio
 	MDB_val v;
 	bool fret = true;
 
-	MDB_cursor_op op = MDB_FIRST;
+	uint64_t start_key = start_idx;
+	k.mv_size = sizeof(start_key);
+	k.mv_data = &start_key;
+	MDB_cursor_op op = MDB_SET_RANGE;
 	while(1)
 	{
 		int ret = mdb_cursor_get(cur, &k, &v, op);
@@ -114,6 +212,8 @@ static bool for_all_transactions(const std::string &filename, const std::functio
 			break;
 		if(ret)
 			throw std::runtime_error("Failed to enumerate transactions: " + std::string(mdb_strerror(ret)));
+		if(*(const uint64_t *)k.mv_data >= end_idx)
+			break;
 
 		cryptonote::transaction_prefix tx;
 		blobdata bd;
@@ -129,6 +229,7 @@ static bool for_all_transactions(const std::string &filename, const std::functio
 			fret = false;
 			break;
 		}
+		start_idx = *(const uint64_t *)k.mv_data + 1;
 	}
 
 	mdb_cursor_close(cur);
@@ -179,6 +280,7 @@ int main(int argc, char *argv[])
 	const command_line::arg_descriptor<std::string> arg_database = {
 		"database", available_dbs.c_str(), default_db_type};
 	const command_line::arg_descriptor<bool> arg_rct_only = {"rct-only", "Only work on ringCT outputs", false};
+	const command_line::arg_descriptor<bool> arg_incremental = {"incremental", "Keep the analysis state in the blackball db dir, and carry on from the previous run", false};
 	const command_line::arg_descriptor<std::vector<std::string>> arg_inputs = {"inputs", "Path to ombre DB, and path to any fork DBs"};
 
 	command_line::add_arg(desc_cmd_sett, arg_blackball_db_dir);
@@ -187,6 +289,7 @@ int main(int argc, char *argv[])
 	command_line::add_arg(desc_cmd_sett, arg_log_level);
 	command_line::add_arg(desc_cmd_sett, arg_database);
 	command_line::add_arg(desc_cmd_sett, arg_rct_only);
+	command_line::add_arg(desc_cmd_sett, arg_incremental);
 	command_line::add_arg(desc_cmd_sett, arg_inputs);
 	command_line::add_arg(desc_cmd_only, command_line::arg_help);
 
@@ -226,6 +329,7 @@ int main(int argc, char *argv[])
 	network_type net_type = opt_testnet ? TESTNET : opt_stagenet ? STAGENET : MAINNET;
 	output_file_path = command_line::get_arg(vm, arg_blackball_db_dir);
 	bool opt_rct_only = command_line::get_arg(vm, arg_rct_only);
+	bool opt_incremental = command_line::get_arg(vm, arg_incremental);
 
 	std::string db_type = command_line::get_arg(vm, arg_database);
 	if(!cryptonote::blockchain_valid_db_type(db_type))
@@ -307,18 +411,92 @@ int main(int argc, char *argv[])
 
 	LOG_PRINT_L0("Scanning for blackballable outputs...");
 
-	size_t done = 0;
-	std::unordered_map<crypto::key_image, std::vector<uint64_t>> relative_rings;
-	std::unordered_map<output_data, std::unordered_set<crypto::key_image>> outputs;
-	std::unordered_set<output_data> spent, newly_spent;
-
 	cryptonote::block b = core_storage[0]->get_db().get_block_from_height(0);
-	tools::ringdb ringdb(output_file_path.string(), epee::string_tools::pod_to_hex(get_block_hash(b)));
+	const std::string genesis = epee::string_tools::pod_to_hex(get_block_hash(b));
+	tools::ringdb ringdb(output_file_path.string(), genesis, true);
+
+	blackball_state state;
+	const std::string state_file_path = (output_file_path / ("blackball-state-" + genesis)).string();
+	if(opt_incremental && boost::filesystem::exists(state_file_path))
+	{
+		if(!tools::unserialize_obj_from_file(state, state_file_path))
+		{
+			MERROR("Failed to load state from " << state_file_path << ", remove it to start over");
+			return 1;
+		}
+		if(state.rct_only != opt_rct_only)
+		{
+			MERROR("State in " << state_file_path << " was made with" << (state.rct_only ? "" : "out") << " --rct-only, remove it to start over");
+			return 1;
+		}
+		LOG_PRINT_L0("Resuming from " << state_file_path << ", " << state.spent.size() << " spent outputs known");
+	}
+	state.rct_only = opt_rct_only;
+
+	// blackballs are written in batches, one ringdb transaction each
+	std::vector<crypto::public_key> blackballs;
+	auto flush_blackballs = [&]() {
+		if(blackballs.empty())
+			return;
+		ringdb.blackball(blackballs);
+		blackballs.clear();
+	};
+	auto add_blackball = [&](const crypto::public_key &pkey) {
+		blackballs.push_back(pkey);
+		if(blackballs.size() >= BLACKBALL_BATCH_SIZE)
+			flush_blackballs();
+	};
+	// the state on disk must never be ahead of the ringdb
+	auto save_state = [&]() {
+		if(!opt_incremental)
+			return true;
+		flush_blackballs();
+		ringdb.sync();
+		const std::string tmp_file_path = state_file_path + ".tmp";
+		if(!tools::serialize_obj_to_file(state, tmp_file_path))
+		{
+			MERROR("Failed to save state to " << tmp_file_path);
+			return false;
+		}
+		std::error_code e = tools::replace_file(tmp_file_path, state_file_path);
+		if(e)
+		{
+			MERROR("Failed to rename " << tmp_file_path << " to " << state_file_path << ": " << e.message());
+			return false;
+		}
+		return true;
+	};
+	// marks an output spent, and queues the other rings it is in for checking
+	auto mark_spent = [&](const output_data &od, const crypto::public_key &pkey) {
+		add_blackball(pkey);
+		if(!state.spent.insert(od).second)
+			return;
+		const auto it = state.outputs.find(od);
+		if(it != state.outputs.end())
+			for(const crypto::key_image &ki : it->second)
+				state.pending[ki] = od.amount;
+	};
 
 	for(size_t n = 0; n < inputs.size(); ++n)
 	{
-		LOG_PRINT_L0("Reading blockchain from " << inputs[n]);
-		for_all_transactions(inputs[n], [&](const cryptonote::transaction_prefix &tx) -> bool {
+		// read up to the top block as it is now, the daemon may be adding more
+		const BlockchainDB &db = core_storage[n]->get_db();
+		const uint64_t db_height = db.height();
+		input_state &input = state.inputs[inputs[n]];
+		if(!input.blocks.empty())
+		{
+			// LMDB reuses the indices of popped transactions for the ones replacing
+			// them, go back to the last block this chain still shares with the read one
+			const uint64_t common_height = get_common_height(db, input.blocks);
+			if(common_height < input.blocks.front().first + 1)
+			{
+				MWARNING(inputs[n] << " was reorganized since the last run, going back to block " << common_height);
+				input.next_tx = common_height ? get_tx_index_after_block(db, common_height - 1) : 0;
+			}
+		}
+		uint64_t &start_idx = input.next_tx;
+		LOG_PRINT_L0("Reading blockchain from " << inputs[n] << ", starting at transaction " << start_idx);
+		for_all_transactions(inputs[n], start_idx, get_tx_index_after_block(db, db_height - 1), [&](const cryptonote::transaction_prefix &tx) -> bool {
 			for(const auto &in : tx.vin)
 			{
 				if(in.type() != typeid(txin_to_key))
@@ -329,26 +507,28 @@ int main(int argc, char *argv[])
 
 				const std::vector<uint64_t> absolute = cryptonote::relative_output_offsets_to_absolute(txin.key_offsets);
 				if(n == 0)
+				{
 					for(uint64_t out : absolute)
-						outputs[output_data(txin.amount, out)].insert(txin.k_image);
+						state.outputs[output_data(txin.amount, out)].insert(txin.k_image);
+					state.pending[txin.k_image] = txin.amount;
+				}
 
 				std::vector<uint64_t> new_ring = txin.key_offsets;
 				const uint32_t ring_size = txin.key_offsets.size();
+				auto &relative_ring = state.relative_rings[txin.k_image];
 				if(ring_size == 1)
 				{
 					const crypto::public_key pkey = core_storage[n]->get_output_key(txin.amount, txin.key_offsets[0]);
 					MINFO("Blackballing output " << pkey << ", due to being used in a 1-ring");
-					ringdb.blackball(pkey);
-					newly_spent.insert(output_data(txin.amount, txin.key_offsets[0]));
-					spent.insert(output_data(txin.amount, txin.key_offsets[0]));
+					mark_spent(output_data(txin.amount, txin.key_offsets[0]), pkey);
 				}
-				else if(relative_rings.find(txin.k_image) != relative_rings.end())
+				else if(!relative_ring.empty())
 				{
-					MINFO("Key image " << txin.k_image << " already seen: rings " << boost::join(relative_rings[txin.k_image] | boost::adaptors::transformed([](uint64_t out) { return std::to_string(out); }), " ") << ", " << boost::join(txin.key_offsets | boost::adaptors::transformed([](uint64_t out) { return std::to_string(out); }), " "));
-					if(relative_rings[txin.k_image] != txin.key_offsets)
+					MINFO("Key image " << txin.k_image << " already seen: rings " << boost::join(relative_ring | boost::adaptors::transformed([](uint64_t out) { return std::to_string(out); }), " ") << ", " << boost::join(txin.key_offsets | boost::adaptors::transformed([](uint64_t out) { return std::to_string(out); }), " "));
+					if(relative_ring != txin.key_offsets)
 					{
 						MINFO("Rings are different");
-						const std::vector<uint64_t> r0 = cryptonote::relative_output_offsets_to_absolute(relative_rings[txin.k_image]);
+						const std::vector<uint64_t> r0 = cryptonote::relative_output_offsets_to_absolute(relative_ring);
 						const std::vector<uint64_t> r1 = cryptonote::relative_output_offsets_to_absolute(txin.key_offsets);
 						std::vector<uint64_t> common;
 						for(uint64_t out : r0)
@@ -364,9 +544,7 @@ int main(int argc, char *argv[])
 						{
 							const crypto::public_key pkey = core_storage[n]->get_output_key(txin.amount, common[0]);
 							MINFO("Blackballing output " << pkey << ", due to being used in rings with a single common element");
-							ringdb.blackball(pkey);
-							newly_spent.insert(output_data(txin.amount, common[0]));
-							spent.insert(output_data(txin.amount, common[0]));
+							mark_spent(output_data(txin.amount, common[0]), pkey);
 						}
 						else
 						{
@@ -378,45 +556,73 @@ int main(int argc, char *argv[])
 						}
 					}
 				}
-				relative_rings[txin.k_image] = new_ring;
+				relative_ring = new_ring;
 			}
 			return true;
 		});
+		input.blocks = get_block_history(db, db_height);
+		if(!save_state())
+			return 1;
 	}
 
-	while(!newly_spent.empty())
+	// A ring where all but one output are known spent gives away the last one,
+	// which may in turn settle other rings it is in. Each pass checks the queued
+	// rings against the spent set in parallel, then applies what it found.
+	tools::threadpool &tpool = tools::threadpool::getInstance();
+	const size_t n_threads = std::max(1, tpool.get_max_concurrency());
+	while(!state.pending.empty())
 	{
-		LOG_PRINT_L0("Secondary pass due to " << newly_spent.size() << " newly found spent outputs");
-		std::unordered_set<output_data> work_spent = std::move(newly_spent);
-		newly_spent.clear();
-
-		for(const output_data &od : work_spent)
+		LOG_PRINT_L0("Checking " << state.pending.size() << " rings against " << state.spent.size() << " known spent outputs");
+		const std::vector<std::pair<crypto::key_image, uint64_t>> work(state.pending.begin(), state.pending.end());
+		state.pending.clear();
+
+		std::vector<std::vector<std::pair<output_data, size_t>>> found(n_threads);
+		const size_t chunk_size = (work.size() + n_threads - 1) / n_threads;
+		tools::threadpool::waiter waiter;
+		for(size_t t = 0; t < n_threads && t * chunk_size < work.size(); ++t)
 		{
-			for(const crypto::key_image &ki : outputs[od])
-			{
-				std::vector<uint64_t> absolute = cryptonote::relative_output_offsets_to_absolute(relative_rings[ki]);
-				size_t known = 0;
-				uint64_t last_unknown = 0;
-				for(uint64_t out : absolute)
+			tpool.submit(&waiter, [&, t]() {
+				const size_t end = std::min(work.size(), (t + 1) * chunk_size);
+				for(size_t i = t * chunk_size; i < end; ++i)
 				{
-					output_data new_od(od.amount, out);
-					if(spent.find(new_od) != spent.end())
-						++known;
-					else
-						last_unknown = out;
-				}
-				if(known == absolute.size() - 1)
-				{
-					const crypto::public_key pkey = core_storage[0]->get_output_key(od.amount, last_unknown);
-					MINFO("Blackballing output " << pkey << ", due to being used in a " << absolute.size() << "-ring where all other outputs are known to be spent");
-					ringdb.blackball(pkey);
-					newly_spent.insert(output_data(od.amount, last_unknown));
-					spent.insert(output_data(od.amount, last_unknown));
+					const uint64_t amount = work[i].second;
+					const auto it = state.relative_rings.find(work[i].first);
+					if(it == state.relative_rings.end())
+						continue;
+					const std::vector<uint64_t> absolute = cryptonote::relative_output_offsets_to_absolute(it->second);
+					size_t known = 0;
+					uint64_t last_unknown = 0;
+					for(uint64_t out : absolute)
+					{
+						if(state.spent.find(output_data(amount, out)) != state.spent.end())
+							++known;
+						else
+							last_unknown = out;
+					}
+					if(known + 1 == absolute.size())
+						found[t].push_back(std::make_pair(output_data(amount, last_unknown), absolute.size()));
 				}
+			});
+		}
+		waiter.wait();
+
+		for(const auto &f : found)
+		{
+			for(const auto &e : f)
+			{
+				if(state.spent.find(e.first) != state.spent.end())
+					continue;
+				const crypto::public_key pkey = core_storage[0]->get_output_key(e.first.amount, e.first.index);
+				MINFO("Blackballing output " << pkey << ", due to being used in a " << e.second << "-ring where all other outputs are known to be spent");
+				mark_spent(e.first, pkey);
 			}
 		}
 	}
 
+	flush_blackballs();
+	ringdb.sync();
+	if(!save_state())
+		return 1;
 	LOG_PRINT_L0("Blockchain blackball data exported OK");
 	return 0;
 
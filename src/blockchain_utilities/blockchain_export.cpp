@@ -20,6 +20,7 @@
 #include "blockchain_db/db_types.h"
 #include "blocksdat_file.h"
 #include "bootstrap_file.h"
+#include "bootstrap_indexed_file.h"
 #include "common/command_line.h"
 #include "cryptonote_core/cryptonote_core.h"
 #include "cryptonote_core/tx_pool.h"
@@ -53,8 +54,15 @@ int main(int argc, char *argv[])
 	available_dbs = "available: " + available_dbs;
 
 	uint32_t log_level = 0;
+	uint64_t block_start = 0;
 	uint64_t block_stop = 0;
 	bool blocks_dat = false;
+	uint32_t blocks_per_chunk = 100;
+#ifdef HAVE_ZSTD
+	std::string default_compression = "zstd";
+#else
+	std::string default_compression = "none";
+#endif
 
 	tools::on_startup();
 
@@ -68,6 +76,10 @@ int main(int argc, char *argv[])
 	const command_line::arg_descriptor<std::string> arg_database = {
 		"database", available_dbs.c_str(), default_db_type};
 	const command_line::arg_descriptor<bool> arg_blocks_dat = {"blocksdat", "Output in blocks.dat format", blocks_dat};
+	const command_line::arg_descriptor<bool> arg_indexed = {"indexed", "Output in the chunked, indexed bootstrap format", false};
+	const command_line::arg_descriptor<std::string> arg_compression = {"compression", "Chunk compression for --indexed: none, zstd or lz4", default_compression};
+	const command_line::arg_descriptor<uint32_t> arg_blocks_per_chunk = {"blocks-per-chunk", "Blocks per chunk for --indexed", blocks_per_chunk};
+	const command_line::arg_descriptor<uint64_t> arg_block_start = {"block-start", "Start at block number, for --indexed", block_start};
 
 	command_line::add_arg(desc_cmd_sett, cryptonote::arg_data_dir);
 	command_line::add_arg(desc_cmd_sett, arg_output_file);
@@ -77,6 +89,10 @@ int main(int argc, char *argv[])
 	command_line::add_arg(desc_cmd_sett, arg_database);
 	command_line::add_arg(desc_cmd_sett, arg_block_stop);
 	command_line::add_arg(desc_cmd_sett, arg_blocks_dat);
+	command_line::add_arg(desc_cmd_sett, arg_indexed);
+	command_line::add_arg(desc_cmd_sett, arg_compression);
+	command_line::add_arg(desc_cmd_sett, arg_blocks_per_chunk);
+	command_line::add_arg(desc_cmd_sett, arg_block_start);
 
 	command_line::add_arg(desc_cmd_only, command_line::arg_help);
 
@@ -116,6 +132,35 @@ int main(int argc, char *argv[])
 		return 1;
 	}
 	bool opt_blocks_dat = command_line::get_arg(vm, arg_blocks_dat);
+	bool opt_indexed = command_line::get_arg(vm, arg_indexed);
+	if(opt_blocks_dat && opt_indexed)
+	{
+		std::cerr << "Can't specify more than one of --blocksdat and --indexed" << std::endl;
+		return 1;
+	}
+	uint8_t compression;
+	if(!BootstrapIndexedFile::compression_from_string(command_line::get_arg(vm, arg_compression), compression))
+	{
+		std::cerr << "Invalid compression type: " << command_line::get_arg(vm, arg_compression) << std::endl;
+		return 1;
+	}
+	if(opt_indexed && !BootstrapIndexedFile::compression_supported(compression))
+	{
+		std::cerr << "Compression type " << command_line::get_arg(vm, arg_compression) << " is not supported by this build" << std::endl;
+		return 1;
+	}
+	blocks_per_chunk = command_line::get_arg(vm, arg_blocks_per_chunk);
+	if(blocks_per_chunk == 0)
+	{
+		std::cerr << "--blocks-per-chunk must be at least 1" << std::endl;
+		return 1;
+	}
+	block_start = command_line::get_arg(vm, arg_block_start);
+	if(block_start != 0 && !opt_indexed)
+	{
+		std::cerr << "--block-start requires --indexed" << std::endl;
+		return 1;
+	}
 
 	std::string m_config_folder;
 
@@ -183,6 +228,11 @@ int main(int argc, char *argv[])
 		BlocksdatFile blocksdat;
 		r = blocksdat.store_blockchain_raw(core_storage, NULL, output_file_path, block_stop);
 	}
+	else if(opt_indexed)
+	{
+		BootstrapIndexedFile bootstrap;
+		r = bootstrap.store_blockchain_raw(core_storage, output_file_path, block_start, block_stop, compression, blocks_per_chunk);
+	}
 	else
 	{
 		BootstrapFile bootstrap;
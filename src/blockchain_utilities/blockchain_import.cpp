@@ -23,7 +23,9 @@
 
 #include "blockchain_db/db_types.h"
 #include "bootstrap_file.h"
+#include "bootstrap_indexed_file.h"
 #include "bootstrap_serialization.h"
+#include "common/threadpool.h"
 #include "cryptonote_basic/cryptonote_format_utils.h"
 #include "cryptonote_core/cryptonote_core.h"
 #include "include_base_utils.h"
@@ -44,6 +46,7 @@ bool opt_verify = true; // use add_new_block, which does verification before cal
 bool opt_resume = true;
 bool opt_testnet = true;
 bool opt_stagenet = true;
+bool opt_bulk_load = false;
 
 // number of blocks per batch transaction
 // adjustable through command-line argument according to available RAM
@@ -58,6 +61,10 @@ uint64_t db_batch_size = 100;
 // frequently saved
 uint64_t db_batch_size_verify = 5000;
 
+// number of blocks read from the file and decoded in parallel at a time in
+// bulk load mode
+uint64_t bulk_decode_window = 1000;
+
 std::string refresh_string = "\r                                    \r";
 }
 
@@ -223,6 +230,459 @@ int check_flush(cryptonote::core &core, std::list<block_complete_entry> &blocks,
 	return 0;
 }
 
+// 0: chunk read, 1: end of file, 2: error
+int read_chunk(std::ifstream &import_file, std::string &chunk)
+{
+	char buffer1[sizeof(uint32_t)];
+	uint32_t chunk_size;
+	import_file.read(buffer1, sizeof(chunk_size));
+	if(!import_file)
+	{
+		std::cout << refresh_string;
+		MINFO("End of file reached");
+		return 1;
+	}
+
+	std::string str1(buffer1, sizeof(chunk_size));
+	if(!::serialization::parse_binary(str1, chunk_size))
+	{
+		MFATAL("Error in deserialization of chunk size");
+		return 2;
+	}
+	MDEBUG("chunk_size: " << chunk_size);
+
+	if(chunk_size > BUFFER_SIZE)
+	{
+		MFATAL("ERROR: chunk_size " << chunk_size << " > BUFFER_SIZE " << BUFFER_SIZE);
+		return 2;
+	}
+	if(chunk_size > CHUNK_SIZE_WARNING_THRESHOLD)
+	{
+		MINFO("NOTE: chunk_size " << chunk_size << " > " << CHUNK_SIZE_WARNING_THRESHOLD);
+	}
+	else if(chunk_size == 0)
+	{
+		MFATAL("ERROR: chunk_size == 0");
+		return 2;
+	}
+
+	chunk.resize(chunk_size);
+	import_file.read(&chunk[0], chunk_size);
+	if(!import_file)
+	{
+		if(import_file.eof())
+		{
+			std::cout << refresh_string;
+			MINFO("End of file reached - file was truncated");
+			return 1;
+		}
+		MFATAL("ERROR: unexpected end of file: bytes read before error: "
+			   << import_file.gcount() << " of chunk_size " << chunk_size);
+		return 2;
+	}
+	return 0;
+}
+
+// Fill the hash caches of a decoded block and its txs, so the writer thread
+// does not have to. The txs are checked against the hashes the block commits
+// to, which is all the checking a trusted file gets.
+bool prepare_block_package(bootstrap::block_package &bp)
+{
+	if(bp.txs.size() != bp.block.tx_hashes.size())
+		return false;
+
+	crypto::hash h;
+	if(!get_block_hash(bp.block, h))
+		return false;
+	for(size_t i = 0; i < bp.txs.size(); ++i)
+	{
+		if(!get_transaction_hash(bp.txs[i], h) || h != bp.block.tx_hashes[i])
+			return false;
+	}
+	return true;
+}
+
+bool decode_block_package(const std::string &chunk, bootstrap::block_package &bp)
+{
+	if(!::serialization::parse_binary(chunk, bp))
+		return false;
+	return prepare_block_package(bp);
+}
+
+// blobs for the verifying path, which goes through handle_incoming_block
+void block_package_to_entry(const bootstrap::block_package &bp, block_complete_entry &entry)
+{
+	cryptonote::block_to_blob(bp.block, entry.block);
+	entry.txs.clear();
+	for(const auto &tx : bp.txs)
+	{
+		entry.txs.push_back(cryptonote::blobdata());
+		cryptonote::tx_to_blob(tx, entry.txs.back());
+	}
+}
+
+// Import without verification: blocks are decoded on the threadpool a window
+// at a time, then written in order through the db in bulk load mode.
+int bulk_import_from_file(cryptonote::core &core, const std::string &import_file_path, uint64_t block_stop = 0)
+{
+	BlockchainDB &db = core.get_blockchain_storage().get_db();
+	db.reset_stats();
+
+	boost::system::error_code ec;
+	if(!boost::filesystem::exists(boost::filesystem::path(import_file_path), ec))
+	{
+		MFATAL("bootstrap file not found: " << import_file_path);
+		return 2;
+	}
+
+	uint64_t start_height = db.height(), seek_height = start_height;
+	BootstrapFile bootstrap;
+	std::streampos pos;
+	uint64_t total_source_blocks = bootstrap.count_blocks(import_file_path, pos, seek_height);
+	MINFO("bootstrap file last block number: " << total_source_blocks - 1 << " (zero-based height)  total blocks: " << total_source_blocks);
+	if(total_source_blocks - 1 <= start_height)
+		return 0;
+
+	if(!block_stop)
+		block_stop = total_source_blocks - 1;
+	MINFO("start block: " << start_height << "  stop block: " << block_stop);
+
+	std::ifstream import_file;
+	import_file.open(import_file_path, std::ios_base::binary | std::ifstream::in);
+	if(import_file.fail())
+	{
+		MFATAL("import_file.open() fail");
+		return 2;
+	}
+	bootstrap.seek_to_first_chunk(import_file);
+	import_file.seekg(pos);
+	uint64_t h = 0;
+	bool q2 = false;
+	bootstrap.count_bytes(import_file, start_height - seek_height, h, q2);
+	if(q2)
+		return 2;
+
+	if(!db.set_bulk_load(true))
+	{
+		MFATAL("Database type " << db.get_db_name() << " does not support bulk load");
+		return 2;
+	}
+
+	tools::threadpool &tpool = tools::threadpool::getInstance();
+	const size_t threads = std::max(1, tpool.get_max_concurrency());
+	MINFO("bulk load: decoding on " << threads << " threads");
+
+	std::vector<std::string> chunks;
+	std::vector<bootstrap::block_package> packages;
+	std::unique_ptr<bool[]> decoded(new bool[bulk_decode_window]);
+	crypto::hash prev_hash = db.top_block_hash();
+	uint64_t num_imported = 0, in_batch = 0;
+	int quit = 0;
+
+	h = start_height;
+	db.batch_start(db_batch_size);
+	while(!quit && h <= block_stop)
+	{
+		chunks.clear();
+		while(chunks.size() < bulk_decode_window && h + chunks.size() <= block_stop)
+		{
+			chunks.emplace_back();
+			int ret = read_chunk(import_file, chunks.back());
+			if(ret)
+			{
+				chunks.pop_back();
+				quit = ret;
+				break;
+			}
+		}
+		if(quit > 1 || chunks.empty())
+			break;
+
+		packages.clear();
+		packages.resize(chunks.size());
+		const size_t per_thread = (chunks.size() + threads - 1) / threads;
+		tools::threadpool::waiter waiter;
+		for(size_t begin = 0; begin < chunks.size(); begin += per_thread)
+		{
+			const size_t end = std::min(begin + per_thread, chunks.size());
+			tpool.submit(&waiter, [&chunks, &packages, &decoded, begin, end]() {
+				for(size_t i = begin; i < end; ++i)
+					decoded[i] = decode_block_package(chunks[i], packages[i]);
+			});
+		}
+		waiter.wait();
+
+		for(size_t i = 0; i < packages.size(); ++i, ++h)
+		{
+			const bootstrap::block_package &bp = packages[i];
+			if(!decoded[i] || bp.block.prev_id != prev_hash)
+			{
+				std::cout << refresh_string;
+				MFATAL("Bad block in bootstrap file at height " << h << (decoded[i] ? ": does not build on the previous block" : ": failed to decode"));
+				quit = 2;
+				break;
+			}
+			try
+			{
+				db.add_block(bp.block, bp.block_size, bp.cumulative_difficulty, bp.coins_generated, bp.txs);
+			}
+			catch(const std::exception &e)
+			{
+				std::cout << refresh_string;
+				MFATAL("Error adding block to blockchain: " << e.what());
+				quit = 2;
+				break;
+			}
+			prev_hash = get_block_hash(bp.block);
+			++num_imported;
+
+			if(++in_batch == db_batch_size)
+			{
+				std::cout << refresh_string << ENDL << "[- batch commit at height " << h << " -]" << ENDL;
+				try
+				{
+					db.batch_stop();
+				}
+				catch(const std::exception &e)
+				{
+					MFATAL("Error committing batch: " << e.what());
+					quit = 2;
+					break;
+				}
+				db.batch_start(db_batch_size);
+				db.show_stats();
+				in_batch = 0;
+			}
+		}
+		std::cout << refresh_string << "block " << h - 1 << " / " << block_stop << std::flush;
+	}
+	import_file.close();
+
+	// On error, leave the batch to be aborted when the db is closed, along
+	// with any index entries still buffered for it.
+	if(quit > 1)
+		return quit;
+
+	try
+	{
+		db.batch_stop();
+		db.set_bulk_load(false);
+	}
+	catch(const std::exception &e)
+	{
+		MFATAL("Error committing batch: " << e.what());
+		return 2;
+	}
+
+	std::cout << ENDL;
+	db.show_stats();
+	MINFO("Number of blocks imported: " << num_imported);
+	MINFO("Finished at block: " << h - 1 << "  total blocks: " << h);
+	return 0;
+}
+
+// Import from an indexed bootstrap file. The index locates the chunk holding
+// the current height, then chunks are read a window at a time and
+// decompressed and decoded in parallel on the threadpool. Blocks go through
+// the verifying path or straight to the db, as for version 0 files.
+int import_from_indexed_file(cryptonote::core &core, const std::string &import_file_path, uint64_t block_stop = 0)
+{
+	BlockchainDB &db = core.get_blockchain_storage().get_db();
+	db.reset_stats();
+
+	BootstrapIndexedFile bootstrap;
+	if(!bootstrap.open_reader(import_file_path))
+		return 2;
+
+	const uint64_t start_height = db.height();
+	const uint64_t file_end = bootstrap.first_height() + bootstrap.block_count();
+	if(bootstrap.first_height() > start_height)
+	{
+		MFATAL("bootstrap file starts at block " << bootstrap.first_height() << ", but the database is at height " << start_height);
+		return 2;
+	}
+	if(file_end <= start_height)
+	{
+		MINFO("bootstrap file ends at block " << file_end - 1 << ", nothing to import");
+		return 0;
+	}
+	if(!block_stop || block_stop >= file_end)
+		block_stop = file_end - 1;
+	MINFO("start block: " << start_height << "  stop block: " << block_stop);
+
+	uint64_t h;
+	if(!bootstrap.seek_to_height(start_height, h))
+	{
+		MFATAL("Failed to seek to height " << start_height);
+		return 2;
+	}
+
+	const bool use_batch = opt_batch && !opt_verify;
+	if(opt_bulk_load && !db.set_bulk_load(true))
+	{
+		MFATAL("Database type " << db.get_db_name() << " does not support bulk load");
+		return 2;
+	}
+
+	tools::threadpool &tpool = tools::threadpool::getInstance();
+	const size_t threads = std::max(1, tpool.get_max_concurrency());
+	const size_t chunks_per_window = 4 * threads;
+	MINFO("decoding on " << threads << " threads");
+
+	std::vector<std::string> stored;
+	std::vector<uint32_t> raw_sizes;
+	std::vector<std::vector<bootstrap::block_package>> chunks;
+	std::vector<char> decoded;
+	std::list<block_complete_entry> blocks;
+	crypto::hash prev_hash = db.top_block_hash();
+	uint64_t num_imported = 0, in_batch = 0;
+	int quit = 0;
+
+	if(use_batch)
+		db.batch_start(db_batch_size);
+	while(!quit && h <= block_stop)
+	{
+		stored.clear();
+		raw_sizes.clear();
+		while(stored.size() < chunks_per_window)
+		{
+			stored.emplace_back();
+			raw_sizes.emplace_back();
+			int ret = bootstrap.read_chunk(stored.back(), raw_sizes.back());
+			if(ret)
+			{
+				stored.pop_back();
+				raw_sizes.pop_back();
+				quit = ret;
+				break;
+			}
+		}
+		if(quit > 1 || stored.empty())
+			break;
+
+		chunks.clear();
+		chunks.resize(stored.size());
+		decoded.assign(stored.size(), 0);
+		tools::threadpool::waiter waiter;
+		for(size_t i = 0; i < stored.size(); ++i)
+		{
+			tpool.submit(&waiter, [&bootstrap, &stored, &raw_sizes, &chunks, &decoded, i]() {
+				bool ok = bootstrap.decode_chunk(stored[i], raw_sizes[i], chunks[i]);
+				for(size_t j = 0; ok && j < chunks[i].size(); ++j)
+					ok = prepare_block_package(chunks[i][j]);
+				decoded[i] = ok;
+			});
+		}
+		waiter.wait();
+
+		for(size_t i = 0; !quit && i < chunks.size(); ++i)
+		{
+			if(!decoded[i])
+			{
+				std::cout << refresh_string;
+				MFATAL("Failed to decode chunk starting at height " << h);
+				quit = 2;
+				break;
+			}
+			for(bootstrap::block_package &bp : chunks[i])
+			{
+				if(h < start_height)
+				{
+					++h;
+					continue;
+				}
+				if(h > block_stop)
+				{
+					quit = 1;
+					break;
+				}
+				if(bp.block.prev_id != prev_hash)
+				{
+					std::cout << refresh_string;
+					MFATAL("Bad block in bootstrap file at height " << h << ": does not build on the previous block");
+					quit = 2;
+					break;
+				}
+				prev_hash = get_block_hash(bp.block);
+
+				if(opt_verify)
+				{
+					blocks.emplace_back();
+					block_package_to_entry(bp, blocks.back());
+					if(check_flush(core, blocks, false))
+					{
+						quit = 2;
+						break;
+					}
+				}
+				else
+				{
+					try
+					{
+						db.add_block(bp.block, bp.block_size, bp.cumulative_difficulty, bp.coins_generated, bp.txs);
+					}
+					catch(const std::exception &e)
+					{
+						std::cout << refresh_string;
+						MFATAL("Error adding block to blockchain: " << e.what());
+						quit = 2;
+						break;
+					}
+					if(use_batch && ++in_batch == db_batch_size)
+					{
+						std::cout << refresh_string << ENDL << "[- batch commit at height " << h << " -]" << ENDL;
+						try
+						{
+							db.batch_stop();
+						}
+						catch(const std::exception &e)
+						{
+							MFATAL("Error committing batch: " << e.what());
+							quit = 2;
+							break;
+						}
+						db.batch_start(db_batch_size);
+						db.show_stats();
+						in_batch = 0;
+					}
+				}
+				++num_imported;
+				++h;
+			}
+		}
+		std::cout << refresh_string << "block " << h - 1 << " / " << block_stop << std::flush;
+	}
+
+	// On error, leave the batch to be aborted when the db is closed
+	if(quit > 1)
+		return quit;
+
+	if(opt_verify)
+	{
+		int ret = check_flush(core, blocks, true);
+		if(ret)
+			return ret;
+	}
+	try
+	{
+		if(use_batch)
+			db.batch_stop();
+		if(opt_bulk_load)
+			db.set_bulk_load(false);
+	}
+	catch(const std::exception &e)
+	{
+		MFATAL("Error committing batch: " << e.what());
+		return 2;
+	}
+
+	std::cout << ENDL;
+	db.show_stats();
+	MINFO("Number of blocks imported: " << num_imported);
+	MINFO("Finished at block: " << h - 1 << "  total blocks: " << h);
+	return 0;
+}
+
 int import_from_file(cryptonote::core &core, const std::string &import_file_path, uint64_t block_stop = 0)
 {
 	// Reset stats, in case we're using newly created db, accumulating stats
@@ -272,9 +732,7 @@ int import_from_file(cryptonote::core &core, const std::string &import_file_path
 	// 4 byte magic + (currently) 1024 byte header structures
 	bootstrap.seek_to_first_chunk(import_file);
 
-	std::string str1;
-	char buffer1[1024];
-	char buffer_block[BUFFER_SIZE];
+	std::string chunk;
 	block b;
 	transaction tx;
 	int quit = 0;
@@ -325,57 +783,15 @@ int import_from_file(cryptonote::core &core, const std::string &import_file_path
 	}
 	while(!quit)
 	{
-		uint32_t chunk_size;
-		import_file.read(buffer1, sizeof(chunk_size));
-		// TODO: bootstrap.read_chunk();
-		if(!import_file)
+		int ret = read_chunk(import_file, chunk);
+		if(ret)
 		{
-			std::cout << refresh_string;
-			MINFO("End of file reached");
+			if(ret > 1)
+				return 2;
 			quit = 1;
 			break;
 		}
-		bytes_read += sizeof(chunk_size);
-
-		str1.assign(buffer1, sizeof(chunk_size));
-		if(!::serialization::parse_binary(str1, chunk_size))
-		{
-			throw std::runtime_error("Error in deserialization of chunk size");
-		}
-		MDEBUG("chunk_size: " << chunk_size);
-
-		if(chunk_size > BUFFER_SIZE)
-		{
-			MWARNING("WARNING: chunk_size " << chunk_size << " > BUFFER_SIZE " << BUFFER_SIZE);
-			throw std::runtime_error("Aborting: chunk size exceeds buffer size");
-		}
-		if(chunk_size > CHUNK_SIZE_WARNING_THRESHOLD)
-		{
-			MINFO("NOTE: chunk_size " << chunk_size << " > " << CHUNK_SIZE_WARNING_THRESHOLD);
-		}
-		else if(chunk_size == 0)
-		{
-			MFATAL("ERROR: chunk_size == 0");
-			return 2;
-		}
-		import_file.read(buffer_block, chunk_size);
-		if(!import_file)
-		{
-			if(import_file.eof())
-			{
-				std::cout << refresh_string;
-				MINFO("End of file reached - file was truncated");
-				quit = 1;
-				break;
-			}
-			else
-			{
-				MFATAL("ERROR: unexpected end of file: bytes read before error: "
-					   << import_file.gcount() << " of chunk_size " << chunk_size);
-				return 2;
-			}
-		}
-		bytes_read += chunk_size;
+		bytes_read += sizeof(uint32_t) + chunk.size();
 		MDEBUG("Total bytes read: " << bytes_read);
 
 		if(h > block_stop)
@@ -391,9 +807,8 @@ int import_from_file(cryptonote::core &core, const std::string &import_file_path
 
 		try
 		{
-			str1.assign(buffer_block, chunk_size);
 			bootstrap::block_package bp;
-			if(!::serialization::parse_binary(str1, bp))
+			if(!::serialization::parse_binary(chunk, bp))
 				throw std::runtime_error("Error in deserialization of chunk");
 
 			int display_interval = 1000;
@@ -423,15 +838,8 @@ int import_from_file(cryptonote::core &core, const std::string &import_file_path
 
 				if(opt_verify)
 				{
-					cryptonote::blobdata block;
-					cryptonote::block_to_blob(bp.block, block);
-					std::list<cryptonote::blobdata> txs;
-					for(const auto &tx : bp.txs)
-					{
-						txs.push_back(cryptonote::blobdata());
-						cryptonote::tx_to_blob(tx, txs.back());
-					}
-					blocks.push_back({block, txs});
+					blocks.emplace_back();
+					block_package_to_entry(bp, blocks.back());
 					int ret = check_flush(core, blocks, false);
 					if(ret)
 					{
@@ -568,6 +976,7 @@ int main(int argc, char *argv[])
 	uint32_t log_level = 0;
 	uint64_t num_blocks = 0;
 	uint64_t block_stop = 0;
+	uint64_t start_height = 0;
 	std::string m_config_folder;
 	std::string db_arg_str;
 
@@ -580,6 +989,7 @@ int main(int argc, char *argv[])
 	const command_line::arg_descriptor<std::string> arg_input_file = {"input-file", "Specify input file", "", true};
 	const command_line::arg_descriptor<std::string> arg_log_level = {"log-level", "0-4 or categories", ""};
 	const command_line::arg_descriptor<uint64_t> arg_block_stop = {"block-stop", "Stop at block number", block_stop};
+	const command_line::arg_descriptor<uint64_t> arg_start_height = {"start-height", "Start at block number, must match the database height", start_height};
 	const command_line::arg_descriptor<uint64_t> arg_batch_size = {"batch-size", "", db_batch_size};
 	const command_line::arg_descriptor<uint64_t> arg_pop_blocks = {"pop-blocks", "Remove blocks from end of blockchain", num_blocks};
 	const command_line::arg_descriptor<bool> arg_drop_hf = {"drop-hard-fork", "Drop hard fork subdbs", false};
@@ -593,12 +1003,16 @@ int main(int argc, char *argv[])
 														  "Batch transactions for faster import", true};
 	const command_line::arg_descriptor<bool> arg_resume = {"resume",
 														   "Resume from current height if output database already exists", true};
+	const command_line::arg_descriptor<bool> arg_bulk_load = {"bulk-load",
+															  "Decode blocks in parallel and defer index writes to batch commits. Trusted input only, requires --guard-against-pwnage 0", false};
 
 	command_line::add_arg(desc_cmd_sett, arg_input_file);
 	command_line::add_arg(desc_cmd_sett, arg_log_level);
 	command_line::add_arg(desc_cmd_sett, arg_database);
 	command_line::add_arg(desc_cmd_sett, arg_batch_size);
 	command_line::add_arg(desc_cmd_sett, arg_block_stop);
+	command_line::add_arg(desc_cmd_sett, arg_start_height);
+	command_line::add_arg(desc_cmd_sett, arg_bulk_load);
 
 	command_line::add_arg(desc_cmd_only, arg_count_blocks);
 	command_line::add_arg(desc_cmd_only, arg_pop_blocks);
@@ -627,6 +1041,7 @@ int main(int argc, char *argv[])
 	opt_resume = command_line::get_arg(vm, arg_resume);
 	block_stop = command_line::get_arg(vm, arg_block_stop);
 	db_batch_size = command_line::get_arg(vm, arg_batch_size);
+	opt_bulk_load = command_line::get_arg(vm, arg_bulk_load);
 
 	if(command_line::get_arg(vm, command_line::arg_help))
 	{
@@ -645,6 +1060,11 @@ int main(int argc, char *argv[])
 		std::cerr << "Error: batch-size must be > 0" << ENDL;
 		return 1;
 	}
+	if(opt_bulk_load && (opt_verify || !opt_batch || !opt_resume))
+	{
+		std::cerr << "Error: bulk-load requires batch and resume on and guard-against-pwnage off" << ENDL;
+		return 1;
+	}
 	if(opt_verify && command_line::is_arg_defaulted(vm, arg_batch_size))
 	{
 		// usually want batch size default lower if verify on, so progress can be
@@ -685,12 +1105,26 @@ int main(int argc, char *argv[])
 
 	import_file_path = fs_import_file_path.string();
 
+	const bool indexed_file = BootstrapIndexedFile::is_indexed_file(import_file_path);
 	if(command_line::has_arg(vm, arg_count_blocks))
 	{
+		if(indexed_file)
+		{
+			BootstrapIndexedFile bootstrap;
+			if(!bootstrap.open_reader(import_file_path))
+				return 1;
+			std::cout << "first block: " << bootstrap.first_height() << "  total blocks: " << bootstrap.block_count() << ENDL;
+			return 0;
+		}
 		BootstrapFile bootstrap;
 		bootstrap.count_blocks(import_file_path);
 		return 0;
 	}
+	if(indexed_file && !opt_resume)
+	{
+		std::cerr << "Error: indexed bootstrap files always import from the current database height, resume must be on" << ENDL;
+		return 1;
+	}
 
 	std::string db_type;
 	int db_flags = 0;
@@ -721,6 +1155,7 @@ int main(int argc, char *argv[])
 		MINFO("batch:   " << std::boolalpha << opt_batch << std::noboolalpha);
 	}
 	MINFO("resume:  " << std::boolalpha << opt_resume << std::noboolalpha);
+	MINFO("bulk:    " << std::boolalpha << opt_bulk_load << std::noboolalpha);
 	MINFO("nettype: " << (opt_testnet ? "testnet" : opt_stagenet ? "stagenet" : "mainnet"));
 
 	MINFO("bootstrap file path: " << import_file_path);
@@ -757,7 +1192,27 @@ int main(int argc, char *argv[])
 			return 0;
 		}
 
-		import_from_file(core, import_file_path, block_stop);
+		if(!command_line::is_arg_defaulted(vm, arg_start_height))
+		{
+			// blocks can only be added on top of the chain, so the start
+			// height only selects where in the file reading begins
+			start_height = command_line::get_arg(vm, arg_start_height);
+			const uint64_t db_height = core.get_blockchain_storage().get_current_blockchain_height();
+			if(start_height != db_height)
+			{
+				std::cerr << "Error: start-height " << start_height << " does not match the database height " << db_height
+						  << ", use --pop-blocks to rewind the database" << ENDL;
+				core.deinit();
+				return 1;
+			}
+		}
+
+		if(indexed_file)
+			import_from_indexed_file(core, import_file_path, block_stop);
+		else if(opt_bulk_load)
+			bulk_import_from_file(core, import_file_path, block_stop);
+		else
+			import_from_file(core, import_file_path, block_stop);
 
 		// ensure db closed
 		//   - transactions properly checked and handled
@@ -26,3 +26,8 @@
 #define CHUNK_SIZE_WARNING_THRESHOLD 500000
 #define NUM_BLOCKS_PER_CHUNK 1
 #define BLOCKCHAIN_RAW "blockchain.raw"
+
+// This number was picked by taking the leading 4 bytes from this output:
+// echo Monero bootstrap file | sha1sum
+#define BLOCKCHAIN_RAW_MAGIC 0x28721586
+#define BLOCKCHAIN_RAW_HEADER_SIZE 1024
@@ -32,10 +32,8 @@ using namespace epee;
 
 namespace
 {
-// This number was picked by taking the leading 4 bytes from this output:
-// echo Monero bootstrap file | sha1sum
-const uint32_t blockchain_raw_magic = 0x28721586;
-const uint32_t header_size = 1024;
+const uint32_t blockchain_raw_magic = BLOCKCHAIN_RAW_MAGIC;
+const uint32_t header_size = BLOCKCHAIN_RAW_HEADER_SIZE;
 
 std::string refresh_string = "\r                                    \r";
 }
@@ -352,6 +350,8 @@ uint64_t BootstrapFile::seek_to_first_chunk(std::ifstream &import_file)
 	if(!::serialization::parse_binary(str1, bfi))
 		throw std::runtime_error("Error in deserialization of bootstrap::file_info");
 	MINFO("bootstrap file v" << unsigned(bfi.major_version) << "." << unsigned(bfi.minor_version));
+	if(bfi.major_version > 0)
+		throw std::runtime_error("Error: indexed bootstrap file, not readable as a version 0 file");
 	MINFO("bootstrap magic size: " << sizeof(file_magic));
 	MINFO("bootstrap header size: " << bfi.header_size);
 
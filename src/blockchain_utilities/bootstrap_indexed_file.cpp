@@ -0,0 +1,557 @@
+// Copyright (c) 2018, Ryo Currency Project
+// Portions copyright (c) 2014-2018, The Monero Project
+//
+// Portions of this file are available under BSD-3 license. Please see ORIGINAL-LICENSE for details
+// All rights reserved.
+//
+// ombre changes to this code are in public domain. Please note, other licences may apply to the file.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "bootstrap_indexed_file.h"
+#include "common/util.h"
+#include "misc_language.h"
+#include "serialization/binary_utils.h" // dump_binary(), parse_binary()
+
+#include <algorithm>
+#include <boost/filesystem/operations.hpp>
+
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
+#ifdef HAVE_LZ4
+#include <lz4.h>
+#endif
+
+//#undef RYO_DEFAULT_LOG_CATEGORY
+//#define RYO_DEFAULT_LOG_CATEGORY "bcutil"
+
+using namespace cryptonote;
+using namespace epee;
+
+namespace
+{
+// leading 4 bytes of: echo ombre bootstrap index | sha1sum
+const uint32_t index_magic = 0x6ebfc6e1;
+// index offset (8), index size (4), index magic (4)
+const uint32_t footer_size = 16;
+// sanity limit on a chunk's stored and uncompressed size
+const uint32_t max_chunk_size = 256 * 1024 * 1024;
+const int zstd_level = 3;
+
+std::string refresh_string = "\r                                    \r";
+
+template <typename T>
+bool write_binary(std::ofstream &file, T v)
+{
+	std::string blob;
+	if(!::serialization::dump_binary(v, blob))
+		return false;
+	file.write(blob.data(), blob.size());
+	return file.good();
+}
+
+template <typename T>
+bool read_binary(std::ifstream &file, T &v)
+{
+	char buf[sizeof(T)];
+	file.read(buf, sizeof(T));
+	if(!file)
+		return false;
+	return ::serialization::parse_binary(std::string(buf, sizeof(T)), v);
+}
+
+bool compress(uint8_t compression, const std::string &raw, std::string &stored)
+{
+	switch(compression)
+	{
+	case bootstrap::compression_none:
+		stored = raw;
+		return true;
+#ifdef HAVE_ZSTD
+	case bootstrap::compression_zstd:
+	{
+		stored.resize(ZSTD_compressBound(raw.size()));
+		size_t size = ZSTD_compress(&stored[0], stored.size(), raw.data(), raw.size(), zstd_level);
+		if(ZSTD_isError(size))
+			return false;
+		stored.resize(size);
+		return true;
+	}
+#endif
+#ifdef HAVE_LZ4
+	case bootstrap::compression_lz4:
+	{
+		stored.resize(LZ4_compressBound(raw.size()));
+		int size = LZ4_compress_default(raw.data(), &stored[0], raw.size(), stored.size());
+		if(size <= 0)
+			return false;
+		stored.resize(size);
+		return true;
+	}
+#endif
+	default:
+		return false;
+	}
+}
+
+bool decompress(uint8_t compression, const std::string &stored, uint32_t raw_size, std::string &raw)
+{
+	switch(compression)
+	{
+	case bootstrap::compression_none:
+		raw = stored;
+		return raw.size() == raw_size;
+#ifdef HAVE_ZSTD
+	case bootstrap::compression_zstd:
+	{
+		raw.resize(raw_size);
+		size_t size = ZSTD_decompress(&raw[0], raw.size(), stored.data(), stored.size());
+		return !ZSTD_isError(size) && size == raw_size;
+	}
+#endif
+#ifdef HAVE_LZ4
+	case bootstrap::compression_lz4:
+	{
+		raw.resize(raw_size);
+		int size = LZ4_decompress_safe(stored.data(), &raw[0], stored.size(), raw.size());
+		return size >= 0 && (uint32_t)size == raw_size;
+	}
+#endif
+	default:
+		return false;
+	}
+}
+}
+
+BootstrapIndexedFile::BootstrapIndexedFile() : m_chunk_height(0), m_index_offset(0), m_next_chunk(0)
+{
+	m_format.compression = bootstrap::compression_none;
+	m_format.blocks_per_chunk = 0;
+	m_index.block_count = 0;
+}
+
+bool BootstrapIndexedFile::compression_from_string(const std::string &name, uint8_t &compression)
+{
+	if(name == "none")
+		compression = bootstrap::compression_none;
+	else if(name == "zstd")
+		compression = bootstrap::compression_zstd;
+	else if(name == "lz4")
+		compression = bootstrap::compression_lz4;
+	else
+		return false;
+	return true;
+}
+
+bool BootstrapIndexedFile::compression_supported(uint8_t compression)
+{
+	switch(compression)
+	{
+	case bootstrap::compression_none:
+		return true;
+#ifdef HAVE_ZSTD
+	case bootstrap::compression_zstd:
+		return true;
+#endif
+#ifdef HAVE_LZ4
+	case bootstrap::compression_lz4:
+		return true;
+#endif
+	default:
+		return false;
+	}
+}
+
+bool BootstrapIndexedFile::is_indexed_file(const std::string &import_file_path)
+{
+	std::ifstream file(import_file_path, std::ios_base::binary | std::ifstream::in);
+	if(file.fail())
+		return false;
+	BootstrapIndexedFile reader;
+	return reader.read_header(file);
+}
+
+bool BootstrapIndexedFile::write_header()
+{
+	if(!write_binary(m_writer, (uint32_t)BLOCKCHAIN_RAW_MAGIC))
+		return false;
+
+	bootstrap::file_info bfi;
+	bfi.major_version = 1;
+	bfi.minor_version = 0;
+	bfi.header_size = BLOCKCHAIN_RAW_HEADER_SIZE;
+
+	std::string header, blob;
+	if(!::serialization::dump_binary(bfi, blob))
+		return false;
+	header += t_serializable_object_to_blob((uint32_t)blob.size()) + blob;
+	if(!::serialization::dump_binary(m_format, blob))
+		return false;
+	header += t_serializable_object_to_blob((uint32_t)blob.size()) + blob;
+	if(header.size() > BLOCKCHAIN_RAW_HEADER_SIZE)
+		return false;
+	header.resize(BLOCKCHAIN_RAW_HEADER_SIZE, 0); // fill in rest with null bytes
+
+	m_writer.write(header.data(), header.size());
+	m_index_offset = sizeof(uint32_t) + BLOCKCHAIN_RAW_HEADER_SIZE;
+	return m_writer.good();
+}
+
+bool BootstrapIndexedFile::read_header(std::ifstream &file)
+{
+	uint32_t magic, size;
+	if(!read_binary(file, magic) || magic != BLOCKCHAIN_RAW_MAGIC)
+		return false;
+
+	bootstrap::file_info bfi;
+	std::string blob;
+	if(!read_binary(file, size) || size > BLOCKCHAIN_RAW_HEADER_SIZE)
+		return false;
+	blob.resize(size);
+	if(!file.read(&blob[0], size) || !::serialization::parse_binary(blob, bfi))
+		return false;
+	if(bfi.major_version != 1)
+	{
+		MDEBUG("bootstrap file v" << unsigned(bfi.major_version) << "." << unsigned(bfi.minor_version) << " is not indexed");
+		return false;
+	}
+
+	if(!read_binary(file, size) || size > BLOCKCHAIN_RAW_HEADER_SIZE)
+		return false;
+	blob.resize(size);
+	if(!file.read(&blob[0], size) || !::serialization::parse_binary(blob, m_format))
+		return false;
+	if(m_format.blocks_per_chunk == 0)
+		return false;
+	return true;
+}
+
+bool BootstrapIndexedFile::read_index(std::ifstream &file, uint64_t &index_offset)
+{
+	uint32_t index_size, magic;
+	file.seekg(0, std::ios_base::end);
+	const uint64_t file_size = file.tellg();
+	const uint64_t chunks_offset = sizeof(uint32_t) + BLOCKCHAIN_RAW_HEADER_SIZE;
+	if(!file || file_size < chunks_offset + footer_size)
+	{
+		MERROR("bootstrap file is too small to hold an index");
+		return false;
+	}
+	file.seekg(file_size - footer_size);
+	if(!read_binary(file, index_offset) || !read_binary(file, index_size) || !read_binary(file, magic))
+		return false;
+	if(magic != index_magic)
+	{
+		MERROR("bootstrap file index not found, the file may be truncated");
+		return false;
+	}
+	// the index sits between the last chunk and the footer
+	if(index_offset < chunks_offset || index_offset > file_size - footer_size || index_size != file_size - footer_size - index_offset)
+	{
+		MERROR("bootstrap file index bounds are invalid: offset " << index_offset << ", size " << index_size << ", file size " << file_size);
+		return false;
+	}
+
+	std::string blob(index_size, 0);
+	file.seekg(index_offset);
+	if(!file.read(&blob[0], index_size) || !::serialization::parse_binary(blob, m_index))
+	{
+		MERROR("Failed to read bootstrap file index");
+		return false;
+	}
+	if(m_index.heights.size() != m_index.offsets.size())
+	{
+		MERROR("Inconsistent bootstrap file index");
+		return false;
+	}
+
+	for(size_t i = 0; i < m_index.offsets.size(); ++i)
+	{
+		if(m_index.offsets[i] >= index_offset || (i > 0 && (m_index.offsets[i] <= m_index.offsets[i - 1] || m_index.heights[i] <= m_index.heights[i - 1])))
+		{
+			MERROR("Inconsistent bootstrap file index");
+			return false;
+		}
+	}
+	return true;
+}
+
+bool BootstrapIndexedFile::open_reader(const std::string &import_file_path)
+{
+	m_reader.open(import_file_path, std::ios_base::binary | std::ifstream::in);
+	if(m_reader.fail())
+	{
+		MFATAL("Failed to open " << import_file_path);
+		return false;
+	}
+	if(!read_header(m_reader))
+	{
+		MFATAL("Not an indexed bootstrap file: " << import_file_path);
+		return false;
+	}
+	if(!compression_supported(m_format.compression))
+	{
+		MFATAL("Bootstrap file uses compression type " << unsigned(m_format.compression) << ", which this build does not support");
+		return false;
+	}
+	if(!read_index(m_reader, m_index_offset))
+		return false;
+	m_next_chunk = 0;
+
+	MINFO("indexed bootstrap file: " << m_index.offsets.size() << " chunks, blocks " << first_height() << " to " << first_height() + block_count() - 1);
+	return true;
+}
+
+bool BootstrapIndexedFile::seek_to_height(uint64_t height, uint64_t &chunk_height)
+{
+	if(m_index.heights.empty() || height < first_height() || height >= first_height() + block_count())
+		return false;
+
+	auto it = std::upper_bound(m_index.heights.begin(), m_index.heights.end(), height);
+	m_next_chunk = std::distance(m_index.heights.begin(), it) - 1;
+	chunk_height = m_index.heights[m_next_chunk];
+	return true;
+}
+
+int BootstrapIndexedFile::read_chunk(std::string &stored, uint32_t &raw_size)
+{
+	if(m_next_chunk >= m_index.offsets.size())
+		return 1;
+
+	uint32_t stored_size;
+	m_reader.clear();
+	m_reader.seekg(m_index.offsets[m_next_chunk]);
+	if(!read_binary(m_reader, stored_size) || !read_binary(m_reader, raw_size))
+	{
+		MFATAL("Failed to read chunk " << m_next_chunk << " header");
+		return 2;
+	}
+	if(stored_size > max_chunk_size || raw_size > max_chunk_size)
+	{
+		MFATAL("Chunk " << m_next_chunk << " is too large: " << stored_size << "/" << raw_size << " bytes");
+		return 2;
+	}
+
+	stored.resize(stored_size);
+	if(!m_reader.read(&stored[0], stored_size))
+	{
+		MFATAL("Failed to read chunk " << m_next_chunk);
+		return 2;
+	}
+	++m_next_chunk;
+	return 0;
+}
+
+bool BootstrapIndexedFile::decode_chunk(const std::string &stored, uint32_t raw_size, std::vector<bootstrap::block_package> &blocks) const
+{
+	std::string raw;
+	if(!decompress(m_format.compression, stored, raw_size, raw))
+		return false;
+
+	bootstrap::chunk chunk;
+	if(!::serialization::parse_binary(raw, chunk))
+		return false;
+	blocks.swap(chunk.blocks);
+	return true;
+}
+
+bool BootstrapIndexedFile::flush_chunk()
+{
+	if(m_chunk.blocks.empty())
+		return true;
+
+	std::string raw, stored;
+	if(!::serialization::dump_binary(m_chunk, raw) || raw.size() > max_chunk_size)
+	{
+		MFATAL("Failed to serialize chunk at height " << m_chunk_height);
+		return false;
+	}
+	if(!compress(m_format.compression, raw, stored))
+	{
+		MFATAL("Failed to compress chunk at height " << m_chunk_height);
+		return false;
+	}
+
+	if(!write_binary(m_writer, (uint32_t)stored.size()) || !write_binary(m_writer, (uint32_t)raw.size()))
+		return false;
+	m_writer.write(stored.data(), stored.size());
+	if(!m_writer.good())
+		return false;
+
+	m_index.heights.push_back(m_chunk_height);
+	m_index.offsets.push_back(m_index_offset);
+	m_index.block_count += m_chunk.blocks.size();
+	m_index_offset += 2 * sizeof(uint32_t) + stored.size();
+	m_chunk_height += m_chunk.blocks.size();
+	m_chunk.blocks.clear();
+
+	MDEBUG("flushed chunk: raw size " << raw.size() << ", stored size " << stored.size());
+	return true;
+}
+
+bool BootstrapIndexedFile::write_index()
+{
+	std::string blob;
+	if(!::serialization::dump_binary(m_index, blob))
+		return false;
+	m_writer.write(blob.data(), blob.size());
+	return write_binary(m_writer, m_index_offset) && write_binary(m_writer, (uint32_t)blob.size()) && write_binary(m_writer, index_magic);
+}
+
+bool BootstrapIndexedFile::store_blockchain_raw(Blockchain *cs, boost::filesystem::path &output_file,
+												 uint64_t block_start, uint64_t block_stop, uint8_t compression, uint32_t blocks_per_chunk)
+{
+	const uint64_t chain_height = cs->get_current_blockchain_height();
+	if(block_stop == 0 || block_stop >= chain_height)
+		block_stop = chain_height - 1;
+
+	BlockchainDB &db = cs->get_db();
+	return store_blocks(output_file, block_start, block_stop, compression, blocks_per_chunk, [cs, &db](uint64_t height, bootstrap::block_package &bp) {
+		if(height >= cs->get_current_blockchain_height())
+			return false;
+		crypto::hash hash = cs->get_block_id_by_height(height);
+		if(!cs->get_block_by_hash(hash, bp.block))
+			return false;
+		bp.txs.clear();
+		for(const auto &tx_id : bp.block.tx_hashes)
+			bp.txs.push_back(db.get_tx(tx_id));
+		bp.block_size = db.get_block_size(height);
+		bp.cumulative_difficulty = db.get_block_cumulative_difficulty(height);
+		bp.coins_generated = db.get_block_already_generated_coins(height);
+		return true;
+	});
+}
+
+bool BootstrapIndexedFile::store_blocks(const boost::filesystem::path &output_file, uint64_t block_start, uint64_t block_stop, uint8_t compression, uint32_t blocks_per_chunk,
+										const std::function<bool(uint64_t height, bootstrap::block_package &bp)> &get_block)
+{
+	const boost::filesystem::path dir_path = output_file.parent_path();
+	if(!dir_path.empty() && !boost::filesystem::exists(dir_path) && !boost::filesystem::create_directory(dir_path))
+	{
+		MFATAL("Failed to create directory " << dir_path);
+		return false;
+	}
+
+	// everything is written to a temporary file, which only replaces the
+	// output once its index is complete
+	const std::string tmp_file = output_file.string() + ".tmp";
+	bool done = false;
+	epee::misc_utils::auto_scope_leave_caller tmp_dtor = epee::misc_utils::create_scope_leave_handler([&]() {
+		if(m_writer.is_open())
+			m_writer.close();
+		if(!done)
+		{
+			boost::system::error_code ec;
+			boost::filesystem::remove(tmp_file, ec);
+		}
+	});
+
+	if(boost::filesystem::exists(output_file))
+	{
+		if(!open_reader(output_file.string()))
+			return false;
+		block_start = first_height() + block_count();
+		if(m_format.compression != compression || m_format.blocks_per_chunk != blocks_per_chunk)
+			MINFO("appending with the existing file's chunk format");
+
+		// the new blocks must follow on from the file's last one
+		if(block_start > 0)
+		{
+			uint64_t chunk_height;
+			std::string stored;
+			uint32_t raw_size;
+			std::vector<bootstrap::block_package> blocks;
+			bootstrap::block_package bp;
+			if(!seek_to_height(block_start - 1, chunk_height) || read_chunk(stored, raw_size) != 0 || !decode_chunk(stored, raw_size, blocks) || blocks.size() != block_start - chunk_height)
+			{
+				MFATAL("Failed to read the last block of " << output_file);
+				return false;
+			}
+			if(!get_block(block_start - 1, bp) || get_block_hash(bp.block) != get_block_hash(blocks.back().block))
+			{
+				MFATAL("The last block of " << output_file << ", at height " << block_start - 1 << ", is not on the current chain, export to a new file");
+				return false;
+			}
+		}
+		m_reader.close();
+
+		boost::system::error_code ec;
+		boost::filesystem::copy_file(output_file, tmp_file, boost::filesystem::copy_option::overwrite_if_exists, ec);
+		if(!ec)
+			boost::filesystem::resize_file(tmp_file, m_index_offset, ec);
+		if(ec)
+		{
+			MFATAL("Failed to copy the chunks of " << output_file << " to " << tmp_file << ": " << ec.message());
+			return false;
+		}
+		m_writer.open(tmp_file, std::ios_base::binary | std::ios_base::out | std::ios::app);
+		MINFO("appending to existing file, next block: " << block_start);
+	}
+	else
+	{
+		if(!compression_supported(compression))
+		{
+			MFATAL("Compression type " << unsigned(compression) << " is not supported by this build");
+			return false;
+		}
+		m_format.compression = compression;
+		m_format.blocks_per_chunk = blocks_per_chunk;
+		m_writer.open(tmp_file, std::ios_base::binary | std::ios_base::out | std::ios::trunc);
+		if(m_writer.fail() || !write_header())
+		{
+			MFATAL("Failed to write the header of " << tmp_file);
+			return false;
+		}
+	}
+	if(m_writer.fail())
+		return false;
+
+	MINFO("Storing blocks " << block_start << " to " << block_stop << ", " << m_format.blocks_per_chunk << " per chunk");
+	m_chunk.blocks.clear();
+	m_chunk_height = block_start;
+	const uint64_t progress_interval = 100;
+	for(uint64_t height = block_start; height <= block_stop; ++height)
+	{
+		m_chunk.blocks.emplace_back();
+		if(!get_block(height, m_chunk.blocks.back()))
+		{
+			MFATAL("Failed to get block at height " << height);
+			return false;
+		}
+		if(m_chunk.blocks.size() >= m_format.blocks_per_chunk && !flush_chunk())
+			return false;
+		if(height % progress_interval == 0)
+			std::cout << refresh_string << "block " << height << "/" << block_stop << std::flush;
+	}
+	if(!flush_chunk() || !write_index())
+	{
+		MFATAL("Failed to finish writing " << tmp_file);
+		return false;
+	}
+	m_writer.close();
+	if(m_writer.fail())
+	{
+		MFATAL("Failed to close " << tmp_file);
+		return false;
+	}
+	std::error_code e = tools::replace_file(tmp_file, output_file.string());
+	if(e)
+	{
+		MFATAL("Failed to rename " << tmp_file << " to " << output_file << ": " << e.message());
+		return false;
+	}
+	done = true;
+
+	std::cout << refresh_string << "block " << block_stop << "/" << block_stop << ENDL;
+	MINFO("Number of blocks in file: " << block_count() << ", chunks: " << m_index.offsets.size());
+	return true;
+}
@@ -0,0 +1,92 @@
+// Copyright (c) 2018, Ryo Currency Project
+// Portions copyright (c) 2014-2018, The Monero Project
+//
+// Portions of this file are available under BSD-3 license. Please see ORIGINAL-LICENSE for details
+// All rights reserved.
+//
+// ombre changes to this code are in public domain. Please note, other licences may apply to the file.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <boost/filesystem/path.hpp>
+
+#include "cryptonote_basic/cryptonote_basic.h"
+#include "cryptonote_core/blockchain.h"
+
+#include <fstream>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "blockchain_utilities.h"
+#include "bootstrap_serialization.h"
+
+using namespace cryptonote;
+
+// Bootstrap file, version 1. Blocks are grouped into optionally compressed
+// chunks and a height -> offset index is kept after the last chunk:
+//
+//   magic | header (file_info, chunk_format) | chunk... | chunk_index | footer
+//
+// Each chunk is a pair of 32 bit sizes (stored, uncompressed) followed by
+// the stored payload. The footer holds the offset and size of the index.
+// A file is written under a temporary name and renamed over the old one
+// when complete. Appending copies the old file's chunks, adds the new ones
+// and writes a new, complete index and footer after them.
+class BootstrapIndexedFile
+{
+  public:
+	BootstrapIndexedFile();
+
+	bool store_blockchain_raw(cryptonote::Blockchain *cs, boost::filesystem::path &output_file,
+							  uint64_t block_start, uint64_t block_stop, uint8_t compression, uint32_t blocks_per_chunk);
+	// as above, with blocks from get_block rather than a blockchain
+	bool store_blocks(const boost::filesystem::path &output_file, uint64_t block_start, uint64_t block_stop, uint8_t compression, uint32_t blocks_per_chunk,
+					  const std::function<bool(uint64_t height, bootstrap::block_package &bp)> &get_block);
+
+	static bool is_indexed_file(const std::string &import_file_path);
+	static bool compression_from_string(const std::string &name, uint8_t &compression);
+	static bool compression_supported(uint8_t compression);
+
+	// reading
+	bool open_reader(const std::string &import_file_path);
+	uint64_t first_height() const { return m_index.heights.empty() ? 0 : m_index.heights.front(); }
+	uint64_t block_count() const { return m_index.block_count; }
+
+	// position the reader at the chunk holding the given height, returns
+	// the height of the first block of that chunk
+	bool seek_to_height(uint64_t height, uint64_t &chunk_height);
+
+	// 0: chunk read, 1: no more chunks, 2: error
+	int read_chunk(std::string &stored, uint32_t &raw_size);
+
+	// thread safe
+	bool decode_chunk(const std::string &stored, uint32_t raw_size, std::vector<bootstrap::block_package> &blocks) const;
+
+  private:
+	bool read_header(std::ifstream &file);
+	bool read_index(std::ifstream &file, uint64_t &index_offset);
+	bool write_header();
+	bool flush_chunk();
+	bool write_index();
+
+	std::ifstream m_reader;
+	std::ofstream m_writer;
+
+	bootstrap::chunk_format m_format;
+	bootstrap::chunk_index m_index;
+	bootstrap::chunk m_chunk;		// chunk being written
+	uint64_t m_chunk_height;		// height of the first block in m_chunk
+	uint64_t m_index_offset;		// where the index starts, end of the last chunk
+	size_t m_next_chunk;			// index of the next chunk read_chunk returns
+};
@@ -71,5 +71,52 @@ struct block_package
 	VARINT_FIELD(coins_generated)
 	END_SERIALIZE()
 };
+
+// Indexed format (file_info::major_version 1)
+
+enum compression_type : uint8_t
+{
+	compression_none = 0,
+	compression_zstd = 1,
+	compression_lz4 = 2
+};
+
+// follows file_info in the header of an indexed file
+struct chunk_format
+{
+	uint8_t compression;
+	uint32_t blocks_per_chunk;
+
+	BEGIN_SERIALIZE_OBJECT()
+	FIELD(compression)
+	VARINT_FIELD(blocks_per_chunk)
+	END_SERIALIZE()
+};
+
+// uncompressed payload of one chunk
+struct chunk
+{
+	std::vector<block_package> blocks;
+
+	BEGIN_SERIALIZE_OBJECT()
+	FIELD(blocks)
+	END_SERIALIZE()
+};
+
+// written after the last chunk, located through the fixed size file footer
+struct chunk_index
+{
+	std::vector<uint64_t> heights; // height of the first block of each chunk
+	std::vector<uint64_t> offsets; // file offset of each chunk
+	uint64_t block_count;
+
+	BEGIN_SERIALIZE_OBJECT()
+	FIELD(heights)
+	FIELD(offsets)
+	VARINT_FIELD(block_count)
+	if(heights.size() != offsets.size())
+		return false;
+	END_SERIALIZE()
+};
 }
 }
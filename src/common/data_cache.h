@@ -0,0 +1,76 @@
+// Copyright (c) 2018, Ryo Currency Project
+// Portions copyright (c) 2014-2018, The Monero Project
+//
+// Portions of this file are available under BSD-3 license. Please see ORIGINAL-LICENSE for details
+// All rights reserved.
+//
+// ombre changes to this code are in public domain. Please note, other licences may apply to the file.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#pragma once
+
+#include <boost/thread/lock_guard.hpp>
+#include <boost/thread/mutex.hpp>
+#include <cstddef>
+#include <deque>
+#include <unordered_set>
+
+namespace tools
+{
+
+// Set of the last <MAX_SIZE> distinct values added to it. Once full, adding a value
+// evicts the oldest one, so it is meant for caching results that are cheap to
+// recompute on a miss, like "this signature was already checked".
+template <typename T, size_t MAX_SIZE>
+class data_cache
+{
+  public:
+	void add(const T &value)
+	{
+		boost::lock_guard<boost::mutex> lock(m_mutex);
+		if(!m_set.insert(value).second)
+			return;
+
+		m_queue.push_back(value);
+		if(m_queue.size() > MAX_SIZE)
+		{
+			m_set.erase(m_queue.front());
+			m_queue.pop_front();
+		}
+	}
+
+	bool has(const T &value) const
+	{
+		boost::lock_guard<boost::mutex> lock(m_mutex);
+		return m_set.count(value) != 0;
+	}
+
+	size_t size() const
+	{
+		boost::lock_guard<boost::mutex> lock(m_mutex);
+		return m_queue.size();
+	}
+
+	void clear()
+	{
+		boost::lock_guard<boost::mutex> lock(m_mutex);
+		m_set.clear();
+		m_queue.clear();
+	}
+
+  private:
+	mutable boost::mutex m_mutex;
+	std::unordered_set<T> m_set;
+	std::deque<T> m_queue;
+};
+}
@@ -0,0 +1,135 @@
+// Copyright (c) 2018, Ryo Currency Project
+// Portions copyright (c) 2014-2018, The Monero Project
+//
+// Portions of this file are available under BSD-3 license. Please see ORIGINAL-LICENSE for details
+// All rights reserved.
+//
+// ombre changes to this code are in public domain. Please note, other licences may apply to the file.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <set>
+
+namespace tools
+{
+
+// Median of the last <capacity> values of a sequence. The values are split between two
+// multisets, the lower half (plus the middle value when the count is odd) and the upper
+// half, so an update costs O(log n) and the median is read in O(1). The result matches
+// epee::misc_utils::median over the same values.
+//
+// push_back evicts the oldest value once the window is full, pop_back undoes the last
+// push_back, and push_front puts back a value that fell out of the window, so a caller
+// that removes values from the back can keep the window filled.
+template <typename T>
+class rolling_median
+{
+  public:
+	explicit rolling_median(size_t capacity) : m_capacity(capacity) {}
+
+	size_t capacity() const { return m_capacity; }
+	size_t size() const { return m_values.size(); }
+	bool empty() const { return m_values.empty(); }
+	bool full() const { return m_values.size() >= m_capacity; }
+	const T &front() const { return m_values.front(); }
+	const T &back() const { return m_values.back(); }
+
+	void clear()
+	{
+		m_values.clear();
+		m_low.clear();
+		m_high.clear();
+	}
+
+	void push_back(const T &v)
+	{
+		if(m_capacity == 0)
+			return;
+		if(full())
+		{
+			erase(m_values.front());
+			m_values.pop_front();
+		}
+		m_values.push_back(v);
+		insert(v);
+	}
+
+	void pop_back()
+	{
+		erase(m_values.back());
+		m_values.pop_back();
+	}
+
+	// ignored when the window is already full
+	void push_front(const T &v)
+	{
+		if(full())
+			return;
+		m_values.push_front(v);
+		insert(v);
+	}
+
+	T median() const
+	{
+		if(m_low.empty())
+			return T();
+		if(m_low.size() > m_high.size())
+			return *m_low.rbegin();
+		return (*m_low.rbegin() + *m_high.begin()) / 2;
+	}
+
+  private:
+	void insert(const T &v)
+	{
+		if(m_low.empty() || v <= *m_low.rbegin())
+			m_low.insert(v);
+		else
+			m_high.insert(v);
+		rebalance();
+	}
+
+	// every value in m_low is <= every value in m_high, so v is in m_low iff v <= max(m_low)
+	void erase(const T &v)
+	{
+		if(!m_low.empty() && v <= *m_low.rbegin())
+			m_low.erase(m_low.find(v));
+		else
+			m_high.erase(m_high.find(v));
+		rebalance();
+	}
+
+	void rebalance()
+	{
+		if(m_low.size() > m_high.size() + 1)
+		{
+			auto it = std::prev(m_low.end());
+			m_high.insert(*it);
+			m_low.erase(it);
+		}
+		else if(m_high.size() > m_low.size())
+		{
+			auto it = m_high.begin();
+			m_low.insert(*it);
+			m_high.erase(it);
+		}
+	}
+
+	size_t m_capacity;
+	std::deque<T> m_values; // in sequence order
+	std::multiset<T> m_low;
+	std::multiset<T> m_high;
+};
+}
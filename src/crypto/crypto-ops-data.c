@@ -22,6 +22,1600 @@
 
 #include "crypto-ops.h"
 
+#if CRYPTO_OPS_FE64
+
+/* sqrt(x) is such an integer y that 0 <= y <= p - 1, y % 2 = 0, and y^2 = x (mod p). */
+/* d = -121665 / 121666 */
+const fe fe_d = {0x34dca135978a3, 0x1a8283b156ebd, 0x5e7a26001c029, 0x739c663a03cbb, 0x52036cee2b6ff}; /* d */
+const fe fe_sqrtm1 = {0x61b274a0ea0b0, 0x0d5a5fc8f189d, 0x7ef5e9cbd0c60, 0x78595a6804c9e, 0x2b8324804fc1d}; /* sqrt(-1) */
+const fe fe_d2 = {0x69b9426b2f159, 0x35050762add7a, 0x3cf44c0038052, 0x6738cc7407977, 0x2406d9dc56dff}; /* 2 * d */
+
+/* base[i][j] = (j+1)*256^i*B */
+const ge_precomp ge_base[32][8] = {
+	{{{0x493c6f58c3b85, 0x0df7181c325f7, 0x0f50b0b3e4cb7, 0x5329385a44c32, 0x07cf9d3a33d4b},
+	  {0x03905d740913e, 0x0ba2817d673a2, 0x23e2827f4e67c, 0x133d2e0c21a34, 0x44fd2f9298f81},
+	  {0x11205877aaa68, 0x479955893d579, 0x50d66309b67a0, 0x2d42d0dbee5ee, 0x6f117b689f0c6}},
+	 {{0x4e7fc933c71d7, 0x2cf41feb6b244, 0x7581c0a7d1a76, 0x7172d534d32f0, 0x590c063fa87d2},
+	  {0x1a56042b4d5a8, 0x189cc159ed153, 0x5b8deaa3cae04, 0x2aaf04f11b5d8, 0x6bb595a669c92},
+	  {0x2a8b3a59b7a5f, 0x3abb359ef087f, 0x4f5a8c4db05af, 0x5b9a807d04205, 0x701af5b13ea50}},
+	 {{0x5b0a84cee9730, 0x61d10c97155e4, 0x4059cc8096a10, 0x47a608da8014f, 0x7a164e1b9a80f},
+	  {0x11fe8a4fcd265, 0x7bcb8374faacc, 0x52f5af4ef4d4f, 0x5314098f98d10, 0x2ab91587555bd},
+	  {0x6933f0dd0d889, 0x44386bb4c4295, 0x3cb6d3162508c, 0x26368b872a2c6, 0x5a2826af12b9b}},
+	 {{0x351b98efc099f, 0x68fbfa4a7050e, 0x42a49959d971b, 0x393e51a469efd, 0x680e910321e58},
+	  {0x6050a056818bf, 0x62acc1f5532bf, 0x28141ccc9fa25, 0x24d61f471e683, 0x27933f4c7445a},
+	  {0x3fbe9c476ff09, 0x0af6b982e4b42, 0x0ad1251ba78e5, 0x715aeedee7c88, 0x7f9d0cbf63553}},
+	 {{0x2bc4408a5bb33, 0x078ebdda05442, 0x2ffb112354123, 0x375ee8df5862d, 0x2945ccf146e20},
+	  {0x182c3a447d6ba, 0x22964e536eff2, 0x192821f540053, 0x2f9f19e788e5c, 0x154a7e73eb1b5},
+	  {0x3dbf1812a8285, 0x0fa17ba3f9797, 0x6f69cb49c3820, 0x34d5a0db3858d, 0x43aabe696b3bb}},
+	 {{0x4eeeb77157131, 0x1201915f10741, 0x1669cda6c9c56, 0x45ec032db346d, 0x51e57bb6a2cc3},
+	  {0x006b67b7d8ca4, 0x084fa44e72933, 0x1154ee55d6f8a, 0x4425d842e7390, 0x38b64c41ae417},
+	  {0x4326702ea4b71, 0x06834376030b5, 0x0ef0512f9c380, 0x0f1a9f2512584, 0x10b8e91a9f0d6}},
+	 {{0x25cd0944ea3bf, 0x75673b81a4d63, 0x150b925d1c0d4, 0x13f38d9294114, 0x461bea69283c9},
+	  {0x72c9aaa3221b1, 0x267774474f74d, 0x064b0e9b28085, 0x3f04ef53b27c9, 0x1d6edd5d2e531},
+	  {0x36dc801b8b3a2, 0x0e0a7d4935e30, 0x1deb7cecc0d7d, 0x053a94e20dd2c, 0x7a9fbb1c6a0f9}},
+	 {{0x7596604dd3e8f, 0x6fc510e058b36, 0x3670c8db2cc0d, 0x297d899ce332f, 0x0915e76061bce},
+	  {0x75dedf39234d9, 0x01c36ab1f3c54, 0x0f08fee58f5da, 0x0e19613a0d637, 0x3a9024a1320e0},
+	  {0x1f5d9c9a2911a, 0x7117994fafcf8, 0x2d8a8cae28dc5, 0x74ab1b2090c87, 0x26907c5c2ecc4}}},
+	{{{0x4dd0e632f9c1d, 0x2ced12622a5d9, 0x18de9614742da, 0x79ca96fdbb5d4, 0x6dd37d49a00ee},
+	  {0x3635449aa515e, 0x3e178d0475dab, 0x50b4712a19712, 0x2dcc2860ff4ad, 0x30d76d6f03d31},
+	  {0x444172106e4c7, 0x01251afed2d88, 0x534fc9bed4f5a, 0x5d85a39cf5234, 0x10c697112e864}},
+	 {{0x62aa08358c805, 0x46f440848e194, 0x447b771a8f52b, 0x377ba3269d31d, 0x03bf9baf55080},
+	  {0x3c4277dbe5fde, 0x5a335afd44c92, 0x0c1164099753e, 0x70487006fe423, 0x25e61cabed66f},
+	  {0x3e128cc586604, 0x5968b2e8fc7e2, 0x049a3d5bd61cf, 0x116505b1ef6e6, 0x566d78634586e}},
+	 {{0x54285c65a2fd0, 0x55e62ccf87420, 0x46bb961b19044, 0x1153405712039, 0x14fba5f34793b},
+	  {0x7a49f9cc10834, 0x2b513788a22c6, 0x5ff4b6ef2395b, 0x2ec8e5af607bf, 0x33975bca5ecc3},
+	  {0x746166985f7d4, 0x09939000ae79a, 0x5844c7964f97a, 0x13617e1f95b3d, 0x14829cea83fc5}},
+	 {{0x70b2f4e71ecb8, 0x728148efc643c, 0x0753e03995b76, 0x5bf5fb2ab6767, 0x05fc3bc4535d7},
+	  {0x37b8497dd95c2, 0x61549d6b4ffe8, 0x217a22db1d138, 0x0b9cf062eb09e, 0x2fd9c71e5f758},
+	  {0x0b3ae52afdedd, 0x19da76619e497, 0x6fa0654d2558e, 0x78219d25e41d4, 0x373767475c651}},
+	 {{0x095cb14246590, 0x002d82aa6ac68, 0x442f183bc4851, 0x6464f1c0a0644, 0x6bf5905730907},
+	  {0x299fd40d1add9, 0x5f2de9a04e5f7, 0x7c0eebacc1c59, 0x4cca1b1f8290a, 0x1fbea56c3b18f},
+	  {0x778f1e1415b8a, 0x6f75874efc1f4, 0x28a694019027f, 0x52b37a96bdc4d, 0x02521cf67a635}},
+	 {{0x46720772f5ee4, 0x632c0f359d622, 0x2b2092ba3e252, 0x662257c112680, 0x001753d9f7cd6},
+	  {0x7ee0b0a9d5294, 0x381fbeb4cca27, 0x7841f3a3e639d, 0x676ea30c3445f, 0x3fa00a7e71382},
+	  {0x1232d963ddb34, 0x35692e70b078d, 0x247ca14777a1f, 0x6db556be8fcd0, 0x12b5fe2fa048e}},
+	 {{0x37c26ad6f1e92, 0x46a0971227be5, 0x4722f0d2d9b4c, 0x3dc46204ee03a, 0x6f7e93c20796c},
+	  {0x0fbc496fce34d, 0x575be6b7dae3e, 0x4a31585cee609, 0x037e9023930ff, 0x749b76f96fb12},
+	  {0x2f604aea6ae05, 0x637dc939323eb, 0x3fdad9b048d47, 0x0a8b0d4045af7, 0x0fcec10f01e02}},
+	 {{0x2d29dc4244e45, 0x6927b1bc147be, 0x0308534ac0839, 0x4853664033f41, 0x413779166feab},
+	  {0x558a649fe1e44, 0x44635aeefcc89, 0x1ff434887f2ba, 0x0f981220e2d44, 0x4901aa7183c51},
+	  {0x1b7548c1af8f0, 0x7848c53368116, 0x01b64e7383de9, 0x109fbb0587c8f, 0x41bb887b726d1}}},
+	{{{0x34c597c6691ae, 0x7a150b6990fc4, 0x52beb9d922274, 0x70eed7164861a, 0x0a871e070c6a9},
+	  {0x07d44744346be, 0x282b6a564a81d, 0x4ed80f875236b, 0x6fbbe1d450c50, 0x4eb728c12fcdb},
+	  {0x1b5994bbc8989, 0x74b7ba84c0660, 0x75678f1cdaeb8, 0x23206b0d6f10c, 0x3ee7300f2685d}},
+	 {{0x27947841e7518, 0x32c7388dae87f, 0x414add3971be9, 0x01850832f0ef1, 0x7d47c6a2cfb89},
+	  {0x255e49e7dd6b7, 0x38c2163d59eba, 0x3861f2a005845, 0x2e11e4ccbaec9, 0x1381576297912},
+	  {0x2d0148ef0d6e0, 0x3522a8de787fb, 0x2ee055e74f9d2, 0x64038f6310813, 0x148cf58d34c9e}},
+	 {{0x72f7d9ae4756d, 0x7711e690ffc4a, 0x582a2355b0d16, 0x0dccfe885b6b4, 0x278febad4eaea},
+	  {0x492f67934f027, 0x7ded0815528d4, 0x58461511a6612, 0x5ea2e50de1544, 0x3ff2fa1ebd5db},
+	  {0x2681f8c933966, 0x3840521931635, 0x674f14a308652, 0x3bd9c88a94890, 0x4104dd02fe9c6}},
+	 {{0x14e06db096ab8, 0x1219c89e6b024, 0x278abd486a2db, 0x240b292609520, 0x0165b5a48efca},
+	  {0x2bf5e1124422a, 0x673146756ae56, 0x14ad99a87e830, 0x1eaca65b080fd, 0x2c863b00afaf5},
+	  {0x0a474a0846a76, 0x099a5ef981e32, 0x2a8ae3c4bbfe6, 0x45c34af14832c, 0x591b67d9bffec}},
+	 {{0x1b3719f18b55d, 0x754318c83d337, 0x27c17b7919797, 0x145b084089b61, 0x489b4f8670301},
+	  {0x70d1c80b49bfa, 0x3d57e7d914625, 0x3c0722165e545, 0x5e5b93819e04f, 0x3de02ec7ca8f7},
+	  {0x2102d3aeb92ef, 0x68c22d50c3a46, 0x42ea89385894e, 0x75f9ebf55f38c, 0x49f5fbba496cb}},
+	 {{0x5628c1e9c572e, 0x598b108e822ab, 0x55d8fae29361a, 0x0adc8d1a97b28, 0x06a1a6c288675},
+	  {0x49a108a5bcfd4, 0x6178c8e7d6612, 0x1f03473710375, 0x73a49614a6098, 0x5604a86dcbfa6},
+	  {0x0d1d47c1764b6, 0x01c08316a2e51, 0x2b3db45c95045, 0x1634f818d300c, 0x20989e89fe274}},
+	 {{0x4278b85eaec2e, 0x0ef59657be2ce, 0x72fd169588770, 0x2e9b205260b30, 0x730b9950f7059},
+	  {0x777fd3a2dcc7f, 0x594a9fb124932, 0x01f8e80ca15f0, 0x714d13cec3269, 0x0403ed1d0ca67},
+	  {0x32d35874ec552, 0x1f3048df1b929, 0x300d73b179b23, 0x6e67be5a37d0b, 0x5bd7454308303}},
+	 {{0x4932115e7792a, 0x457b9bbb930b8, 0x68f5d8b193226, 0x4164e8f1ed456, 0x5bb7db123067f},
+	  {0x2d19528b24cc2, 0x4ac66b8302ff3, 0x701c8d9fdad51, 0x6c1b35c5b3727, 0x133a78007380a},
+	  {0x1f467c6ca62be, 0x2c4232a5dc12c, 0x7551dc013b087, 0x0690c11b03bcd, 0x740dca6d58f0e}}},
+	{{{0x28c570478433c, 0x1d8502873a463, 0x7641e7eded49c, 0x1ecedd54cf571, 0x2c03f5256c2b0},
+	  {0x0ee0752cfce4e, 0x660dd8116fbe9, 0x55167130fffeb, 0x1c682b885955c, 0x161d25fa963ea},
+	  {0x718757b53a47d, 0x619e18b0f2f21, 0x5fbdfe4c1ec04, 0x5d798c81ebb92, 0x699468bdbd96b}},
+	 {{0x53de66aa91948, 0x045f81a599b1b, 0x3f7a8bd214193, 0x71d4da412331a, 0x293e1c4e6c4a2},
+	  {0x72f46f4dafecf, 0x2948ffadef7a3, 0x11ecdfdf3bc04, 0x3c2e98ffeed25, 0x525219a473905},
+	  {0x6134b925112e1, 0x6bb942bb406ed, 0x070c445c0dde2, 0x411d822c4d7a3, 0x5b605c447f032}},
+	 {{0x1fec6f0e7f04c, 0x3cebc692c477d, 0x077986a19a95e, 0x6eaaaa1778b0f, 0x2f12fef4cc5ab},
+	  {0x5805920c47c89, 0x1924771f9972c, 0x38bbddf9fc040, 0x1f7000092b281, 0x24a76dcea8aeb},
+	  {0x522b2dfc0c740, 0x7e8193480e148, 0x33fd9a04341b9, 0x3c863678a20bc, 0x5e607b2518a43}},
+	 {{0x4431ca596cf14, 0x015da7c801405, 0x03c9b6f8f10b5, 0x0346922934017, 0x201f33139e457},
+	  {0x31d8f6cdf1818, 0x1f86c4b144b16, 0x39875b8d73e9d, 0x2fbf0d9ffa7b3, 0x5067acab6ccdd},
+	  {0x27f6b08039d51, 0x4802f8000dfaa, 0x09692a062c525, 0x1baea91075817, 0x397cba8862460}},
+	 {{0x5c3fbc81379e7, 0x41bbc255e2f02, 0x6a3f756998650, 0x1297fd4e07c42, 0x771b4022c1e1c},
+	  {0x13093f05959b2, 0x1bd352f2ec618, 0x075789b88ea86, 0x61d1117ea48b9, 0x2339d320766e6},
+	  {0x5d986513a2fa7, 0x63f3a99e11b0f, 0x28a0ecfd6b26d, 0x53b6835e18d8f, 0x331a189219971}},
+	 {{0x12f3a9d7572af, 0x10d00e953c4ca, 0x603df116f2f8a, 0x33dc276e0e088, 0x1ac9619ff649a},
+	  {0x66f45fb4f80c6, 0x3cc38eeb9fea2, 0x107647270db1f, 0x710f1ea740dc8, 0x31167c6b83bdf},
+	  {0x33842524b1068, 0x77dd39d30fe45, 0x189432141a0d0, 0x088fe4eb8c225, 0x612436341f08b}},
+	 {{0x349e31a2d2638, 0x0137a7fa6b16c, 0x681ae92777edc, 0x222bfc5f8dc51, 0x1522aa3178d90},
+	  {0x541db874e898d, 0x62d80fb841b33, 0x03e6ef027fa97, 0x7a03c9e9633e8, 0x46ebe2309e5ef},
+	  {0x02f5369614938, 0x356e5ada20587, 0x11bc89f6bf902, 0x036746419c8db, 0x45fe70f505243}},
+	 {{0x24920c8951491, 0x107ec61944c5e, 0x72752e017c01f, 0x122b7dda2e97a, 0x16619f6db57a2},
+	  {0x075a6960c0b8c, 0x6dde1c5e41b49, 0x42e3f516da341, 0x16a03fda8e79e, 0x428d1623a0e39},
+	  {0x74a4401a308fd, 0x06ed4b9558109, 0x746f1f6a08867, 0x4636f5c6f2321, 0x1d81592d60bd3}}},
+	{{{0x5b69f7b85c5e8, 0x17a2d175650ec, 0x4cc3e6dbfc19e, 0x73e1d3873be0e, 0x3a5f6d51b0af8},
+	  {0x68756a60dac5f, 0x55d757b8aec26, 0x3383df45f80bd, 0x6783f8c9f96a6, 0x20234a7789ecd},
+	  {0x20db67178b252, 0x73aa3da2c0eda, 0x79045c01c70d3, 0x1b37b15251059, 0x7cd682353cffe}},
+	 {{0x5cd6068acf4f3, 0x3079afc7a74cc, 0x58097650b64b4, 0x47fabac9c4e99, 0x3ef0253b2b2cd},
+	  {0x1a45bd887fab6, 0x65748076dc17c, 0x5b98000aa11a8, 0x4a1ecc9080974, 0x2838c8863bdc0},
+	  {0x3b0cf4a465030, 0x022b8aef57a2d, 0x2ad0677e925ad, 0x4094167d7457a, 0x21dcb8a606a82}},
+	 {{0x500fabe7731ba, 0x7cc53c3113351, 0x7cf65fe080d81, 0x3c5d966011ba1, 0x5d840dbf6c6f6},
+	  {0x004468c9d9fc8, 0x5da8554796b8c, 0x3b8be70950025, 0x6d5892da6a609, 0x0bc3d08194a31},
+	  {0x6380d309fe18b, 0x4d73c2cb8ee0d, 0x6b882adbac0b6, 0x36eabdddd4cbe, 0x3a4276232ac19}},
+	 {{0x0c172db447ecb, 0x3f8c505b7a77f, 0x6a857f97f3f10, 0x4fcc0567fe03a, 0x0770c9e824e1a},
+	  {0x2432c8a7084fa, 0x47bf73ca8a968, 0x1639176262867, 0x5e8df4f8010ce, 0x1ff177cea16de},
+	  {0x1d99a45b5b5fd, 0x523674f2499ec, 0x0f8fa26182613, 0x58f7398048c98, 0x39f264fd41500}},
+	 {{0x34aabfe097be1, 0x43bfc03253a33, 0x29bc7fe91b7f3, 0x0a761e4844a16, 0x65c621272c35f},
+	  {0x53417dbe7e29c, 0x54573827394f5, 0x565eea6f650dd, 0x42050748dc749, 0x1712d73468889},
+	  {0x389f8ce3193dd, 0x2d424b8177ce5, 0x073fa0d3440cd, 0x139020cd49e97, 0x22f9800ab19ce}},
+	 {{0x29fdd9a6efdac, 0x7c694a9282840, 0x6f7cdeee44b3a, 0x55a3207b25cc3, 0x4171a4d38598c},
+	  {0x2368a3e9ef8cb, 0x454aa08e2ac0b, 0x490923f8fa700, 0x372aa9ea4582f, 0x13f416cd64762},
+	  {0x758aa99c94c8c, 0x5f6001700ff44, 0x7694e488c01bd, 0x0d5fde948eed6, 0x508214fa574bd}},
+	 {{0x215bb53d003d6, 0x1179e792ca8c3, 0x1a0e96ac840a2, 0x22393e2bb3ab6, 0x3a7758a4c86cb},
+	  {0x269153ed6fe4b, 0x72a23aef89840, 0x052be5299699c, 0x3a5e5ef132316, 0x22f960ec6faba},
+	  {0x111f693ae5076, 0x3e3bfaa94ca90, 0x445799476b887, 0x24a0912464879, 0x5d9fd15f8de7f}},
+	 {{0x44d2aeed7521e, 0x50865d2c2a7e4, 0x2705b5238ea40, 0x46c70b25d3b97, 0x3bc187fa47eb9},
+	  {0x408d36d63727f, 0x5faf8f6a66062, 0x2bb892da8de6b, 0x769d4f0c7e2e6, 0x332f35914f8fb},
+	  {0x70115ea86c20c, 0x16d88da24ada8, 0x1980622662adf, 0x501ebbc195a9d, 0x450d81ce906fb}}},
+	{{{0x4d8961cae743f, 0x6bdc38c7dba0e, 0x7d3b4a7e1b463, 0x0844bdee2adf3, 0x4cbad279663ab},
+	  {0x3b6a1a6205275, 0x2e82791d06dcf, 0x23d72caa93c87, 0x5f0b7ab68aaf4, 0x2de25d4ba6345},
+	  {0x19024a0d71fcd, 0x15f65115f101a, 0x4e99067149708, 0x119d8d1cba5af, 0x7d7fbcefe2007}},
+	 {{0x45dc5f3c29094, 0x3455220b579af, 0x070c1631e068a, 0x26bc0630e9b21, 0x4f9cd196dcd8d},
+	  {0x71e6a266b2801, 0x09aae73e2df5d, 0x40dd8b219b1a3, 0x546fb4517de0d, 0x5975435e87b75},
+	  {0x297d86a7b3768, 0x4835a2f4c6332, 0x070305f434160, 0x183dd014e56ae, 0x7ccdd084387a0}},
+	 {{0x484186760cc93, 0x7435665533361, 0x02f686336b801, 0x5225446f64331, 0x3593ca848190c},
+	  {0x6422c6d260417, 0x212904817bb94, 0x5a319deb854f5, 0x7a9d4e060da7d, 0x428bd0ed61d0c},
+	  {0x3189a5e849aa7, 0x6acbb1f59b242, 0x7f6ef4753630c, 0x1f346292a2da9, 0x27398308da2d6}},
+	 {{0x10e4c0a702453, 0x4daafa37bd734, 0x49f6bdc3e8961, 0x1feffdcecdae6, 0x572c2945492c3},
+	  {0x38d28435ed413, 0x4064f19992858, 0x7680fbef543cd, 0x1aadd83d58d3c, 0x269597aebe8c3},
+	  {0x7c745d6cd30be, 0x27c7755df78ef, 0x1776833937fa3, 0x5405116441855, 0x7f985498c05bc}},
+	 {{0x615520fbf6363, 0x0b9e9bf74da6a, 0x4fe8308201169, 0x173f76127de43, 0x30f2653cd69b1},
+	  {0x1ce889f0be117, 0x36f6a94510709, 0x7f248720016b4, 0x1821ed1e1cf91, 0x76c2ec470a31f},
+	  {0x0c938aac10c85, 0x41b64ed797141, 0x1beb1c1185e6d, 0x1ed5490600f07, 0x2f1273f159647}},
+	 {{0x08bd755a70bc0, 0x49e3a885ce609, 0x16585881b5ad6, 0x3c27568d34f5e, 0x38ac1997edc5f},
+	  {0x1fc7c8ae01e11, 0x2094d5573e8e7, 0x5ca3cbbf549d2, 0x4f920ecc54143, 0x5d9e572ad85b6},
+	  {0x6b517a751b13b, 0x0cfd370b180cc, 0x5377925d1f41a, 0x34e56566008a2, 0x22dfcd9cbfe9e}},
+	 {{0x459b4103be0a1, 0x59a4b3f2d2add, 0x7d734c8bb8eeb, 0x2393cbe594a09, 0x0fe9877824cde},
+	  {0x3d2e0c30d0cd9, 0x3f597686671bb, 0x0aa587eb63999, 0x0e3c7b592c619, 0x6b2916c05448c},
+	  {0x334d10aba913b, 0x045cdb581cfdb, 0x5e3e0553a8f36, 0x50bb3041effb2, 0x4c303f307ff00}},
+	 {{0x403580dd94500, 0x48df77d92653f, 0x38a9fe3b349ea, 0x0ea89850aafe1, 0x416b151ab706a},
+	  {0x23bd617b28c85, 0x6e72ee77d5a61, 0x1a972ff174dde, 0x3e2636373c60f, 0x0d61b8f78b2ab},
+	  {0x0d7efe9c136b0, 0x1ab1c89640ad5, 0x55f82aef41f97, 0x46957f317ed0d, 0x191a2af74277e}}},
+	{{{0x62b434f460efb, 0x294c6c0fad3fc, 0x68368937b4c0f, 0x5c9f82910875b, 0x237e7dbe00545},
+	  {0x6f74bc53c1431, 0x1c40e5dbbd9c2, 0x6c8fb9cae5c97, 0x4845c5ce1b7da, 0x7e2e0e450b5cc},
+	  {0x575ed6701b430, 0x4d3e17fa20026, 0x791fc888c4253, 0x2f1ba99078ac1, 0x71afa699b1115}},
+	 {{0x23c1c473b50d6, 0x3e7671de21d48, 0x326fa5547a1e8, 0x50e4dc25fafd9, 0x00731fbc78f89},
+	  {0x66f9b3953b61d, 0x555f4283cccb9, 0x7dd67fb1960e7, 0x14707a1affed4, 0x021142e9c2b1c},
+	  {0x0c71848f81880, 0x44bd9d8233c86, 0x6e8578efe5830, 0x4045b6d7041b5, 0x4c4d6f3347e15}},
+	 {{0x4ddfc988f1970, 0x4f6173ea365e1, 0x645daf9ae4588, 0x7d43763db623b, 0x38bf9500a88f9},
+	  {0x7eccfc17d1fc9, 0x4ca280782831e, 0x7b8337db1d7d6, 0x5116def3895fb, 0x193fddaaa7e47},
+	  {0x2c93c37e8876f, 0x3431a28c583fa, 0x49049da8bd879, 0x4b4a8407ac11c, 0x6a6fb99ebf0d4}},
+	 {{0x122b5b6e423c6, 0x21e50dff1ddd6, 0x73d76324e75c0, 0x588485495418e, 0x136fda9f42c5e},
+	  {0x6c1bb560855eb, 0x71f127e13ad48, 0x5c6b304905aec, 0x3756b8e889bc7, 0x75f76914a3189},
+	  {0x4dfb1a305bdd1, 0x3b3ff05811f29, 0x6ed62283cd92e, 0x65d1543ec52e1, 0x022183510be8d}},
+	 {{0x2710143307a7f, 0x3d88fb48bf3ab, 0x249eb4ec18f7a, 0x136115dff295f, 0x1387c441fd404},
+	  {0x766385ead2d14, 0x0194f8b06095e, 0x08478f6823b62, 0x6018689d37308, 0x6a071ce17b806},
+	  {0x3c3d187978af8, 0x7afe1c88276ba, 0x51df281c8ad68, 0x64906bda4245d, 0x3171b26aaf1ed}},
+	 {{0x5b7d8b28a47d1, 0x2c2ee149e34c1, 0x776f5629afc53, 0x1f4ea50fc49a9, 0x6c514a6334424},
+	  {0x7319097564ca8, 0x1844ebc233525, 0x21d4543fdeee1, 0x1ad27aaff1bd2, 0x221fd4873cf08},
+	  {0x2204f3a156341, 0x537414065a464, 0x43c0c3bedcf83, 0x5557e706ea620, 0x48daa596fb924}},
+	 {{0x61d5dc84c9793, 0x47de83040c29e, 0x189deb26507e7, 0x4d4e6fadc479a, 0x58c837fa0e8a7},
+	  {0x28e665ca59cc7, 0x165c715940dd9, 0x0785f3aa11c95, 0x57b98d7e38469, 0x676dd6fccad84},
+	  {0x1688596fc9058, 0x66f6ad403619f, 0x4d759a87772ef, 0x7856e6173bea4, 0x1c4f73f2c6a57}},
+	 {{0x6706efc7c3484, 0x6987839ec366d, 0x0731f95cf7f26, 0x3ae758ebce4bc, 0x70459adb7daf6},
+	  {0x24fbd305fa0bb, 0x40a98cc75a1cf, 0x78ce1220a7533, 0x6217a10e1c197, 0x795ac80d1bf64},
+	  {0x1db4991b42bb3, 0x469605b994372, 0x631e3715c9a58, 0x7e9cfefcf728f, 0x5fe162848ce21}}},
+	{{{0x1852d5d7cb208, 0x60d0fbe5ce50f, 0x5a1e246e37b75, 0x51aee05ffd590, 0x2b44c043677da},
+	  {0x1214fe194961a, 0x0e1ae39a9e9cb, 0x543c8b526f9f7, 0x119498067e91d, 0x4789d446fc917},
+	  {0x487ab074eb78e, 0x1d33b5e8ce343, 0x13e419feb1b46, 0x2721f565de6a4, 0x60c52eef2bb9a}},
+	 {{0x3c5c27cae6d11, 0x36a9491956e05, 0x124bac9131da6, 0x3b6f7de202b5d, 0x70d77248d9b66},
+	  {0x589bc3bfd8bf1, 0x6f93e6aa3416b, 0x4c0a3d6c1ae48, 0x55587260b586a, 0x10bc9c312ccfc},
+	  {0x2e84b3ec2a05b, 0x69da2f03c1551, 0x23a174661a67b, 0x209bca289f238, 0x63755bd3a976f}},
+	 {{0x7101897f1acb7, 0x3d82cb77b07b8, 0x684083d7769f5, 0x52b28472dce07, 0x2763751737c52},
+	  {0x7a03e2ad10853, 0x213dcc6ad36ab, 0x1a6e240d5bdd6, 0x7c24ffcf8fedf, 0x0d8cc1c48bc16},
+	  {0x402d36eb419a9, 0x7cef68c14a052, 0x0f1255bc2d139, 0x373e7d431186a, 0x70c2dd8a7ad16}},
+	 {{0x4967db8ed7e13, 0x15aeed02f523a, 0x6149591d094bc, 0x672f204c17006, 0x32b8613816a53},
+	  {0x194509f6fec0e, 0x528d8ca31acac, 0x7826d73b8b9fa, 0x24acb99e0f9b3, 0x2e0fac6363948},
+	  {0x7f7bee448cd64, 0x4e10f10da0f3c, 0x3936cb9ab20e9, 0x7a0fc4fea6cd0, 0x4179215c735a4}},
+	 {{0x633b9286bcd34, 0x6cab3badb9c95, 0x74e387edfbdfa, 0x14313c58a0fd9, 0x31fa85662241c},
+	  {0x094e7d7dced2a, 0x068fa738e118e, 0x41b640a5fee2b, 0x6bb709df019d4, 0x700344a30cd99},
+	  {0x26c422e3622f4, 0x0f3066a05b5f0, 0x4e2448f0480a6, 0x244cde0dbf095, 0x24bb2312a9952}},
+	 {{0x00c2af5f85c6b, 0x0609f4cf2883f, 0x6e86eb5a1ca13, 0x68b44a2efccd1, 0x0d1d2af9ffeb5},
+	  {0x0ed1732de67c3, 0x308c369291635, 0x33ef348f2d250, 0x004475ea1a1bb, 0x0fee3e871e188},
+	  {0x28aa132621edf, 0x42b244caf353b, 0x66b064cc2e08a, 0x6bb20020cbdd3, 0x16acd79718531}},
+	 {{0x1c6c57887b6ad, 0x5abf21fd7592b, 0x50bd41253867a, 0x3800b71273151, 0x164ed34b18161},
+	  {0x772af2d9b1d3d, 0x6d486448b4e5b, 0x2ce58dd8d18a8, 0x1849f67503c8b, 0x123e0ef6b9302},
+	  {0x6d94c192fe69a, 0x5475222a2690f, 0x693789d86b8b3, 0x1f5c3bdfb69dc, 0x78da0fc61073f}},
+	 {{0x780f1680c3a94, 0x2a35d3cfcd453, 0x005e5cdc7ddf8, 0x6ee888078ac24, 0x054aa4b316b38},
+	  {0x15d28e52bc66a, 0x30e1e0351cb7e, 0x30a2f74b11f8c, 0x39d120cd7de03, 0x2d25deeb256b1},
+	  {0x0468d19267cb8, 0x38cdca9b5fbf9, 0x1bbb05c2ca1e2, 0x3b015758e9533, 0x134610a6ab7da}}},
+	{{{0x265e777d1f515, 0x0f1f54c1e39a5, 0x2f01b95522646, 0x4fdd8db9dde6d, 0x654878cba97cc},
+	  {0x38ec78df6b0fe, 0x13caebea36a22, 0x5ebc6e54e5f6a, 0x32804903d0eb8, 0x2102fdba2b20d},
+	  {0x6e405055ce6a1, 0x5024a35a532d3, 0x1f69054daf29d, 0x15d1d0d7a8bd5, 0x0ad725db29ecb}},
+	 {{0x7bc0c9b056f85, 0x51cfebffaffd8, 0x44abbe94df549, 0x7ecbbd7e33121, 0x4f675f5302399},
+	  {0x267b1834e2457, 0x6ae19c378bb88, 0x7457b5ed9d512, 0x3280d783d05fb, 0x4aefcffb71a03},
+	  {0x536360415171e, 0x2313309077865, 0x251444334afbc, 0x2b0c3853756e8, 0x0bccbb72a2a86}},
+	 {{0x55e4c50fe1296, 0x05fdd13efc30d, 0x1c0c6c380e5ee, 0x3e11de3fb62a8, 0x6678fd69108f3},
+	  {0x6962feab1a9c8, 0x6aca28fb9a30b, 0x56db7ca1b9f98, 0x39f58497018dd, 0x4024f0ab59d6b},
+	  {0x6fa31636863c2, 0x10ae5a67e42b0, 0x27abbf01fda31, 0x380a7b9e64fbc, 0x2d42e2108ead4}},
+	 {{0x17b0d0f537593, 0x16263c0c9842e, 0x4ab827e4539a4, 0x6370ddb43d73a, 0x420bf3a79b423},
+	  {0x5131594dfd29b, 0x3a627e98d52fe, 0x1154041855661, 0x19175d09f8384, 0x676b2608b8d2d},
+	  {0x0ba651c5b2b47, 0x5862363701027, 0x0c4d6c219c6db, 0x0f03dff8658de, 0x745d2ffa9c0cf}},
+	 {{0x6df5721d34e6a, 0x4f32f767a0c06, 0x1d5abeac76e20, 0x41ce9e104e1e4, 0x06e15be54c1dc},
+	  {0x25a1e2bc9c8bd, 0x104c8f3b037ea, 0x405576fa96c98, 0x2e86a88e3876f, 0x1ae23ceb960cf},
+	  {0x25d871932994a, 0x6b9d63b560b6e, 0x2df2814c8d472, 0x0fbbee20aa4ed, 0x58ded861278ec}},
+	 {{0x35ba8b6c2c9a8, 0x1dea58b3185bf, 0x4b455cd23bbbe, 0x5ec19c04883f8, 0x08ba696b531d5},
+	  {0x73793f266c55c, 0x0b988a9c93b02, 0x09b0ea32325db, 0x37cae71c17c5e, 0x2ff39de85485f},
+	  {0x53eeec3efc57a, 0x2fa9fe9022efd, 0x699c72c138154, 0x72a751ebd1ff8, 0x120633b4947cf}},
+	 {{0x531474912100a, 0x5afcdf7c0d057, 0x7a9e71b788ded, 0x5ef708f3b0c88, 0x07433be3cb393},
+	  {0x4987891610042, 0x79d9d7f5d0172, 0x3c293013b9ec4, 0x0c2b85f39caca, 0x35d30a99b4d59},
+	  {0x144c05ce997f4, 0x4960b8a347fef, 0x1da11f15d74f7, 0x54fac19c0fead, 0x2d873ede7af6d}},
+	 {{0x202e14e5df981, 0x2ea02bc3eb54c, 0x38875b2883564, 0x1298c513ae9dd, 0x0543618a01600},
+	  {0x2316443373409, 0x5de95503b22af, 0x699201beae2df, 0x3db5849ff737a, 0x2e773654707fa},
+	  {0x2bdf4974c23c1, 0x4b3b9c8d261bd, 0x26ae8b2a9bc28, 0x3068210165c51, 0x4b1443362d079}}},
+	{{{0x454e91c529ccb, 0x24c98c6bf72cf, 0x0486594c3d89a, 0x7ae13a3d7fa3c, 0x17038418eaf66},
+	  {0x4b7c7b66e1f7a, 0x4bea185efd998, 0x4fabc711055f8, 0x1fb9f7836fe38, 0x582f446752da6},
+	  {0x17bd320324ce4, 0x51489117898c6, 0x1684d92a0410b, 0x6e4d90f78c5a7, 0x0c2a1c4bcda28}},
+	 {{0x4814869bd6945, 0x7b7c391a45db8, 0x57316ac35b641, 0x641e31de9096a, 0x5a6a9b30a314d},
+	  {0x5c7d06f1f0447, 0x7db70f80b3a49, 0x6cb4a3ec89a78, 0x43be8ad81397d, 0x7c558bd1c6f64},
+	  {0x41524d396463d, 0x1586b449e1a1d, 0x2f17e904aed8a, 0x7e1d2861d3c8e, 0x0404a5ca0afba}},
+	 {{0x49e1b2a416fd1, 0x51c6a0b316c57, 0x575a59ed71bdc, 0x74c021a1fec1e, 0x39527516e7f8e},
+	  {0x740070aa743d6, 0x16b64cbdd1183, 0x23f4b7b32eb43, 0x319aba58235b3, 0x46395bfdcadd9},
+	  {0x7db2d1a5d9a9c, 0x79a200b85422f, 0x355bfaa71dd16, 0x00b77ea5f78aa, 0x76579a29e822d}},
+	 {{0x4b51352b434f2, 0x1327bd01c2667, 0x434d73b60c8a1, 0x3e0daa89443ba, 0x02c514bb2a277},
+	  {0x68e7e49c02a17, 0x45795346fe8b6, 0x089306c8f3546, 0x6d89f6b2f88f6, 0x43a384dc9e05b},
+	  {0x3d5da8bf1b645, 0x7ded6a96a6d09, 0x6c3494fee2f4d, 0x02c989c8b6bd4, 0x1160920961548}},
+	 {{0x05616369b4dcd, 0x4ecab86ac6f47, 0x3c60085d700b2, 0x0213ee10dfcea, 0x2f637d7491e6e},
+	  {0x5166929dacfaa, 0x190826b31f689, 0x4f55567694a7d, 0x705f4f7b1e522, 0x351e125bc5698},
+	  {0x49b461af67bbe, 0x75915712c3a96, 0x69a67ef580c0d, 0x54d38ef70cffc, 0x7f182d06e7ce2}},
+	 {{0x54b728e217522, 0x69a90971b0128, 0x51a40f2a963a3, 0x10be9ac12a6bf, 0x44acc043241c5},
+	  {0x48e64ab0168ec, 0x2a2bdb8a86f4f, 0x7343b6b2d6929, 0x1d804aa8ce9a3, 0x67d4ac8c343e9},
+	  {0x56bbb4f7a5777, 0x29230627c238f, 0x5ad1a122cd7fb, 0x0dea56e50e364, 0x556d1c8312ad7}},
+	 {{0x06756b11be821, 0x462147e7bb03e, 0x26519743ebfe0, 0x782fc59682ab5, 0x097abe38cc8c7},
+	  {0x740e30c8d3982, 0x7c2b47f4682fd, 0x5cd91b8c7dc1c, 0x77fa790f9e583, 0x746c6c6d1d824},
+	  {0x1c9877ea52da4, 0x2b37b83a86189, 0x733af49310da5, 0x25e81161c04fb, 0x577e14a34bee8}},
+	 {{0x6cebebd4dd72b, 0x340c1e442329f, 0x32347ffd1a93f, 0x14a89252cbbe0, 0x705304b8fb009},
+	  {0x268ac61a73b0a, 0x206f234bebe1c, 0x5b403a7cbebe8, 0x7a160f09f4135, 0x60fa7ee96fd78},
+	  {0x51d354d296ec6, 0x7cbf5a63b16c7, 0x2f50bb3cf0c14, 0x1feb385cac65a, 0x21398e0ca1635}}},
+	{{{0x0aaf9b4b75601, 0x26b91b5ae44f3, 0x6de808d7ab1c8, 0x6a769675530b0, 0x1bbfb284e98f7},
+	  {0x5058a382b33f3, 0x175a91816913e, 0x4f6cdb96b8ae8, 0x17347c9da81d2, 0x5aa3ed9d95a23},
+	  {0x777e9c7d96561, 0x28e58f006ccac, 0x541bbbb2cac49, 0x3e63282994cec, 0x4a07e14e5e895}},
+	 {{0x358cdc477a49b, 0x3cc88fe02e481, 0x721aab7f4e36b, 0x0408cc9469953, 0x50af7aed84afa},
+	  {0x412cb980df999, 0x5e78dd8ee29dc, 0x171dff68c575d, 0x2015dd2f6ef49, 0x3f0bac391d313},
+	  {0x7de0115f65be5, 0x4242c21364dc9, 0x6b75b64a66098, 0x0033c0102c085, 0x1921a316baebd}},
+	 {{0x2ad9ad9f3c18b, 0x5ec1638339aeb, 0x5703b6559a83b, 0x3fa9f4d05d612, 0x7b049deca062c},
+	  {0x22f7edfb870fc, 0x569eed677b128, 0x30937dcb0a5af, 0x758039c78ea1b, 0x6458df41e273a},
+	  {0x3e37a35444483, 0x661fdb7d27b99, 0x317761dd621e4, 0x7323c30026189, 0x6093dccbc2950}},
+	 {{0x6eebe6084034b, 0x6cf01f70a8d7b, 0x0b41a54c6670a, 0x6c84b99bb55db, 0x6e3180c98b647},
+	  {0x39a8585e0706d, 0x3167ce72663fe, 0x63d14ecdb4297, 0x4be21dcf970b8, 0x57d1ea084827a},
+	  {0x2b6e7a128b071, 0x5b27511755dcf, 0x08584c2930565, 0x68c7bda6f4159, 0x363e999ddd97b}},
+	 {{0x048dce24baec6, 0x2b75795ec05e3, 0x3bfa4c5da6dc9, 0x1aac8659e371e, 0x231f979bc6f9b},
+	  {0x043c135ee1fc4, 0x2a11c9919f2d5, 0x6334cc25dbacd, 0x295da17b400da, 0x48ee9b78693a0},
+	  {0x1de4bcc2af3c6, 0x61fc411a3eb86, 0x53ed19ac12ec0, 0x209dbc6b804e0, 0x079bfa9b08792}},
+	 {{0x1ed80a2d54245, 0x70efec72a5e79, 0x42151d42a822d, 0x1b5ebb6d631e8, 0x1ef4fb1594706},
+	  {0x03a51da300df4, 0x467b52b561c72, 0x4d5920210e590, 0x0ca769e789685, 0x038c77f684817},
+	  {0x65ee65b167bec, 0x052da19b850a9, 0x0408665656429, 0x7ab39596f9a4c, 0x575ee92a4a0bf}},
+	 {{0x6bc450aa4d801, 0x4f4a6773b0ba8, 0x6241b0b0ebc48, 0x40d9c4f1d9315, 0x200a1e7e382f5},
+	  {0x080908a182fcf, 0x0532913b7ba98, 0x3dccf78c385c3, 0x68002dd5eaba9, 0x43d4e7112cd3f},
+	  {0x5b967eaf93ac5, 0x360acca580a31, 0x1c65fd5c6f262, 0x71c7f15c2ecab, 0x050eca52651e4}},
+	 {{0x4397660e668ea, 0x7c2a75692f2f5, 0x3b29e7e6c66ef, 0x72ba658bcda9a, 0x6151c09fa131a},
+	  {0x31ade453f0c9c, 0x3dfee07737868, 0x611ecf7a7d411, 0x2637e6cbd64f6, 0x4b0ee6c21c58f},
+	  {0x55c0dfdf05d96, 0x405569dcf475e, 0x05c5c277498bb, 0x18588d95dc389, 0x1fef24fa800f0}}},
+	{{{0x2aff530976b86, 0x0d85a48c0845a, 0x796eb963642e0, 0x60bee50c4b626, 0x28005fe6c8340},
+	  {0x653fb1aa73196, 0x607faec8306fa, 0x4e85ec83e5254, 0x09f56900584fd, 0x544d49292fc86},
+	  {0x7ba9f34528688, 0x284a20fb42d5d, 0x3652cd9706ffe, 0x6fd7baddde6b3, 0x72e472930f316}},
+	 {{0x3f635d32a7627, 0x0cbecacde00fe, 0x3411141eaa936, 0x21c1e42f3cb94, 0x1fee7f000fe06},
+	  {0x5208c9781084f, 0x16468a1dc24d2, 0x7bf780ac540a8, 0x1a67eced75301, 0x5a9d2e8c2733a},
+	  {0x305da03dbf7e5, 0x1228699b7aeca, 0x12a23b2936bc9, 0x2a1bda56ae6e9, 0x00f94051ee040}},
+	 {{0x793bb07af9753, 0x1e7b6ecd4fafd, 0x02c7b1560fb43, 0x2296734cc5fb7, 0x47b7ffd25dd40},
+	  {0x56b23c3d330b2, 0x37608e360d1a6, 0x10ae0f3c8722e, 0x086d9b618b637, 0x07d79c7e8beab},
+	  {0x3fb9cbc08dd12, 0x75c3dd85370ff, 0x47f06fe2819ac, 0x5db06ab9215ed, 0x1c3520a35ea64}},
+	 {{0x06f40216bc059, 0x3a2579b0fd9b5, 0x71c26407eec8c, 0x72ada4ab54f0b, 0x38750c3b66d12},
+	  {0x253a6bccba34a, 0x427070433701a, 0x20b8e58f9870e, 0x337c861db00cc, 0x1c3d05775d0ee},
+	  {0x6f1409422e51a, 0x7856bbece2d25, 0x13380a72f031c, 0x43e1080a7f3ba, 0x0621e2c7d3304}},
+	 {{0x61796b0dbf0f3, 0x73c2f9c32d6f5, 0x6aa8ed1537ebe, 0x74e92c91838f4, 0x5d8e589ca1002},
+	  {0x060cc8259838d, 0x038d3f35b95f3, 0x56078c243a923, 0x2de3293241bb2, 0x0007d6097bd3a},
+	  {0x71d950842a94b, 0x46b11e5c7d817, 0x5478bbecb4f0d, 0x7c3054b0a1c5d, 0x1583d7783c1cb}},
+	 {{0x34704cc9d28c7, 0x3dee598b1f200, 0x16e1c98746d9e, 0x4050b7095afdf, 0x4958064e83c55},
+	  {0x6a2ef5da27ae1, 0x28aace02e9d9d, 0x02459e965f0e8, 0x7b864d3150933, 0x252a5f2e81ed8},
+	  {0x094265066e80d, 0x0a60f918d61a5, 0x0444bf7f30fde, 0x1c40da9ed3c06, 0x079c170bd843b}},
+	 {{0x6cd50c0d5d056, 0x5b7606ae779ba, 0x70fbd226bdda1, 0x5661e53391ff9, 0x6768c0d7317b8},
+	  {0x6ece464fa6fff, 0x3cc40bca460a0, 0x6e3a90afb8d0c, 0x5801abca11228, 0x6dec05e34ac9f},
+	  {0x625e5f155c1b3, 0x4f32f6f723296, 0x5ac980105efce, 0x17a61165eee36, 0x51445e14ddcd5}},
+	 {{0x147ab2bbea455, 0x1f240f2253126, 0x0c3de9e314e89, 0x21ea5a4fca45f, 0x12e990086e4fd},
+	  {0x02b4b3b144951, 0x5688977966aea, 0x18e176e399ffd, 0x2e45c5eb4938b, 0x13186f31e3929},
+	  {0x496b37fdfbb2e, 0x3c2439d5f3e21, 0x16e60fe7e6a4d, 0x4d7ef889b621d, 0x77b2e3f05d3e9}}},
+	{{{0x0639c12ddb0a4, 0x6180490cd7ab3, 0x3f3918297467c, 0x74568be1781ac, 0x07a195152e095},
+	  {0x7a9c59c2ec4de, 0x7e9f09e79652d, 0x6a3e422f22d86, 0x2ae8e3b836c8b, 0x63b795fc7ad32},
+	  {0x68f02389e5fc8, 0x059f1bc877506, 0x504990e410cec, 0x09bd7d0feaee2, 0x3e8fe83d032f0}},
+	 {{0x04c8de8efd13c, 0x1c67c06e6210e, 0x183378f7f146a, 0x64352ceaed289, 0x22d60899a6258},
+	  {0x315b90570a294, 0x60ce108a925f1, 0x6eff61253c909, 0x003ef0e2d70b0, 0x75ba3b797fac4},
+	  {0x1dbc070cdd196, 0x16d8fb1534c47, 0x500498183fa2a, 0x72f59c423de75, 0x0904d07b87779}},
+	 {{0x22d6648f940b9, 0x197a5a1873e86, 0x207e4c41a54bc, 0x5360b3b4bd6d0, 0x6240aacebaf72},
+	  {0x61fd4ddba919c, 0x7d8e991b55699, 0x61b31473cc76c, 0x7039631e631d6, 0x43e2143fbc1dd},
+	  {0x4749c5ba295a0, 0x37946fa4b5f06, 0x724c5ab5a51f1, 0x65633789dd3f3, 0x56bdaf238db40}},
+	 {{0x0d36cc19d3bb2, 0x6ec4470d72262, 0x6853d7018a9ae, 0x3aa3e4dc2c8eb, 0x03aa31507e1e5},
+	  {0x2b9e3f53533eb, 0x2add727a806c5, 0x56955c8ce15a3, 0x18c4f070a290e, 0x1d24a86d83741},
+	  {0x47648ffd4ce1f, 0x60a9591839e9d, 0x424d5f38117ab, 0x42cc46912c10e, 0x43b261dc9aeb4}},
+	 {{0x13d8b6c951364, 0x4c0017e8f632a, 0x53e559e53f9c4, 0x4b20146886eea, 0x02b4d5e242940},
+	  {0x31e1988bb79bb, 0x7b82f46b3bcab, 0x0f7a8ce827b41, 0x5e15816177130, 0x326055cf5b276},
+	  {0x155cb28d18df2, 0x0c30d9ca11694, 0x2090e27ab3119, 0x208624e7a49b6, 0x27a6c809ae5d3}},
+	 {{0x4270ac43d6954, 0x2ed4cd95659a5, 0x75c0db37528f9, 0x2ccbcfd2c9234, 0x221503603d8c2},
+	  {0x6ebcd1f0db188, 0x74ceb4b7d1174, 0x7d56168df4f5c, 0x0bf79176fd18a, 0x2cb67174ff60a},
+	  {0x6cdf9390be1d0, 0x08e519c7e2b3d, 0x253c3d2a50881, 0x21b41448e333d, 0x7b1df4b73890f}},
+	 {{0x6221807f8f58c, 0x3fa92813a8be5, 0x6da98c38d5572, 0x01ed95554468f, 0x68698245d352e},
+	  {0x2f2e0b3b2a224, 0x0c56aa22c1c92, 0x5fdec39f1b278, 0x4c90af5c7f106, 0x61fcef2658fc5},
+	  {0x15d852a18187a, 0x270dbb59afb76, 0x7db120bcf92ab, 0x0e7a25d714087, 0x46cf4c473daf0}},
+	 {{0x46ea7f1498140, 0x70725690a8427, 0x0a73ae9f079fb, 0x2dd924461c62b, 0x1065aae50d8cc},
+	  {0x525ed9ec4e5f9, 0x022d20660684c, 0x7972b70397b68, 0x7a03958d3f965, 0x29387bcd14eb5},
+	  {0x44525df200d57, 0x2d7f94ce94385, 0x60d00c170ecb7, 0x38b0503f3d8f0, 0x69a198e64f1ce}}},
+	{{{0x14434dcc5caed, 0x2c7909f667c20, 0x61a839d1fb576, 0x4f23800cabb76, 0x25b2697bd267f},
+	  {0x2b2e0d91a78bc, 0x3990a12ccf20c, 0x141c2e11f2622, 0x0dfcefaa53320, 0x7369e6a92493a},
+	  {0x73ffb13986864, 0x3282bb8f713ac, 0x49ced78f297ef, 0x6697027661def, 0x1420683db54e4}},
+	 {{0x6bb6fc1cc5ad0, 0x532c8d591669d, 0x1af794da86c33, 0x0e0e9d86d24d3, 0x31e83b4161d08},
+	  {0x0bd1e249dd197, 0x00bcb1820568f, 0x2eab1718830d4, 0x396fd816997e6, 0x60b63bebf508a},
+	  {0x0c7129e062b4f, 0x1e526415b12fd, 0x461a0fd27923d, 0x18badf670a5b7, 0x55cf1eb62d550}},
+	 {{0x6b5e37df58c52, 0x3bcf33986c60e, 0x44fb8835ceae7, 0x099dec18e71a4, 0x1a56fbaa62ba0},
+	  {0x1101065c23d58, 0x5aa1290338b0f, 0x3157e9e2e7421, 0x0ea712017d489, 0x669a656457089},
+	  {0x66b505c9dc9ec, 0x774ef86e35287, 0x4d1d944c0955e, 0x52e4c39d72b20, 0x13c4836799c58}},
+	 {{0x4fb6a5d8bd080, 0x58ae34908589b, 0x3954d977baf13, 0x413ea597441dc, 0x50bdc87dc8e5b},
+	  {0x25d465ab3e1b9, 0x0f8fe27ec2847, 0x2d6e6dbf04f06, 0x3038cfc1b3276, 0x66f80c93a637b},
+	  {0x537836edfe111, 0x2be02357b2c0d, 0x6dcee58c8d4f8, 0x2d732581d6192, 0x1dd56444725fd}},
+	 {{0x7e60008bac89a, 0x23d5c387c1852, 0x79e5df1f533a8, 0x2e6f9f1c5f0cf, 0x3a3a450f63a30},
+	  {0x47ff83362127d, 0x08e39af82b1f4, 0x488322ef27dab, 0x1973738a2a1a4, 0x0e645912219f7},
+	  {0x72f31d8394627, 0x07bd294a200f1, 0x665be00e274c6, 0x43de8f1b6368b, 0x318c8d9393a9a}},
+	 {{0x69e29ab1dd398, 0x30685b3c76bac, 0x565cf37f24859, 0x57b2ac28efef9, 0x509a41c325950},
+	  {0x45d032afffe19, 0x12fe49b6cde4e, 0x21663bc327cf1, 0x18a5e4c69f1dd, 0x224c7c679a1d5},
+	  {0x06edca6f925e9, 0x68c8363e677b8, 0x60cfa25e4fbcf, 0x1c4c17609404e, 0x05bff02328a11}},
+	 {{0x1a0dd0dc512e4, 0x10894bf5fcd10, 0x52949013f9c37, 0x1f50fba4735c7, 0x576277cdee01a},
+	  {0x2137023cae00b, 0x15a3599eb26c6, 0x0687221512b3c, 0x253cb3a0824e9, 0x780b8cc3fa2a4},
+	  {0x38abc234f305f, 0x7a280bbc103de, 0x398a836695dfe, 0x3d0af41528a1a, 0x5ff418726271b}},
+	 {{0x347e813b69540, 0x76864c21c3cbb, 0x1e049dbcd74a8, 0x5b4d60f93749c, 0x29d4db8ca0a0c},
+	  {0x6080c1789db9d, 0x4be7cef1ea731, 0x2f40d769d8080, 0x35f7d4c44a603, 0x106a03dc25a96},
+	  {0x50aaf333353d0, 0x4b59a613cbb35, 0x223dfc0e19a76, 0x77d1e2bb2c564, 0x4ab38a51052cb}}},
+	{{{0x7d1ef5fddc09c, 0x7beeaebb9dad9, 0x058d30ba0acfb, 0x5cd92eab5ae90, 0x3041c6bb04ed2},
+	  {0x42b256768d593, 0x2e88459427b4f, 0x02b3876630701, 0x34878d405eae5, 0x29cdd1adc088a},
+	  {0x2f2f9d956e148, 0x6b3e6ad65c1fe, 0x5b00972b79e5d, 0x53d8d234c5daf, 0x104bbd6814049}},
+	 {{0x59a5fd67ff163, 0x3a998ead0352b, 0x083c95fa4af9a, 0x6fadbfc01266f, 0x204f2a20fb072},
+	  {0x0fd3168f1ed67, 0x1bb0de7784a3e, 0x34bcb78b20477, 0x0a4a26e2e2182, 0x5be8cc57092a7},
+	  {0x43b3d30ebb079, 0x357aca5c61902, 0x5b570c5d62455, 0x30fb29e1e18c7, 0x2570fb17c2791}},
+	 {{0x6a9550bb8245a, 0x511f20a1a2325, 0x29324d7239bee, 0x3343cc37516c4, 0x241c5f91de018},
+	  {0x2367f2cb61575, 0x6c39ac04d87df, 0x6d4958bd7e5bd, 0x566f4638a1532, 0x3dcb65ea53030},
+	  {0x0172940de6caa, 0x6045b2e67451b, 0x56c07463efcb3, 0x0728b6bfe6e91, 0x08420edd5fcdf}},
+	 {{0x0c34e04f410ce, 0x344edc0d0a06b, 0x6e45486d84d6d, 0x44e2ecb3863f5, 0x04d654f321db8},
+	  {0x720ab8362fa4a, 0x29c4347cdd9bf, 0x0e798ad5f8463, 0x4fef18bcb0bfe, 0x0d9a53efbc176},
+	  {0x5c116ddbdb5d5, 0x6d1b4bba5abcf, 0x4d28a48a5537a, 0x56b8e5b040b99, 0x4a7a4f2618991}},
+	 {{0x3b291af372a4b, 0x60e3028fe4498, 0x2267bca4f6a09, 0x719eec242b243, 0x4a96314223e0e},
+	  {0x718025fb15f95, 0x68d6b8371fe94, 0x3804448f7d97c, 0x42466fe784280, 0x11b50c4cddd31},
+	  {0x0274408a4ffd6, 0x7d382aedb34dd, 0x40acfc9ce385d, 0x628bb99a45b1e, 0x4f4bce4dce6bc}},
+	 {{0x2616ec49d0b6f, 0x1f95d8462e61c, 0x1ad3e9b9159c6, 0x79ba475a04df9, 0x3042cee561595},
+	  {0x7ce5ae2242584, 0x2d25eb153d4e3, 0x3a8f3d09ba9c9, 0x0f3690d04eb8e, 0x73fcdd14b71c0},
+	  {0x67079449bac41, 0x5b79c4621484f, 0x61069f2156b8d, 0x0eb26573b10af, 0x389e740c9a9ce}},
+	 {{0x578f6570eac28, 0x644f2339c3937, 0x66e47b7956c2c, 0x34832fe1f55d0, 0x25c425e5d6263},
+	  {0x4b3ae34dcb9ce, 0x47c691a15ac9f, 0x318e06e5d400c, 0x3c422d9f83eb1, 0x61545379465a6},
+	  {0x606a6f1d7de6e, 0x4f1c0c46107e7, 0x229b1dcfbe5d8, 0x3acc60a7b1327, 0x6539a08915484}},
+	 {{0x4dbd414bb4a19, 0x7930849f1dbb8, 0x329c5a466caf0, 0x6c824544feb9b, 0x0f65320ef019b},
+	  {0x21f74c3d2f773, 0x024b88d08bd3a, 0x6e678cf054151, 0x43631272e747c, 0x11c5e4aac5cd1},
+	  {0x6d1b1cafde0c6, 0x462c76a303a90, 0x3ca4e693cff9b, 0x3952cd45786fd, 0x4cabc7bdec330}}},
+	{{{0x7788f3f78d289, 0x5942809b3f811, 0x5973277f8c29c, 0x010f93bc5fe67, 0x7ee498165acb2},
+	  {0x69624089c0a2e, 0x0075fc8e70473, 0x13e84ab1d2313, 0x2c10bedf6953b, 0x639b93f0321c8},
+	  {0x508e39111a1c3, 0x290120e912f7a, 0x1cbf464acae43, 0x15373e9576157, 0x0edf493c85b60}},
+	 {{0x7c4d284764113, 0x7fefebf06acec, 0x39afb7a824100, 0x1b48e47e7fd65, 0x04c00c54d1dfa},
+	  {0x48158599b5a68, 0x1fd75bc41d5d9, 0x2d9fc1fa95d3c, 0x7da27f20eba11, 0x403b92e3019d4},
+	  {0x22f818b465cf8, 0x342901dff09b8, 0x31f595dc683cd, 0x37a57745fd682, 0x355bb12ab2617}},
+	 {{0x1dac75a8c7318, 0x3b679d5423460, 0x6b8fcb7b6400e, 0x6c73783be5f9d, 0x7518eaf8e052a},
+	  {0x664cc7493bbf4, 0x33d94761874e3, 0x0179e1796f613, 0x1890535e2867d, 0x0f9b8132182ec},
+	  {0x059c41b7f6c32, 0x79e8706531491, 0x6c747643cb582, 0x2e20c0ad494e4, 0x47c3871bbb175}},
+	 {{0x65d50c85066b0, 0x6167453361f7c, 0x06ba3818bb312, 0x6aff29baa7522, 0x08fea02ce8d48},
+	  {0x4539771ec4f48, 0x7b9318badca28, 0x70f19afe016c5, 0x4ee7bb1608d23, 0x00b89b8576469},
+	  {0x5dd7668deead0, 0x4096d0ba47049, 0x6275997219114, 0x29bda8a67e6ae, 0x473829a74f75d}},
+	 {{0x1533aad3902c9, 0x1dde06b11e47b, 0x784bed1930b77, 0x1c80a92b9c867, 0x6c668b4d44e4d},
+	  {0x2da754679c418, 0x3164c31be105a, 0x11fac2b98ef5f, 0x35a1aaf779256, 0x2078684c4833c},
+	  {0x0cf217a78820c, 0x65024e7d2e769, 0x23bb5efdda82a, 0x19fd4b632d3c6, 0x7411a6054f8a4}},
+	 {{0x2e53d18b175b4, 0x33e7254204af3, 0x3bcd7d5a1c4c5, 0x4c7c22af65d0f, 0x1ec9a872458c3},
+	  {0x59d32b99dc86d, 0x6ac075e22a9ac, 0x30b9220113371, 0x27fd9a638966e, 0x7c136574fb813},
+	  {0x6a4d400a2509b, 0x041791056971c, 0x655d5866e075c, 0x2302bf3e64df8, 0x3add88a5c7cd6}},
+	 {{0x298d459393046, 0x30bfecb3d90b8, 0x3d9b8ea3df8d6, 0x3900e96511579, 0x61ba1131a406a},
+	  {0x15770b635dcf2, 0x59ecd83f79571, 0x2db461c0b7fbd, 0x73a42a981345f, 0x249929fccc879},
+	  {0x0a0f116959029, 0x5974fd7b1347a, 0x1e0cc1c08edad, 0x673bdf8ad1f13, 0x5620310cbbd8e}},
+	 {{0x6b5f477e285d6, 0x4ed91ec326cc8, 0x6d6537503a3fd, 0x626d3763988d5, 0x7ec846f3658ce},
+	  {0x193434934d643, 0x0d4a2445eaa51, 0x7d0708ae76fe0, 0x39847b6c3c7e1, 0x37676a2a4d9d9},
+	  {0x68f3f1da22ec7, 0x6ed8039a2736b, 0x2627ee04c3c75, 0x6ea90a647e7d1, 0x6daaf723399b9}}},
+	{{{0x304bfacad8ea2, 0x502917d108b07, 0x043176ca6dd0f, 0x5d5158f2c1d84, 0x2b5449e58eb3b},
+	  {0x27562eb3dbe47, 0x291d7b4170be7, 0x5d1ca67dfa8e1, 0x2a88061f298a2, 0x1304e9e71627d},
+	  {0x014d26adc9cfe, 0x7f1691ba16f13, 0x5e71828f06eac, 0x349ed07f0fffc, 0x4468de2d7c2dd}},
+	 {{0x2d8c6f86307ce, 0x6286ba1850973, 0x5e9dcb08444d4, 0x1a96a543362b2, 0x5da6427e63247},
+	  {0x3355e9419469e, 0x1847bb8ea8a37, 0x1fe6588cf9b71, 0x6b1c9d2db6b22, 0x6cce7c6ffb44b},
+	  {0x4c688deac22ca, 0x6f775c3ff0352, 0x565603ee419bb, 0x6544456c61c46, 0x58f29abfe79f2}},
+	 {{0x264bf710ecdf6, 0x708c58527896b, 0x42ceae6c53394, 0x4381b21e82b6a, 0x6af93724185b4},
+	  {0x6cfab8de73e68, 0x3e6efced4bd21, 0x0056609500dbe, 0x71b7824ad85df, 0x577629c4a7f41},
+	  {0x0024509c6a888, 0x2696ab12e6644, 0x0cca27f4b80d8, 0x0c7c1f11b119e, 0x701f25bb0caec}},
+	 {{0x0f6d97cbec113, 0x4ce97fb7c93a3, 0x139835a11281b, 0x728907ada9156, 0x720a5bc050955},
+	  {0x0b0f8e4616ced, 0x1d3c4b50fb875, 0x2f29673dc0198, 0x5f4b0f1830ffa, 0x2e0c92bfbdc40},
+	  {0x709439b805a35, 0x6ec48557f8187, 0x08a4d1ba13a2c, 0x076348a0bf9ae, 0x0e9b9cbb144ef}},
+	 {{0x69bd55db1beee, 0x6e14e47f731bd, 0x1a35e47270eac, 0x66f225478df8e, 0x366d44191cfd3},
+	  {0x2d48ffb5720ad, 0x57b7f21a1df77, 0x5550effba0645, 0x5ec6a4098a931, 0x221104eb3f337},
+	  {0x41743f2bc8c14, 0x796b0ad8773c7, 0x29fee5cbb689b, 0x122665c178734, 0x4167a4e6bc593}},
+	 {{0x62665f8ce8fee, 0x29d101ac59857, 0x4d93bbba59ffc, 0x17b7897373f17, 0x34b33370cb7ed},
+	  {0x39d2876f62700, 0x001cecd1d6c87, 0x7f01a11747675, 0x2350da5a18190, 0x7938bb7e22552},
+	  {0x591ee8681d6cc, 0x39db0b4ea79b8, 0x202220f380842, 0x2f276ba42e0ac, 0x1176fc6e2dfe6}},
+	 {{0x0e28949770eb8, 0x5559e88147b72, 0x35e1e6e63ef30, 0x35b109aa7ff6f, 0x1f6a3e54f2690},
+	  {0x76cd05b9c619b, 0x69654b0901695, 0x7a53710b77f27, 0x79a1ea7d28175, 0x08fc3a4c677d5},
+	  {0x4c199d30734ea, 0x6c622cb9acc14, 0x5660a55030216, 0x068f1199f11fb, 0x4f2fad0116b90}},
+	 {{0x4d91db73bb638, 0x55f82538112c5, 0x6d85a279815de, 0x740b7b0cd9cf9, 0x3451995f2944e},
+	  {0x6b24194ae4e54, 0x2230afded8897, 0x23412617d5071, 0x3d5d30f35969b, 0x445484a4972ef},
+	  {0x2fcd09fea7d7c, 0x296126b9ed22a, 0x4a171012a05b2, 0x1db92c74d5523, 0x10b89ca604289}}},
+	{{{0x141be5a45f06e, 0x5adb38becaea7, 0x3fd46db41f2bb, 0x6d488bbb5ce39, 0x17d2d1d9ef0d4},
+	  {0x147499718289c, 0x0a48a67e4c7ab, 0x30fbc544bafe3, 0x0c701315fe58a, 0x20b878d577b75},
+	  {0x2af18073f3e6a, 0x33aea420d24fe, 0x298008bf4ff94, 0x3539171db961e, 0x72214f63cc65c}},
+	 {{0x5b7b9f43b29c9, 0x149ea31eea3b3, 0x4be7713581609, 0x2d87960395e98, 0x1f24ac855a154},
+	  {0x37f405307a693, 0x2e5e66cf2b69c, 0x5d84266ae9c53, 0x5e4eb7de853b9, 0x5fdf48c58171c},
+	  {0x608328e9505aa, 0x22182841dc49a, 0x3ec96891d2307, 0x2f363fff22e03, 0x00ba739e2ae39}},
+	 {{0x426f5ea88bb26, 0x33092e77f75c8, 0x1a53940d819e7, 0x1132e4f818613, 0x72297de7d518d},
+	  {0x698de5c8790d6, 0x268b8545beb25, 0x6d2648b96fedf, 0x47988ad1db07c, 0x03283a3e67ad7},
+	  {0x41dc7be0cb939, 0x1b16c66100904, 0x0a24c20cbc66d, 0x4a2e9efe48681, 0x05e1296846271}},
+	 {{0x7bbc8242c4550, 0x59a06103b35b7, 0x7237e4af32033, 0x726421ab3537a, 0x78cf25d38258c},
+	  {0x2eeb32d9c495a, 0x79e25772f9750, 0x6d747833bbf23, 0x6cdd816d5d749, 0x39c00c9c13698},
+	  {0x66b8e31489d68, 0x573857e10e2b5, 0x13be816aa1472, 0x41964d3ad4bf8, 0x006b52076b3ff}},
+	 {{0x37e16b9ce082d, 0x1882f57853eb9, 0x7d29eacd01fc5, 0x2e76a59b5e715, 0x7de2e9561a9f7},
+	  {0x0cfe19d95781c, 0x312cc621c453c, 0x145ace6da077c, 0x0912bef9ce9b8, 0x4d57e3443bc76},
+	  {0x0d4f4b6a55ecb, 0x7ebb0bb733bce, 0x7ba6a05200549, 0x4f6ede4e22069, 0x6b2a90af1a602}},
+	 {{0x3f3245bb2d80a, 0x0e5f720f36efd, 0x3b9cccf60c06d, 0x084e323f37926, 0x465812c8276c2},
+	  {0x3f4fc9ae61e97, 0x3bc07ebfa2d24, 0x3b744b55cd4a0, 0x72553b25721f3, 0x5fd8f4e9d12d3},
+	  {0x3beb22a1062d9, 0x6a7063b82c9a8, 0x0a5a35dc197ed, 0x3c80c06a53def, 0x05b32c2b1cb16}},
+	 {{0x4a42c7ad58195, 0x5c8667e799eff, 0x02e5e74c850a1, 0x3f0db614e869a, 0x31771a4856730},
+	  {0x05eccd24da8fd, 0x580bbfdf07918, 0x7e73586873c6a, 0x74ceddf77f93e, 0x3b5556a37b471},
+	  {0x0c524e14dd482, 0x283457496c656, 0x0ad6bcfb6cd45, 0x375d1e8b02414, 0x4fc079d27a733}},
+	 {{0x48b440c86c50d, 0x139929cca3b86, 0x0f8f2e44cdf2f, 0x68432117ba6b2, 0x241170c2bae3c},
+	  {0x138b089bf2f7f, 0x4a05bfd34ea39, 0x203914c925ef5, 0x7497fffe04e3c, 0x124567cecaf98},
+	  {0x1ab860ac473b4, 0x5c0227c86a7ff, 0x71b12bfc24477, 0x006a573a83075, 0x3f8612966c870}}},
+	{{{0x0fcfa36048d13, 0x66e7133bbb383, 0x64b42a8a45676, 0x4ea6e4f9a85cf, 0x26f57eee878a1},
+	  {0x20cc9782a0dde, 0x65d4e3070aab3, 0x7bc8e31547736, 0x09ebfb1432d98, 0x504aa77679736},
+	  {0x32cd55687efb1, 0x4448f5e2f6195, 0x568919d460345, 0x034c2e0ad1a27, 0x4041943d9dba3}},
+	 {{0x17743a26caadd, 0x48c9156f9c964, 0x7ef278d1e9ad0, 0x00ce58ea7bd01, 0x12d931429800d},
+	  {0x0eeba43ebcc96, 0x384dd5395f878, 0x1df331a35d272, 0x207ecfd4af70e, 0x1420a1d976843},
+	  {0x67799d337594f, 0x01647548f6018, 0x57fce5578f145, 0x009220c142a71, 0x1b4f92314359a}},
+	 {{0x73030a49866b1, 0x2442be90b2679, 0x77bd3d8947dcf, 0x1fb55c1552028, 0x5ff191d56f9a2},
+	  {0x4109d89150951, 0x225bd2d2d47cb, 0x57cc080e73bea, 0x6d71075721fcb, 0x239b572a7f132},
+	  {0x6d433ac2d9068, 0x72bf930a47033, 0x64facf4a20ead, 0x365f7a2b9402a, 0x020c526a758f3}},
+	 {{0x1ef59f042cc89, 0x3b1c24976dd26, 0x31d665cb16272, 0x28656e470c557, 0x452cfe0a5602c},
+	  {0x034f89ed8dbbc, 0x73b8f948d8ef3, 0x786c1d323caab, 0x43bd4a9266e51, 0x02aacc4615313},
+	  {0x0f7a0647877df, 0x4e1cc0f93f0d4, 0x7ec4726ef1190, 0x3bdd58bf512f8, 0x4cfb7d7b304b8}},
+	 {{0x699c29789ef12, 0x63beae321bc50, 0x325c340adbb35, 0x562e1a1e42bf6, 0x5b1d4cbc434d3},
+	  {0x43d6cb89b75fe, 0x3338d5b900e56, 0x38d327d531a53, 0x1b25c61d51b9f, 0x14b4622b39075},
+	  {0x32615cc0a9f26, 0x57711b99cb6df, 0x5a69c14e93c38, 0x6e88980a4c599, 0x2f98f71258592}},
+	 {{0x2ae444f54a701, 0x615397afbc5c2, 0x60d7783f3f8fb, 0x2aa675fc486ba, 0x1d8062e9e7614},
+	  {0x4a74cb50f9e56, 0x531d1c2640192, 0x0c03d9d6c7fd2, 0x57ccd156610c1, 0x3a6ae249d806a},
+	  {0x2da85a9907c5a, 0x6b23721ec4caf, 0x4d2d3a4683aa2, 0x7f9c6870efdef, 0x298b8ce8aef25}},
+	 {{0x272ea0a2165de, 0x68179ef3ed06f, 0x4e2b9c0feac1e, 0x3ee290b1b63bb, 0x6ba6271803a7d},
+	  {0x27953eff70cb2, 0x54f22ae0ec552, 0x29f3da92e2724, 0x242ca0c22bd18, 0x34b8a8404d5ce},
+	  {0x6ecb583693335, 0x3ec76bfdfb84d, 0x2c895cf56a04f, 0x6355149d54d52, 0x71d62bdd465e1}},
+	 {{0x5b5dab1f75ef5, 0x1e2d60cbeb9a5, 0x527c2175dfe57, 0x59e8a2b8ff51f, 0x1c333621262b2},
+	  {0x3cc28d378df80, 0x72141f4968ca6, 0x407696bdb6d0d, 0x5d271b22ffcfb, 0x74d5f317f3172},
+	  {0x7e55467d9ca81, 0x6a5653186f50d, 0x6b188ece62df1, 0x4c66d36844971, 0x4aebcc4547e9d}}},
+	{{{0x08d9e7354b610, 0x26b750b6dc168, 0x162881e01acc9, 0x7966df31d01a5, 0x173bd9ddc9a1d},
+	  {0x0071b276d01c9, 0x0b0d8918e025e, 0x75beea79ee2eb, 0x3c92984094db8, 0x5d88fbf95a3db},
+	  {0x00f1efe5872df, 0x5da872318256a, 0x59ceb81635960, 0x18cf37693c764, 0x06e1cd13b19ea}},
+	 {{0x3af629e5b0353, 0x204f1a088e8e5, 0x10efc9ceea82e, 0x589863c2fa34b, 0x7f3a6a1a8d837},
+	  {0x0ad516f166f23, 0x263f56d57c81a, 0x13422384638ca, 0x1331ff1af0a50, 0x3080603526e16},
+	  {0x644395d3d800b, 0x2b9203dbedefc, 0x4b18ce656a355, 0x03f3466bc182c, 0x30d0fded2e513}},
+	 {{0x4971e68b84750, 0x52ccc9779f396, 0x3e904ae8255c8, 0x4ecae46f39339, 0x4615084351c58},
+	  {0x14d1af21233b3, 0x1de1989b39c0b, 0x52669dc6f6f9e, 0x43434b28c3fc7, 0x0a9214202c099},
+	  {0x019c0aeb9a02e, 0x1a2c06995d792, 0x664cbb1571c44, 0x6ff0736fa80b2, 0x3bca0d2895ca5}},
+	 {{0x08eb69ecc01bf, 0x5b4c8912df38d, 0x5ea7f8bc2f20e, 0x120e516caafaf, 0x4ea8b4038df28},
+	  {0x031bc3c5d62a4, 0x7d9fe0f4c081e, 0x43ed51467f22c, 0x1e6cc0c1ed109, 0x5631deddae8f1},
+	  {0x5460af1cad202, 0x0b4919dd0655d, 0x7c4697d18c14c, 0x231c890bba2a4, 0x24ce0930542ca}},
+	 {{0x7a155fdf30b85, 0x1c6c6e5d487f9, 0x24be1134bdc5a, 0x1405970326f32, 0x549928a7324f4},
+	  {0x090f5fd06c106, 0x6abb1021e43fd, 0x232bcfad711a0, 0x3a5c13c047f37, 0x41d4e3c28a06d},
+	  {0x632a763ee1a2e, 0x6fa4bffbd5e4d, 0x5fd35a6ba4792, 0x7b55e1de99de8, 0x491b66dec0dcf}},
+	 {{0x04a8ed0da64a1, 0x5ecfc45096ebe, 0x5edee93b488b2, 0x5b3c11a51bc8f, 0x4cf6b8b0b7018},
+	  {0x5b13dc7ea32a7, 0x18fc2db73131e, 0x7e3651f8f57e3, 0x25656055fa965, 0x08f338d0c85ee},
+	  {0x3a821991a73bd, 0x03be6418f5870, 0x1ddc18eac9ef0, 0x54ce09e998dc2, 0x530d4a82eb078}},
+	 {{0x173456c9abf9e, 0x7892015100dad, 0x33ee14095fecb, 0x6ad95d67a0964, 0x0db3e7e00cbfb},
+	  {0x43630e1f94825, 0x4d1956a6b4009, 0x213fe2df8b5e0, 0x05ce3a41191e6, 0x65ea753f10177},
+	  {0x6fc3ee2096363, 0x7ec36b96d67ac, 0x510ec6a0758b1, 0x0ed87df022109, 0x02a4ec1921e1a}},
+	 {{0x06162f1cf795f, 0x324ddcafe5eb9, 0x018d5e0463218, 0x7e78b9092428e, 0x36d12b5dec067},
+	  {0x6259a3b24b8a2, 0x188b5f4170b9c, 0x681c0dee15deb, 0x4dfe665f37445, 0x3d143c5112780},
+	  {0x5279179154557, 0x39f8f0741424d, 0x45e6eb357923d, 0x42c9b5edb746f, 0x2ef517885ba82}}},
+	{{{0x6bffb305b2f51, 0x5b112b2d712dd, 0x35774974fe4e2, 0x04af87a96e3a3, 0x57968290bb3a0},
+	  {0x7974e8c58aedc, 0x7757e083488c6, 0x601c62ae7bc8b, 0x45370c2ecab74, 0x2f1b78fab143a},
+	  {0x2b8430a20e101, 0x1a49e1d88fee3, 0x38bbb47ce4d96, 0x1f0e7ba84d437, 0x7dc43e35dc2aa}},
+	 {{0x02a5c273e9718, 0x32bc9dfb28b4f, 0x48df4f8d5db1a, 0x54c87976c028f, 0x044fb81d82d50},
+	  {0x66665887dd9c3, 0x629760a6ab0b2, 0x481e6c7243e6c, 0x097e37046fc77, 0x7ef72016758cc},
+	  {0x718c5a907e3d9, 0x3b9c98c6b383b, 0x006ed255eccdc, 0x6976538229a59, 0x7f79823f9c30d}},
+	 {{0x41ff068f587ba, 0x1c00a191bcd53, 0x7b56f9c209e25, 0x3781e5fccaabe, 0x64a9b0431c06d},
+	  {0x4d239a3b513e8, 0x29723f51b1066, 0x642f4cf04d9c3, 0x4da095aa09b7a, 0x0a4e0373d784d},
+	  {0x3d6a15b7d2919, 0x41aa75046a5d6, 0x691751ec2d3da, 0x23638ab6721c4, 0x071a7d0ace183}},
+	 {{0x4355220e14431, 0x0e1362a283981, 0x2757cd8359654, 0x2e9cd7ab10d90, 0x7c69bcf761775},
+	  {0x72daac887ba0b, 0x0b7f4ac5dda60, 0x3bdda2c0498a4, 0x74e67aa180160, 0x2c3bcc7146ea7},
+	  {0x0d7eb04e8295f, 0x4a5ea1e6fa0fe, 0x45e635c436c60, 0x28ef4a8d4d18b, 0x6f5a9a7322aca}},
+	 {{0x1d4eba3d944be, 0x0100f15f3dce5, 0x61a700e367825, 0x5922292ab3d23, 0x02ab9680ee8d3},
+	  {0x1000c2f41c6c5, 0x0219fdf737174, 0x314727f127de7, 0x7e5277d23b81e, 0x494e21a2e147a},
+	  {0x48a85dde50d9a, 0x1c1f734493df4, 0x47bdb64866889, 0x59a7d048f8eec, 0x6b5d76cbea46b}},
+	 {{0x141171e782522, 0x6806d26da7c1f, 0x3f31d1bc79ab9, 0x09f20459f5168, 0x16fb869c03dd3},
+	  {0x7556cec0cd994, 0x5eb9a03b7510a, 0x50ad1dd91cb71, 0x1aa5780b48a47, 0x0ae333f685277},
+	  {0x6199733b60962, 0x69b157c266511, 0x64740f893f1ca, 0x03aa408fbf684, 0x3f81e38b8f70d}},
+	 {{0x37f355f17c824, 0x07ae85334815b, 0x7e3abddd2e48f, 0x61eeabe1f45e5, 0x0ad3e2d34cded},
+	  {0x10fcc7ed9affe, 0x4248cb0e96ff2, 0x4311c115172e2, 0x4c9d41cbf6925, 0x50510fc104f50},
+	  {0x40fc5336e249d, 0x3386639fb2de1, 0x7bbf871d17b78, 0x75f796b7e8004, 0x127c158bf0fa1}},
+	 {{0x28fc4ae51b974, 0x26e89bfd2dbd4, 0x4e122a07665cf, 0x7cab1203405c3, 0x4ed82479d167d},
+	  {0x17c422e9879a2, 0x28a5946c8fec3, 0x53ab32e912b77, 0x7b44da09fe0a5, 0x354ef87d07ef4},
+	  {0x3b52260c5d975, 0x79d6836171fdc, 0x7d994f140d4bb, 0x1b6c404561854, 0x302d92d205392}}},
+	{{{0x46fb6e4e0f177, 0x53497ad5265b7, 0x1ebdba01386fc, 0x0302f0cb36a3c, 0x0edc5f5eb426d},
+	  {0x3c1a2bca4283d, 0x23430c7bb2f02, 0x1a3ea1bb58bc2, 0x7265763de5c61, 0x10e5d3b76f1ca},
+	  {0x3bfd653da8e67, 0x584953ec82a8a, 0x55e288fa7707b, 0x5395fc3931d81, 0x45b46c51361cb}},
+	 {{0x54ddd8a7fe3e4, 0x2cecc41c619d3, 0x43a6562ac4d91, 0x4efa5aca7bdd9, 0x5c1c0aef32122},
+	  {0x02abf314f7fa1, 0x391d19e8a1528, 0x6a2fa13895fc7, 0x09d8eddeaa591, 0x2177bfa36dcb7},
+	  {0x01bbcfa79db8f, 0x3d84beb3666e1, 0x20c921d812204, 0x2dd843d3b32ce, 0x4ae619387d8ab}},
+	 {{0x17e44985bfb83, 0x54e32c626cc22, 0x096412ff38118, 0x6b241d61a246a, 0x75685abe5ba43},
+	  {0x3f6aa5344a32e, 0x69683680f11bb, 0x04c3581f623aa, 0x701af5875cba5, 0x1a00d91b17bf3},
+	  {0x60933eb61f2b2, 0x5193fe92a4dd2, 0x3d995a550f43e, 0x3556fb93a883d, 0x135529b623b0e}},
+	 {{0x716bce22e83fe, 0x33d0130b83eb8, 0x0952abad0afac, 0x309f64ed31b8a, 0x5972ea051590a},
+	  {0x0dbd7add1d518, 0x119f823e2231e, 0x451d66e5e7de2, 0x500c39970f838, 0x79b5b81a65ca3},
+	  {0x4ac20dc8f7811, 0x29589a9f501fa, 0x4d810d26a6b4a, 0x5ede00d96b259, 0x4f7e9c95905f3}},
+	 {{0x0443d355299fe, 0x39b7d7d5aee39, 0x692519a2f34ec, 0x6e4404924cf78, 0x1942eec4a144a},
+	  {0x74bbc5781302e, 0x73135bb81ec4c, 0x7ef671b61483c, 0x7264614ccd729, 0x31993ad92e638},
+	  {0x45319ae234992, 0x2219d47d24fb5, 0x4f04488b06cf6, 0x53aaa9e724a12, 0x2a0a65314ef9c}},
+	 {{0x61acd3c1c793a, 0x58b46b78779e6, 0x3369aacbe7af2, 0x509b0743074d4, 0x055dc39b6dea1},
+	  {0x7937ff7f927c2, 0x0c2fa14c6a5b6, 0x556bddb6dd07c, 0x6f6acc179d108, 0x4cf6e218647c2},
+	  {0x1227cc28d5bb6, 0x78ee9bff57623, 0x28cb2241f893a, 0x25b541e3c6772, 0x121a307710aa2}},
+	 {{0x1713ec77483c9, 0x6f70572d5facb, 0x25ef34e22ff81, 0x54d944f141188, 0x527bb94a6ced3},
+	  {0x35d5e9f034a97, 0x126069785bc9b, 0x5474ec7854ff0, 0x296a302a348ca, 0x333fc76c7a40e},
+	  {0x5992a995b482e, 0x78dc707002ac7, 0x5936394d01741, 0x4fba4281aef17, 0x6b89069b20a7a}},
+	 {{0x2fa8cb5c7db77, 0x718e6982aa810, 0x39e95f81a1a1b, 0x5e794f3646cfb, 0x0473d308a7639},
+	  {0x2a0416270220d, 0x75f248b69d025, 0x1cbbc16656a27, 0x5b9ffd6e26728, 0x23bc2103aa73e},
+	  {0x6792603589e05, 0x248db9892595d, 0x006a53cad2d08, 0x20d0150f7ba73, 0x102f73bfde043}}},
+	{{{0x4dae0b5511c9a, 0x5257fffe0d456, 0x54108d1eb2180, 0x096cc0f9baefa, 0x3f6bd725da4ea},
+	  {0x0b9ab7f5745c6, 0x5caf0f8d21d63, 0x7debea408ea2b, 0x09edb93896d16, 0x36597d25ea5c0},
+	  {0x58d7b106058ac, 0x3cdf8d20bee69, 0x00a4cb765015e, 0x36832337c7cc9, 0x7b7ecc19da60d}},
+	 {{0x64a51a77cfa9b, 0x29cf470ca0db5, 0x4b60b6e0898d9, 0x55d04ddffe6c7, 0x03bedc661bf5c},
+	  {0x2373c695c690d, 0x4c0c8520dcf18, 0x384af4b7494b9, 0x4ab4a8ea22225, 0x4235ad7601743},
+	  {0x0cb0d078975f5, 0x292313e530c4b, 0x38dbb9124a509, 0x350d0655a11f1, 0x0e7ce2b0cdf06}},
+	 {{0x6fedfd94b70f9, 0x2383f9745bfd4, 0x4beae27c4c301, 0x75aa4416a3f3f, 0x615256138aece},
+	  {0x4643ac48c85a3, 0x6878c2735b892, 0x3a53523f4d877, 0x3a504ed8bee9d, 0x666e0a5d8fb46},
+	  {0x3f64e4870cb0d, 0x61548b16d6557, 0x7a261773596f3, 0x7724d5f275d3a, 0x7f0bc810d514d}},
+	 {{0x49dad737213a0, 0x745dee5d31075, 0x7b1a55e7fdbe2, 0x5ba988f176ea1, 0x1d3a907ddec5a},
+	  {0x06ba426f4136f, 0x3cafc0606b720, 0x518f0a2359cda, 0x5fae5e46feca7, 0x0d1f8dbcf8eed},
+	  {0x693313ed081dc, 0x5b0a366901742, 0x40c872ca4ca7e, 0x6f18094009e01, 0x00011b44a31bf}},
+	 {{0x61f696a0aa75c, 0x38b0a57ad42ca, 0x1e59ab706fdc9, 0x01308d46ebfcd, 0x63d988a2d2851},
+	  {0x7a06c3fc66c0c, 0x1c9bac1ba47fb, 0x23935c575038e, 0x3f0bd71c59c13, 0x3ac48d916e835},
+	  {0x20753afbd232e, 0x71fbb1ed06002, 0x39cae47a4af3a, 0x0337c0b34d9c2, 0x33fad52b2368a}},
+	 {{0x4c8d0c422cfe8, 0x760b4275971a5, 0x3da95bc1cad3d, 0x0f151ff5b7376, 0x3cc355ccb90a7},
+	  {0x649c6c5e41e16, 0x60667eee6aa80, 0x4179d182be190, 0x653d9567e6979, 0x16c0f429a256d},
+	  {0x69443903e9131, 0x16f4ac6f9dd36, 0x2ea4912e29253, 0x2b4643e68d25d, 0x631eaf426bae7}},
+	 {{0x175b9a3700de8, 0x77c5f00aa48fb, 0x3917785ca0317, 0x05aa9b2c79399, 0x431f2c7f665f8},
+	  {0x10410da66fe9f, 0x24d82dcb4d67d, 0x3e6fe0e17752d, 0x4dade1ecbb08f, 0x5599648b1ea91},
+	  {0x26344858f7b19, 0x5f43d4a295ac0, 0x242a75c52acd4, 0x5934480220d10, 0x7b04715f91253}},
+	 {{0x6c280c4e6bac6, 0x3ada3b361766e, 0x42fe5125c3b4f, 0x111d84d4aac22, 0x48d0acfa57cde},
+	  {0x5bd28acf6ae43, 0x16fab8f56907d, 0x7acb11218d5f2, 0x41fe02023b4db, 0x59b37bf5c2f65},
+	  {0x726e47dabe671, 0x2ec45e746f6c1, 0x6580e53c74686, 0x5eda104673f74, 0x16234191336d3}}},
+	{{{0x19cd61ff38640, 0x060c6c4b41ba9, 0x75cf70ca7366f, 0x118a8f16c011e, 0x4a25707a203b9},
+	  {0x499def6267ff6, 0x76e858108773c, 0x693cac5ddcb29, 0x00311d00a9ff4, 0x2cdfdfecd5d05},
+	  {0x7668a53f6ed6a, 0x303ba2e142556, 0x3880584c10909, 0x4fe20000a261d, 0x5721896d248e4}},
+	 {{0x55091a1d0da4e, 0x4f6bfc7c1050b, 0x64e4ecd2ea9be, 0x07eb1f28bbe70, 0x03c935afc4b03},
+	  {0x65517fd181bae, 0x3e5772c76816d, 0x019189640898a, 0x1ed2a84de7499, 0x578edd74f63c1},
+	  {0x276c6492b0c3d, 0x09bfc40bf932e, 0x588e8f11f330b, 0x3d16e694dc26e, 0x3ec2ab590288c}},
+	 {{0x13a09ae32d1cb, 0x3e81eb85ab4e4, 0x07aaca43cae1f, 0x62f05d7526374, 0x0e1bf66c6adba},
+	  {0x0d27be4d87bb9, 0x56c27235db434, 0x72e6e0ea62d37, 0x5674cd06ee839, 0x2dd5c25a200fc},
+	  {0x3d5e9792c887e, 0x319724dabbc55, 0x2b97c78680800, 0x7afdfdd34e6dd, 0x730548b35ae88}},
+	 {{0x3094ba1d6e334, 0x6e126a7e3300b, 0x089c0aefcfbc5, 0x2eea11f836583, 0x585a2277d8784},
+	  {0x551a3cba8b8ee, 0x3b6422be2d886, 0x630e1419689bc, 0x4653b07a7a955, 0x3043443b411db},
+	  {0x25f8233d48962, 0x6bd8f04aff431, 0x4f907fd9a6312, 0x40fd3c737d29b, 0x7656278950ef9}},
+	 {{0x073a3ea86cf9d, 0x6e0e2abfb9c2e, 0x60e2a38ea33ee, 0x30b2429f3fe18, 0x28bbf484b613f},
+	  {0x3cf59d51fc8c0, 0x7a0a0d6de4718, 0x55c3a3e6fb74b, 0x353135f884fd5, 0x3f4160a8c1b84},
+	  {0x12f5c6f136c7c, 0x0fedba237de4c, 0x779bccebfab44, 0x3aea93f4d6909, 0x1e79cb358188f}},
+	 {{0x153d8f5e08181, 0x08533bbdb2efd, 0x1149796129431, 0x17a6e36168643, 0x478ab52d39d1f},
+	  {0x436c3eef7e3f1, 0x7ffd3c21f0026, 0x3e77bf20a2da9, 0x418bffc8472de, 0x65d7951b3a3b3},
+	  {0x6a4d39252d159, 0x790e35900ecd4, 0x30725bf977786, 0x10a5c1635a053, 0x16d87a411a212}},
+	 {{0x4d5e2d54e0583, 0x2e5d7b33f5f74, 0x3a5de3f887ebf, 0x6ef24bd6139b7, 0x1f990b577a5a6},
+	  {0x57e5a42066215, 0x1a18b44983677, 0x3e652de1e6f8f, 0x6532be02ed8eb, 0x28f87c8165f38},
+	  {0x44ead1be8f7d6, 0x5759d4f31f466, 0x0378149f47943, 0x69f3be32b4f29, 0x45882fe1534d6}},
+	 {{0x49929943c6fe4, 0x4347072545b15, 0x3226bced7e7c5, 0x03a134ced89df, 0x7dcf843ce405f},
+	  {0x1345d757983d6, 0x222f54234cccd, 0x1784a3d8adbb4, 0x36ebeee8c2bcc, 0x688fe5b8f626f},
+	  {0x0d6484a4732c0, 0x7b94ac6532d92, 0x5771b8754850f, 0x48dd9df1461c8, 0x6739687e73271}}},
+	{{{0x5cc9dc80c1ac0, 0x683671486d4cd, 0x76f5f1a5e8173, 0x6d5d3f5f9df4a, 0x7da0b8f68d7e7},
+	  {0x02014385675a6, 0x6155fb53d1def, 0x37ea32e89927c, 0x059a668f5a82e, 0x46115aba1d4dc},
+	  {0x71953c3b5da76, 0x6642233d37a81, 0x2c9658076b1bd, 0x5a581e63010ff, 0x5a5f887e83674}},
+	 {{0x628d3a0a643b9, 0x01cd8640c93d2, 0x0b7b0cad70f2c, 0x3864da98144be, 0x43e37ae2d5d1c},
+	  {0x301cf70a13d11, 0x2a6a1ba1891ec, 0x2f291fb3f3ae0, 0x21a7b814bea52, 0x3669b656e44d1},
+	  {0x63f06eda6e133, 0x233342758070f, 0x098e0459cc075, 0x4df5ead6c7c1b, 0x6a21e6cd4fd5e}},
+	 {{0x129126699b2e3, 0x0ee11a2603de8, 0x60ac2f5c74c21, 0x59b192a196808, 0x45371b07001e8},
+	  {0x6170a3046e65f, 0x5401a46a49e38, 0x20add5561c4a8, 0x7abb4edde9e46, 0x586bf9f1a195f},
+	  {0x3088d5ef8790b, 0x38c2126fcb4db, 0x685bae149e3c3, 0x0bcd601a4e930, 0x0eafb03790e52}},
+	 {{0x0805e0f75ae1d, 0x464cc59860a28, 0x248e5b7b00bef, 0x5d99675ef8f75, 0x44ae3344c5435},
+	  {0x555c13748042f, 0x4d041754232c0, 0x521b430866907, 0x3308e40fb9c39, 0x309acc675a02c},
+	  {0x289b9bba543ee, 0x3ab592e28539e, 0x64d82abcdd83a, 0x3c78ec172e327, 0x62d5221b7f946}},
+	 {{0x5d4263af77a3c, 0x23fdd2289aeb0, 0x7dc64f77eb9ec, 0x01bd28338402c, 0x14f29a5383922},
+	  {0x4299c18d0936d, 0x5914183418a49, 0x52a18c721aed5, 0x2b151ba82976d, 0x5c0efde4bc754},
+	  {0x17edc25b2d7f5, 0x37336a6081bee, 0x7b5318887e5c3, 0x49f6d491a5be1, 0x5e72365c7bee0}},
+	 {{0x339062f08b33e, 0x4bbf3e657cfb2, 0x67af7f56e5967, 0x4dbd67f9ed68f, 0x70b20555cb734},
+	  {0x3fc074571217f, 0x3a0d29b2b6aeb, 0x06478ccdde59d, 0x55e4d051bddfa, 0x77f1104c47b4e},
+	  {0x113c555112c4c, 0x7535103f9b7ca, 0x140ed1d9a2108, 0x02522333bc2af, 0x0e34398f4a064}},
+	 {{0x30b093e4b1928, 0x1ce7e7ec80312, 0x4e575bdf78f84, 0x61f7a190bed39, 0x6f8aded6ca379},
+	  {0x522d93ecebde8, 0x024f045e0f6cf, 0x16db63426cfa1, 0x1b93a1fd30fd8, 0x5e5405368a362},
+	  {0x0123dfdb7b29a, 0x4344356523c68, 0x79a527921ee5f, 0x74bfccb3e817e, 0x780de72ec8d3d}},
+	 {{0x7eaf300f42772, 0x5455188354ce3, 0x4dcca4a3dcbac, 0x3d314d0bfebcb, 0x1defc6ad32b58},
+	  {0x28545089ae7bc, 0x1e38fe9a0c15c, 0x12046e0e2377b, 0x6721c560aa885, 0x0eb28bf671928},
+	  {0x3be1aef5195a7, 0x6f22f62bdb5eb, 0x39768b8523049, 0x43394c8fbfdbd, 0x467d201bf8dd2}}},
+	{{{0x6f4bd567ae7a9, 0x65ac89317b783, 0x07d3b20fd8932, 0x000f208326916, 0x2ef9c5a5ba384},
+	  {0x6919a74ef4fad, 0x59ed4611452bf, 0x691ec04ea09ef, 0x3cbcb2700e984, 0x71c43c4f5ba3c},
+	  {0x56df6fa9e74cd, 0x79c95e4cf56df, 0x7be643bc609e2, 0x149c12ad9e878, 0x5a758ca390c5f}},
+	 {{0x0918b1d61dc94, 0x0d350260cd19c, 0x7a2ab4e37b4d9, 0x21fea735414d7, 0x0a738027f639d},
+	  {0x72710d9462495, 0x25aafaa007456, 0x2d21f28eaa31b, 0x17671ea005fd0, 0x2dbae244b3eb7},
+	  {0x74a2f57ffe1cc, 0x1bc3073087301, 0x7ec57f4019c34, 0x34e082e1fa524, 0x2698ca635126a}},
+	 {{0x5702f5e3dd90e, 0x31c9a4a70c5c7, 0x136a5aa78fc24, 0x1992f3b9f7b01, 0x3c004b0c4afa3},
+	  {0x5318832b0ba78, 0x6f24b9ff17cec, 0x0a47f30e060c7, 0x58384540dc8d0, 0x1fb43dcc49cae},
+	  {0x146ac06f4b82b, 0x4b500d89e7355, 0x3351e1c728a12, 0x10b9f69932fe3, 0x6b43fd01cd1fd}},
+	 {{0x742583e760ef3, 0x73dc1573216b8, 0x4ae48fdd7714a, 0x4f85f8a13e103, 0x73420b2d6ff0d},
+	  {0x75d4b4697c544, 0x11be1fff7f8f4, 0x119e16857f7e1, 0x38a14345cf5d5, 0x5a68d7105b52f},
+	  {0x4f6cb9e851e06, 0x278c4471895e5, 0x7efcdce3d64e4, 0x64f6d455c4b4c, 0x3db5632fea34b}},
+	 {{0x190b1829825d5, 0x0e7d3513225c9, 0x1c12be3b7abae, 0x58777781e9ca6, 0x59197ea495df2},
+	  {0x6ee2bf75dd9d8, 0x6c72ceb34be8d, 0x679c9cc345ec7, 0x7898df96898a4, 0x04321adf49d75},
+	  {0x16019e4e55aae, 0x74fc5f25d209c, 0x4566a939ded0d, 0x66063e716e0b7, 0x45eafdc1f4d70}},
+	 {{0x64624cfccb1ed, 0x257ab8072b6c1, 0x0120725676f0a, 0x4a018d04e8eee, 0x3f73ceea5d56d},
+	  {0x401858045d72b, 0x459e5e0ca2d30, 0x488b719308bea, 0x56f4a0d1b32b5, 0x5a5eebc80362d},
+	  {0x7bfd10a4e8dc6, 0x7c899366736f4, 0x55ebbeaf95c01, 0x46db060903f8a, 0x2605889126621}},
+	 {{0x18e3cc676e542, 0x26079d995a990, 0x04a7c217908b2, 0x1dc7603e6655a, 0x0dedfa10b2444},
+	  {0x704a68360ff04, 0x3cecc3cde8b3e, 0x21cd5470f64ff, 0x6abc18d953989, 0x54ad0c2e4e615},
+	  {0x367d5b82b522a, 0x0d3f4b83d7dc7, 0x3067f4cdbc58d, 0x20452da697937, 0x62ecb2baa77a9}},
+	 {{0x72836afb62874, 0x0af3c2094b240, 0x0c285297f357a, 0x7cc2d5680d6e3, 0x61913d5075663},
+	  {0x5795261152b3d, 0x7a1dbbafa3cbd, 0x5ad31c52588d5, 0x45f3a4164685c, 0x2e59f919a966d},
+	  {0x62d361a3231da, 0x65284004e01b8, 0x656533be91d60, 0x6ae016c00a89f, 0x3ddbc2a131c05}}},
+	{{{0x257a22796bb14, 0x6f360fb443e75, 0x680e47220eaea, 0x2fcf2a5f10c18, 0x5ee7fb38d8320},
+	  {0x40ff9ce5ec54b, 0x57185e261b35b, 0x3e254540e70a9, 0x1b5814003e3f8, 0x78968314ac04b},
+	  {0x5fdcb41446a8e, 0x5286926ff2a71, 0x0f231e296b3f6, 0x684a357c84693, 0x61d0633c9bca0}},
+	 {{0x328bcf8fc73df, 0x3b4de06ff95b4, 0x30aa427ba11a5, 0x5ee31bfda6d9c, 0x5b23ac2df8067},
+	  {0x44935ffdb2566, 0x12f016d176c6e, 0x4fbb00f16f5ae, 0x3fab78d99402a, 0x6e965fd847aed},
+	  {0x2b953ee80527b, 0x55f5bcdb1b35a, 0x43a0b3fa23c66, 0x76e07388b820a, 0x79b9bbb9dd95d}},
+	 {{0x17dae8e9f7374, 0x719f76102da33, 0x5117c2a80ca8b, 0x41a66b65d0936, 0x1ba811460accb},
+	  {0x355406a3126c2, 0x50d1918727d76, 0x6e5ea0b498e0e, 0x0a3b6063214f2, 0x5065f158c9fd2},
+	  {0x169fb0c429954, 0x59aedd9ecee10, 0x39916eb851802, 0x57917555cc538, 0x3981f39e58a4f}},
+	 {{0x5dfa56de66fde, 0x0058809075908, 0x6d3d8cb854a94, 0x5b2f4e970b1e3, 0x30f4452edcbc1},
+	  {0x38a7559230a93, 0x52c1cde8ba31f, 0x2a4f2d4745a3d, 0x07e9d42d4a28a, 0x38dc083705acd},
+	  {0x52782c5759740, 0x53f3397d990ad, 0x3a939c7e84d15, 0x234c4227e39e0, 0x632d9a1a593f2}},
+	 {{0x1fd11ed0c84a7, 0x021b3ed2757e1, 0x73e1de58fc1c6, 0x5d110c84616ab, 0x3a5a7df28af64},
+	  {0x36b15b807cba6, 0x3f78a9e1afed7, 0x0a59c2c608f1f, 0x52bdd8ecb81b7, 0x0b24f48847ed4},
+	  {0x2d4be511beac7, 0x6bda4d99e5b9b, 0x17e6996914e01, 0x7b1f0ce7fcf80, 0x34fcf74475481}},
+	 {{0x31dab78cfaa98, 0x4e3216e5e54b7, 0x249823973b689, 0x2584984e48885, 0x0119a3042fb37},
+	  {0x7e04c789767ca, 0x1671b28cfb832, 0x7e57ea2e1c537, 0x1fbaaef444141, 0x3d3bdc164dfa6},
+	  {0x2d89ce8c2177d, 0x6cd12ba182cf4, 0x20a8ac19a7697, 0x539fab2cc72d9, 0x56c088f1ede20}},
+	 {{0x35fac24f38f02, 0x7d75c6197ab03, 0x33e4bc2a42fa7, 0x1c7cd10b48145, 0x038b7ea483590},
+	  {0x53d1110a86e17, 0x6416eb65f466d, 0x41ca6235fce20, 0x5c3fc8a99bb12, 0x09674c6b99108},
+	  {0x6f82199316ff8, 0x05d54f1a9f3e9, 0x3bcc5d0bd274a, 0x5b284b8d2d5ad, 0x6e5e31025969e}},
+	 {{0x4fb0e63066222, 0x130f59747e660, 0x041868fecd41a, 0x3105e8c923bc6, 0x3058ad43d1838},
+	  {0x462f587e593fb, 0x3d94ba7ce362d, 0x330f9b52667b7, 0x5d45a48e0f00a, 0x08f5114789a8d},
+	  {0x40ffde57663d0, 0x71445d4c20647, 0x2653e68170f7c, 0x64cdee3c55ed6, 0x26549fa4efe3d}}},
+	{{{0x68549af3f666e, 0x09e2941d4bb68, 0x2e8311f5dff3c, 0x6429ef91ffbd2, 0x3a10dfe132ce3},
+	  {0x55a461e6bf9d6, 0x78eeef4b02e83, 0x1d34f648c16cf, 0x07fea2aba5132, 0x1926e1dc6401e},
+	  {0x74e8aea17cea0, 0x0c743f83fbc0f, 0x7cb03c4bf5455, 0x68a8ba9917e98, 0x1fa1d01d861e5}},
+	 {{0x4ac00d1df94ab, 0x3ba2101bd271b, 0x7578988b9c4af, 0x0f2bf89f49f7e, 0x73fced18ee9a0},
+	  {0x055947d599832, 0x346fe2aa41990, 0x0164c8079195b, 0x799ccfb7bba27, 0x773563bc6a75c},
+	  {0x1e90863139cb3, 0x4f8b407d9a0d6, 0x58e24ca924f69, 0x7a246bbe76456, 0x1f426b701b864}},
+	 {{0x635c891a12552, 0x26aebd38ede2f, 0x66dc8faddae05, 0x21c7d41a03786, 0x0b76bb1b3fa7e},
+	  {0x1264c41911c01, 0x702f44584bdf9, 0x43c511fc68ede, 0x0482c3aed35f9, 0x4e1af5271d31b},
+	  {0x0c1f97f92939b, 0x17a88956dc117, 0x6ee005ef99dc7, 0x4aa9172b231cc, 0x7b6dd61eb772a}},
+	 {{0x0abf9ab01d2c7, 0x3880287630ae6, 0x32eca045beddb, 0x57f43365f32d0, 0x53fa9b659bff6},
+	  {0x5c1e850f33d92, 0x1ec119ab9f6f5, 0x7f16f6de663e9, 0x7a7d6cb16dec6, 0x703e9bceaf1d2},
+	  {0x4c8e994885455, 0x4ccb5da9cad82, 0x3596bc610e975, 0x7a80c0ddb9f5e, 0x398d93e5c4c61}},
+	 {{0x77c60d2e7e3f2, 0x4061051763870, 0x67bc4e0ecd2aa, 0x2bb941f1373b9, 0x699c9c9002c30},
+	  {0x3d16733e248f3, 0x0e2b7e14be389, 0x42c0ddaf6784a, 0x589ea1fc67850, 0x53b09b5ddf191},
+	  {0x6a7235946f1cc, 0x6b99cbb2fbe60, 0x6d3a5d6485c62, 0x4839466e923c0, 0x51caf30c6fcdd}},
+	 {{0x2f99a18ac54c7, 0x398a39661ee6f, 0x384331e40cde3, 0x4cd15c4de19a6, 0x12ae29c189f8e},
+	  {0x3a7427674e00a, 0x6142f4f7e74c1, 0x4cc93318c3a15, 0x6d51bac2b1ee7, 0x5504aa292383f},
+	  {0x6c0cb1f0d01cf, 0x187469ef5d533, 0x27138883747bf, 0x2f52ae53a90e8, 0x5fd14fe958eba}},
+	 {{0x2fe5ebf93cb8e, 0x226da8acbe788, 0x10883a2fb7ea1, 0x094707842cf44, 0x7dd73f960725d},
+	  {0x42ddf2845ab2c, 0x6214ffd3276bb, 0x00b8d181a5246, 0x268a6d579eb20, 0x093ff26e58647},
+	  {0x524fe68059829, 0x65b75e47cb621, 0x15eb0a5d5cc19, 0x05209b3929d5a, 0x2f59bcbc86b47}},
+	 {{0x1d560b691c301, 0x7f5bafce3ce08, 0x4cd561614806c, 0x4588b6170b188, 0x2aa55e3d01082},
+	  {0x47d429917135f, 0x3eacfa07af070, 0x1deab46b46e44, 0x7a53f3ba46cdf, 0x5458b42e2e51a},
+	  {0x192e60c07444f, 0x5ae8843a21daa, 0x6d721910b1538, 0x3321a95a6417e, 0x13e9004a8a768}}},
+	{{{0x600c9193b877f, 0x21c1b8a0d7765, 0x379927fb38ea2, 0x70d7679dbe01b, 0x5f46040898de9},
+	  {0x58845832fcedb, 0x135cd7f0c6e73, 0x53ffbdfe8e35b, 0x22f195e06e55b, 0x73937e8814bce},
+	  {0x37116297bf48d, 0x45a9e0d069720, 0x25af71aa744ec, 0x41af0cb8aaba3, 0x2cf8a4e891d5e}},
+	 {{0x5487e17d06ba2, 0x3872a032d6596, 0x65e28c09348e0, 0x27b6bb2ce40c2, 0x7a6f7f2891d6a},
+	  {0x3fd8707110f67, 0x26f8716a92db2, 0x1cdaa1b753027, 0x504be58b52661, 0x2049bd6e58252},
+	  {0x1fd8d6a9aef49, 0x7cb67b7216fa1, 0x67aff53c3b982, 0x20ea610da9628, 0x6011aadfc5459}},
+	 {{0x6d0c802cbf890, 0x141bfed554c7b, 0x6dbb667ef4263, 0x58f3126857edc, 0x69ce18b779340},
+	  {0x7926dcf95f83c, 0x42e25120e2bec, 0x63de96df1fa15, 0x4f06b50f3f9cc, 0x6fc5cc1b0b62f},
+	  {0x75528b29879cb, 0x79a8fd2125a3d, 0x27c8d4b746ab8, 0x0f8893f02210c, 0x15596b3ae5710}},
+	 {{0x731167e5124ca, 0x17b38e8bbe13f, 0x3d55b942f9056, 0x09c1495be913f, 0x3aa4e241afb6d},
+	  {0x739d23f9179a2, 0x632fadbb9e8c4, 0x7c8522bfe0c48, 0x6ed0983ef5aa9, 0x0d2237687b5f4},
+	  {0x138bf2a3305f5, 0x1f45d24d86598, 0x5274bad2160fe, 0x1b6041d58d12a, 0x32fcaa6e4687a}},
+	 {{0x7a4732787ccdf, 0x11e427c7f0640, 0x03659385f8c64, 0x5f4ead9766bfb, 0x746f6336c2600},
+	  {0x56e8dc57d9af5, 0x5b3be17be4f78, 0x3bf928cf82f4b, 0x52e55600a6f11, 0x4627e9cefebd6},
+	  {0x2f345ab6c971c, 0x653286e63e7e9, 0x51061b78a23ad, 0x14999acb54501, 0x7b4917007ed66}},
+	 {{0x41b28dd53a2dd, 0x37be85f87ea86, 0x74be3d2a85e41, 0x1be87fac96ca6, 0x1d03620fe08cd},
+	  {0x5fb5cab84b064, 0x2513e778285b0, 0x457383125e043, 0x6bda3b56e223d, 0x122ba376f844f},
+	  {0x232cda2b4e554, 0x0422ba30ff840, 0x751e7667b43f5, 0x6261755da5f3e, 0x02c70bf52b68e}},
+	 {{0x532bf458d72e1, 0x40f96e796b59c, 0x22ef79d6f9da3, 0x501ab67beca77, 0x6b0697e3feb43},
+	  {0x7ec4b5d0b2fbb, 0x200e910595450, 0x742057105715e, 0x2f07022530f60, 0x26334f0a409ef},
+	  {0x0f04adf62a3c0, 0x5e0edb48bb6d9, 0x7c34aa4fbc003, 0x7d74e4e5cac24, 0x1cc37f43441b2}},
+	 {{0x656f1c9ceaeb9, 0x7031cacad5aec, 0x1308cd0716c57, 0x41c1373941942, 0x3a346f772f196},
+	  {0x7565a5cc7324f, 0x01ca0d5244a11, 0x116b067418713, 0x0a57d8c55edae, 0x6c6809c103803},
+	  {0x55112e2da6ac8, 0x6363d0a3dba5a, 0x319c98ba6f40c, 0x2e84b03a36ec7, 0x05911b9f6ef7c}}},
+	{{{0x1acf3512eeaef, 0x2639839692a69, 0x669a234830507, 0x68b920c0603d4, 0x555ef9d1c64b2},
+	  {0x39983f5df0ebb, 0x1ea2589959826, 0x6ce638703cdd6, 0x6311678898505, 0x6b3cecf9aa270},
+	  {0x770ba3b73bd08, 0x11475f7e186d4, 0x0251bc9892bbc, 0x24eab9bffcc5a, 0x675f4de133817}},
+	 {{0x7f6d93bdab31d, 0x1f3aca5bfd425, 0x2fa521c1c9760, 0x62180ce27f9cd, 0x60f450b882cd3},
+	  {0x452036b1782fc, 0x02d95b07681c5, 0x5901cf99205b2, 0x290686e5eecb4, 0x13d99df70164c},
+	  {0x35ec321e5c0ca, 0x13ae337f44029, 0x4008e813f2da7, 0x640272f8e0c3a, 0x1c06de9e55eda}},
+	 {{0x52b40ff6d69aa, 0x31b8809377ffa, 0x536625cd14c2c, 0x516af252e17d1, 0x78096f8e7d32b},
+	  {0x77ad6a33ec4e2, 0x717c5dc11d321, 0x4a114559823e4, 0x306ce50a1e2b1, 0x4cf38a1fec2db},
+	  {0x2aa650dfa5ce7, 0x54916a8f19415, 0x00dc96fe71278, 0x55f2784e63eb8, 0x373cad3a26091}},
+	 {{0x6a8fb89ddbbad, 0x78c35d5d97e37, 0x66e3674ef2cb2, 0x34347ac53dd8f, 0x21547eda5112a},
+	  {0x4634d82c9f57c, 0x4249268a6d652, 0x6336d687f2ff7, 0x4fe4f4e26d9a0, 0x0040f3d945441},
+	  {0x5e939fd5986d3, 0x12a2147019bdf, 0x4c466e7d09cb2, 0x6fa5b95d203dd, 0x63550a334a254}},
+	 {{0x2584572547b49, 0x75c58811c1377, 0x4d3c637cc171b, 0x33d30747d34e3, 0x39a92bafaa7d7},
+	  {0x7d6edb569cf37, 0x60194a5dc2ca0, 0x5af59745e10a6, 0x7a8f53e004875, 0x3eea62c7daf78},
+	  {0x4c713e693274e, 0x6ed1b7a6eb3a4, 0x62ace697d8e15, 0x266b8292ab075, 0x68436a0665c9c}},
+	 {{0x6d317e820107c, 0x090815d2ca3ca, 0x03ff1eb1499a1, 0x23960f050e319, 0x5373669c91611},
+	  {0x235e8202f3f27, 0x44c9f2eb61780, 0x630905b1d7003, 0x4fcc8d274ead1, 0x17b6e7f68ab78},
+	  {0x014ab9a0e5257, 0x09939567f8ba5, 0x4b47b2a423c82, 0x688d7e57ac42d, 0x1cb4b5a678f87}},
+	 {{0x4aa62a2a007e7, 0x61e0e38f62d6e, 0x02f888fcc4782, 0x7562b83f21c00, 0x2dc0fd2d82ef6},
+	  {0x4c06b394afc6c, 0x4931b4bf636cc, 0x72b60d0322378, 0x25127c6818b25, 0x330bca78de743},
+	  {0x6ff841119744e, 0x2c560e8e49305, 0x7254fefe5a57a, 0x67ae2c560a7df, 0x3c31be1b369f1}},
+	 {{0x0bc93f9cb4272, 0x3f8f9db73182d, 0x2b235eabae1c4, 0x2ddbf8729551a, 0x41cec1097e7d5},
+	  {0x4864d08948aee, 0x5d237438df61e, 0x2b285601f7067, 0x25dbcbae6d753, 0x330b61134262d},
+	  {0x619d7a26d808a, 0x3c3b3c2adbef2, 0x6877c9eec7f52, 0x3beb9ebe1b66d, 0x26b44cd91f287}}},
+	{{{0x7f29362730383, 0x7fd7951459c36, 0x7504c512d49e7, 0x087ed7e3bc55f, 0x7deb10149c726},
+	  {0x048478f387475, 0x69397d9678a3e, 0x67c8156c976f3, 0x2eb4d5589226c, 0x2c709e6c1c10a},
+	  {0x2af6a8766ee7a, 0x08aaa79a1d96c, 0x42f92d59b2fb0, 0x1752c40009c07, 0x08e68e9ff62ce}},
+	 {{0x509d50ab8f2f9, 0x1b8ab247be5e5, 0x5d9b2e6b2e486, 0x4faa5479a1339, 0x4cb13bd738f71},
+	  {0x5500a4bc130ad, 0x127a17a938695, 0x02a26fa34e36d, 0x584d12e1ecc28, 0x2f1f3f87eeba3},
+	  {0x48c75e515b64a, 0x75b6952071ef0, 0x5d46d42965406, 0x7746106989f9f, 0x19a1e353c0ae2}},
+	 {{0x172cdd596bdbd, 0x0731ddf881684, 0x10426d64f8115, 0x71a4fd8a9a3da, 0x736bd3990266a},
+	  {0x47560bafa05c3, 0x418dcabcc2fa3, 0x35991cecf8682, 0x24371a94b8c60, 0x41546b11c20c3},
+	  {0x32d509334b3b4, 0x16c102cae70aa, 0x1720dd51bf445, 0x5ae662faf9821, 0x412295a2b87fa}},
+	 {{0x55261e293eac6, 0x06426759b65cc, 0x40265ae116a48, 0x6c02304bae5bc, 0x0760bb8d195ad},
+	  {0x19b88f57ed6e9, 0x4cdbf1904a339, 0x42b49cd4e4f2c, 0x71a2e771909d9, 0x14e153ebb52d2},
+	  {0x61a17cde6818a, 0x53dad34108827, 0x32b32c55c55b6, 0x2f9165f9347a3, 0x6b34be9bc33ac}},
+	 {{0x469656571f2d3, 0x0aa61ce6f423f, 0x3f940d71b27a1, 0x185f19d73d16a, 0x01b9c7b62e6dd},
+	  {0x72f643a78c0b2, 0x3de45c04f9e7b, 0x706d68d30fa5c, 0x696f63e8e2f24, 0x2012c18f0922d},
+	  {0x355e55ac89d29, 0x3e8b414ec7101, 0x39db07c520c90, 0x6f41e9b77efe1, 0x08af5b784e4ba}},
+	 {{0x314d289cc2c4b, 0x23450e2f1bc4e, 0x0cd93392f92f4, 0x1370c6a946b7d, 0x6423c1d5afd98},
+	  {0x499dc881f2533, 0x34ef26476c506, 0x4d107d2741497, 0x346c4bd6efdb3, 0x32b79d71163a1},
+	  {0x5f8d9edfcb36a, 0x1e6e8dcbf3990, 0x7974f348af30a, 0x6e6724ef19c7c, 0x480a5efbc13e2}},
+	 {{0x14ce442ce221f, 0x18980a72516cc, 0x072f80db86677, 0x703331fda526e, 0x24b31d47691c8},
+	  {0x1e70b01622071, 0x1f163b5f8a16a, 0x56aaf341ad417, 0x7989635d830f7, 0x47aa27600cb7b},
+	  {0x41eedc015f8c3, 0x7cf8d27ef854a, 0x289e3584693f9, 0x04a7857b309a7, 0x545b585d14dda}},
+	 {{0x4e4d0e3b321e1, 0x7451fe3d2ac40, 0x666f678eea98d, 0x038858667fead, 0x4d22dc3e64c8d},
+	  {0x7275ea0d43a0f, 0x681137dd7ccf7, 0x1e79cbab79a38, 0x22a214489a66a, 0x0f62f9c332ba5},
+	  {0x46589d63b5f39, 0x7eaf979ec3f96, 0x4ebe81572b9a8, 0x21b7f5d61694a, 0x1c0fa01a36371}}},
+	{{{0x02b0e8c936a50, 0x6b83b58b6cd21, 0x37ed8d3e72680, 0x0a037db9f2a62, 0x4005419b1d2bc},
+	  {0x604b622943dff, 0x1c899f6741a58, 0x60219e2f232fb, 0x35fae92a7f9cb, 0x0fa3614f3b1ca},
+	  {0x3febdb9be82f0, 0x5e74895921400, 0x553ea38822706, 0x5a17c24cfc88c, 0x1fba218aef40a}},
+	 {{0x657043e7b0194, 0x5c11b55efe9e7, 0x7737bc6a074fb, 0x0eae41ce355cc, 0x6c535d13ff776},
+	  {0x49448fac8f53e, 0x34f74c6e8356a, 0x0ad780607dba2, 0x7213a7eb63eb6, 0x392e3acaa8c86},
+	  {0x534e93e8a35af, 0x08b10fd02c997, 0x26ac2acb81e05, 0x09d8c98ce3b79, 0x25e17fe4d50ac}},
+	 {{0x77ff576f121a7, 0x4e5f9b0fc722b, 0x46f949b0d28c8, 0x4cde65d17ef26, 0x6bba828f89698},
+	  {0x09bd71e04f676, 0x25ac841f2a145, 0x1a47eac823871, 0x1a8a8c36c581a, 0x255751442a9fb},
+	  {0x1bc6690fe3901, 0x314132f5abc5a, 0x611835132d528, 0x5f24b8eb48a57, 0x559d504f7f6b7}},
+	 {{0x091e7f6d266fd, 0x36060ef037389, 0x18788ec1d1286, 0x287441c478eb0, 0x123ea6a3354bd},
+	  {0x38378b3eb54d5, 0x4d4aaa78f94ee, 0x4a002e875a74d, 0x10b851367b17c, 0x01ab12d5807e3},
+	  {0x5189041e32d96, 0x05b062b090231, 0x0c91766e7b78f, 0x0aa0f55a138ec, 0x4a3961e2c918a}},
+	 {{0x7d644f3233f1e, 0x1c69f9e02c064, 0x36ae5e5266898, 0x08fc1dad38b79, 0x68aceead9bd41},
+	  {0x43be0f8e6bba0, 0x68fdffc614e3b, 0x4e91dab5b3be0, 0x3b1d4c9212ff0, 0x2cd6bce3fb1db},
+	  {0x4c90ef3d7c210, 0x496f5a0818716, 0x79cf88cc239b8, 0x2cb9c306cf8db, 0x595760d5b508f}},
+	 {{0x2cbebfd022790, 0x0b8822aec1105, 0x4d1cfd226bccc, 0x515b2fa4971be, 0x2cb2c5df54515},
+	  {0x1bfe104aa6397, 0x11494ff996c25, 0x64251623e5800, 0x0d49fc5e044be, 0x709fa43edcb29},
+	  {0x25d8c63fd2aca, 0x4c5cd29dffd61, 0x32ec0eb48af05, 0x18f9391f9b77c, 0x70f029ecf0c81}},
+	 {{0x2afaa5e10b0b9, 0x61de08355254d, 0x0eb587de3c28d, 0x4f0bb9f7dbbd5, 0x44eca5a2a74bd},
+	  {0x307b32eed3e33, 0x6748ab03ce8c2, 0x57c0d9ab810bc, 0x42c64a224e98c, 0x0b7d5d8a6c314},
+	  {0x448327b95d543, 0x0146681e3a4ba, 0x38714adc34e0c, 0x4f26f0e298e30, 0x272224512c7de}},
+	 {{0x3bb8a42a975fc, 0x6f2d5b46b17ef, 0x7b6a9223170e5, 0x053713fe3b7e6, 0x19735fd7f6bc2},
+	  {0x492af49c5342e, 0x2365cdf5a0357, 0x32138a7ffbb60, 0x2a1f7d14646fe, 0x11b5df18a44cc},
+	  {0x390d042c84266, 0x1efe32a8fdc75, 0x6925ee7ae1238, 0x4af9281d0e832, 0x0fef911191df8}}}};
+
+const ge_precomp ge_Bi[8] = {
+	{{0x493c6f58c3b85, 0x0df7181c325f7, 0x0f50b0b3e4cb7, 0x5329385a44c32, 0x07cf9d3a33d4b},
+	 {0x03905d740913e, 0x0ba2817d673a2, 0x23e2827f4e67c, 0x133d2e0c21a34, 0x44fd2f9298f81},
+	 {0x11205877aaa68, 0x479955893d579, 0x50d66309b67a0, 0x2d42d0dbee5ee, 0x6f117b689f0c6}},
+	{{0x5b0a84cee9730, 0x61d10c97155e4, 0x4059cc8096a10, 0x47a608da8014f, 0x7a164e1b9a80f},
+	 {0x11fe8a4fcd265, 0x7bcb8374faacc, 0x52f5af4ef4d4f, 0x5314098f98d10, 0x2ab91587555bd},
+	 {0x6933f0dd0d889, 0x44386bb4c4295, 0x3cb6d3162508c, 0x26368b872a2c6, 0x5a2826af12b9b}},
+	{{0x2bc4408a5bb33, 0x078ebdda05442, 0x2ffb112354123, 0x375ee8df5862d, 0x2945ccf146e20},
+	 {0x182c3a447d6ba, 0x22964e536eff2, 0x192821f540053, 0x2f9f19e788e5c, 0x154a7e73eb1b5},
+	 {0x3dbf1812a8285, 0x0fa17ba3f9797, 0x6f69cb49c3820, 0x34d5a0db3858d, 0x43aabe696b3bb}},
+	{{0x25cd0944ea3bf, 0x75673b81a4d63, 0x150b925d1c0d4, 0x13f38d9294114, 0x461bea69283c9},
+	 {0x72c9aaa3221b1, 0x267774474f74d, 0x064b0e9b28085, 0x3f04ef53b27c9, 0x1d6edd5d2e531},
+	 {0x36dc801b8b3a2, 0x0e0a7d4935e30, 0x1deb7cecc0d7d, 0x053a94e20dd2c, 0x7a9fbb1c6a0f9}},
+	{{0x6678aa6a8632f, 0x5ea3788d8b365, 0x21bd6d6994279, 0x7ace75919e4e3, 0x34b9ed338add7},
+	 {0x6217e039d8064, 0x6dea408337e6d, 0x57ac112628206, 0x647cb65e30473, 0x49c05a51fadc9},
+	 {0x4e8bf9045af1b, 0x514e33a45e0d6, 0x7533c5b8bfe0f, 0x583557b7e14c9, 0x73c172021b008}},
+	{{0x700848a802ade, 0x1e04605c4e5f7, 0x5c0d01b9767fb, 0x7d7889f42388b, 0x4275aae2546d8},
+	 {0x75b0249864348, 0x52ee11070262b, 0x237ae54fb5acd, 0x3bfd1d03aaab5, 0x18ab598029d5c},
+	 {0x32cc5fd6089e9, 0x426505c949b05, 0x46a18880c7ad2, 0x4a4221888ccda, 0x3dc65522b53df}},
+	{{0x0c222a2007f6d, 0x356b79bdb77ee, 0x41ee81efe12ce, 0x120a9bd07097d, 0x234fd7eec346f},
+	 {0x7013b327fbf93, 0x1336eeded6a0d, 0x2b565a2bbf3af, 0x253ce89591955, 0x0267882d17602},
+	 {0x0a119732ea378, 0x63bf1ba8e2a6c, 0x69f94cc90df9a, 0x431d1779bfc48, 0x497ba6fdaa097}},
+	{{0x6cc0313cfeaa0, 0x1a313848da499, 0x7cb534219230a, 0x39596dedefd60, 0x61e22917f12de},
+	 {0x3cd86468ccf0b, 0x48553221ac081, 0x6c9464b4e0a6e, 0x75fba84180403, 0x43b5cd4218d05},
+	 {0x2762f9bd0b516, 0x1c6e7fbddcbb3, 0x75909c3ace2bd, 0x42101972d3ec9, 0x511d61210ae4d}}};
+
+/* A = 2 * (1 - d) / (1 + d) = 486662 */
+const fe fe_ma2 = {0x7ffc8db3de3c9, 0x7ffffffffffff, 0x7ffffffffffff, 0x7ffffffffffff, 0x7ffffffffffff}; /* -A^2 */
+const fe fe_ma = {0x7fffffff892e7, 0x7ffffffffffff, 0x7ffffffffffff, 0x7ffffffffffff, 0x7ffffffffffff}; /* -A */
+const fe fe_fffb1 = {0x76975321c41ee, 0x517254e71a454, 0x7ec678f465012, 0x58b9054e29ba0, 0x7e71fbefdad61}; /* sqrt(-2 * A * (A + 2)) */
+const fe fe_fffb2 = {0x66483607c9ae0, 0x0c08adefbfa5b, 0x0597ef947780d, 0x67b48ea28dbe0, 0x4d061e0a045a2}; /* sqrt(2 * A * (A + 2)) */
+const fe fe_fffb3 = {0x37d8717302c66, 0x1d4b2c8452b03, 0x4368bb50093fd, 0x477dc4aa3201f, 0x674a110d14c20}; /* sqrt(-sqrt(-1) * A * (A + 2)) */
+const fe fe_fffb4 = {0x51903b6b39186, 0x11427e94930a7, 0x3dd0cbbb91bf0, 0x5fc93607a443f, 0x1a43f3031067d}; /* sqrt(sqrt(-1) * A * (A + 2)) */
+const ge_p3 ge_p3_identity = {{0}, {1, 0}, {1, 0}, {0}};
+
+const ge_p3 ge_p3_H = {
+  {0x46649386fd873, 0x1d0c4fddf4d0e, 0x73cddc5ab32b3, 0x65c2eab55bf7c, 0x6188ae4072004},
+  {0x137157059658b, 0x633fb9d4555f3, 0x545c9b3ab42b7, 0x39654e7aa20ea, 0x141f9cd30d3a1},
+  {0x0000000000001, 0x0000000000000, 0x0000000000000, 0x0000000000000, 0x0000000000000},
+  {0x6c8160965b85d, 0x6f6cb437a16a2, 0x47e1f8869205f, 0x0c82358720e9a, 0x6391430de06ee}
+};
+
+/* H[i][j] = (j+1)*256^i*H */
+const ge_precomp ge_H[32][8] = {
+	{{{0x59d5ea8c93dfe, 0x004c09b24a301, 0x482a77956756b, 0x1f28392ffe067, 0x75a84b137f3a6},
+	  {0x4d0cc37e98d05, 0x463369f6608e4, 0x608ebee001004, 0x53a263c54616d, 0x3296ee929b39c},
+	  {0x7a70c273cb425, 0x7799b3af016b0, 0x59b3e788bdfe2, 0x791b9bd24aed9, 0x3ebdd1e65026b}},
+	 {{0x23a82f8a510f1, 0x40e7042e3a39c, 0x3180c974bbb54, 0x161ef35744473, 0x42eb418df8d20},
+	  {0x32d461be4441a, 0x633d4906bcb5c, 0x5cb7f371f4453, 0x17bdb87593ea8, 0x62237b15cac48},
+	  {0x3de4bb77104e7, 0x3f2b90106d262, 0x5536022e9658f, 0x28d1f84c65d8d, 0x57e9fd1a168cd}},
+	 {{0x4b0ed08c064e1, 0x3c32861ab2923, 0x202b1f7084deb, 0x37fef61df964c, 0x213d971f521ed},
+	  {0x057e5400edc1c, 0x5b0a60c66186c, 0x529805a5e9a58, 0x22a03c0c168bf, 0x2ffe9d9c60079},
+	  {0x435f2d800dab5, 0x131185de19a5c, 0x654788db19ff0, 0x7c73d6be081d2, 0x4067ace16f0b5}},
+	 {{0x6664073b8a9a0, 0x3a2bd0ceb709c, 0x579a490b5199f, 0x7b0233bf10e5f, 0x79ba1eb474635},
+	  {0x4bcade5f4a471, 0x17afcafea61fc, 0x77a4844ed6dcd, 0x30d7d8bf3b2df, 0x41d51a47bcd86},
+	  {0x5d090c61bf52e, 0x35a28d6581d0e, 0x3083932a280a0, 0x793d7349c120a, 0x0dc5ffaaa9c82}},
+	 {{0x1c44956a21bbe, 0x4aff3d5722218, 0x4084fe6571339, 0x5dc4cf071de24, 0x51a9325f00774},
+	  {0x5384c92d0e9c6, 0x0d7028c4460f6, 0x0b60e4463ee2b, 0x0f43503ddaa1c, 0x6e5a20bf00323},
+	  {0x57aa6a773e94d, 0x4eb1d614a9a50, 0x0e2f78b2ffed1, 0x59f442672b0d4, 0x08e05352d6688}},
+	 {{0x552143a7ec37e, 0x0eef925a73d8e, 0x5432b8a27bb7c, 0x7382ea51e2be0, 0x4825eb70ea6ab},
+	  {0x042edf1185dc4, 0x738d5bef438ff, 0x3a52c4fbe3b57, 0x5d13459452def, 0x56fe12356c7fb},
+	  {0x61a3d59a8a228, 0x768f56998d506, 0x3ae39087bf8b4, 0x2f30889fbfb0a, 0x13691c64c4c08}},
+	 {{0x36e10e6748776, 0x73611dfab1219, 0x1e0ffe9a05dab, 0x6a744e9bad259, 0x17c115bebfba1},
+	  {0x2e20df28d336b, 0x5c04299d50927, 0x0bebe484e9186, 0x5e25c24efc9c9, 0x51df6faf7d798},
+	  {0x6e027c612b078, 0x62997080b2cff, 0x2a6734419e9b3, 0x4cda94a48e971, 0x75668e5d241b6}},
+	 {{0x7eeb8b74fd00a, 0x77244ddd4b20c, 0x29a5f8a9d9aae, 0x36abbb557a631, 0x6fdc9e1f91f7c},
+	  {0x0a3de702364e6, 0x6691240650c64, 0x78447caff2a73, 0x0a15629bba9be, 0x03b18bc5d656e},
+	  {0x6b8205a2a2c8b, 0x46e6d226621ba, 0x01e52d7b12d55, 0x52ada98cfb3d4, 0x0a9e88566783d}}},
+	{{{0x3397756433347, 0x730503ea04dda, 0x33271f4b2ba55, 0x3e79c7fd075e3, 0x3c2a7293acc59},
+	  {0x6867176cd8259, 0x197128ae76dc8, 0x7d4ca9fb372cb, 0x128104db6214c, 0x1368dffbf87e4},
+	  {0x41b7118f2e1da, 0x3218b55af4c60, 0x2fdc025294261, 0x1722115555def, 0x6a1a99f73911e}},
+	 {{0x21e9f2d4ac26b, 0x5294b697dfd1a, 0x60f4174bbb782, 0x76f18162eb0da, 0x47221587c9ff8},
+	  {0x55b927e0ad83f, 0x3889391764a47, 0x3905e7945326d, 0x2bec579c9b3bd, 0x13e5adb632d43},
+	  {0x0afe7c4739b06, 0x6a0aef24dc1c1, 0x69db83f52cf77, 0x152edd437ece4, 0x63ec0899cde09}},
+	 {{0x7cf557343f601, 0x232da7569f152, 0x27bcb9022aaab, 0x307532369a92f, 0x0d3007aa0f493},
+	  {0x43286d381a097, 0x06ef7553ff542, 0x4d8e01835f7bf, 0x16c8398632e3f, 0x39f7fe5ffbb34},
+	  {0x79197c5c9a347, 0x5a05a8d194d79, 0x5b81337ec3b9f, 0x3f1649feddba3, 0x5601ba273ce8a}},
+	 {{0x1a159e9ea6581, 0x59b72eb910659, 0x215c086b0d829, 0x7ea530c4c104b, 0x3080f894fa76a},
+	  {0x58edb41126e3a, 0x3d36e1f4b6f1a, 0x0298918099f75, 0x78453e11cbaf4, 0x5d05b79ec499b},
+	  {0x753c5950b9d73, 0x5f22fa350e8e4, 0x01ce7f1ece5c4, 0x31493ee2111c1, 0x36c6fa18f5982}},
+	 {{0x112780e58e1b6, 0x303d0e231dfcf, 0x70fd04ae59bce, 0x0c49a79a226b5, 0x4f3cbf89e4d84},
+	  {0x57c708bc178b8, 0x6f8ea0b79b3f8, 0x1454846344bce, 0x1890554020918, 0x3420edbd1143e},
+	  {0x25a36b50679ba, 0x7b7440f79d1b5, 0x66f3a5e64ee81, 0x052101cb8d956, 0x5f30b23a4e236}},
+	 {{0x35ab55521a0f0, 0x08506a72225d1, 0x1c5f81808bef6, 0x40aaaa4f374c6, 0x3e47646416d06},
+	  {0x37a46b8eaa4f7, 0x2006752de62a9, 0x4ce3a7c5cac6b, 0x26603e2cb474f, 0x28ec1814b498c},
+	  {0x789da220224ab, 0x1bb8ba5cb4382, 0x4a162550e0b35, 0x0a0cde6afec03, 0x3b17be7e3c69a}},
+	 {{0x1c6169f5dc802, 0x7236d577e6f31, 0x2e2304c6ee654, 0x06c70a0d66d32, 0x336557df96a1b},
+	  {0x2cd3564c092d2, 0x488dc96955865, 0x1b46ea6c31cd1, 0x757d3ba5f7397, 0x729c56d350876},
+	  {0x39983794665d2, 0x7af949dac7ecb, 0x293e18407ce8f, 0x2ba156b5db29f, 0x134182766cda1}},
+	 {{0x306f59be1c780, 0x197ed207f9de7, 0x18d082cf15d9a, 0x1f175dce89781, 0x36abadc05b023},
+	  {0x5de667b4c8e72, 0x636c50f62ac76, 0x267df783337bc, 0x24b445ea2fa14, 0x586feb5575fd8},
+	  {0x78f8dd2046511, 0x4adb9f092bc64, 0x4716041483baf, 0x63b2c82b86c36, 0x662a148c86831}}},
+	{{{0x4339ad0c30cae, 0x5f4b7b2b1f01c, 0x4323bc049c931, 0x352e1cc99b22a, 0x61f1f2e3e5b0f},
+	  {0x61121dda9e78c, 0x63caf8d1c8460, 0x7287c6bded69e, 0x75e02c7c0cf38, 0x5363a1cbc3cd2},
+	  {0x2bb336448d2f9, 0x412d6711af785, 0x06f21b6cd57cb, 0x0df4b42db6421, 0x109be9113b874}},
+	 {{0x427afbf16d70a, 0x12c9fc2e8b78e, 0x69daa14932a74, 0x23d8f41ac45ff, 0x7c2c392880bdd},
+	  {0x6755d358a8283, 0x642fa3bbc09e4, 0x1d8da7d856ea7, 0x73ab91235c140, 0x44bfe29a04a7d},
+	  {0x613b4f8258c01, 0x355d16a3e53c0, 0x1636635a5d2ba, 0x55087b8056fc5, 0x023ca739b8911}},
+	 {{0x3e3235435d433, 0x6452da0d22bdb, 0x7c62000e76606, 0x76598ab373322, 0x60e45c1aae121},
+	  {0x04b4fb7f0b588, 0x4d1a691ff44ed, 0x40adfaba21279, 0x6941e20604c75, 0x3ccc19b319f64},
+	  {0x03a1fe564584d, 0x628d8aaa0000b, 0x3c7cd24ea6db0, 0x2224214244c42, 0x6c16d65c8ecff}},
+	 {{0x3e0c4ce474cdd, 0x649b778bdc211, 0x0621de10bb55f, 0x340ecd4e64352, 0x1c34fb4cbef42},
+	  {0x0027348c2410f, 0x6d206ba4dacc0, 0x132526edb4afc, 0x53e8300b2cd91, 0x0c6cdb6ebc1b9},
+	  {0x71bb3c9a66064, 0x0cc4d79d43482, 0x4bfac1834e4a6, 0x6d44b3ec3d821, 0x43d012dd43c3e}},
+	 {{0x52f3e51f3fb47, 0x5c8ddc095f3d1, 0x59f79225fe2aa, 0x28a831ff1cc37, 0x165d776d48fe7},
+	  {0x3e735ca8acfbe, 0x0916ca832ad68, 0x05b0bee404c24, 0x218c3f64b5c6a, 0x5bb48a81b3639},
+	  {0x1715125c06a8f, 0x04b45445baa16, 0x0326b70b39269, 0x6bd375cf14308, 0x6dffb05e270e7}},
+	 {{0x36491a6c62db5, 0x385855ba70856, 0x684067bd75fc8, 0x0ad0f3bd3da97, 0x72c2a6512349e},
+	  {0x2b6ecfb9c2ab8, 0x33645d6770505, 0x575ba6214d9f3, 0x604b5b9864610, 0x418f17cdea6a1},
+	  {0x7dcbf3054e205, 0x05318dca2272b, 0x138589ab295cf, 0x18ff19b47f14b, 0x06cf69d3f2580}},
+	 {{0x30bb30aa679f1, 0x19a20597f5ad5, 0x5f4747594bbea, 0x36aebe86b1dde, 0x3231282616767},
+	  {0x1bf8c091c9faa, 0x7725d5f4f14b9, 0x768e1e770f4a7, 0x09e3ee5ac138a, 0x77cde4a9642c3},
+	  {0x7fcdc83d6091c, 0x38f44376cab2f, 0x6594270f70c03, 0x2fbabf4d0b409, 0x1a0893ff8d0d0}},
+	 {{0x3a23b1d0d26f8, 0x2b974ac8ab0b4, 0x5bfbb297f0c2b, 0x368502d54fc14, 0x10ecd6d03a876},
+	  {0x06c454927df58, 0x6923bb56c3b8f, 0x1bf8e71796094, 0x160c71ae5fc7c, 0x1ed577950cba8},
+	  {0x450dba3602c18, 0x24ca84fb1e716, 0x7a4e3ee751697, 0x4dc07eda8d03a, 0x06c5a205a912d}}},
+	{{{0x17212e50a0b31, 0x3ba0e93b45bbe, 0x2fc47d2914b82, 0x547d36fb0573a, 0x23f7c7d755739},
+	  {0x34f8ee3d3ab4a, 0x2d84579e9bc25, 0x5a1e3c8002e58, 0x1b22a74d3fb13, 0x3245fe5620db3},
+	  {0x4e2b8dda2e45a, 0x3070896bbea41, 0x03a53b0c06659, 0x3907b39486251, 0x495f92c06d911}},
+	 {{0x6fd1d4f052420, 0x08c4aa65124d8, 0x76c02e666e001, 0x490771cb955a0, 0x66dca92f6f35d},
+	  {0x2496ea7adc8fc, 0x3cdaf6c48ba85, 0x082018c3637d0, 0x5377209f1ed54, 0x6bf27ee246bf4},
+	  {0x48a0d0f56fd99, 0x11b2938f6cfd9, 0x5c0152c11b903, 0x6a2b0802c2642, 0x74b008ef5d830}},
+	 {{0x002b71131fc5f, 0x13cefb97af15b, 0x4c16e2ca2295e, 0x14431cf403b31, 0x709e0bf608ec2},
+	  {0x3b147560a4957, 0x11b0d2a200f39, 0x430d325953021, 0x6499fb4070f72, 0x30e93ffe85a36},
+	  {0x4d12cee6ccf7d, 0x7a0a27fe2629d, 0x2d3b90391a73b, 0x21ec9995cc561, 0x2fc3d2c16e244}},
+	 {{0x6ff4d27652b7e, 0x59cf9f8008f0b, 0x5a96b932fdff2, 0x55050f878a5f7, 0x3bb909002f4c2},
+	  {0x749c90c38e0cf, 0x2703fb9ec77f0, 0x395d47b0d7810, 0x77edcfce515d7, 0x4858f65309111},
+	  {0x7a188be9d6dc1, 0x020cde676f600, 0x3608e720a66d7, 0x5ea5390702b5e, 0x66d6c4c308fb3}},
+	 {{0x22a59690a7cce, 0x74fb32db91cc7, 0x65603490e1638, 0x06cf1f8de2921, 0x5fd2f04b11213},
+	  {0x79423b0e8184d, 0x4cff967f578a6, 0x71043a11dc39f, 0x1641b757fdc53, 0x2bd9d002a5813},
+	  {0x6d03b702cd6bf, 0x02245437fcef1, 0x2764af84c970f, 0x2a0eb450dc7a9, 0x70b343394b624}},
+	 {{0x31eb4ec71c572, 0x74eb4c5dc5b52, 0x27536c2dfe7f9, 0x34e1a93d7bc2a, 0x050bd4aff6e64},
+	  {0x2ca82cc63354d, 0x795229f1524c6, 0x2a87af62cbccd, 0x1b0924139c894, 0x52760442f69be},
+	  {0x1fccf7d7d0bda, 0x350644bcbc73b, 0x76475977f688b, 0x4b489a825cc03, 0x52d6d7fa5bd8a}},
+	 {{0x32d2ee308acf5, 0x0a0a0f1a9c093, 0x4e1e7227408ab, 0x30f2aae35d3de, 0x202aad0429fad},
+	  {0x7a27f3ccdb83b, 0x766ae4a5873f1, 0x392d92a0c2071, 0x1f6f968e12c35, 0x3237929d72d80},
+	  {0x405c3af48009e, 0x5dae414d2c71a, 0x1389d4ed9d89b, 0x216b95b02fdae, 0x158791aed60f1}},
+	 {{0x2fc4991464f69, 0x07e556f9c2ce4, 0x4eaeedd7d2e35, 0x6a96174d15859, 0x42fc56744a60f},
+	  {0x2d522e73bac81, 0x6e1785bf59b8b, 0x2692c26e5a5d2, 0x5dff1d3e6aaef, 0x110467cf2e1c9},
+	  {0x3638e251c5c9e, 0x62c8223ae5b3f, 0x5c52fd3b0ecf4, 0x698ec7445e332, 0x0e43984550e00}}},
+	{{{0x387491444fd3e, 0x7544f2058dc05, 0x6fddfd7876ae9, 0x3e78b77196eab, 0x2f2356ff2c4ff},
+	  {0x36dca9292ba3b, 0x37cd66f9f1879, 0x1031898a6d623, 0x4731e0516368c, 0x467359ec91378},
+	  {0x45f48abc53a27, 0x37420a735c723, 0x3504ee89b36be, 0x35df3151274d7, 0x5576b8848e512}},
+	 {{0x73e8323db3817, 0x20e996b858293, 0x2ef0585aec540, 0x0d4711c8b150c, 0x0c826d2eeda20},
+	  {0x2c0301d8afafe, 0x32080e40ca877, 0x74d9b1b8ca3ae, 0x41a799efd2d84, 0x4b21208ade846},
+	  {0x2a36462dc929c, 0x0928775b825df, 0x1b90404eac3f8, 0x7e83ef6cdd3c7, 0x21eb50c8c722d}},
+	 {{0x5ec62dbc33b42, 0x56ebb054e89f1, 0x0d491c96a9469, 0x158fea64b6a4b, 0x546151544832f},
+	  {0x44837c0779499, 0x64449f7b0a5a7, 0x2c5f1420fc503, 0x3f41536238ba4, 0x5751deb791dcd},
+	  {0x755dd6d29f9af, 0x7c3397753066e, 0x015fbdc48f8e6, 0x2fb39d0920874, 0x2328663a46e72}},
+	 {{0x2ffd4f6174317, 0x2232061a6cbbf, 0x410043fd1a38c, 0x136b95a572546, 0x48c84376ff94b},
+	  {0x28eeaf09ab4f6, 0x32fb43bd35300, 0x7ead3c04660a1, 0x473290ab56750, 0x7039bd6396f81},
+	  {0x34e06f1368f0c, 0x40cd107a75559, 0x3c643332abb7c, 0x27a3fd6f6bd7c, 0x141656cefb37d}},
+	 {{0x1f5e6aa3dc8b2, 0x6c5156d9b0662, 0x24c57ac6cc5d6, 0x7b2a5cfdba94a, 0x03bba945c0482},
+	  {0x7aeea23eb7140, 0x3fafb5c3a578a, 0x45a0f0eb562fb, 0x6abdacf2dfd41, 0x7dc92f86f1df5},
+	  {0x3d8e204a2650a, 0x1feeedfcfaf2d, 0x5e5dbc9c95937, 0x352506196cc86, 0x5218b2b8ccb0b}},
+	 {{0x64467ec6f96ce, 0x5d3f8204edbee, 0x0b6479330fd0a, 0x1955d8ae62209, 0x7f221716ba59b},
+	  {0x082f5ef346740, 0x1791ad52d6d5d, 0x26b86245acc08, 0x20995b2c3751d, 0x3274a63aca699},
+	  {0x70f499dc310e6, 0x493fe3df6aca0, 0x6b3ef243f581a, 0x07a3c003ca6fc, 0x2a07e47762457}},
+	 {{0x5196b5a06a0d0, 0x051274ecdd8ad, 0x55c836048211e, 0x1d5b7a4b56521, 0x043a0935ed3f3},
+	  {0x4491d084f1d7c, 0x26850421b2347, 0x2aa87200a1610, 0x40b2239b49f77, 0x699e056b4ea19},
+	  {0x738fbd586d904, 0x51b42a9361894, 0x0c59660853a5a, 0x18e30ba6eca4b, 0x51668fc3d7696}},
+	 {{0x1b874e4f8c100, 0x10779d63ac67c, 0x1e6efa5f8d794, 0x4ac289c431041, 0x0f00219d43ebb},
+	  {0x4f604f230d9b4, 0x7e15c647597e4, 0x1d4282881a7cd, 0x3c9bb8512d32e, 0x635ad57397d58},
+	  {0x25984d6d12209, 0x2476367f7afeb, 0x3531518123ec8, 0x206ab3bafeb07, 0x78dc74aeb02a0}}},
+	{{{0x523d8548cfefd, 0x122ca6ec8b872, 0x5052309f2347b, 0x191f11f46fe0f, 0x435771f1c95a4},
+	  {0x226e1270116ad, 0x76b5975ccf932, 0x31008d5ee8786, 0x6b750b8fc4e75, 0x43630fa514785},
+	  {0x5e53ffaeaee18, 0x55e07d0db6580, 0x6ae72050866cd, 0x3e11f482542ea, 0x6ca01925baccd}},
+	 {{0x5e28c4ffe12bb, 0x2626b1fcc8514, 0x271f45b33c86a, 0x13b6fafefccb2, 0x4c0bc5c2278f1},
+	  {0x39ab6cdc4d340, 0x36c0d85fa3a7c, 0x0855acbec0978, 0x1714efaafde47, 0x3c2087997f591},
+	  {0x55e0c53bef17f, 0x5a470a53371f4, 0x007d5cc9cf884, 0x18e2af6e946c9, 0x28c9b5ff7ef31}},
+	 {{0x5d796f399b0bb, 0x703e365e333c5, 0x218d9548bdff6, 0x0dd02a1490910, 0x6580d49f9ae28},
+	  {0x50f74b9d4989e, 0x52ef790df0904, 0x2ef039398a985, 0x718d261845acd, 0x0b36e8ae75d74},
+	  {0x29cbb59e20f12, 0x3514548a867c6, 0x05b0f0984d8cb, 0x4cc994c00dd87, 0x01b7c79a1d4a3}},
+	 {{0x0ffcd75a4a9cc, 0x20ff563933819, 0x196fd3fa16bdd, 0x6ff4f119714b9, 0x358a5de2a09ef},
+	  {0x027838278b619, 0x636e1f4dafc73, 0x7b20eb36ce5dc, 0x0323fdb761ac5, 0x0b0285cf35067},
+	  {0x134f6594e96dd, 0x3295cc4bf8bf7, 0x70b86476cd1ea, 0x7aa64944cceef, 0x2e810ec29d761}},
+	 {{0x1f05e156f0fc6, 0x2cc4a967b7cd5, 0x201799eeb8207, 0x3682bb03f9c94, 0x3354543fbb262},
+	  {0x3a2c3e05409f2, 0x60eebb6795a95, 0x502bceab9bb2c, 0x33eb01bd1d820, 0x09f2e6985978c},
+	  {0x5a773ee3b045f, 0x4717f995beab7, 0x14dbdae4ab08f, 0x1df0e5f5d8615, 0x32387b5cc5e2d}},
+	 {{0x18f615d4c8c62, 0x67fe03de8bc65, 0x66e81d584af96, 0x6bfa6f596a15d, 0x339f9f5373c49},
+	  {0x693d2acd64f65, 0x1f808f7aa1052, 0x371b1ebbca227, 0x7a7f4f68fc8c2, 0x026d0a22552a9},
+	  {0x646bdfef45197, 0x0d2228fa97c32, 0x0e90e4e53a72e, 0x03b8c81a6eedb, 0x3a3a8374946ab}},
+	 {{0x07b2efe63d9c3, 0x0b02a11326ac7, 0x3960621935397, 0x548ffb0433a8f, 0x43c0962385c1e},
+	  {0x03bd22d411135, 0x732f47043ed6f, 0x62c85f95add07, 0x27e0cbbe71d6f, 0x4b84421d4167b},
+	  {0x633de9b6516f0, 0x118cb2f1bc082, 0x292cd0fbe7915, 0x590f76e3eb25a, 0x62b5dae9943c3}},
+	 {{0x461d6b5144b08, 0x5ee830802de5f, 0x3fb2ed25824ab, 0x5bc21e039668b, 0x360780995d25e},
+	  {0x49c3c5175da01, 0x1b5cd69e52be4, 0x267a1b3f39ef4, 0x5d6f30d5bffe5, 0x4142cbeaa9c78},
+	  {0x306a0902a31c6, 0x66004c6ba43ae, 0x1140cb744b3de, 0x1ab088b78f7bd, 0x51e2215b76f6a}}},
+	{{{0x2a01653025e3d, 0x56e27f02d8775, 0x65b5b7ee7d6ff, 0x4312e599e763d, 0x38af7a380893b},
+	  {0x32adcd503a9b2, 0x4811f25499c53, 0x26bf512bd113f, 0x2b33572dddb2c, 0x1fc6839190ab2},
+	  {0x3414d251050af, 0x6c94ae41950b1, 0x5b4d6b83f0039, 0x22adac6d597c9, 0x6a9968a23c6b6}},
+	 {{0x60f6431a37d63, 0x66050683b2972, 0x3f25c13d138d6, 0x0816272c36a56, 0x44db916e450a8},
+	  {0x08d4055c821da, 0x70ac113f3172d, 0x66f7da514d947, 0x7436bade92e44, 0x63c157fd7641a},
+	  {0x3ae2e85d4607c, 0x08520e389cbed, 0x214f69615fabf, 0x605fdcc9d6e8a, 0x2eae84ad56ff1}},
+	 {{0x68060fd7d0700, 0x03e08486ae8ae, 0x65d1f45d69bae, 0x6d8ce6d0badf9, 0x0d9f3aa2a109e},
+	  {0x6418197be1d57, 0x573b2cf429771, 0x15fb0e4a87d6b, 0x15fa9ce250049, 0x2fd5e6f143614},
+	  {0x76d79a0392292, 0x524adf70d8115, 0x76e81fd1e2698, 0x6db518a582d64, 0x6350b454997ca}},
+	 {{0x66b6d8459277d, 0x7d1ca0c38af96, 0x3ac24b821757c, 0x15b06d044bef3, 0x68c9002c931a5},
+	  {0x6ce8312992fa9, 0x7314f6804c704, 0x7096d5c73f4de, 0x54c53dd3a2432, 0x36f11270fa766},
+	  {0x14bf043d679ee, 0x675cb2a82387b, 0x717e2d2a5589e, 0x4bb90e7a886a3, 0x37d0009754012}},
+	 {{0x0079fe508d03c, 0x0a0a837651b71, 0x784d6a1386bd3, 0x491f11810ed96, 0x1f7bed6e87cbc},
+	  {0x027c245bef716, 0x494e26cc9a38c, 0x0fae19b6154b0, 0x43c8674c5271b, 0x7e3152db78f5e},
+	  {0x1cdd49bde3e9d, 0x1eafbe3b517d4, 0x1be58c1ff575d, 0x77acf3904aa00, 0x111327c6c14a1}},
+	 {{0x771742ec54327, 0x73e8eac05d2e2, 0x61a2f7248fc10, 0x4409f33acd499, 0x029f6d2d39aaf},
+	  {0x7f4fcf49a670b, 0x19c155480ee17, 0x372076da32107, 0x7a0e85aeef8b6, 0x4cb480aa2d641},
+	  {0x5df20a68c409b, 0x1e4508b06c184, 0x430f81711a263, 0x579cf1af8c170, 0x772c93a8bf1a9}},
+	 {{0x22803e85b7ca3, 0x1ed8d253fabc2, 0x6ddfb029405bd, 0x4acd56edab2e4, 0x67d29febe56b2},
+	  {0x61081f9c35b61, 0x4a6747b961915, 0x282bfd0aeea42, 0x463354f81d5ab, 0x162fde0615756},
+	  {0x51549803dcdb8, 0x2ebc0ac2e0ccd, 0x60549b793d760, 0x31859011fb03d, 0x7aefdaee5d702}},
+	 {{0x7a7e1430dbe93, 0x51d0217ce8b20, 0x70aff91725fb7, 0x2b6ba57016a2a, 0x0d030fb97e158},
+	  {0x02357ab0ba3ac, 0x6665a5a07f0d3, 0x754d59f7fc389, 0x37d1ba0b47f3d, 0x227b4163f001d},
+	  {0x2ff90f718c469, 0x273cb4e9eee46, 0x0aa07f0109d66, 0x04e4d6281c9c1, 0x0cf3afd38eaf5}}},
+	{{{0x343c8c5cf55be, 0x37262a7d3ff6c, 0x3e978746031ac, 0x1a2614ad7c1bf, 0x16806f16bc52c},
+	  {0x59741fd40eb51, 0x66af8054ecbbc, 0x3f5529c386616, 0x70842e719d465, 0x073e6956e1dc5},
+	  {0x501d3a43ce309, 0x5ddda55d204d4, 0x0f8c5efea6b1d, 0x4f1359fc254e6, 0x49efe0b4db511}},
+	 {{0x54a43d0187e57, 0x61143fa4e1378, 0x5bdfb52a4b201, 0x434a29c53a6e2, 0x41610db09f334},
+	  {0x458922ebe4a5f, 0x7701a868b2ccb, 0x2be6655729e08, 0x1085c00bb5e5e, 0x7f9503f6f885e},
+	  {0x5f6268a2b4b22, 0x4a330716fae73, 0x627632c7f5eaf, 0x6828a98d892ee, 0x52a7930428bc4}},
+	 {{0x771a027744565, 0x6d0cc9f4b24ad, 0x2cf9b29caf1cb, 0x0857dce29f92c, 0x36ccad39c09f9},
+	  {0x4deb2d1e70021, 0x2522a79f05f3e, 0x418c5ca41281b, 0x5772008c90285, 0x1b850d901f90f},
+	  {0x557f15856f989, 0x5f3fc07ac687d, 0x225dc00e1dd6f, 0x460ed2b0038e0, 0x0deadf075c9f4}},
+	 {{0x2cce403403005, 0x24ba94153327c, 0x1952c98dc56e7, 0x5d86b1050c1ac, 0x5cad2b7527f59},
+	  {0x6d91994faaad0, 0x0fc0803748d7f, 0x6467d80ba539a, 0x3b0bf982bfe29, 0x79d90f8bf30ec},
+	  {0x658efe20a6aea, 0x1378121466c50, 0x4860797e59719, 0x27a9e1090ae3d, 0x1271add051753}},
+	 {{0x27c339774c1ff, 0x0884dea386fc5, 0x629db53ca5ec0, 0x19363978ccdd5, 0x25438e746257a},
+	  {0x63f214d2c95d6, 0x1d3f6a9049d22, 0x1f9048f3c204c, 0x7aea62cc9494e, 0x535c6d299c5ad},
+	  {0x1c7de33feabf3, 0x7b90778198026, 0x1fe677e5936f3, 0x440c92790ecdd, 0x494a4acf05cdd}},
+	 {{0x7af6e209cb418, 0x0d4fc10b254b6, 0x7915c65253a2c, 0x1fba2e605eca1, 0x178463bef980f},
+	  {0x0f7ab6e19cabb, 0x2f0727acd5927, 0x13d6b01b219ec, 0x2c92013878a31, 0x2b23f26dd3e8b},
+	  {0x3dfe67e21297a, 0x7870fab49c15b, 0x79ac629d944b5, 0x29038d967a619, 0x63ab887c88cc6}},
+	 {{0x771757804d263, 0x09c53d0a2da62, 0x0e6da6cac0e43, 0x0b66a990ec20c, 0x689eb2d2dbb5d},
+	  {0x2ec82e5738379, 0x2d8e79e41d3a9, 0x3132d43ac8b73, 0x6f7f37abe07c8, 0x77be13894fc77},
+	  {0x68e7db7a8e036, 0x4e40147dc0ae2, 0x69f6e106207f6, 0x0aedf498190fb, 0x1be60c334d01f}},
+	 {{0x0a9e3fa54e058, 0x275e2db04e3c5, 0x74758b441b8b8, 0x5e9903d4a0519, 0x4791d7bea8bdb},
+	  {0x22cb01fce513e, 0x0b948a483bba9, 0x0a06d75428fb3, 0x26a2387e58637, 0x14a1df522ee69},
+	  {0x6ef99b3e8732f, 0x41c9946efcaa1, 0x5a9b86e0fc0e9, 0x29b25f18b1c8a, 0x50be4e2c91b53}}},
+	{{{0x785984cf1089d, 0x4fe84bad41691, 0x1916bb4364824, 0x46bf8c0b320f5, 0x74f24f106ab9f},
+	  {0x4360a636bcada, 0x6150651a50568, 0x6dc750bdcfcd1, 0x303531b753278, 0x1ae8c87204c9a},
+	  {0x3772b7d258a55, 0x5a2a9da78a082, 0x3477588ba39b5, 0x43da06bbd6048, 0x01e6e2c28b15c}},
+	 {{0x0e15e74bda87b, 0x50ec9d287683b, 0x55bd95b7b4991, 0x2726dda393499, 0x5d350c07e16e4},
+	  {0x26b9828dc4ca2, 0x544e06c3f1acf, 0x5a5639bf87894, 0x55b47fdb2ced3, 0x7a2e72a5442c3},
+	  {0x080f08fd3f932, 0x0921b0c3afed7, 0x03ff8b5171178, 0x2420e23e89c84, 0x7668edbbcbdc6}},
+	 {{0x6218b4e4df318, 0x20e5836f75d12, 0x7b7187f5dfaa7, 0x77d76fb20515d, 0x542600b976738},
+	  {0x34796b7f54220, 0x5e0ad62183ef8, 0x4cf1a06d068a8, 0x23a4f79756996, 0x4e3a788b485f3},
+	  {0x643b4d4ead36c, 0x33f6a1b367cba, 0x75aaa1ddcbd37, 0x7c5746ba95b07, 0x5e9f53dd46a4f}},
+	 {{0x6a520e23d2d5b, 0x0aa337721e711, 0x415cd8977dbbb, 0x1967e0feb694b, 0x274b313320249},
+	  {0x2bea9a2009aac, 0x0c02d93cb6520, 0x6f8a753998085, 0x22161bb61f04b, 0x4a31c429c0e38},
+	  {0x47209d656f37c, 0x3623d691d6982, 0x3b78a3af25d7a, 0x59eda6534fa89, 0x7ff17d34c643e}},
+	 {{0x5611c477d47ee, 0x71a827f8b129d, 0x7c806df8c8c79, 0x6cd9805486147, 0x2ab0531838edc},
+	  {0x2941c297cef37, 0x77938ec994a9f, 0x2e48a206f4dc9, 0x447cda1430f3a, 0x76d1995a5510b},
+	  {0x138eb8e6e8190, 0x253e6476387b1, 0x105ea11616d7c, 0x3afdba175db46, 0x586ca39e3eeaf}},
+	 {{0x46872764eacd2, 0x39f739c13fadf, 0x117e9ac9127f8, 0x41d7eef8b7a09, 0x2b601baab7db0},
+	  {0x218c64d5aba29, 0x50364479606b1, 0x5efaff11e264d, 0x2236785cf6396, 0x28772d22a1955},
+	  {0x76c8aaec3700b, 0x5de57230fca2b, 0x13aed8aa175da, 0x7e00157c22418, 0x28d20770cb351}},
+	 {{0x5d42befcfad5c, 0x594e08a39b9b8, 0x4ab7c8e585225, 0x46e6b9034d29b, 0x3f8342ba75b55},
+	  {0x0b555c7e49e9b, 0x0b55ad3914b83, 0x591d345726e25, 0x6b8eba284b460, 0x7c832c835044a},
+	  {0x7e2107e0cd3c3, 0x7030785c05dd3, 0x34c277fc716d2, 0x0118ad172393b, 0x65bc87319a1cb}},
+	 {{0x61a1fd71895eb, 0x333f7c5aa54e7, 0x3b42323ccc235, 0x51c9cd49995b6, 0x4e0de3d27f55e},
+	  {0x7a80fe9f5611e, 0x173f6ae64dead, 0x500da757f392f, 0x6356e1eb4dd06, 0x1601688ef753a},
+	  {0x2845b69d608b7, 0x6dab475dfe53f, 0x2ab6f0298632c, 0x6d2b808cc98e8, 0x3d765b7f439a5}}},
+	{{{0x283631265853f, 0x7787943e1740e, 0x5e6dfb23de9d3, 0x19d90f6dadbee, 0x728c3c633a035},
+	  {0x0acfcdc02f72a, 0x023d3a549c445, 0x7b7016b81b5af, 0x4797759cd001c, 0x3b52035da9253},
+	  {0x2c60ed0cce52c, 0x540413809e986, 0x58b68ca5e6ccf, 0x5a5291146a374, 0x38d4b5983a27e}},
+	 {{0x20438a8f93c05, 0x7593f3e6065d7, 0x67b5a4fc54114, 0x7e86d67acba0b, 0x4e01e9ef465f6},
+	  {0x5bfab8429340d, 0x536c919b65d12, 0x63a84ce42d70e, 0x6c2cdaf1367f7, 0x4e547e83dfe02},
+	  {0x0b5a2e7266028, 0x4ffcdf8d56dfc, 0x340dffdf479e2, 0x5c9f96e472eb7, 0x182321035252f}},
+	 {{0x041a04f71aedf, 0x5ac6b0680842d, 0x6fb8bad7523fd, 0x05fcab70bfd9c, 0x3d4a95154a32e},
+	  {0x2a83db0a376d8, 0x0e3f1c489228e, 0x0acfbed70f0fe, 0x154059c4d81fe, 0x5949c1ffc3fa6},
+	  {0x45b92144fd8ce, 0x77bd1b2961514, 0x7f656b5ff3b90, 0x5761045ab953e, 0x7f638e1a0c669}},
+	 {{0x41f54483c49c2, 0x21dc3e246f120, 0x1f909d3262685, 0x622742fdc9b93, 0x2747b36545805},
+	  {0x7edcd97dc3f7b, 0x39674d4339e45, 0x151977c6b5f45, 0x0311c30390916, 0x69b7e906921f3},
+	  {0x4fb513a646ac3, 0x43fabe3c1ad91, 0x786da1fbe84f6, 0x00f98969dbe9e, 0x03dd78449900d}},
+	 {{0x6203c86c57250, 0x37c83f4b572a6, 0x645282842bc0c, 0x09cc2f0c7526f, 0x1759d5643f118},
+	  {0x3bd0bb50a9103, 0x043711e1ea719, 0x0429a05a799c8, 0x7e5ed4565b0c3, 0x29778b0184b63},
+	  {0x66b721e8424af, 0x63d1d5528f9a1, 0x32b193d23df3f, 0x0b725c810d9c3, 0x1392a1375fef8}},
+	 {{0x36452ed61db12, 0x5fdecbd5566a1, 0x2d89f2ec9d209, 0x276079d6847b8, 0x72818c7b4a2d2},
+	  {0x46b90d2e121bf, 0x68db5c723c3e0, 0x563782f5a5dca, 0x2077d00821136, 0x384069e0b120a},
+	  {0x50eaea170a5c2, 0x53be638d69946, 0x00676be272bbf, 0x4b705d8897ada, 0x3e49e158e8cfd}},
+	 {{0x1e9142654e8b4, 0x5d5e3a761fc90, 0x2919f1f505976, 0x624db59109116, 0x375dc121f32c6},
+	  {0x477edfe0667a1, 0x79ada56bbc45a, 0x3717927f347b4, 0x2b9afc8e17a29, 0x1f68e21369cc2},
+	  {0x567a370a76765, 0x1b426d104c5e0, 0x18d8d275847c2, 0x34462bf41eebd, 0x237d384ed856f}},
+	 {{0x0dbccebc72d0b, 0x177ae6f6b1551, 0x566fe89ae6650, 0x1524322ce8221, 0x4e9e904a9778e},
+	  {0x64947ce910b63, 0x1651f8aa7cba9, 0x20f10aa1c08a9, 0x03c487e131fe1, 0x5b0efb339b8de},
+	  {0x3e7b69361c5a4, 0x682fc9e7d7d04, 0x62b2efb0fc4e9, 0x7daff4b8bea08, 0x66a070bc81bde}}},
+	{{{0x5a36c2dc719af, 0x73fb47821524b, 0x530d06a380f48, 0x1fb5a44f66aa7, 0x01af5ed4798dc},
+	  {0x391b854e48f24, 0x6979fbda317d7, 0x627657afa1626, 0x72e861e025ed0, 0x023db9b47007b},
+	  {0x7840ce69b20da, 0x499f5b3244fc2, 0x5792f55c000b9, 0x7cef21cf7ae17, 0x543c6fea6e93e}},
+	 {{0x24dd682720139, 0x7d26a571a630e, 0x5930ffc95de3a, 0x429d549d0ba93, 0x4bd191268d783},
+	  {0x71d785168c266, 0x3b044680e4134, 0x208a8c1bd65aa, 0x01b93d53120f9, 0x6753ee8931ef3},
+	  {0x0aac7ce63232d, 0x3c84ac7bbbcc2, 0x6f81c832c322d, 0x7eea178b3b866, 0x03555dfb51f31}},
+	 {{0x466c4f69a7f72, 0x192c26a180385, 0x610568cc6bde2, 0x2a4074c6d0288, 0x5cff4968887ef},
+	  {0x7643e9c1b51db, 0x38ba073d55001, 0x1ea2d722d7b45, 0x7f24ba30ff74b, 0x473f088096cdd},
+	  {0x60948bc656978, 0x3f11c49a666fb, 0x763a7c406919b, 0x496425e3a5e43, 0x1d980104086a4}},
+	 {{0x25bb871db6907, 0x2f3cbf85f1e3b, 0x6c0d7d9d19819, 0x48ab22063f2c3, 0x48845d0e71829},
+	  {0x165ab34b7508f, 0x4807b59475985, 0x2951cb53e042c, 0x4038c59c8e1b8, 0x006dde46af3bb},
+	  {0x4d5a7b127746b, 0x40c979b5c9909, 0x06228ae5766d0, 0x4632a5e96cc59, 0x65de77fb92c09}},
+	 {{0x2e032e2f585b6, 0x22992f8f47f46, 0x6a1a8a58e53d9, 0x407dcc1685120, 0x25bc7e091ea4a},
+	  {0x13d5b8935f6fd, 0x3cc1b4fcf93d7, 0x41ad9272288e3, 0x18c5249e80367, 0x0eef3a94e7d69},
+	  {0x7f0dc545cb252, 0x2fa9e453a10d5, 0x2183adfd70013, 0x4e3468073509d, 0x70a3abce3631b}},
+	 {{0x3172e5303caa9, 0x14121c01864dd, 0x45346d7ce3054, 0x492e7d957e759, 0x78c944596dcb8},
+	  {0x5bba129c16a76, 0x39d3abbd794fd, 0x4120f0871b3b0, 0x54e759a009f6d, 0x1ee857c1d484b},
+	  {0x6f2f748de5706, 0x11104a1a93406, 0x5e34ce1bdaaee, 0x5157f81ceeb02, 0x57075fe03e651}},
+	 {{0x155810553cce4, 0x5bc6f61d2292c, 0x27d7546bb9fd7, 0x28efe6e861a5f, 0x658f0a416990c},
+	  {0x2eaef12fa0eb7, 0x0f20bd8cfaaf8, 0x6b250ea84777b, 0x7c72796447a5a, 0x0b3f3a6f81159},
+	  {0x1a807e91a70cf, 0x1aacc58ab16dd, 0x724acf3578749, 0x6f810bfe9e4ea, 0x3d17f67f342c0}},
+	 {{0x142176c9dfe23, 0x446f35b0f6f87, 0x2dbaf7e263d18, 0x743df8292d4d4, 0x25f9f6cada1d6},
+	  {0x08731a219946a, 0x3f2ab57d0b6ab, 0x0e6a7d122ef25, 0x307323cab0a8a, 0x6481f9fe45e17},
+	  {0x79489200dcd39, 0x4213ea73643ce, 0x73ee70e712253, 0x7f87854b42220, 0x3ffd4a376884d}}},
+	{{{0x39af79336a460, 0x2ac7f0f5910c9, 0x6a7ab668c03c7, 0x08b5dbd9231e1, 0x43b72b0c1a832},
+	  {0x3361a721e5060, 0x399c40165ae36, 0x41d37058f6693, 0x030083f917716, 0x4f9c043448b80},
+	  {0x0fd6a33e7c33a, 0x4d0a920c292fc, 0x13eda82953282, 0x4354636753d72, 0x7cccdab10d82c}},
+	 {{0x39312a65b1c32, 0x3ae4a3e571c3a, 0x2f06474da73a3, 0x1b7d16b1fe23f, 0x25aed12a8504d},
+	  {0x0840a4d46eb54, 0x26059cef1cf4a, 0x7dd789fdc6f5f, 0x4243b53ec247b, 0x47b73c00e9b48},
+	  {0x62400dea73fb8, 0x7fcd1a56bf541, 0x44f3e5a9d8c7f, 0x419b1668a5f77, 0x786104584634c}},
+	 {{0x01be5d70ca8de, 0x2fdb97c917930, 0x73737e4cf8f6c, 0x5dfcb1999b4fd, 0x180058703e330},
+	  {0x0634c6a039d14, 0x51e1ace3063a3, 0x7956ced9308db, 0x4a5ec544a7a9c, 0x02c2a52a41b30},
+	  {0x53242427d0fab, 0x0c7a1b8e0a0fe, 0x5dcf709f1ee74, 0x321faff6747ad, 0x1464ec235ea74}},
+	 {{0x4ed0d57f690dd, 0x18c08f337c2c5, 0x4e3fbbfec8a1c, 0x1522929a1ed98, 0x171fbff0e1d78},
+	  {0x227b7d271617d, 0x32fb6bde67c2a, 0x479ddbfb5c75e, 0x094b4dc755c16, 0x0f7f52062b288},
+	  {0x7d66f7c9f7ca8, 0x5559ffb6f17f0, 0x3971a4f038a5f, 0x4d2433d926696, 0x59ca4cfae6f45}},
+	 {{0x434fe6c70a5df, 0x0dfcd815b67cc, 0x4dccb252ec5ec, 0x52f7d7a71d5b8, 0x2e6d939b8fb06},
+	  {0x419b12ccf48b6, 0x2994519fc9961, 0x3e8fef9b73ae5, 0x3dc647adcac50, 0x6295bbb6e113f},
+	  {0x34053e92469ff, 0x7c59f180c85a1, 0x0307852854d81, 0x7d8b23cb67ef4, 0x2414165d3bfc9}},
+	 {{0x49f131f981fa0, 0x1b8e77e620b39, 0x1c4df1b61b69c, 0x73695e7b5c808, 0x7c704eaa652e1},
+	  {0x60df6b9a4335d, 0x6d7824967bafe, 0x25d85e3323438, 0x1ce2b30acbae2, 0x2e986c764a3ff},
+	  {0x75c31ae9fc3a4, 0x74a4946d3efc6, 0x2c3f254935855, 0x7f91811e6e6bd, 0x50a67d6283ba3}},
+	 {{0x238282a48b480, 0x6828c3329a795, 0x335a48fdb8bcc, 0x7a536976cec60, 0x6a13036521a25},
+	  {0x08e6f60c34b20, 0x42ae1b6aa4077, 0x33d7a16347928, 0x23ef180805011, 0x5d2864b7b423f},
+	  {0x28b93bfe23464, 0x1e34b980a09e7, 0x33629872ce98e, 0x0fceb86be1815, 0x221f21c180a52}},
+	 {{0x42598871f9599, 0x40e2f335ae1fe, 0x21eafb9f027f0, 0x7d7cf8c1b7d63, 0x71426212b6d3e},
+	  {0x0a07d6bb5ba33, 0x1f1166dcf9d42, 0x174eb1c105436, 0x2f4a8657bc8fd, 0x3bfc897efbefc},
+	  {0x75dc37e6f8f57, 0x6f51756775316, 0x77e20750bffcc, 0x7bc157551d60b, 0x19b2340111f08}}},
+	{{{0x2b042997aa360, 0x3123f24ec5955, 0x53aa3edf9b267, 0x57572411f88f5, 0x5ff94e9e1be8f},
+	  {0x7a8d67e11c778, 0x28f0b9178e2a7, 0x45de9cb26baee, 0x2936e52a068da, 0x465b5ecdb7e27},
+	  {0x50ab071cc35b4, 0x511f1ba628c06, 0x595475453fcf0, 0x3567358fb002a, 0x41784cce91272}},
+	 {{0x6e2f27f252d08, 0x5290406d5d58e, 0x0d21e497bdfbd, 0x7e27e5b927e30, 0x5b67090ed9bda},
+	  {0x2924f525a72ab, 0x3f9f08a072dc2, 0x389942e2fc957, 0x6d2c7d1e39266, 0x0730bf0192655},
+	  {0x16a489f63c2c1, 0x667a75ab7b569, 0x237dbad2ed807, 0x49b172afc671e, 0x6693a2ce4c2c5}},
+	 {{0x11cb256cdf467, 0x699431b8eb0e2, 0x4958e6189b5ad, 0x5d4f36a8d0982, 0x600d48dda8465},
+	  {0x0e34fa5c03c1e, 0x2193fadba2263, 0x4888557e3b152, 0x0704034d847b6, 0x04f0d819e5066},
+	  {0x7c5fb14c7422c, 0x251bd414c04a6, 0x7d7ab521f6055, 0x05d813a1a5fef, 0x54aff41dce038}},
+	 {{0x548ce51c7ec46, 0x5b2149bf5ce18, 0x3d23c92af54e2, 0x6a80707a4faab, 0x5389f53b54ae2},
+	  {0x4a9dc02369b7f, 0x307d0ff3fe4f8, 0x5d6b9e631adba, 0x53b4edff03010, 0x15391864f8221},
+	  {0x562d3ad201082, 0x20ffb3a5ae863, 0x3a8ee6d0f16be, 0x41ec6f158818a, 0x5d7fa7532b8d8}},
+	 {{0x28528c850374e, 0x4eb8a0aaee90a, 0x69dff87af8148, 0x2ab480346b423, 0x5462f85cf4508},
+	  {0x35915e8541682, 0x5736d77da0fa2, 0x6dbec5e6f20e2, 0x35a0d4496e96c, 0x66df7d9d21457},
+	  {0x53d7ac4d4b765, 0x60e863b615cc4, 0x5d9f822813b8f, 0x77f09a8a3a16c, 0x01eb688b896ec}},
+	 {{0x47895db450b4a, 0x31f58717569b4, 0x596107e2a9015, 0x003f5eb4ddade, 0x0dd77b3f47c11},
+	  {0x1dcd0a41ea898, 0x570c90b50e849, 0x75b392a9255ec, 0x66a0a1c20d519, 0x7bd1dfc034975},
+	  {0x6f9c74f6020ec, 0x3d3e8dd08ba84, 0x516a7682eaad5, 0x380e13a674004, 0x612e2786b93b4}},
+	 {{0x25790006835cc, 0x42a26e6fc9f8c, 0x2d976035e5db2, 0x373ae1021bd9a, 0x333e308a72471},
+	  {0x6148bc234a43c, 0x1df9c5ffb018f, 0x3f3b9906bef56, 0x4c11174d5f627, 0x7307b23ecac71},
+	  {0x527ce4c8608ab, 0x50d4601690b2b, 0x52170c2a936da, 0x409c6aecf47d7, 0x6673a1b88c1ce}},
+	 {{0x0bb4ba57f7f40, 0x7660cbc6f09fd, 0x4d8651348e094, 0x1436b4f986f29, 0x60fc375d078f3},
+	  {0x5a7de0933b035, 0x28e692ac4e3e0, 0x6b02f106459cc, 0x2a2b466de1d8c, 0x088b2f8dda75a},
+	  {0x2072df83eba87, 0x0682d5f63cee9, 0x3af3e425fe9ec, 0x3dda260ca3a89, 0x168056895c21f}}},
+	{{{0x3f37dcff2eb76, 0x46e2cc8f58edf, 0x01359f820044f, 0x6907cb464ce0e, 0x16cd01901280b},
+	  {0x296b1bfb63c1b, 0x6fb2e077f9942, 0x2af2af04069e4, 0x2cc8b4f7f546d, 0x225547bb95fa0},
+	  {0x6d3109a112a2f, 0x68134af85babf, 0x4e439815132cb, 0x2b25b52f02b0c, 0x7d8a28dfd1fb6}},
+	 {{0x6ef793e08da46, 0x0838205145cc2, 0x124d8e4e4312b, 0x2f6973bce454b, 0x0a5af29887ff4},
+	  {0x4285348d7add8, 0x15b150a852d04, 0x21b72cd4833ec, 0x1d3bc14f6ca0d, 0x6b922a1bebfcf},
+	  {0x0f1ca9d1a71ca, 0x409b30b51002e, 0x19522cd1abd6e, 0x11d3648d1f58f, 0x573d89566d324}},
+	 {{0x0622f39a9cbb6, 0x5f6b5e3314146, 0x272f11b4aaae9, 0x494d28e958aa4, 0x1ddad3d11c900},
+	  {0x79ffd6ee63365, 0x3aa79a681493a, 0x7adc26308d225, 0x62831cbbcabe7, 0x5c066321923d6},
+	  {0x05b90f97e926d, 0x6ded9d7d0df24, 0x68951fe74e25a, 0x65e4165f8a5a8, 0x2cb6b11addff0}},
+	 {{0x6df1350d1adc1, 0x4d1c5b6d8fe5a, 0x6bfb2a4024c6b, 0x680d2ff06e6bf, 0x422ff687a3885},
+	  {0x5f0840afdea03, 0x40a57c1137523, 0x11238cfffaa8b, 0x4e836179925b8, 0x3e0bb8b0592ab},
+	  {0x3eac2f091b5b1, 0x63ff69308ea1c, 0x4bb2f6c8bf69b, 0x67b40324fb0d5, 0x07cba98db7904}},
+	 {{0x0bc3cd0c7f720, 0x528280c594579, 0x39062af2e4e60, 0x4886e5b2bb330, 0x3a988b36b9aac},
+	  {0x2f18fc83c1ead, 0x74528eeb8b474, 0x1012eea8c0b6f, 0x581e4cc012970, 0x174ee07b791eb},
+	  {0x2da0eb1b9c190, 0x3647a7e7943b2, 0x3ac8e3349bc6a, 0x66cf2c5f83421, 0x67508c3c8ca8b}},
+	 {{0x33c4e1cdff49b, 0x534e4ce4c84a7, 0x796ad336d3b2a, 0x33be2a44ec00e, 0x12492f17f61a3},
+	  {0x0d037f102557f, 0x7a616fa32a4fb, 0x78397f3734fc2, 0x4caefa73fcda2, 0x648c3a472bdf2},
+	  {0x78beb15ed4b4b, 0x5b2b3250585df, 0x33e646f7a7d7d, 0x718ce3c6f8904, 0x2314b4dfd1f07}},
+	 {{0x21ead927c56b7, 0x4d074f62b0642, 0x3e272a2d01d9c, 0x6d793d90a36bd, 0x418a22703f4d5},
+	  {0x1eaab74f275ad, 0x3df250bfeba44, 0x6ce1c8b4d56e6, 0x680121da99765, 0x2f316c8da9ed4},
+	  {0x6172b333f56a2, 0x5c0f84a81c561, 0x539fad9d72f62, 0x4ee08c29f523f, 0x3ea6b97a88b9a}},
+	 {{0x4f8966bb9c47d, 0x15eaf1596d4e3, 0x62abf42fa880f, 0x643c931ffe168, 0x5874ad77facde},
+	  {0x7352562d72d7d, 0x3b4c869361f93, 0x3d304e3d2ac74, 0x571a18a506461, 0x18195608136c0},
+	  {0x25d750cc58439, 0x3656d477f7103, 0x353e401abf00f, 0x718bbd0f99aea, 0x382539a693dbd}}},
+	{{{0x0cc77e18e37a4, 0x7748d5f6e29a1, 0x675dc6077191c, 0x79fc5f3966a1a, 0x227e9a6fdb6f0},
+	  {0x744c74e97dd38, 0x6e39260c22061, 0x280d7a3b435a4, 0x37d0c0af6c363, 0x30ef84a9e8c6f},
+	  {0x15d5b8a9a0b58, 0x5f9500fcacfcd, 0x58f5d6be1c038, 0x3cdea82130502, 0x19cb428bc44dd}},
+	 {{0x02c5d3465e2dd, 0x287aa1e716733, 0x1dad55e4140fc, 0x12ab79fbfa40f, 0x1d1a2c64b4f82},
+	  {0x3d77a25afaedb, 0x086b1bd2ff0bd, 0x5fbb26b47c3df, 0x3be9233c762c5, 0x752b2ea3b8d6d},
+	  {0x2303a23a290b6, 0x6ca77f9fe0d37, 0x38a5d59773cd0, 0x5a1279ab690e7, 0x7edb488e01298}},
+	 {{0x035755d12fe96, 0x4e539e2a6252f, 0x5ff1d6ef3aa4e, 0x67f976b4383c6, 0x11cc1525d9642},
+	  {0x7d8e616a6ddc7, 0x4a34310c3184c, 0x59c72b407b976, 0x5879f213b8866, 0x7d93463c2a849},
+	  {0x15136beb7332b, 0x5c93b00edb0e8, 0x7a14db24c150a, 0x4231f41309b77, 0x72fa6fd02ebe4}},
+	 {{0x7f0a1fb48511d, 0x35e84c5d690c9, 0x2820bb4928513, 0x7f66c0fff684c, 0x550a7fe0cb66c},
+	  {0x3af82a8b44d05, 0x7f1c43ced29d1, 0x5ee757ef67f7f, 0x70a863684f81a, 0x53a3a4c0fe4d8},
+	  {0x6c7e7bf6768bb, 0x20664e6c2b18d, 0x26486ec228c8f, 0x0178168ad9892, 0x3aa2fb3b4e28b}},
+	 {{0x2acb6120bb6ae, 0x3f07091950547, 0x62ec05ec965d7, 0x222750ca95deb, 0x0b57f1c325f62},
+	  {0x0fb63d8f99ce0, 0x1006b27ad9f0f, 0x714996741c63b, 0x11c63172e5c2d, 0x7125cbed35b25},
+	  {0x6b2c3e999e799, 0x066ab43a17dd3, 0x76cf511fdbef7, 0x1d8edbe63cb33, 0x12b6e52d24a08}},
+	 {{0x0dd4a98d9dd43, 0x5ac313053ca72, 0x2ab776f464964, 0x4465774994ead, 0x4a212fc54b3da},
+	  {0x2fd648654253d, 0x2a67d0d103b97, 0x404a679347373, 0x54e5b58913d54, 0x504962aa69e05},
+	  {0x33dffc0f32802, 0x79cf74ff96c0d, 0x18258bc94d15c, 0x1f98142183d1a, 0x47db23b9eb213}},
+	 {{0x18adc75dd293e, 0x3483af13646f3, 0x489ef2f5dafab, 0x3acb8f596087b, 0x2778c195a5769},
+	  {0x0322b4cdbac0d, 0x7e6d2e4ebae42, 0x1e93eeb8ff1ca, 0x470138baacc25, 0x604fa65254005},
+	  {0x1c154c2316e22, 0x0b572fb406414, 0x78abdcf26495c, 0x42f6685d38fb0, 0x7e09f38108106}},
+	 {{0x56e7d59591910, 0x45ba2bafc06fb, 0x551b679cd6633, 0x10dc775d3b567, 0x2cec733704221},
+	  {0x5c35e08d32daf, 0x7a2565d824c50, 0x3d9fe9d42714f, 0x7f41369aa7656, 0x22abc327a4923},
+	  {0x4f2f9740c1450, 0x6c46edecbbc83, 0x0a97b479dc7da, 0x12229475d77b8, 0x1db14b6e602b8}}},
+	{{{0x315b20f3163f1, 0x1d8972183ae90, 0x05aa2ce33d328, 0x2d6889502992e, 0x6769d8df88e35},
+	  {0x6b5a25df9c5d6, 0x26727b01d2e9f, 0x7e8a04c35299f, 0x16f12c6c66c8c, 0x33d59b761ddd0},
+	  {0x5867befc19b8f, 0x07b58b1cb5ede, 0x4203f6328e196, 0x3439281b83dad, 0x25fa59c30011f}},
+	 {{0x0ef83705bf2e0, 0x39ba0ba638c71, 0x79c7ee711aac7, 0x12b60a7642c50, 0x7d93af3843d33},
+	  {0x3dea6bfc68f7c, 0x17352c81f8aa7, 0x3accece930312, 0x10c589fcf80aa, 0x031ee84ab38aa},
+	  {0x326914f44f4eb, 0x06eb80e441706, 0x7891c1854fc05, 0x4466eae0582d3, 0x2dee205a9135e}},
+	 {{0x5da13951aeafa, 0x0c456332948e7, 0x5853723b7ad07, 0x3c123254213c6, 0x6a31626e72187},
+	  {0x4749541c27483, 0x328f8ce577779, 0x2fe7451872674, 0x6c1c448bd2652, 0x67f31be74fe7b},
+	  {0x0fafd1263fa36, 0x7c15a078933cc, 0x5b7a7e07d0d6b, 0x6d2c6f5f92dad, 0x0faaaeb36756a}},
+	 {{0x1833d074bc7be, 0x3bc90d4c3c190, 0x457183672655d, 0x0116af1a269d7, 0x71a4cdd16d1ee},
+	  {0x7335de4e67b00, 0x66fb3c1cbb997, 0x455f5c6a11697, 0x1f929a13cd2cf, 0x4f4189ab83adc},
+	  {0x76267382d9d6c, 0x1fec73a0ec876, 0x630c036c8ef74, 0x57109b65834ed, 0x550d2100bf77f}},
+	 {{0x039d6d684162d, 0x45b54e195ce60, 0x33759b0d673df, 0x01edf39470fc7, 0x04be978b41455},
+	  {0x0246b83998837, 0x5827eb7685cf4, 0x70c6e4778e68e, 0x6ce0cc74d8ea5, 0x12b09ebb0dbcb},
+	  {0x31938d1a15854, 0x0fa60f578cb83, 0x50383dde8fb11, 0x272eb31c85150, 0x1447a1c66faec}},
+	 {{0x45ba5fd7547e8, 0x59946f47a1f6c, 0x3d54c6253c8f6, 0x00cec20094568, 0x1aca1947af71b},
+	  {0x06b303c5faa3d, 0x4a8519eeb4196, 0x4215b38f65819, 0x036750b9adde2, 0x579ffae1676ea},
+	  {0x3be88121f5c74, 0x68025c356f3d9, 0x103854d07886f, 0x4157a287133a0, 0x5f48e4b8e9ede}},
+	 {{0x21c578a7d6528, 0x24ee27740989a, 0x243a885b26830, 0x7434754332b7f, 0x0c306488bc5d8},
+	  {0x3378eadeee257, 0x4da346787e54f, 0x415abfc6b9826, 0x755c59fd10bcd, 0x64ab73d6be3c1},
+	  {0x437cd9db5dcb0, 0x0dd173172a6b5, 0x5623e8ea6f0a4, 0x342eb216adea8, 0x7c146e9206ed6}},
+	 {{0x478e3eae65342, 0x0e78247e409ee, 0x24a2444fd1b40, 0x1e157fa68d3e8, 0x2cad651f5939c},
+	  {0x5032f08921e6f, 0x522a47c7274ed, 0x631129c8f92bd, 0x6bd195270791b, 0x75fb81b73594e},
+	  {0x5568dada18fd2, 0x1e98ddae5c690, 0x6f8e3097c5941, 0x6845467be8035, 0x2109d47da9260}}},
+	{{{0x6f4c821a14a0c, 0x02e1bb4d4e3c3, 0x48d60dabb9752, 0x61fa5d46adcc9, 0x580681732783e},
+	  {0x74a4af052b1fb, 0x347df4aeb1d6b, 0x17bef54487cfc, 0x1e0870a9cd033, 0x5e78c81f17617},
+	  {0x00a8e8ce1dd59, 0x0d49e8385ccf7, 0x0ff4d3695fd4e, 0x350c841745442, 0x5930ac6ee09f2}},
+	 {{0x528540634717a, 0x013e9d85e5b96, 0x3d684c80473cf, 0x67a80fd224b75, 0x0bef6dce2f3d5},
+	  {0x5521752ff46fa, 0x23b2b731ea811, 0x25cc79bb1c7f5, 0x42d1fde8ac6a3, 0x4ab5a2480bcc4},
+	  {0x0a46417cbb74b, 0x4810dd35675b8, 0x62506d1600db6, 0x5228a828188a7, 0x6ffbcc014a3ae}},
+	 {{0x67e183bd29352, 0x288442f6d6769, 0x3bd12bc965fc1, 0x4fbf1963bd562, 0x11daaf3e2ce19},
+	  {0x0fd90ede30b92, 0x78c00a1405e12, 0x5de14519f3509, 0x51ab7f2aafe58, 0x1b5ede8ba5b3b},
+	  {0x0bdadd01137e3, 0x4a81d4922f2b8, 0x565e218440db4, 0x325be9bf19353, 0x224527bc3a5e5}},
+	 {{0x66626e0c32734, 0x6ef8d26c67f52, 0x4c3d43d5cc9e9, 0x0f7c926f4700b, 0x5fad6fb1ff728},
+	  {0x0ce3b463647bb, 0x536ce4e51283e, 0x22f70e934fcbf, 0x61edbc89e339b, 0x536837ed929c3},
+	  {0x7a03183797dbd, 0x196185576b388, 0x411d53043fa39, 0x272c5b580807a, 0x187df09f486b7}},
+	 {{0x3fa1ce14bb87b, 0x17b3f153b29c7, 0x78f7968b53a46, 0x51f6742bc5a3a, 0x2c2e8543520f0},
+	  {0x53f7ef64c0dac, 0x56de0d5642455, 0x6ecd3bde15c55, 0x7d827b2d1f6c8, 0x6464066118f86},
+	  {0x20efe3301acda, 0x764314b6a43fb, 0x78268ffc45b65, 0x63e2aef87ba9e, 0x3d8de87ae4152}},
+	 {{0x0e235aa44014b, 0x41323ae7f9e06, 0x633331e846275, 0x418b16123d5bf, 0x0247d093e9975},
+	  {0x3bc350d474f8b, 0x3121340b791d5, 0x08206528d7163, 0x0b40f112d41af, 0x04c4859e611bd},
+	  {0x1489a38727313, 0x20a427b658898, 0x71c0582e03c96, 0x046dd6166cea0, 0x1e6d729b71cf6}},
+	 {{0x2d8c2abe32060, 0x4d560070c6118, 0x5356a3cf5291c, 0x5c2e10f9a6950, 0x0f0e4a5453822},
+	  {0x00ca23f692a35, 0x7a6980278433b, 0x24fa16db6fba6, 0x43102593f4f54, 0x7218331e285d3},
+	  {0x623feb2b4e660, 0x402d27c881e45, 0x481ed2dbe086a, 0x71c923d749682, 0x0f54531cde38b}},
+	 {{0x0bc2971a50b5d, 0x0d13f9f6be880, 0x25b58d297904a, 0x5ca19e1a72f83, 0x0b01c2e6f36e3},
+	  {0x3e7abca0c26fc, 0x3ce116338769a, 0x4762d3cb542bc, 0x20f4d6af63f95, 0x26498b3498dd7},
+	  {0x6af42db7a6f8b, 0x7b74578a7c01a, 0x78bf009a1212f, 0x5bc8924c37e2e, 0x430a4a417254f}}},
+	{{{0x59ee933b835df, 0x28521bd26da6c, 0x1ceb1245649bd, 0x05961306cf42d, 0x2fcadaf6293ae},
+	  {0x66d517cfa9eb4, 0x29abb8c10edc8, 0x5ba34466a39b0, 0x47c3efb39f87a, 0x5175ce8c05965},
+	  {0x05b94ba420dd0, 0x1510c13fb78fb, 0x010400959d732, 0x681ccedee1060, 0x1caf81d6a34b7}},
+	 {{0x279f93180f461, 0x13cdb55f91146, 0x402693ced7739, 0x48b5ec3807da0, 0x5b6538579623f},
+	  {0x128fe940bb90a, 0x75dcae8e92077, 0x0a47dc0e50a1b, 0x1c4e584c3be01, 0x2568e1d13855c},
+	  {0x6e5bfed36f32f, 0x464caf4dcf9b3, 0x0ff88f24d6d85, 0x7d7167ec0bd98, 0x2a5082cc5a6eb}},
+	 {{0x5fe386d8f5f30, 0x176498a1cced1, 0x71925e3507468, 0x4ebc593254db8, 0x49a0b2cc3dfbb},
+	  {0x1cb703640c4da, 0x4b7d2e01e3477, 0x4b2a9571b2523, 0x328352518a100, 0x135ad268bc047},
+	  {0x4a9a76a76cc9d, 0x448b7029324c2, 0x63a58e855125b, 0x375adea42d837, 0x568a5adf05c11}},
+	 {{0x01d47ed26db0a, 0x676e24b7719dc, 0x08db3cbc37e72, 0x211ab9cbe912f, 0x221dfb229470d},
+	  {0x41bfa584f774c, 0x0904d67848b5e, 0x0fd7af275dc93, 0x0b553fd546983, 0x1bf46d6e168c3},
+	  {0x11ef3a8ac229e, 0x2ed86c5686fd5, 0x582546682db06, 0x10c100b9ae44e, 0x3256f2084fd66}},
+	 {{0x55ac4fab02fd0, 0x22b37d304abdc, 0x1ebafd59d4b84, 0x150a7289c1a41, 0x6f148536c13a3},
+	  {0x448be99b321a0, 0x149fd879ee2e9, 0x40669e3a8d0ce, 0x0100570f3401d, 0x428526802ab60},
+	  {0x4a69b3eb0242e, 0x062d7179db795, 0x723b06ec0a21b, 0x4c15d0d47aee0, 0x3918e59cded21}},
+	 {{0x648c2dc0f50c6, 0x102d8833f9cc7, 0x71c09af5e67a1, 0x3f95353d6b332, 0x7364be12d1186},
+	  {0x344779713dd9f, 0x41bcda5927d2f, 0x4b15b7ee9fff3, 0x55f3baeb2dac9, 0x43bd81687e1c0},
+	  {0x6216c6149a98f, 0x5d0b4748451e5, 0x1a87b62a64385, 0x638ae363ef127, 0x543cd53e5f13c}},
+	 {{0x555153f3dd9d0, 0x1c3a740740e14, 0x1c716e6b1b68c, 0x1aa0a73c81e23, 0x2fbd79f0ac351},
+	  {0x7e5a796c1e3a4, 0x5b9b347b81839, 0x13eb9a2736da0, 0x388fef3817846, 0x3fdf7536b5e46},
+	  {0x59f14542fc618, 0x225b4f3f6a816, 0x5d355194485f1, 0x038ebef0306ff, 0x24f9db3e65489}},
+	 {{0x1f294f0a67baf, 0x7923f985ca156, 0x3d410a6df03e8, 0x70dcf0a088016, 0x1fbb59ec25f26},
+	  {0x72c1680dbacea, 0x5dfa725135871, 0x691b3611ba2bb, 0x730cb21825c30, 0x100b90afdcd37},
+	  {0x612809a18b9ab, 0x7e0e66020eee3, 0x176cdf0196fd2, 0x19fa8ac066275, 0x78239f492e868}}},
+	{{{0x051175d739771, 0x1f25b0740d0fd, 0x6032c1521c3d5, 0x0ba654986ea89, 0x20c29c18280d3},
+	  {0x5d765b20b907e, 0x6495b99dbd7b4, 0x46ff376df5fa7, 0x5b5712c93507d, 0x7fd93ade8f4f3},
+	  {0x5b92abdcad548, 0x39486a99d5814, 0x7ce8b5d9b4133, 0x609cdb3cafcd6, 0x4a7fba3c3bb9b}},
+	 {{0x7f566bb4bd92d, 0x0465d1f41ce2f, 0x5caa3e7b660a3, 0x3254afbb4089f, 0x1c3b5ed720938},
+	  {0x5b3da113dd44b, 0x64f53e174e426, 0x0be8c8b16d1d6, 0x633d7eb9cef04, 0x45d57cf875d99},
+	  {0x7826b93673cc1, 0x6b0b5d52de8ee, 0x062da8b659194, 0x4ee40a2db2836, 0x5e03f597800a2}},
+	 {{0x31d90de728b7f, 0x6fc469daab631, 0x2627eb0aa6abe, 0x19b4d680c6f47, 0x467e93c6b9cbb},
+	  {0x13a628a2994d8, 0x61497d0c4af79, 0x7035aa2ede93f, 0x60d4304e9d662, 0x796feda948c10},
+	  {0x024225b07babf, 0x29c6be1991801, 0x15ccce2925e64, 0x58fab11172a8c, 0x7fec7e2e8b873}},
+	 {{0x3d47748446be5, 0x5f2633415a656, 0x341ae4d1a5353, 0x2b73011dae1f4, 0x5b816f8dc3413},
+	  {0x40be2daeeca6c, 0x60d76a582c5b0, 0x6d6ef57741c5b, 0x36b27f641917a, 0x3d4eed13ce6eb},
+	  {0x2ae38d59738f5, 0x222f5509f3621, 0x67f6beff20365, 0x507e0e0a2931f, 0x644ebfbe91610}},
+	 {{0x1b724f51384bf, 0x7a5417e81c81b, 0x005af705328d9, 0x6ecfdd579558a, 0x692c9d51d7501},
+	  {0x7d8e6ddd4014f, 0x5e8d5bf0bf3db, 0x7c4275b677158, 0x4add65b266be6, 0x0ed7299c21322},
+	  {0x23eedf78d51cc, 0x50a48eea2f12d, 0x08f18b1ed17e3, 0x26dcbed167986, 0x46983f45fd592}},
+	 {{0x4b06ec4c5b158, 0x0843d6d3d959d, 0x3b73cfa867261, 0x20936a52843c0, 0x787021f6da281},
+	  {0x227eb828b4aa0, 0x2b73fc5b6b738, 0x1a9bf8ac265ff, 0x6bd0aa123788f, 0x15b3163d95ca7},
+	  {0x2964638a55569, 0x130ca51536b73, 0x10ece114b6df9, 0x74993a387d493, 0x40dd5abeee46b}},
+	 {{0x000878b073ea6, 0x739117808b14d, 0x521b6cc88faf2, 0x2bfc8d351a3eb, 0x1ed41c98a2144},
+	  {0x121d6a9e899ca, 0x6e15839cbb6bc, 0x261ce01fbd72f, 0x0bc18420bcec6, 0x0c30f71fa70b2},
+	  {0x1629c3461d11d, 0x234621b062fb7, 0x7a47e614a065c, 0x28e613f9d3037, 0x54cd44707f81a}},
+	 {{0x31e6029ed0044, 0x4ac7c9028712c, 0x0be23b427e1aa, 0x1e96958f0da84, 0x6735a59842317},
+	  {0x6953fe4753e08, 0x7e9a887df7582, 0x00418b2e978c5, 0x406c165768d7c, 0x61fa24ac868d3},
+	  {0x36ab94d47a5f0, 0x14de488e26a7b, 0x43283011858c0, 0x75e91d44b66d2, 0x37a73f230d252}}},
+	{{{0x482762bbe6b4d, 0x2f57e39f59771, 0x19aa9fef7207c, 0x7d57d29883b09, 0x73fa7e3931b48},
+	  {0x48445d66aa481, 0x4c0cecaed8e3b, 0x5969288f6856c, 0x392d5470acda6, 0x3e6ef719dfe7e},
+	  {0x7b8d2090a7d83, 0x2a16e0c89ac0a, 0x5b23d8167754e, 0x5be64722953eb, 0x0b66681d7c355}},
+	 {{0x3f5d58667d437, 0x72dc48270343e, 0x5ebccbb19bf4a, 0x58d3635ac0b42, 0x426a0fd38b14a},
+	  {0x6ac24861cced5, 0x499ecef6123d2, 0x533f54102fe72, 0x7db929dc31b2f, 0x17a7678d0e478},
+	  {0x53fa2b80c852c, 0x10a03437bda85, 0x55d7d2bbf33a8, 0x26491a820102e, 0x188ef44e52c97}},
+	 {{0x1cf0ac89a4b63, 0x68318098811e5, 0x585d5033c9cf9, 0x1d67c88de595f, 0x33af3c120c727},
+	  {0x448bc3d565b84, 0x201cf76fac89c, 0x3e4be65665d97, 0x234615d1c4568, 0x25ddeb45ae3c6},
+	  {0x4839ce4398279, 0x2505460729620, 0x5987b7aa38b98, 0x087084373d340, 0x0d388aeef5531}},
+	 {{0x42d9a7502f536, 0x3dac64ee04ef0, 0x27fb31c949908, 0x122b1e657450e, 0x5f6ba6e9c3fa8},
+	  {0x75a6477597b07, 0x42f72697cc03c, 0x1c2df2b93df88, 0x1ea3d4b1f4c25, 0x681771698bbe0},
+	  {0x2511f2694cc86, 0x77306fe73b4ef, 0x25f35199354b1, 0x69077f47c550c, 0x56420eb115574}},
+	 {{0x7df21e6e3502c, 0x7324411d0206f, 0x71fc1b144f730, 0x6a071550975cc, 0x20d6fcc37b16c},
+	  {0x04703db333d80, 0x5143124a105b1, 0x02ea5474e90d0, 0x708d979523803, 0x1a686bd8a7dd0},
+	  {0x0083aedb09a49, 0x55b859080b0bc, 0x45b8b4d807693, 0x7ac079c78de96, 0x53373a6d456f7}},
+	 {{0x240c1179949b2, 0x7130ed79265eb, 0x5a573de56f130, 0x443b05baa012f, 0x50503981ccadb},
+	  {0x2d2bc3efa996c, 0x4e3bef25fc83c, 0x47a710aa1c02a, 0x2eac07eda068f, 0x3edca200d306b},
+	  {0x7d8d8ad7bf8fd, 0x460dfd8be7563, 0x0dfa9cfca44b7, 0x622805f7d03cd, 0x061b165792007}},
+	 {{0x2e0d053321bab, 0x76987657095c7, 0x769d6bbf49903, 0x109d5a2b8e60d, 0x53ac580a92bf7},
+	  {0x238be4cf9357e, 0x70586e0bba089, 0x22dd75ed341aa, 0x023155bd241ff, 0x4e23a6d9bffa4},
+	  {0x5c6b4ecd4a7a2, 0x33fb983f4cb40, 0x3476fa1dca4b8, 0x1d33eeafb0641, 0x6cc9f9209aea9}},
+	 {{0x106a0a71ade71, 0x30d827cf8b8ca, 0x53e8597667191, 0x442a3e6d39b0c, 0x78b0ec628e448},
+	  {0x69f59a66eef40, 0x5e716e0567bd4, 0x30b71058e62f0, 0x5c672a4907f50, 0x03e32983fb9ba},
+	  {0x0c1ca33166a80, 0x4024ecd694f1c, 0x02f44feeab34a, 0x129af34b80b19, 0x33b29032496a2}}},
+	{{{0x20e47497cf040, 0x5c019ba5a59ce, 0x4058f3aeeea6c, 0x3eb198a84a5f7, 0x30f0d16fa3996},
+	  {0x2fac1b4d25e69, 0x06aaa5489a496, 0x0fe65bddbfe0d, 0x6d5da39a86b8d, 0x2da2769236635},
+	  {0x32b9eb94f33a0, 0x00cd4462053c7, 0x52480af7c36ff, 0x128ede0f92c42, 0x10871f0aed7a8}},
+	 {{0x31be648263422, 0x29ebd08608bdb, 0x47e49fbe3e662, 0x69e31ce167aca, 0x4c37bacb5661b},
+	  {0x7191f28f3bb0f, 0x66d5107367c6a, 0x5630d975fa31e, 0x23d50dd91600b, 0x6e3b90e052f50},
+	  {0x4344d117748c6, 0x5fb919207df43, 0x0c15f006b6d87, 0x182d8bc4c8eca, 0x2194a6910fd7f}},
+	 {{0x79317975f261c, 0x3b27c354a84b9, 0x6034d0632b4db, 0x6bd5f1a686617, 0x227a1a4b128c0},
+	  {0x4aebd6d8ed551, 0x63f8e12ba91ba, 0x7ccca362322c1, 0x583f74d680de6, 0x4dbcfc5973250},
+	  {0x3012c7275b37e, 0x7c1e6be45b051, 0x3e30e7120d51f, 0x21519c16a75ac, 0x7944bb74e4d51}},
+	 {{0x7bfe598f4f694, 0x24ec65e795aa0, 0x3e3a8cafe9dfb, 0x42c8ae5b6039e, 0x05070fab3dd3f},
+	  {0x5641699fe7e9d, 0x673ff1ea94b66, 0x0f5b6a475d55a, 0x272ecea6f818a, 0x39184a19a0140},
+	  {0x3f69b8253620a, 0x3a19a47d648d5, 0x1856e985bc727, 0x6f8d95cd2d404, 0x4a3c6ba39d822}},
+	 {{0x29aec50f521e7, 0x17efb20faffa3, 0x597075fffb0d3, 0x18e6ea3f97409, 0x7af5178a882eb},
+	  {0x28712a948b7a0, 0x42c36718fcca0, 0x11744040bfe5c, 0x718e00ec6b6c8, 0x1634612a93a83},
+	  {0x01a2781be4483, 0x15d308084e901, 0x3fe92afe3e28f, 0x684bc60f8f1ff, 0x06c5ff5b8b991}},
+	 {{0x1ad487aa85126, 0x6347a0a909f41, 0x675c308ecc0ab, 0x77d705f69d2e8, 0x3d6c7d730e708},
+	  {0x7beffb8eca343, 0x7ecd796d5320e, 0x1560d62debd37, 0x6768ac67e3438, 0x4725947144d51},
+	  {0x30e2c01d5f4ed, 0x56601c399fa2c, 0x1227094b03624, 0x2a3dfa7c82394, 0x40b4791520c6c}},
+	 {{0x631907c53b70e, 0x5ba73c627fe3c, 0x2ff648119e22a, 0x2504aeed54144, 0x76687998b5cdc},
+	  {0x067608bcb0430, 0x5bc016b213eb9, 0x138f9077b7974, 0x6787c9ed3d793, 0x633a1c515ff7a},
+	  {0x268538539e119, 0x6de6113af6ac0, 0x639322cc4d4e1, 0x26375fc537a2f, 0x770c96457ed6c}},
+	 {{0x71eb8850b7490, 0x47390b68ad71d, 0x3ac052baa9829, 0x26ba8f9872e0f, 0x498ff0697c814},
+	  {0x20e5fd058616b, 0x4197d9c459c82, 0x4f78eb1e644cc, 0x56fc956481123, 0x349db6796ba05},
+	  {0x21161798ced35, 0x26ec907a49aed, 0x6152fb65abb8c, 0x044a9c7dd39b9, 0x5764ab9a185eb}}},
+	{{{0x19f44fd74dd11, 0x638458625d00d, 0x50f7b2fd3d6ab, 0x27b39c2dc8b54, 0x0871bae52250c},
+	  {0x7a87009162319, 0x098eb7c91fff7, 0x065f420e88e9d, 0x7f8137ef851a1, 0x7fc15c2354db9},
+	  {0x7298ff8b8f57c, 0x1d5c4805915d1, 0x4e9666646233d, 0x4f0bcf5ed53f9, 0x3a88681a474e7}},
+	 {{0x6dd957313729b, 0x4a422273e8d69, 0x6445ad94a4f83, 0x2ca29eb6f6db5, 0x7483b19593b06},
+	  {0x4b4061d77958f, 0x79e83331cf877, 0x54ab49ec8b7ca, 0x35d774db55a51, 0x3e2fbb72a7f29},
+	  {0x6b14df22c4cc8, 0x197ab9d94b146, 0x46b9f8950bf6d, 0x210d923b5c568, 0x14f1be355643e}},
+	 {{0x7e4fcef167017, 0x1483eddb4f284, 0x46c39f3ae031c, 0x6f6039b14eb7e, 0x3f0abc2a4e4bd},
+	  {0x68647113db861, 0x3489315f08667, 0x711e5f16c7b5b, 0x2017e241993c4, 0x105298d318b52},
+	  {0x4df01466dca22, 0x1ea7454187eae, 0x69f63d3dd79e7, 0x0f82454ce568a, 0x523cbc98e1a46}},
+	 {{0x23b02806f6f14, 0x3325a0de9be73, 0x261e27093723a, 0x3e28e715ddcb3, 0x5ec7d59165ea7},
+	  {0x315eefe0a1ad6, 0x3434fc17d3fac, 0x1e01e864daa9d, 0x671a60866d082, 0x44d34af992ca3},
+	  {0x35f92f738108a, 0x27529765bd703, 0x6c34e494264a1, 0x063dbd1243842, 0x7bd7e900ee8f3}},
+	 {{0x007dca39245c2, 0x6576f64fe46d8, 0x0bf43b8475b80, 0x5967271edd401, 0x5c1ee6fe75f71},
+	  {0x68474c5ad7c67, 0x5beb42c1f1268, 0x5bf908199fe9e, 0x0eecc83aeeaf7, 0x76a0bc12912fc},
+	  {0x18614a225af18, 0x2474c63d77a39, 0x145e37a51d1f9, 0x0309ff68d57e8, 0x18c00c8b940eb}},
+	 {{0x73b0252101a18, 0x24ab97fcb9734, 0x5961cc4b96778, 0x762aa904d2644, 0x60a4dd6bb3b7b},
+	  {0x28e63522e1d38, 0x3ea7cf5a1da94, 0x0ada1af96238d, 0x742d0b5184bde, 0x1aeaa793cf641},
+	  {0x5f921b7c31243, 0x4b145a7841c85, 0x6be5937114589, 0x007e3bf45efe5, 0x4b7ffc3abf021}},
+	 {{0x6cab9a521c746, 0x570245a8bac42, 0x6278e923d9bd0, 0x6f82e74b3930e, 0x05cd3d6afefa6},
+	  {0x49f3e7cd55466, 0x495c988cd369d, 0x4f69bc9122309, 0x506c10b8484ef, 0x7aa96098e32c6},
+	  {0x6581f29ac5a24, 0x5d828289788ae, 0x4874c10eda94a, 0x6bf064fd2dfd9, 0x6e3e92bcd8275}},
+	 {{0x05632fa101617, 0x1767ec789c7e5, 0x1cda5904668b9, 0x27f520fac3d1d, 0x6c0c1f6bc257b},
+	  {0x5c69114829f1a, 0x07773ff2d4ef6, 0x5f93cae879d11, 0x4cfc3700021f6, 0x7f29d4ad43598},
+	  {0x3d77e1159ca34, 0x43cf962734873, 0x474a02e7b1718, 0x2e5c72bc55400, 0x2c8299d615957}}},
+	{{{0x10b8789ce15b1, 0x7e8609d5e74cd, 0x2a1f044965819, 0x331169abaf295, 0x1eba5a5c55a43},
+	  {0x237efe0d24ef1, 0x70bb0a2ce48ff, 0x185d819da23e0, 0x29d06b25a3dfe, 0x5c05ef22fc6d0},
+	  {0x55ea1d489c9ae, 0x2d8813b577c77, 0x2c02f642c7dc4, 0x5d143babce3e6, 0x51b7f3132189f}},
+	 {{0x0a76a378df541, 0x7bff711726ea7, 0x6cac358ac1965, 0x09dcc1d557469, 0x156537c378090},
+	  {0x74a5d9bb3f8a4, 0x0187d6eaedf16, 0x109d731211e61, 0x665a9e8db2463, 0x657a3a6231059},
+	  {0x6fbf070a303f1, 0x6d38ca834e54c, 0x70f2551c29658, 0x0f78ef3fa46aa, 0x70b7a78a02d27}},
+	 {{0x0f7a1fd565c5d, 0x25c2d839c68bb, 0x1815de71aaccd, 0x1e99b8e6465f6, 0x09c29b51b63e1},
+	  {0x20ab6baf15528, 0x403456f3da158, 0x3ac70249eac3b, 0x116eae72f7660, 0x3dc12ff8f7bae},
+	  {0x4a62b557643e5, 0x79c5344821453, 0x4e647c76b5d6f, 0x42b680204962b, 0x1b639d97803f6}},
+	 {{0x7f2cd59d05317, 0x7dd1741d483e3, 0x446c06f3fa51a, 0x19b6bdeeef926, 0x7141b267edb6d},
+	  {0x3ef963773b1d7, 0x5d6b0558b6a6d, 0x3967994286a7f, 0x1fc1451e14470, 0x4b660ab4d7eb7},
+	  {0x6c07b3626613a, 0x555514fd3cb54, 0x37b106abcaffe, 0x1523d6476949a, 0x173de5c80bece}},
+	 {{0x68b20234c6cf4, 0x60cfa9ef1df67, 0x58759839cbdf3, 0x16a0722d20960, 0x7099b46db3ae2},
+	  {0x5b27cd42730af, 0x386f5408dcf7e, 0x338c7b174540b, 0x7afecc43712a3, 0x3f07ef76d48ed},
+	  {0x48c12bbf6db32, 0x43e4121604e96, 0x563c91cea02de, 0x3a0ec0d6c36ec, 0x3148142de7796}},
+	 {{0x6e05fd2d2c505, 0x68576e660a436, 0x0e9c7dcb62b79, 0x5a40cc978ad60, 0x5bad81870fc49},
+	  {0x1e7a842fde0e9, 0x7b0626182505e, 0x5d150574879c3, 0x430ad45b1f9e2, 0x4feae9f4d35ad},
+	  {0x172eeabc6ce1d, 0x484f968ef4723, 0x66fa1cba1950f, 0x064a5dae06a0e, 0x389272d12c301}},
+	 {{0x4116643a2ae4b, 0x25363d0a43ca6, 0x142dc05ecd746, 0x27e57382a4df2, 0x5b69209ba48a5},
+	  {0x7f83a293256fc, 0x2baa595e4760d, 0x1957f66e88c1c, 0x0420cebea1cdc, 0x41983a9baf7a1},
+	  {0x0fbf7e1ba8cfd, 0x6a87bcd6cb9cc, 0x0cce87096c366, 0x5738df769f356, 0x6bf25d30b3a35}},
+	 {{0x15686a3ac86bd, 0x49e5618a2b0f9, 0x04db5a1e4ba76, 0x2440d0c222c87, 0x2d5b59a6e9713},
+	  {0x1ade61ea0c118, 0x62c7a0c1299f8, 0x686d89cd5e6b1, 0x7d06f3eec3f8c, 0x7eb6ae3a0269f},
+	  {0x3f62545a2cae3, 0x482a46aa8c282, 0x52124bdb62d2c, 0x257dd45e63374, 0x6d6f951caa665}}},
+	{{{0x1742b76a6b462, 0x577ac2bef818c, 0x4b06814a498b3, 0x2074dd912f683, 0x02c354446611e},
+	  {0x38878d0b6e460, 0x47a79088933c5, 0x2583ad8720a1a, 0x7f4df57e3b991, 0x49e2b27faf3ea},
+	  {0x6426fa17f3bf6, 0x4ca82625f77f1, 0x38ff022253236, 0x22146fe9112fd, 0x421b7eaa68499}},
+	 {{0x5f13ae2f47c89, 0x267e4fa2416d3, 0x50dd9d375b967, 0x1939da8cb2968, 0x60d908507ba29},
+	  {0x6feaf123e8e7c, 0x529925d154408, 0x6558afbeece29, 0x542639d06cb56, 0x0b8cf1a9eaf53},
+	  {0x58fe44194ede9, 0x063d8d81ac89b, 0x22ae64f0a6a20, 0x028dd3c18c7f6, 0x19457094755c3}},
+	 {{0x617d1023e9913, 0x535af879cc1ef, 0x7964339087e3e, 0x2088f60e13cc6, 0x01ad5e04d73bf},
+	  {0x2d49ae87d513c, 0x099dfde29d693, 0x15dbb9361f3b9, 0x08d35271f196e, 0x4a5537060e95d},
+	  {0x7e24e40af4e36, 0x617385777a62e, 0x43f7993afe8e5, 0x57f6db2c59a42, 0x468acf32606b9}},
+	 {{0x4715b9a833ee3, 0x0c457d8db39e0, 0x5a67ca835144a, 0x49bc28510254b, 0x28bc22b24719a},
+	  {0x2d884cd13139d, 0x586f45f5c2f90, 0x010f0c032eb9f, 0x0a3b143dbc68c, 0x016225fd93987},
+	  {0x0690170701b30, 0x49806b8ec3f02, 0x53544b9070ce5, 0x0c46b958525e1, 0x39c2998ebdec6}},
+	 {{0x36a9264f5130a, 0x533f7df32cb3a, 0x5972b0d9a49bf, 0x334b999e37e33, 0x2e814a99b925f},
+	  {0x1eb91ea1b9b29, 0x6d1617064c1b9, 0x70e24cb4249e9, 0x59c36d8dd3502, 0x08ccb28c29418},
+	  {0x3074ae95a7af2, 0x702a4587d8079, 0x77994649463c2, 0x7ac0e54caf622, 0x35510d3db30fa}},
+	 {{0x61d7dd74fe6ea, 0x60e4fe2f9cf29, 0x1bf553794c910, 0x04365c90fce00, 0x3de63a6f65aa7},
+	  {0x6d11e30be4536, 0x09caa2047740c, 0x1228da980c0d2, 0x488f233ef81f8, 0x7b21506176ca8},
+	  {0x68daaf2255da5, 0x0c05d798d0390, 0x4205fc2b17480, 0x70edbef0410b7, 0x70266026b5893}},
+	 {{0x7667172eaf14e, 0x5afa9b87f51e0, 0x52641c30ca3e7, 0x66e64ac432ec3, 0x3cdc6cfdd2e54},
+	  {0x1d31a3ab88875, 0x7e6b63c765915, 0x194bd4325af82, 0x13e977aa97c01, 0x3154a43de84c5},
+	  {0x41a14f6b911cf, 0x0faa8d2514d54, 0x235a47737e23f, 0x4e85297a8ac3d, 0x5f6699e570f02}},
+	 {{0x4c9eef5e6ddcb, 0x73d3152461929, 0x5f83d9bf41c7e, 0x7b264c9651209, 0x5514e4b85359a},
+	  {0x0c4d567599dfb, 0x5c2a628dff3bb, 0x55b91f5191510, 0x2fd015aab58e9, 0x6188e53c011aa},
+	  {0x388595b558095, 0x0b6e4fc30f14f, 0x76a47fecd9998, 0x47dbc3bd74934, 0x3249f147f6306}}},
+	{{{0x63bee40af1d13, 0x6bd9c9e60b5ee, 0x04e617a318824, 0x3a78adb87888d, 0x064dca83e55fa},
+	  {0x15cd64e3260b7, 0x7c9570cfd3796, 0x1f09a4873ca3e, 0x085124ecac3a3, 0x397db157ca1cb},
+	  {0x1e069ac415633, 0x73ea56b3c7cb4, 0x20e2e7a710ec1, 0x7a9cdcdd76c57, 0x509242445aff3}},
+	 {{0x42240bd804d03, 0x689890c93bf42, 0x4648317b0c593, 0x4655fb9a69457, 0x15ff61a914500},
+	  {0x67dbfa9635afc, 0x66abf5abfec70, 0x12fba24df1692, 0x7ecf69d6d8dbc, 0x69deaf8154d65},
+	  {0x6501eda77a46d, 0x3bdfd83bc87f5, 0x05e2795c2edf6, 0x7dbcf3453dadf, 0x62a2a15815c53}},
+	 {{0x5ace94d8c6b7f, 0x5efd763bb3c9a, 0x002df608e4989, 0x0e3abed95bce9, 0x023dc29dfcd4c},
+	  {0x0f78d5938b925, 0x5c298df336e82, 0x53d91e98a4759, 0x62476cdaf362a, 0x03dbeba4b69f2},
+	  {0x186d76ea32d3e, 0x73c4d6b4bb139, 0x111f539f36b89, 0x658d1b861717a, 0x0739c1b541e9c}},
+	 {{0x3660b99de144f, 0x47744cf741b8a, 0x37605263e2d27, 0x4f71ca32e9cd5, 0x2d30bebec4856},
+	  {0x694dd20fb0f41, 0x45716d47fd78c, 0x15c27a0971220, 0x741525251d2d1, 0x6c9c119c11bfd},
+	  {0x0e1396724aaa4, 0x27988180a4d47, 0x3d18714c9e734, 0x37b9fa2101d5b, 0x033a9fdb8bfee}},
+	 {{0x59020bc5d73be, 0x30b7a98efbabf, 0x716b69e674285, 0x003d2d26e7afc, 0x7ec06484502a0},
+	  {0x51eaf112c8cc1, 0x024f05e3a7028, 0x40951d6a69f82, 0x480618645e71d, 0x50bd16f8bc235},
+	  {0x2d6e3e5cfe8e9, 0x633cc3974acb4, 0x054fb75acaa54, 0x65359ccfe7b39, 0x705251569f079}},
+	 {{0x394bebd5cf61d, 0x1698ab07ff65c, 0x0eb703c24d2ae, 0x07d20fddbc06d, 0x66962e77194f4},
+	  {0x23871d7f61972, 0x7085488549cf0, 0x7234365f0a5c7, 0x7b09acb845a91, 0x3d02b91152fcf},
+	  {0x2c38521f0978c, 0x29dd8c9eab656, 0x4bd236cfaf095, 0x2b895198a8abf, 0x5ca26f6154f39}},
+	 {{0x11bcac575d0da, 0x517565bca7230, 0x5a6fa9bcb055c, 0x6a5704e56679f, 0x664845428969c},
+	  {0x002c2f834e953, 0x4b7bdff2395a6, 0x49d0875ba360f, 0x543c3be0ad148, 0x55c006d97f64e},
+	  {0x109b3088dfc1b, 0x10d0dee18d9b0, 0x133e271ca5492, 0x6a88653136818, 0x15213576eb442}},
+	 {{0x4050728cdc4ec, 0x4ba7a3a696895, 0x7cdaea439b013, 0x7c53b00731cb3, 0x4d22c3b04a618},
+	  {0x440f029cb8bfb, 0x28e95bb0ee31d, 0x79301e8126770, 0x03ac95f5cbc0a, 0x3413e3129eb85},
+	  {0x0934a0e046f34, 0x1064779e26c6c, 0x0ddcf0ba8f967, 0x38334a55ffccf, 0x186788a8b732d}}},
+	{{{0x4d1188decf27d, 0x3675447c54dd9, 0x4a24c28d67624, 0x4f3c4de0b0997, 0x583c508219d15},
+	  {0x31b260cb3b487, 0x5310bc4c55e80, 0x1c04fc2745cec, 0x346e363068e35, 0x5cf93c0ccb9ca},
+	  {0x55842ec98e3db, 0x2616b43506613, 0x683779a655d8b, 0x0a9e09203f6a3, 0x2185a2390c8e7}},
+	 {{0x42610e01b6252, 0x3aef339404d2f, 0x7d2a6ee5a61bc, 0x64820fd124264, 0x6308151938a74},
+	  {0x5f79e67b43691, 0x55a79987dd5c7, 0x1810091fc4afb, 0x011ac078b6f8c, 0x271b71fb8c6bd},
+	  {0x196d83d0a661d, 0x7c378b4b9432c, 0x133ce534ab541, 0x764313469693c, 0x7887e24e7baa0}},
+	 {{0x1e33fa1f52c93, 0x7d2d875934956, 0x073827e26cef5, 0x72a7e0f8e5b13, 0x7dce7831daa1f},
+	  {0x7e9fd15d78230, 0x6501bd50f466e, 0x74bea0752a3b3, 0x719ad8b836706, 0x0109eba43abd2},
+	  {0x77a5ee3e9b606, 0x7c5895c39ae73, 0x051fd13e8beb2, 0x40a79fa8fb854, 0x11e9471dd886b}},
+	 {{0x599536a3a8195, 0x199383321e343, 0x5eda8df4b4832, 0x2bcc21c145233, 0x3df6a875d1627},
+	  {0x42c110dec1bdc, 0x2a132ecdd982d, 0x36a7368e4302b, 0x58fc75d49904d, 0x6af0a99fb162a},
+	  {0x2c9dfede06bc2, 0x7bad35d885575, 0x19e910a6ff2f7, 0x5bb022a7a7bc7, 0x15257f17749aa}},
+	 {{0x0acfbe51b69d4, 0x196135a1c3808, 0x3a736f3c68632, 0x7d2503aa64e6e, 0x5232de80faa47},
+	  {0x20c7376cf8457, 0x3159092133dc5, 0x6781ca13d8c99, 0x7533baaf231aa, 0x775767744519e},
+	  {0x2423643ea70bc, 0x1bf0817cad32e, 0x0e9c30429f498, 0x1fe661f3dd490, 0x6c38b926e282c}},
+	 {{0x6bd6c33d16954, 0x70ac6b2f3d691, 0x17b230f0024c8, 0x1211d17f7cc71, 0x119ff5254a394},
+	  {0x55abd3e0f3a50, 0x4dfeecbd6c979, 0x4a6a5b0aec4b1, 0x4a4343bf8cc71, 0x6e73567b82059},
+	  {0x5bb910648d39f, 0x1a28d7083859a, 0x1685be15b4c21, 0x4ef1be871e630, 0x2ea182aff5f20}},
+	 {{0x5531de7f009de, 0x04787252c4b58, 0x751817f1cd0aa, 0x5ea6515e78d81, 0x75957bf8fc17f},
+	  {0x0fb2acd62a8a2, 0x40134afbb3e38, 0x6098590af1217, 0x0d3b57f72d797, 0x1ef9fd7c99b1c},
+	  {0x4bbbcdec51fd3, 0x2727cccd7e609, 0x68a9afe044d16, 0x41dda544d6360, 0x14535375c79d0}},
+	 {{0x37f72eb96fd18, 0x22294acb76030, 0x730c3e189f645, 0x65d26e07fcddd, 0x3912f312d23f2},
+	  {0x45d0b08e55459, 0x10de6f3fe6c1c, 0x7aece22e3fb1e, 0x402931a545bc5, 0x3d815d9176360},
+	  {0x2d27d3483216a, 0x446b89d26c603, 0x3242c7920aa22, 0x41d20c43661fc, 0x7f64d408e99dc}}},
+	{{{0x20b32385f3b4d, 0x7e2df44f8b5c0, 0x2e2a4906b7881, 0x46251db2cc6d3, 0x36f516d92991d},
+	  {0x747e62e29263d, 0x13219e78de7e3, 0x52c25e9757541, 0x2acecaeb47d8f, 0x773d43a277afd},
+	  {0x38f6cb87866a0, 0x7f6e28f88c382, 0x7648215c641b7, 0x1ba48f74f9613, 0x2491b16b67746}},
+	 {{0x71858533c672a, 0x31e77a070570b, 0x5a58e7f2b8c33, 0x6868c406b7088, 0x092bc39273507},
+	  {0x1d819615c39e2, 0x3892cc305eaae, 0x6a3b555050ad4, 0x170e432b11ef1, 0x3744dca5b8a91},
+	  {0x3fe032d8339c8, 0x73720451151b4, 0x24bfbd648dfdd, 0x0ddd5e110467c, 0x23ee1c87e3b58}},
+	 {{0x7e4eb177174cf, 0x0103284a54b8a, 0x0cdf6fc1d0711, 0x564db8e6340e2, 0x4fe0eb9101821},
+	  {0x38dbe3de8fa64, 0x5b1a82eed4b6e, 0x304839fa49c92, 0x7a203efb70aff, 0x18f2005e8c6ad},
+	  {0x16594a3d7c111, 0x5382e2a109b4f, 0x27749eaac97a1, 0x4ce50748e7b9c, 0x64a86a4fc7ecb}},
+	 {{0x6fa7769cfab5a, 0x2b07f7122cfa2, 0x10a005a50812d, 0x7da552113a473, 0x03b939619dc95},
+	  {0x2364a5d326350, 0x7d45ea3a9bd72, 0x2a44e64c3f91a, 0x2d4d7f94ec5eb, 0x3d6523d4b7433},
+	  {0x29fb8ae3fda83, 0x68e91623f6f8d, 0x351cbcb7954b6, 0x402256728bac0, 0x6c8731efa52c6}},
+	 {{0x301941fa7954c, 0x5a8006c9e381b, 0x1885c021cd3b5, 0x6ce1d3862c23a, 0x2b14e7c298670},
+	  {0x117782a10e8b8, 0x7d0a3bd01af45, 0x573471f572dec, 0x2f8ae7ebd77c3, 0x2e0ef27dcd186},
+	  {0x594ccff1227f9, 0x680cf1c1105c5, 0x50304c59bac27, 0x0ca4b367fd32c, 0x0b331618eba84}},
+	 {{0x5223504a8547b, 0x113b4b44dd047, 0x3c2e4d9ecc2b7, 0x7531812fb9f14, 0x2ae012ef2e495},
+	  {0x1f8cbdbf4b2a6, 0x05451d378c34a, 0x29eba84641989, 0x7d11d44d0af2f, 0x372cc0bbdc205},
+	  {0x125dc810bbc3f, 0x2414f8ef4d213, 0x3b7370068d23d, 0x378f7b06afaf7, 0x7484395e07a0f}},
+	 {{0x25b50a2cc3008, 0x45c285ab8c5cf, 0x5d70d9da55a21, 0x6ad3bdd178d1a, 0x2a7bd314761bd},
+	  {0x7f942dbd7f125, 0x15fe5d4dbaea3, 0x135e060947c41, 0x4aab93ce9607d, 0x48de7137b1bc7},
+	  {0x2a31a888ca1b2, 0x574b0ebfedbc4, 0x05f16c78f5799, 0x6eb292bb5cafa, 0x635a1aec2c49f}},
+	 {{0x359308791a852, 0x0735038dd5ef4, 0x3c6f538e3e4c1, 0x21c094e4ec739, 0x6db9459234e59},
+	  {0x519ff42fa08bf, 0x1b3908bc176f8, 0x69f430b331b24, 0x612596300f7d5, 0x4dfc0947d99d4},
+	  {0x2fdf6cca8609f, 0x218ed6bf5ebdd, 0x6ccff935864a9, 0x71a95d1d9456b, 0x21a6d22024ff2}}},
+	{{{0x15ca2983c1d3d, 0x70b21790db443, 0x4a47cf635f397, 0x32d1c69bb9cf7, 0x760332aadd906},
+	  {0x528be0459f6fa, 0x470a8d06a5f35, 0x44674346df8d4, 0x5d82a3e58e594, 0x4c579c0d635ee},
+	  {0x7ff553d1be0af, 0x4ced596be0560, 0x177c5d80d5faf, 0x3c4f87f5aa7dd, 0x1d6f561edf25e}},
+	 {{0x587becb1db8b3, 0x6bf59af48fdaa, 0x56d2bdbe8679f, 0x73f81913dcdab, 0x71d88ca1a2c48},
+	  {0x034979d51ab4a, 0x24c13c63a3b67, 0x15a7dd6fd26b8, 0x2cd103aad4f55, 0x6e77843e19058},
+	  {0x5570eea6eddb1, 0x1e499c472b424, 0x3fe0214d41647, 0x7f1110306b2c3, 0x42c8b75bf20e6}},
+	 {{0x0acbad0a2c070, 0x2fabdd02657d0, 0x1d3d1e5949676, 0x1a52766d104a7, 0x081a4fe5d28e0},
+	  {0x3eb8fcb7d5de7, 0x43ce7b9943ab2, 0x59cdc64edfa4a, 0x573c761d15efc, 0x4a38d904c032d},
+	  {0x61f099e060539, 0x66129b8ebcd82, 0x78a07695edb04, 0x6e4ae9bf00d31, 0x37d47511b1c1a}},
+	 {{0x07df1141afd36, 0x4b2b44b2a4141, 0x2b67ddd505276, 0x05d99d7540602, 0x24c059f799704},
+	  {0x64e4511ba5964, 0x07c9980b043de, 0x1755ea841ff25, 0x374a9f74e727d, 0x4a0fdd46b2fe2},
+	  {0x51a0ca84d7cbe, 0x0f35e33a086bc, 0x0ef3651b8bdcb, 0x7a1a5b8691241, 0x105e6d59ac38c}},
+	 {{0x1959ceceaf8dd, 0x1ce56268adddc, 0x3a8d0131348be, 0x0d74aa8b13517, 0x04f41a800669c},
+	  {0x1a83d02f891be, 0x03c5c2724a973, 0x191b75ef44603, 0x36d0abe4835b5, 0x59b8f9760dfeb},
+	  {0x43b899b5db159, 0x60c114213e141, 0x2e15384a0e309, 0x67c54a4feb097, 0x5eaeba006cf12}},
+	 {{0x7472fd399b702, 0x5bfcfeb330594, 0x489b26c2babdc, 0x2801a924991ba, 0x4445fabcd1e79},
+	  {0x08717439f2bf4, 0x64b7ef0a6cc06, 0x06fc9e3e7b103, 0x1f8ee78c0ff2b, 0x7b59d625a95f0},
+	  {0x11d3938ffc9bd, 0x42344082b3ce6, 0x794e23c8ed892, 0x30cb9d499cb06, 0x3d16d81b2402f}},
+	 {{0x033fdca7899c9, 0x718e3984b00e7, 0x739e786e3cc8f, 0x22f5e7e6b91b1, 0x195b05d748fea},
+	  {0x2a31d8cd064d3, 0x22d2eb6113172, 0x4ebbd7d64869b, 0x59fe8aedf3459, 0x31fa81b0aa7e1},
+	  {0x500706b94a55a, 0x7079b71afc079, 0x75ecf2812dcb9, 0x249a84b100a00, 0x4a16a6275d4c4}},
+	 {{0x491efd8105f38, 0x68ea6b72efe7e, 0x5313d7b6e6f44, 0x03b0ebb68b849, 0x17d14356a0e0c},
+	  {0x02b5be83b843b, 0x558377a51d2fd, 0x5339a54f5b71b, 0x754c9d17f4332, 0x274886cb053d5},
+	  {0x4c292e2846e3c, 0x51ead70bc77d7, 0x7ed5cd93f5f88, 0x18556d0873bf3, 0x0464762db9627}}},
+	{{{0x422bed1d1cb4e, 0x2aa4b70973fa6, 0x31949940ba81f, 0x23f717b97dac4, 0x55dcfd8953e22},
+	  {0x0035bf345807b, 0x608f4c3730ee8, 0x3e49ae5f19d58, 0x5e345b327d9f6, 0x3c69e8141e6bf},
+	  {0x71ed4251d7b39, 0x69ea4feca49a6, 0x4eb451ed0be05, 0x633ad0c7c4125, 0x5db532203e855}},
+	 {{0x117fcbfec9557, 0x40f786c77619f, 0x6e587a3371f7f, 0x0dd73d18b3200, 0x40ece0242f0f0},
+	  {0x746cd4350f10d, 0x4621788dc636d, 0x1f503851240cb, 0x2c0c07d6cd7cc, 0x4b2bea2d8c0c1},
+	  {0x2b0cf069e2b92, 0x7fd958280e74e, 0x36136b39e8a15, 0x053ac69b84b13, 0x5873963726a7c}},
+	 {{0x1e5b6245dbb22, 0x1972f365e04fc, 0x0d670b526f38e, 0x1f23f59f58f42, 0x39b35014015e4},
+	  {0x6043c0f6d4296, 0x6aa97889e525e, 0x66d776263fa21, 0x7cd0fc9dd2ac4, 0x77afddf622e52},
+	  {0x4472c59f2b0fc, 0x1901c5afebbd7, 0x033ab49aea7a4, 0x149e502e371f2, 0x218a5d573da14}},
+	 {{0x3940675188148, 0x2a49ae42a2bf0, 0x4417ce62c4117, 0x7908b8a03f90a, 0x4b20e44937ec7},
+	  {0x2bb724702d6a8, 0x5379a464f42e8, 0x309864bb21139, 0x6cb859330190d, 0x3adc63eda0f5c},
+	  {0x16490932d8186, 0x7a5261ea15347, 0x2db4788e72c24, 0x05de2f9c188cf, 0x4082dd8bf2d5f}},
+	 {{0x2b34540336788, 0x1cd9ab054e0b1, 0x605d49ddb7407, 0x79bc4b14e58c5, 0x27802f837955a},
+	  {0x165be4501852e, 0x78206a156e511, 0x3ae4f3491238f, 0x0a04a3ec49fa7, 0x65a4ddf2070ac},
+	  {0x57206c6fc0f57, 0x357d21fc5b969, 0x26870b53ffe98, 0x62cf942cd4e8b, 0x2928cfa269480}},
+	 {{0x1b1a6ac450df6, 0x340093a5fccaf, 0x4c7c40af02ffb, 0x46693179dbd21, 0x06121d9ebac52},
+	  {0x6d957b15e7f94, 0x4311115981103, 0x1c0e811e0cbae, 0x0e26d971e33f3, 0x642c72d1fb39b},
+	  {0x0edbd37b7d273, 0x21fb834473d42, 0x21d3de88610db, 0x37770041d90ad, 0x0f7ee0a9d1f10}},
+	 {{0x3bdeaacd53a85, 0x7461351d07833, 0x04df421f904eb, 0x6d4ab5e18c1dc, 0x5fbe6a471c971},
+	  {0x754ded00b1dba, 0x7ac403cab3cbf, 0x2099452616649, 0x31ea12c6bd705, 0x32df84e0aa610},
+	  {0x25357e382483d, 0x2cb699ae3721c, 0x7bf2256bb78f7, 0x104ab121255b8, 0x715572baee477}},
+	 {{0x49d79fcb04aae, 0x1b3ce4dd46e82, 0x4e3c2eba4131a, 0x338f8c1055ea2, 0x26880a36a282d},
+	  {0x559ba72a7e0d0, 0x467a617d5c5c1, 0x6600a90fbf717, 0x0740d9ec7fc7e, 0x0a63600022c5a},
+	  {0x7e2d5e990d7d9, 0x48029e9fff2a6, 0x231fd029ec7c8, 0x61b4736bd1efe, 0x6a71445e1727d}}},
+	{{{0x5a6d16270a678, 0x051667684d136, 0x181456ca5c137, 0x1276b74531863, 0x41abe68319430},
+	  {0x4f87187a2d5d5, 0x624ebf142f210, 0x5cafef8d17d8c, 0x0346f77fc6e7a, 0x3181db32b46f0},
+	  {0x76b9a4fe319a5, 0x6d6d416012c71, 0x60b9404af3dce, 0x2c3ac7c01749e, 0x03cecc188ee3d}},
+	 {{0x3447b88a99cbb, 0x472cccfe77631, 0x56084848074c2, 0x6ff4e685ee7dc, 0x431c271cca8bb},
+	  {0x7f7c7c086735f, 0x5d78749096369, 0x665018063ba0b, 0x2801aac33f109, 0x4ee54d92707cc},
+	  {0x0cb6edcf63e31, 0x5779341fe6131, 0x5a39bbda91b96, 0x51bbd2cae0d3b, 0x106bc41816dbf}},
+	 {{0x6730df1534f2f, 0x46206f3a5260d, 0x08bb3d6b1598f, 0x3dfdba2ace4bb, 0x3d2389fcb4e76},
+	  {0x3a2cfd9260353, 0x7819f12cbb3d9, 0x144fdf0fd9107, 0x70bbd0aa8a12c, 0x55d2510fa6f61},
+	  {0x683993c7fe3f0, 0x337bbcb4a59d4, 0x5553b6b7f2667, 0x683bdad405809, 0x458be63f3c57b}},
+	 {{0x5da4e0a9d4ebc, 0x0e2cb3c543b75, 0x242bb50e51364, 0x598f0598d9821, 0x73a85b8b6ff45},
+	  {0x0429e4d5b6ae7, 0x67a2468645a30, 0x1d4612836bdf1, 0x2a856d6150381, 0x30024bcddadd3},
+	  {0x3b92579a85d94, 0x6b7121a140cf1, 0x6830dca7016b0, 0x7bc64170fc696, 0x748323cacaf1d}},
+	 {{0x29c4206c385c7, 0x06db6c541096f, 0x7408c2c8e49bc, 0x25238d5e86cf5, 0x23ae0638771a5},
+	  {0x1540da592f2a2, 0x44a6c3c8328d8, 0x511034a037fe3, 0x0325e07a85688, 0x0d0918059cd88},
+	  {0x175522cbd078d, 0x0bf868b7ef276, 0x4d7ba69d0c40f, 0x086d2841e1ac3, 0x2c3b303bb5ecb}},
+	 {{0x6f582a2f54421, 0x3124412ea36d7, 0x16af9920825f8, 0x05ef411aab6c2, 0x091a61f23da0a},
+	  {0x7a15a36d649d5, 0x225c3f76e639e, 0x11b7083c69f55, 0x44d4ed07cfa80, 0x385cac1b4dfc3},
+	  {0x37b42a5102518, 0x57ed3d908eb6f, 0x69f02731b9732, 0x77b7a11959625, 0x504de14b52548}},
+	 {{0x4029b0b7afc83, 0x24265f1c1dccb, 0x738f277dcf15d, 0x09b4285a70de1, 0x0b8eac8ccc58a},
+	  {0x3809ce071f2d3, 0x4843b457d3e3e, 0x05f21235f7a47, 0x10738ac90f0c2, 0x770ec467da212},
+	  {0x1d38d169bd52d, 0x529a7fdb6e498, 0x40ce8293a0e41, 0x6b26f7508275f, 0x6231be8d13116}},
+	 {{0x5ab53fea910ae, 0x691303c9846c8, 0x1104423dd140a, 0x09dea5ecbb84b, 0x434a8d84994fc},
+	  {0x3f7072b119ca5, 0x772a102ceb01d, 0x48624fbab47b5, 0x5f42148a6f05d, 0x5e7c2aafb7568},
+	  {0x7ec3c98b6fb1b, 0x6ad7ca3038ce7, 0x48809c7ef8475, 0x09fe54347ffca, 0x61a32d10c3598}}},
+	{{{0x165e51b6308b0, 0x732eefd7ab87f, 0x21114315a263a, 0x508ba90421fb0, 0x25409ca6927a9},
+	  {0x11aedc090bba7, 0x038709feb844b, 0x3c94e072bbdb9, 0x10f516c12b42d, 0x2ae4d26e07f4a},
+	  {0x608207f1508ff, 0x0d8e10de09ea9, 0x13588ecebd1bc, 0x0340f904499c0, 0x4e61fa9e3bbcc}},
+	 {{0x5644c33740374, 0x7b12afa376e67, 0x057601202937e, 0x1841e0ff6faa6, 0x14d06003b1e4c},
+	  {0x39cfab1d81009, 0x31bc976f441d5, 0x0a75ad7f0285d, 0x1f528f4900b46, 0x0bd31c19dbc70},
+	  {0x12797bea74186, 0x6c81ade488be1, 0x717753f7984d3, 0x71ff5c6903c60, 0x33cb34201de0b}},
+	 {{0x48e00e1e8b437, 0x108e61d068189, 0x1ee8eb4baa116, 0x4380b9d2e8c68, 0x56470d1a13a27},
+	  {0x0682d6f35601d, 0x4869fe055fc40, 0x7980afb0d4193, 0x3f5baaa7864d4, 0x089d8861f7c2a},
+	  {0x4edda5e76399d, 0x1230a0e6715b0, 0x02e45ab21f33e, 0x4a7460f6a91e6, 0x38c0bc9c02935}},
+	 {{0x25e83261b1aaf, 0x5ca9205157bf9, 0x5d4cae3042ee8, 0x3d19b03500c55, 0x7e59be37e5892},
+	  {0x455df4a059672, 0x1065f30ffffdd, 0x14e497b61a825, 0x61303eebfce40, 0x41d7c50e40328},
+	  {0x0fb532a1f57b3, 0x00dd7d8777b1e, 0x20c6e14afcd80, 0x03d1fd05ff748, 0x4b2760dc00082}},
+	 {{0x6f942185999bf, 0x30080c7aba338, 0x1d046ebbed0a2, 0x2f23765560c27, 0x792c7cb4cb877},
+	  {0x2da8fd6a2fd07, 0x5d3a0b1dba434, 0x7b3b7bd4de173, 0x7bcf29f4fdaca, 0x14eafee202ae8},
+	  {0x15819772cc0e8, 0x6775a20be78e8, 0x30798225e5aa7, 0x4a9f187fcb10a, 0x03abd7c2ed906}},
+	 {{0x0abde8c0f0017, 0x400773c5a2dad, 0x75b464d8d21d9, 0x3b042a961d387, 0x7e2ed37e3ae63},
+	  {0x1e22fe87340b4, 0x73f1efe39d523, 0x436264f57ad02, 0x57745ac121e47, 0x0b96098d80fba},
+	  {0x1528df1d4d04d, 0x18ba30e7d5875, 0x38088343ff666, 0x61a7b05dadfee, 0x0215b29c3b596}},
+	 {{0x036609030c0b1, 0x784062a39021d, 0x60bd0718c2b3b, 0x47fb1c2d4822c, 0x2225d41249f76},
+	  {0x62df3769027a7, 0x60c9c28e721ca, 0x3a85f0e34931f, 0x586b600616513, 0x404b2edd1792a},
+	  {0x4a345a4124525, 0x35d542b1b97c9, 0x4739f59e0c6f1, 0x3018644b807c2, 0x43ca3bb84dcad}},
+	 {{0x43decd3c44dd3, 0x721b00ee45dfc, 0x2c4fa9bb34b2b, 0x65d1d8fc16ca3, 0x0e95173888d1e},
+	  {0x02cf1ff67eed5, 0x6602c78fec42c, 0x247ac254d0ebe, 0x77d8bf7395343, 0x2504864f12e1a},
+	  {0x25f88d7bc960c, 0x7913c57b36951, 0x210d937633677, 0x48641769834c3, 0x779c380348a0f}}},
+	{{{0x2c1187639f13e, 0x5e2ea6e42df61, 0x5afb024362d02, 0x72d717330f94d, 0x4f943c451f1b3},
+	  {0x3f554232435f2, 0x6dc7e5874d4b4, 0x215daafef23c0, 0x57be410ba7d72, 0x4e5e4cf254d07},
+	  {0x2f57e3f00a782, 0x26bc460be50f1, 0x6fc394da4a390, 0x4209f3c145650, 0x00957a8024b55}},
+	 {{0x6d92b31f58292, 0x589f32ea351fd, 0x19d3c293848aa, 0x65a0e238ce96c, 0x5ef90496479f9},
+	  {0x1b202a0291e1e, 0x7ac362de5080a, 0x10b3419d008b5, 0x30f14c9f1d642, 0x5a06a311d437a},
+	  {0x26c9a61f54d8d, 0x5e2ed6d6150bf, 0x0281e0bce422b, 0x3919c20caeb91, 0x4aecd74b12b69}},
+	 {{0x12dab6f0604b4, 0x148a494f2dd51, 0x4b8d473196f59, 0x6c6f9304f863a, 0x58ee2035aadcf},
+	  {0x197777bed5be6, 0x31dd9d64963f2, 0x0d94624a60528, 0x31c68334d1684, 0x012c55530fdd2},
+	  {0x250467b3f71aa, 0x2ebcc25baf0fe, 0x03bc3fbed70e9, 0x78583aaec7152, 0x0a521b5e093e4}},
+	 {{0x61b3255569bc1, 0x4a431a9822ffd, 0x177ec2a6b22e5, 0x3e5de0f280be0, 0x26a4f32ff6f52},
+	  {0x7a20d625a91f8, 0x205f085b99af0, 0x01009da82a655, 0x71103a15f738c, 0x301b6fefe701f},
+	  {0x4959eac53fa3c, 0x354fd3c0c4f2c, 0x4b4eb7e849e99, 0x5a16504630088, 0x14ec592d32197}},
+	 {{0x2106c840ecb36, 0x493704f7d7128, 0x65a36ace2f18d, 0x7102d3cd17cde, 0x553f698ef079e},
+	  {0x124afa997b0ab, 0x54a3a47904c98, 0x28a45cac8fbc0, 0x5b7c99535c57c, 0x2b4ae97626111},
+	  {0x33292212ef5ef, 0x47fce4cf0fb1a, 0x184ad15b9d46e, 0x6bd6d949e53d6, 0x33c8a1988ae92}},
+	 {{0x363d0c398bc69, 0x3f6dd747fecea, 0x7a2de107b4539, 0x7ee51d11d2b30, 0x7f394a6b52731},
+	  {0x2c0864eb0bdc1, 0x493672e923818, 0x3b83a623cf72b, 0x6b68b5b2668a0, 0x6bd7d32057da5},
+	  {0x559923df030cb, 0x0fd2454d6413d, 0x0a02f34853a29, 0x014895246d1bc, 0x483eb00ee0652}},
+	 {{0x593f64fab1db2, 0x3111125254769, 0x1cc286a6568cd, 0x19160a5f1b53a, 0x7aaca277275b0},
+	  {0x3c46247952c22, 0x6658067810e2a, 0x5ccf2ffa98f10, 0x5cc5fdd40bcc7, 0x4610399bb88a7},
+	  {0x2cd4f7bac96be, 0x427dee78beaea, 0x7c8126043cee9, 0x73adf71dc2206, 0x626064a0a9e48}},
+	 {{0x50d3a044ceda0, 0x6c9b3bac25589, 0x1695ca5465e76, 0x1422962cc8c56, 0x4e7ea3f0dec7e},
+	  {0x6f2b7e1c215b8, 0x488fccc5f671e, 0x1287e0ce35b3b, 0x750eb784b4a16, 0x55f3de8fd865b},
+	  {0x7234ecbffd845, 0x610b228e95bfc, 0x3458cbd380e00, 0x76c53fef02b34, 0x761f214f523bb}}}};
+
+#else
+
 /* sqrt(x) is such an integer y that 0 <= y <= p - 1, y % 2 = 0, and y^2 = x (mod p). */
 /* d = -121665 / 121666 */
 const fe fe_d = {-10913610, 13857413, -15372611, 6949391, 114729, -8787816, -6275908, -3247719, -18696448, -12055116};  /* d */
@@ -840,3 +2434,776 @@ const ge_p3 ge_p3_H = {
   {1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
   {23443568, -5110398, -8776029, -4345135, 6889568, -14710814, 7474843, 3279062, 14550766, -7453428}
 };
+
+/* H[i][j] = (j+1)*256^i*H */
+const ge_precomp ge_H[32][8] = {
+	{{{13188625, -10004566, -14376190, 77863, 22443371, -14636578, -16785304, 8167653, 20444070, -2711252},
+	  {-1471227, -13356274, -10090267, -15151704, -33550331, -8242436, 5529966, -11630193, 19510173, 13261754},
+	  {-12798939, -1457398, -17819983, -2201905, 9166819, -10039394, 19181274, -1806737, -26934676, 16447304}},
+	 {{10817796, 9347262, -18635876, -16540655, -11814059, 12976934, 24396915, 5798861, 14650656, -16012026},
+	  {-1817555, 13324679, 7064412, -7539420, -14728108, -9248818, -10928471, 6223586, 22850632, -7827988},
+	  {-9370374, 16225006, 17224290, 16559680, -18258545, -11216887, 13000078, 10700769, 27355341, -10508300}},
+	 {{12608737, -13878462, 27994404, 15780376, -16232981, 8432766, 31430220, 14679000, 32842221, 8713820},
+	  {973852, 1440080, 6690924, -9688701, -27354535, -11902953, 12675264, 9076976, 29753465, 12581494},
+	  {56008, -15893322, 31562333, 4998679, 28418032, -7004637, -2063917, -929957, -32051018, -16671052}},
+	 {{-4675149, -6713315, 15429789, 15249219, 11868575, -10589916, -979360, -1308465, -12106186, -1644421},
+	  {32810116, -13685895, -1416707, 6209324, 15560141, -2190831, -806176, 12803939, 8113542, -16296855},
+	  {-31722194, -9165774, -27779825, 14060086, -22904672, 12717645, 10228234, -1772083, -22373245, 3610623}},
+	 {{-22930479, 7410262, 24257048, -13894411, -27847878, -16641030, 7462437, -8973508, 32507765, -12147511},
+	  {-19863079, -11660507, 4481271, 3522723, 6549035, 2982801, -2250212, 4001089, -1047773, -4626301},
+	  {-9180851, -10573398, 21666385, -12925096, -13631790, 3718627, -26038060, -9973494, 19752585, 2326861}},
+	 {{-25246831, -11238129, 27737487, 3915337, -30950532, -11482397, 18754529, -3273815, -15817044, -14641234},
+	  {18374103, 1096572, -17549057, -3263120, -4310184, 15289108, 21310959, -9155306, -11089924, -10749879},
+	  {27828776, -7958698, 26793223, -2474662, 8124597, 15437378, 33291018, 12370466, -28554232, 5088370}},
+	 {{-25917578, 14386234, -5565927, -3308424, 27286956, 7880698, 29020761, -5648070, -1311838, 6227031},
+	  {-24300674, 12092285, 30738727, -9432922, 5149063, 3125138, 15714761, -8874231, -17311847, -12091969},
+	  {-32329589, -4716046, 732416, -7707198, 1698228, 11115729, -28776079, -13407661, 30556599, -2778567}},
+	 {{-11546595, -283090, 30716429, -2322121, -23225681, 10917859, 22521393, 14331629, 33103740, -4230536},
+	  {2319590, 2684828, 6622308, -6667120, -16831884, -2027021, 29075903, 2643338, 6120814, 968239},
+	  {-30790517, -5371881, -26861125, -14967991, -5165738, 496822, 13611988, -11880794, 23492670, 2783777}}},
+	{{{-29150393, 13524438, -23048742, -3402736, 11713110, 13409405, -3115549, 16377632, 20630617, 15772106},
+	  {-20086183, -6185890, -18387511, 6669475, -5016885, -707928, 28713293, 4850707, -4225052, 5088128},
+	  {15917549, -16327610, 28265569, 13132501, 19481185, 12546057, 22371823, 6064197, -9203426, -5739928}},
+	 {{21676670, 8890315, 25034010, -11906342, 12302211, -8138659, -30494501, -2374138, 8167417, -14907306},
+	  {-32843713, -11082592, 24529480, 14820580, 21312109, 14948254, 29995965, 11514206, -10277565, 5215927},
+	  {7576345, 2882033, -28458559, -5755971, -11350152, -5804528, 3665125, 5553013, 27057673, -7360478}},
+	 {{-12323327, -797347, 23720275, 9221789, 2271915, 10416868, -9852625, 12702921, -23006061, 3457055},
+	  {-8281961, -15949387, 20968771, 1818069, 3536831, -13223930, 6499904, 5972198, 33536820, 15196153},
+	  {29991770, -1808911, 18435450, -9955677, -1295456, -9567026, -1188956, 16537896, -25964918, -11008279}},
+	 {{32138625, 6837882, -7272871, -10036037, -21964758, 8744994, 4984907, -355133, 21997419, 12714978},
+	  {17985101, -10242352, -11833573, 16046984, 630645, 680518, 18660084, -2026248, 32262556, -9169186},
+	  {17538419, -2821787, -11474715, -8614935, 32302533, 473596, -31387199, 12920060, 26171778, 14359528}},
+	 {{-27729463, 4496900, -30285873, 12645433, -18506802, -3935213, 27403958, 3221150, 10374532, -12782850},
+	  {-4097864, -10544093, -8801287, -4310397, -30127153, 5329426, 133400, 6439253, -3075010, 13665207},
+	  {17201613, 9866669, -8793675, -1191676, -26939774, -6566248, 12114263, 1344519, -5971402, -8600887}},
+	 {{18981104, 14069077, -14539311, 2179498, 573174, 7437830, 15955142, -16602455, -29266681, 16326034},
+	  {15377655, 14586286, -18980183, 8395221, 6073451, -13398369, -20232368, 10060025, 21711244, 10727520},
+	  {-33413973, -1935735, 30098307, 7267049, 17697589, -14133099, -22025212, 2634618, -1849702, 15490810}},
+	 {{-10631166, 7439784, -8491215, -3613866, 7267925, 12094483, 14052658, 1776680, 33122843, 13473119},
+	  {12620517, 11750745, -23766939, -14534874, -20767534, 7150506, -27298921, -2755345, 20252791, -3509925},
+	  {21390802, 15098078, 28081867, -1317593, 511632, 10811489, -10636641, 11437403, -10039903, 5047818}},
+	 {{-1980544, 12696935, 8363495, 6683464, 15818138, 6504971, 15243137, 8150391, 372771, 14331575},
+	  {-11759995, -8939105, -10310537, -7491260, 3356605, 10090462, -22873580, 9621784, 22503384, -10371155},
+	  {-33266396, -1842315, 9616485, -13930884, 21511088, -14919664, -21468105, -7419103, 13133874, -6772654}}},
+	{{{12782785, -15931724, -21893091, -8573459, 4835634, -15954192, 10072619, 13940851, -29467889, -7878708},
+	  {27912095, -8107913, 18646113, -7394333, -2173281, -3530981, -4141255, -2654030, 12336339, -11694457},
+	  {4772601, 11455705, 18544517, -16468580, -20097076, 1820782, -19176415, 3658449, 18069620, 4353956}},
+	 {{-15280355, -16126992, -18303089, 4925425, 9644660, -5805435, 28067328, 9397200, -24638499, -1003291},
+	  {25854614, -6465715, -4453915, -7291249, 25521832, 7747231, -30031552, -3232187, 27282046, -15532150},
+	  {2460673, -8065730, -29469759, 13988955, 27644602, 5822861, 356293, -11263506, -6584046, 586397}},
+	 {{3527750, 16304341, 13773787, -7255192, 15164935, -948224, -13159645, -2529749, 27975970, -8154768},
+	  {-1002104, 1233902, 33506541, -13342300, -6155654, -16599061, 6311030, -5961848, -13525147, 15937639},
+	  {23353440, 952313, -23068661, -7719381, 15363505, 15856457, 2378818, 8949893, 29945087, -5219495}},
+	 {{-28881699, 16265524, 12435985, -7180834, 17544544, 1607544, 15090514, 13646645, 13365058, 7394285},
+	  {12730639, 40146, -28463936, -4947537, -19182851, 5018780, 11718033, -11558720, -18103878, 3257198},
+	  {27680887, -3740430, 30684291, 3347294, 3466406, -13636858, -20719582, -4910384, 30686271, -15777717}},
+	 {{32766791, -11808876, 9827282, -9291920, -27270485, -9970103, -930760, 10657992, -19623961, 5862878},
+	  {-24457263, 16371059, 3321192, 2382634, -29340636, 1491708, -28615574, 8794366, 1783353, -9514454},
+	  {29387426, 6050889, 6007318, 1233233, 11768425, 826076, 15811336, -5288489, 31617256, -4718911}},
+	 {{-20566584, 14230634, -5830570, 14770519, -2662456, -6225505, -2893160, 2835407, 17970334, -3470695},
+	  {-6542645, 11385663, -25754363, 13472118, -32187917, -10654055, 25576977, -8311442, 14591650, -16368545},
+	  {5562885, -577588, 10626860, 1361463, -21850673, 5117479, -12062389, 6552679, 20915584, 1785255}},
+	 {{-22644239, 12774595, 25123541, 6719510, 26524650, -8577763, 7019999, 14334714, -27170969, 13157537},
+	  {18653117, 7332610, -11594567, -2320552, -9374552, -2475910, 28054411, 2592697, -23706941, -2148461},
+	  {-2750180, -51423, -9655504, 14930190, 16190467, -6926180, 13677578, 12511997, -470832, 6824528}},
+	 {{17639160, 15240903, 9089204, 11427115, 25103403, -9441590, 22346773, 14291979, 17016950, 4436827},
+	  {19390296, 1773906, 23870351, -5992723, 24731797, 7332764, -18482052, 5779911, 22072232, 8082910},
+	  {-10474472, -15452439, -5118185, 9644564, -25880937, -1492740, 27840571, -13172229, 5935406, 1775240}}},
+	{{{17435441, 6063289, -4957250, 15631269, -24032382, 12521973, -5220550, -11406116, 24467258, 9428767},
+	  {-2905270, 13886393, 32095269, 11931998, 11864, -9930510, 13892372, 7113373, 23203251, 13178873},
+	  {27452525, -13062601, -21239230, 12698150, 12609113, 955628, 21520977, 14950094, 448785, -14320053}},
+	 {{-16440269, -4241580, -28236583, 2298538, -26812415, -2424646, 12146081, -14410297, -17370274, -6589787},
+	  {-5388017, 9591722, 4766341, 15952859, 3553232, 2130019, 32632148, -11674494, -31167499, -5256708},
+	  {-11076180, -14515388, 16175066, 4639310, 1161475, -9435829, 2893379, -5723104, -17442767, -2965468}},
+	 {{20053106, 44484, 24834395, 5192686, 10627422, -13608053, -12567758, 5311604, -10449214, -4032464},
+	  {-32880297, 15487446, -31453383, 4637515, 26554401, -15977271, 462707, -7182355, -1549769, 12821760},
+	  {-26423427, -13350084, -1940834, -1562464, -7231684, 11857473, 22857057, 8893030, 1499716, 12521291}},
+	 {{-10146946, -4205750, 36620, -10011010, -13639693, -9807131, 7906808, -11267010, 193731, 15655972},
+	  {3727586, -2985405, 32274417, 10227694, -15894512, 15037727, 15013335, -2115777, 19960082, -14588967},
+	  {-23237164, -1547728, -25758207, 537466, -32872745, 14164893, 7351134, -8743708, 3182516, -6595821}},
+	 {{17464545, 9082458, 28908743, -2888501, 17700409, -6979374, 14559522, 1784958, 11604499, -8434751},
+	  {15210573, -1767188, -690009, -13369766, 18727840, -3927832, 25156692, 5834461, 2775059, 11495232},
+	  {2938578, -4976932, -8401166, 561489, 5019407, 10326718, 17680297, 11025105, -7031260, -4010739}},
+	 {{7456114, 13086011, 31218514, -2904783, -18880518, 10309041, -2638806, 13862565, -16814492, 1322835},
+	  {6501728, 11706547, -15391546, -1750872, -30622514, 11148990, 20564116, 7087248, 3107262, -11937775},
+	  {24972269, 8336351, -3422405, 13900051, -8427381, -2548378, 2477060, -13819286, -5915253, -11838624}},
+	 {{-16208651, 13323193, 27902099, 2631740, -25950037, -13076023, -30026785, 12831404, 4366253, 8432308},
+	  {13482043, -1531953, -27757582, -2511981, -32759694, 14988875, 14756917, 8240730, 30879104, 13164106},
+	  {-12058466, -16682772, 13813531, -8996603, -19277668, 5121876, -16581202, 8760919, -17997583, 5643847}},
+	 {{21385084, 12522084, -6542108, 2069852, 24981045, -12928073, 13719642, -5613475, -12278256, -15994534},
+	  {-12866431, 11880634, -681077, -4694505, -18504237, 10111754, -1660177, -8913803, 15917514, 4460959},
+	  {18635934, 14214025, -5350593, -7659383, -5182219, -9352203, 4580147, -5883107, 5574145, 3739233}}},
+	{{{4521278, 14799429, 5823493, -2812984, -7902486, -4229130, -15110484, 16376542, -867073, 12356956},
+	  {-23938482, 14381733, -6350727, 14628252, 10933795, 4245030, 18232972, -14891135, -20376711, -15086232},
+	  {-3851718, -15216085, -13252828, 14485546, 10172094, 13898682, 17986775, 14122181, 4777234, -11150622}},
+	 {{-2410473, -3170103, -8027500, 8627803, 28230976, 12304737, 9114892, 3480647, -17901024, 3279285},
+	  {25885457, 11537415, 829559, 13115449, -7560274, -2922809, -16962171, -16343448, 11397191, -13859710},
+	  {-19098980, 11065625, 28845535, 2400733, 15385592, 7225601, -20065337, -389186, 9204270, 8891715}},
+	 {{-3982507, -8709961, 21924338, -10768703, 23762026, 3482738, -28612021, 5652394, 21267247, -11434683},
+	  {7836844, -15594000, -5200472, -7269762, -32520956, 11631697, -31224924, 16581966, -8839731, -10664069},
+	  {19528111, -2787493, -11336081, -995746, 4782311, 360183, 9570420, 12504692, -6001038, 9216409}},
+	 {{-32029910, 12580158, 27708351, 8964120, -3038324, -16514800, -27843257, 5090903, -9438901, -14474994},
+	  {10138889, 10730172, -2927872, 13364495, 4612257, -346896, -21665967, -14890429, -29790334, -4135178},
+	  {20352780, 13861308, -5810855, -16567230, -13976707, 15831245, -17384068, 10391542, 15709053, 5265755}},
+	 {{-29505358, 8223147, 26936930, -5159589, 7128535, 9639403, -2381494, -1267340, 6030467, 978597},
+	  {-1347245, -1328503, 3823499, 16694999, -21667077, -15301692, -13763262, -5572940, 7282166, -580418},
+	  {10642717, 16136321, -3166419, 8371128, 29972791, -8816910, 26659975, 13931544, -7550197, -12033333}},
+	 {{7313121, -7267845, 5168111, -9110008, -13566709, 2986469, -18472439, 6641507, 23831963, -227236},
+	  {-13342912, 2145660, 19754333, 6178485, 5950472, 10150281, -20744931, 8545645, -5462375, 13226649},
+	  {29561062, -3943833, 32943265, -14352497, 4151323, -5440567, 3974909, 2002688, -9034665, 11018130}},
+	 {{-33120048, -12166441, -20064082, 1329620, 4727070, -11067176, 11887906, 7695849, -10562573, 1108005},
+	  {5184911, -15579326, -31775928, 10097681, 661008, 11182536, 28614519, -16594802, -21698022, -5867498},
+	  {25614615, -3260683, 20322453, -12136278, 8731227, 3237272, -26293685, 6523951, 4028054, -12215745}},
+	 {{16302336, 7216441, -29702532, 4316790, 33085332, 7977961, 4395073, -13956569, 30686908, 3932294},
+	  {-30352953, -12746435, 7706597, -501991, 8497102, 7670282, 18010926, 15888097, -13009576, -7509162},
+	  {-19848676, 9855286, -544789, 9558234, 1195720, 13944134, -5248249, 8497871, -18152800, -1871405}}},
+	{{{9240336, -11995627, -20400013, 4764316, 32650363, -12498750, -12124656, 6585416, -14903900, -15901240},
+	  {-16705856, 9025610, 30210354, -2435491, 32409479, 12845621, 16535157, -5385170, -28227706, -15889345},
+	  {-18158037, -8826881, 14378369, -11042316, 17327822, -5530495, 2441963, 16271314, -27546419, -5078939}},
+	 {{-126258, -8871148, -3373803, 10001096, -13383574, 10255639, -1061710, 5168108, 2259185, -13619433},
+	  {29676352, 15117747, 33176188, 14353249, -1308296, 2184883, -22028729, 6050751, 26736017, 15761950},
+	  {-4263553, -11042027, 20148725, -9888727, 10287237, 128371, -18266423, 6523582, -528591, 10692312}},
+	 {{-6704946, -9050691, 31667142, -4130599, 9166839, 8795733, 21563664, 3621032, 33140264, -6945966},
+	  {30709918, -12329682, 14616837, -11813404, -6772346, 12304613, 25451213, -3787624, -18391691, 2939811},
+	  {31592210, 10956502, 11036614, 13914450, 25483467, 1491906, 56711, -13425069, 27382948, 450334}},
+	 {{27568588, 4191069, -7129063, 8650073, -6198307, 6668112, 26678457, -4205628, -30799376, 14035320},
+	  {-25643495, 647393, 14351475, -7489411, -9640483, -1277011, -9037114, 823287, 15945831, 2886167},
+	  {21927645, 5062038, 12553207, 13260593, -9645590, -4005486, 5033712, -1402587, 2742114, 12190779}},
+	 {{24055750, 8132485, -25461547, 11735718, -18120185, 8412776, 4168852, 14289644, -282014, 13455697},
+	  {5507570, 15249656, -25601387, -8144146, -21382355, -12538053, -3024863, 13609991, 25532300, 2608026},
+	  {-29686689, -9839364, 22801080, -14917658, -28659568, 5468012, -10648043, 7848856, 30170669, 13165037}},
+	 {{21793890, 6543447, 32029797, -6293489, 25472919, -6578059, 26648926, -5248579, 20397130, 13532797},
+	  {14045029, -5966677, -5631917, 8258110, -4414937, 14445691, -24131390, -1442498, -31108438, 635945},
+	  {-17542761, -7229568, -5669837, 3442852, -28072146, 3818388, 27717339, 975648, -11974997, 15264270}},
+	 {{-27010602, 2018240, 20081351, 2886276, 26432407, 15040904, 4405903, -11386900, -29860833, -15793575},
+	  {21041480, 980107, 4451695, -3359460, 22732040, -7659138, -1630864, 10453807, 30676603, -13758200},
+	  {-10152189, -7538777, -14958461, 4600524, -4294379, 10793796, -29445542, -10207780, -23510076, -7678100}},
+	 {{18107144, -15174227, 188000, -8675134, -27777876, 16698293, 3761803, -9500552, 26595935, 14163458},
+	  {24500756, -14217452, 31796197, 7172954, -811276, 10086509, 22806501, -9061181, -22373255, -16446672},
+	  {2765273, 12691492, -21347410, -6815438, -12274721, 4522798, -8849475, 6996515, 28798826, -12089211}}},
+	{{{-16622019, 11011477, 2983797, -10778116, -18360576, -6891808, 27162174, -15971434, -8353476, 14859753},
+	  {17017266, 13285173, 21601363, -14661687, -21163712, 10157381, -19014868, 11324765, 18418354, 8329742},
+	  {17846466, 13652809, 1659057, -5090631, 4128826, -9620050, -19556406, 9090738, -31209802, -5610077}},
+	 {{27491702, -8136436, 3877235, -6810598, -3065641, 16553733, -20747690, 2119837, -18591576, -15503802},
+	  {29893101, 2314261, -846035, -4018107, 18143560, -6561943, 32058949, -3089685, -2661349, -7404192},
+	  {30695548, 15436705, -7746579, 2181177, -32113985, 8732070, 10317450, -8290445, -19566606, 12237331}},
+	 {{24971008, -6285249, 7006383, 1016338, 30841774, -6862895, 17542650, -4836453, -30797665, 3570923},
+	  {-4317865, -7315354, -12413070, -10687308, 11042156, 5762105, -31129527, 5761652, -15452652, 12539804},
+	  {3744421, -2400664, -15892202, -11981954, 18753177, -2383745, -27775643, -4795293, 21600203, -7519535}},
+	 {{5842832, -6628511, 3714967, -757117, 2192765, 15403310, 4505331, 5685684, -20368987, -6085631},
+	  {-23515223, -5005115, 313093, -3386406, 7599327, -4039849, 20587571, -11332361, -15751321, 14402634},
+	  {-2721298, 5438481, -25020293, -6458677, -22718305, -3802955, -5732700, -13704134, 24461331, 14630914}},
+	 {{17354812, 124921, -10151055, 2632206, 20474835, -2017880, 1109399, -14386106, -18318147, 8253366},
+	  {29292329, 651409, 13214604, -14337893, -10398543, 4110439, 12920603, -15785571, 28807007, -473781},
+	  {-2212195, 7566631, -4909100, 8044281, 33511261, 7312944, 17082880, -2182194, 7083170, 4476063}},
+	 {{-20626649, -2335476, 381667, -3169365, -28771311, -7959587, -5450598, -15718451, -19686736, 687541},
+	  {10118942, -180419, 8449560, 6751573, 27468039, 14451163, -17893194, -1557993, -22882750, -13446653},
+	  {-24362834, -8927190, -16334459, 7935011, -15621533, -15974906, -17251983, -10587193, -24383062, -2313649}},
+	 {{5995702, 9044218, 20949954, 8086345, -23853635, -4751679, -19221787, -13945508, -21080397, -6337920},
+	  {29580129, -8118146, -6940394, -14050017, 11463235, 10530804, -8268373, -15151788, 6379351, 5816184},
+	  {4050379, -12234144, 3017934, 12251179, -7088288, -8301970, 18853950, 12981824, -18491646, -1327252}},
+	 {{-15876461, -1443759, -3241183, -12107642, 24272824, -4014108, -16684501, 11382422, -6823592, 3411007},
+	  {-16014420, 579051, -33034029, -6711657, -8404086, -2804376, 11829054, 14632680, -29425635, 9039110},
+	  {-15154071, 12575806, -23138746, 10285780, 1088870, 2785788, -25048639, 1282905, 20507381, 3395263}}},
+	{{{30365118, 13693489, -2883732, 14457002, 6304172, 16408093, -19414593, 6854739, 23840044, 5898684},
+	  {21031761, -10104705, 21941181, -6636031, 3696151, 16602279, -15084443, -4058950, 23993798, 1898917},
+	  {3990300, -12552983, 30541013, -8948075, -1414370, 4075900, -4041498, -12825240, -11684590, -14172285}},
+	 {{1605226, -11366156, -28437639, -8105729, -22760958, -9470251, 5482211, -15914841, -16125131, -16415689},
+	  {-21083534, -15326068, -24433460, -2357598, 24288777, 11508117, 12279390, 4331264, -9467810, -109552},
+	  {-30717131, -8549981, 24096372, -14103524, 8347312, -7743285, 14193391, -6249818, 4361157, -11887028}},
+	 {{-9157275, -2332662, -11852626, -4967640, 30077388, 11790026, -30803668, 2187124, -6551047, 14365365},
+	  {31916065, -13128524, 32530239, 9734814, -29284325, -16371341, 13173382, -10631166, 16906512, 7214134},
+	  {5699977, -11142058, -5478274, -8585470, 14802288, 9008896, -16762656, -15189173, 7719413, 3648380}},
+	 {{-12570600, 11745537, 22229628, 9628240, 14440167, 6638374, 5292460, -9037116, -11370662, -9259858},
+	  {16427747, -4831643, -9138816, 4129281, 12211098, -7233696, 2883114, 15478758, 12529900, -1612738},
+	  {-32871702, -6931463, 21392465, 5103688, -1730791, -14581274, 9481790, 10397572, 17110867, 4834999}},
+	 {{-9125377, 10423526, -29855803, 2233211, -3514688, -7702827, -7549482, 6609126, -12180102, 9768506},
+	  {19699177, -7354285, 17079587, 7667114, -12836788, 8274212, 13191502, -1332853, -23476818, -11701835},
+	  {-87034, 7468941, 1671206, -1162786, -27707660, 8362464, -7279395, -15715766, 15752414, -14341845}},
+	 {{10269720, -1320056, 11687095, 3489540, 19216940, -1812711, -33166174, 8317114, -1075185, 6164879},
+	  {-31864133, 4057820, -20096729, 12328095, 28449260, 5200576, -7894479, 11683845, -19054965, 11309002},
+	  {-31381107, 16251296, -11943589, -1981461, 31016118, -1658486, 23569946, 10751542, -3633978, -7426526}},
+	 {{316022, -2335394, 10672739, 2561268, 11275843, 3782299, 17744396, 2988710, 19774301, -6128949},
+	  {24347532, 12263609, -29240407, 11942376, -5469325, 12897105, -21100600, -4326177, 9763960, -2164658},
+	  {-5709770, -6054034, -2356509, -13041582, 6424567, -5776508, 25268476, 2865106, -13316065, 7313457}},
+	 {{-27991957, 2783487, -16456763, 10320055, 4307128, -3025363, 21628186, -8756209, -1405988, -14792865},
+	  {-3256002, 9120776, 8633257, 3035689, 21139379, 2628445, -1735113, 10127586, 19066473, 5408637},
+	  {-1543358, -4462995, -17839454, -16308654, -32522006, -9802212, 25894027, 10930556, -20374701, -12388039}}},
+	{{{15796400, -2005485, -19655022, -12607185, 3557413, 6576877, 11739381, -15008208, 17214368, -2897604},
+	  {-9712934, -15891815, 27592041, -8044140, -2294574, -4776637, -9096583, 12637383, -14660454, 7054114},
+	  {19237461, 14535391, -25649022, -9917833, 12204470, 13753698, -4366264, -15767525, 2666845, 498571}},
+	 {{12429454, 3692445, -24680389, -12340619, -8697454, -11078057, -29805414, 10263415, 8263396, -9120720},
+	  {14437557, 10151434, 4135631, -11454437, -493419, -9873177, 28495572, -11087361, -28032316, -1525301},
+	  {-2885307, 2112548, 3866327, 2393795, 18289016, 1048109, -1532796, 9470857, -4407866, -2513993}},
+	 {{-28445909, -7839020, -17343213, 8623630, -10618201, -1194464, -14659234, -2138689, -6854855, -11495421},
+	  {-703949, 13755822, -31965448, -8901799, -19896151, -13384062, 24471959, 9343966, 11830771, -13047326},
+	  {15389567, -7279307, -13206341, 13621895, 31243575, -2708857, -5678328, -959205, 30698064, -8749745}},
+	 {{-29545125, -5683143, -14555374, 2788574, 24632251, -16419998, -1349300, 6659972, -13499831, 10300613},
+	  {-33514817, 11512425, -3447520, 3148645, -6717307, -4314667, -10358708, 8935535, -23327176, -14104815},
+	  {-27855985, -14908810, 18704771, 14192474, -17670790, 15590031, 20249225, -9980263, -11770817, -14859}},
+	 {{-8566802, -10991854, -7662946, -3759968, -7566214, -917064, 21520712, -5020159, 25399005, 11190604},
+	  {24964938, 10815242, 10046111, -2208197, 7294410, 12133000, 21172026, -15600792, 27611404, -2406811},
+	  {-26312285, 5126884, -10254415, 9763218, 23162236, 4291204, 24501062, 15464168, 31714991, -10374514}},
+	 {{-28398382, -15065954, 1309408, 15195367, 9512952, 4586091, -7636471, -16293956, -22315599, 11370607},
+	  {22723113, 8794515, -6945103, -12527342, 18753102, -8655876, 30368663, 8968673, -30795435, 10607797},
+	  {-20746229, -2415956, -15742420, -8940087, -22972965, 5159779, -4053992, -524202, -15944878, 10700830}},
+	 {{-3166884, -9106692, -29771335, -10143709, -27766234, -13967580, 3461788, -14968092, -5809322, 16649483},
+	  {-1794386, 2970994, -7255165, 2971317, 24276517, -10193711, -24857503, -5358871, 3474507, -914254},
+	  {-32713770, -490464, 29384148, -4144671, -3729709, 13830624, 24262971, 287412, -15097397, -6884835}},
+	 {{-15165954, -7960586, 27940072, 13434353, -3358155, 15534281, 10065334, -12114123, 19395935, -13092977},
+	  {32858398, -1440774, -26943826, 6094252, 25114927, -12568931, -21701369, -7513208, 15693115, 5768610},
+	  {30804151, 10557146, 31450431, -4805347, -23567571, 11197377, 13408488, -4936190, -771674, 16111982}}},
+	{{{-26901166, 10541253, -2001906, -2220463, -29496876, -8800275, -19211281, 6775870, -30171083, -3526414},
+	  {194346, 2834231, 21611589, 586985, -8276561, -1195941, 30212125, -14787114, 31101524, 15550477},
+	  {13428012, 11633588, 649606, -11530162, -27366192, -10298829, 21406581, -9876924, 25404031, 14897878}},
+	 {{16333848, 8457770, -27236905, -2732080, -3849963, -6367596, -5457396, -386214, -17537545, -13105240},
+	  {2700320, -9442591, 28728595, -11685306, -29174001, -7429836, -15505416, -5196948, 4062723, -13020678},
+	  {-14262232, 2975930, 13987324, -12586114, 32799203, 13645823, -28889417, -9273764, 3482928, 6327428}},
+	 {{-9326881, 1075220, -25131987, -9758014, 24454142, -4267285, -15991395, 1569454, 22324014, 16067156},
+	  {10712811, 11145068, 8987278, 3734641, 24178942, 2834171, 5079550, 5570919, -245850, -10148088},
+	  {5232865, -15276923, -23718635, -2165651, 33504145, -158291, 28022079, -10648559, 27313770, -160200}},
+	 {{3951042, -16263918, -28905183, 8876281, -14276987, 8274549, -2319469, -7824116, -28026874, 10297038},
+	  {-2343026, -298138, 3382854, 15047989, 7036741, 5531103, 3737878, 804620, 6889971, -5840988},
+	  {-26973501, -12659633, -4084334, -15734023, -4291337, -1984888, -23216481, 255526, 4821005, 1013217}},
+	 {{-20614576, -7860446, 11891367, 14622973, 4373516, -7255542, 13062768, 2568380, -29101800, 6121302},
+	  {17469699, 15680237, -31545575, 1104968, 27761096, 1091201, 23441603, -427183, 1592164, 10870316},
+	  {-24894289, -6628216, 19462562, -7387307, 19128128, 13289039, 1104323, 3000690, -9044232, 5130885}},
+	 {{23190309, 14226619, 22374049, -8422609, -20327926, 11937740, 23611320, 10322407, -4939054, -3537358},
+	  {-18800193, -15014859, -14433311, -6066830, -10854965, -10953204, 8524087, 8511296, -32828918, 14746024},
+	  {24159682, -12342360, 14063943, -11601522, -30987328, 105904, 9009882, -13778570, 26119422, 16328581}},
+	 {{-27989836, 8013066, -10355568, -9078550, -11511433, 10774472, 17862934, -7784746, -31509817, 14513925},
+	  {-33134687, -14812288, -21248933, -1657194, -833611, 14442058, 14776873, 11430898, 20356290, 8233864},
+	  {10970981, -10884900, 17090017, 7145908, -10991678, 6513482, -12456259, 13703344, 15566191, 9303265}},
+	 {{-3724002, 3601211, -9759407, 6155164, 28206672, -10895454, -20020702, 5542089, 11106190, -12944831},
+	  {-24048778, -7187980, -22557782, 5851107, -31717207, 8635435, -32301087, 987680, -12994338, -9683987},
+	  {-10369609, 16379301, -25330428, -6242520, -15743766, -7681089, -7607799, -606253, -3662881, -6651453}}},
+	{{{29825455, -9905397, 2183756, -3150562, -29880503, -11783141, 16149160, 8312465, 21469404, 441723},
+	  {14978852, 14970389, 27465687, -5904401, -17164761, -7743137, -33399087, -3432056, -12124036, 587495},
+	  {-23387923, -2030790, -14397501, -14254739, 29360314, -10597419, 16231960, -803705, -22615745, -11472448}},
+	 {{-26082996, 9663905, -15047922, -746858, 9821755, -10173441, 30456468, -16091822, -26683516, -13679035},
+	  {23642745, -3711468, 934197, 15470874, 29189546, 8530480, 19996921, 451829, 9641715, -6467654},
+	  {-27057363, 2798068, -4473662, 15864498, -13880787, -4323551, 11778151, -284578, -4907214, 873848}},
+	 {{-23429243, -15093442, -31980666, 6598811, 13024738, -8120925, 7144073, 11076051, -24606737, -9175770},
+	  {1790446, -2551897, -2797566, 14870557, -30573755, 8031069, -15730869, -224535, 617694, -14877662},
+	  {6646136, -8236497, 27682556, 16533266, 430491, -2561551, -29729212, -14315368, 4228773, 7757828}},
+	 {{31156506, 9891356, 6233659, 12382974, 30513177, -5229066, 6550212, -14504824, 15145002, -14544524},
+	  {12013711, 5860045, 21453189, -14672170, 20841517, 10831661, 29942200, -16719082, 7009212, 112505},
+	  {19362942, -13276692, -10708726, -16570905, -27826479, 1608236, -23671719, -15152488, -4641782, -6850080}},
+	 {{-17463882, 12061881, 16023366, 9069758, 26104793, -5739991, 23613729, -16648400, 9562699, 9892344},
+	  {20313853, 5199586, -3173417, 15926996, -14513949, -16337334, 31982440, 6493330, 21921129, 3914986},
+	  {6074981, -248043, 20582614, 12494737, -2686957, 8785592, 7557277, -13053536, 14902044, -4026705}},
+	 {{-16528708, 12962709, 1598685, 5261424, -3264428, -15412810, 22538074, -14370314, 26664121, -1891055},
+	  {29452918, -9508790, -2648834, 15158959, 7451568, -16481342, -33513618, -11297433, 1919052, 8102239},
+	  {14571289, -4407854, 27866119, 4473128, 29207278, -8858824, 30337795, -12230688, -33298862, -10740352}},
+	 {{22269175, 5595201, 30550316, -9495592, -21258280, 10444114, -24765857, 10731420, 1480972, -6931415},
+	  {-17166665, 12237765, 13609720, 3965686, -24873093, -5467077, -29066661, -931354, -17297062, 2948330},
+	  {18510031, 6947322, 11212509, 6992662, -11040951, -3593411, -1448725, -4324304, -834879, 16015322}},
+	 {{10354211, 5277147, -15765625, -15614761, -31048423, 11987936, -23931692, -3082271, 11379159, 9955291},
+	  {-31878019, 2215017, -3098965, 16558806, 19066661, 3779060, 11209354, 12700815, -1810921, -7206936},
+	  {904505, -1760696, -13220913, -16232534, -26140076, -3163708, 11805217, -123371, -9009074, 16774441}}},
+	{{{-13196173, 15121893, -10940215, 11214788, -24378425, -5641510, 26358242, 2283375, 12691506, -15803220},
+	  {-31567757, 13469341, 23440950, 15102208, 26175123, -16298559, -7244009, 786960, -12285056, -12685295},
+	  {-1588403, 4151949, 12751612, -13358520, -23776637, 5224097, -25870990, -15904370, -15673299, -838805}},
+	 {{-27583438, 14992554, -27845574, 15438480, 14316451, 12327197, -14687681, 7205979, -22523827, 9878341},
+	  {21424999, 2163347, -17707190, 9967220, -2330785, -565720, -1301380, -16183595, 957257, -14754576},
+	  {-22593589, -7798728, 23852354, -52119, -23229312, -15478889, -24486024, -16356262, 25453389, -1997807}},
+	 {{-15947554, 457078, 9533744, 12545631, 13602668, -3289607, 26850558, -8916282, -16522447, 6291810},
+	  {-33317612, 1626907, -30383197, -12089676, 26413276, -1746117, 4881053, -14058731, -22799567, 723605},
+	  {-25358421, -11759471, 14721279, 3270766, 32632436, -8962622, -10008658, 13139648, -30021004, 5346225}},
+	 {{-618275, -12893354, -13122874, 6488637, -1275364, -13041936, 27389337, 5540426, -15852168, 6061824},
+	  {-26123907, 9039349, 31882282, 13364655, -4864162, -14780560, 7691287, 2436407, 6468232, 4062536},
+	  {10452155, -680993, -9496591, -11180033, -16545184, 15058580, 26371734, -13332273, -5345466, -10016460}},
+	 {{7382495, -15908965, 22767565, 3666784, 19842540, -13159735, -26094151, -11804833, 28900103, 12170830},
+	  {13584585, -16356277, 33331554, 10899782, 28785381, 16400318, -19092400, 16193823, -9563841, -7710993},
+	  {19163647, 13636858, 820641, -956474, -24818302, 794133, 11960052, -643953, 30654410, 9457753}},
+	 {{-6807629, -14170936, -27129030, 7223776, -10373476, 7419847, -4863992, -3299974, -22654238, -933573},
+	  {27538269, -8159826, 23575295, -4857710, -13487047, 9920889, 11320034, 7572172, -10181633, 12214706},
+	  {-23084105, -2683796, -19664953, -2977198, 9656406, 11598997, 31909565, -113148, -30917724, -12412426}},
+	 {{-28789613, 9308683, -14047339, -6249715, -2389043, 13461796, -9638816, -1487450, -28173786, -5747698},
+	  {12798771, 2333656, -22396809, -16074642, -30115543, 13590150, 8409105, 9419872, -8699329, -9133677},
+	  {-1952668, 10675440, 657895, 7918310, -13833842, 13470306, -21096427, 4143842, 1575506, 8944775}},
+	 {{-14707284, -16161246, -10821121, -16544819, 32516081, 8891374, 1801571, -658461, 19623231, -3864184},
+	  {-4867533, 2629467, 30383426, 8144283, 1070134, 6109895, 24889597, 12397081, -1065220, 15725094},
+	  {-26243241, -2658080, -25734377, -4373034, 17563597, -2127843, 22140428, -1112739, 1122057, 6736080}}},
+	{{{24814451, 11276454, 15489365, 12881865, 33141351, -11622149, 18843894, -10658672, 31571600, -8395462},
+	  {-32389237, -1428064, 24699560, 10732260, -14238994, -15238541, -23041829, 10804117, 14384679, -15110789},
+	  {30160327, -12407780, -27096057, -12288913, 5504241, -10137131, 16449579, 13999318, 15274610, -16391885}},
+	 {{-14340837, -4670304, -19540593, -11910910, 24895422, 3442578, -7176656, -483433, 15571931, -9593820},
+	  {-27626837, 10785749, -33083966, 16677923, -30422697, 14837004, 31691366, -4935180, 1648214, 1884924},
+	  {-10239276, 5935656, -21514903, -6690345, 19847176, 9303787, -17012962, -14236213, 14992070, -6664565}},
+	 {{-20056966, 4664470, -7425822, -5877561, 25802158, -14326888, -24311421, -9093925, 31097958, -8375005},
+	  {29375518, 3724265, 28975715, 8802283, -1855150, -14540458, 14174135, 1839117, 27152486, 1295200},
+	  {13058623, -950587, 21759143, 9727824, -31498155, -660779, -31825936, 1531983, 31252536, -11354160}},
+	 {{29879385, -11390060, -668135, -9665241, -22063901, 16027429, -5965141, -5635646, -4896029, -11655211},
+	  {-29975681, -13994239, -12589831, 12710976, -30298694, -9064838, -1036271, -11611208, -28343774, 5563490},
+	  {18878613, -10963733, -27596700, 8650447, 17766078, 15350683, 22577546, -16272964, 20101337, -9044323}},
+	 {{5257057, 10570290, -22091510, -12918141, -5275319, -5799966, -12143580, 11194881, 30360840, -11432991},
+	  {5510805, 14042490, -2486366, -10691746, -26271517, -4785384, 9890157, 14058321, 30544983, -6586890},
+	  {13940581, -11575631, -10396475, -8150641, -25085040, -9011703, 10723693, -2112918, 12097261, 503202}},
+	 {{-12252342, -14801545, 24471989, 13096476, -30765035, -10124256, -11674913, 64891, -754671, 3628525},
+	  {2009259, 7812137, -11474871, -10735037, -23964179, -2699701, 2151706, -6651257, 215414, -1095809},
+	  {-10477313, -4296236, 17349253, 16054839, 3058389, -12211750, -26787835, 14694479, 7050164, -8079202}},
+	 {{6829516, 9823232, -16998516, -16086598, -10592845, 11951489, 2211226, 14478212, 10953841, 13433026},
+	  {-30104497, -8051983, -327280, 7857944, 7073622, 16576100, 14022183, -13613987, -1266574, -3399991},
+	  {8784062, -11930733, 23661356, -12365440, -22464805, -12035023, -19970088, -16617044, -7814705, -6697337}},
+	 {{25132883, 3068649, 7277053, -2522321, -12001131, -13231803, -6787286, 5298900, 30439667, -8130339},
+	  {20164661, -9832574, -20651039, 10721867, 6576588, -5502012, -18997875, 11054362, 14526298, 2239678},
+	  {4110983, 8506238, -10236183, 1706840, -27268628, 15454097, 13253257, 16214168, 9814559, 5898586}}},
+	{{{-857226, 16572276, 16092895, -14972110, 2098256, 317054, 6606350, -6021331, 16853004, 5977094},
+	  {-4834277, 10857584, -8414910, -4273278, 4221413, 11258556, -8432531, 11739860, -4628576, 9000223},
+	  {-32429502, -4930521, -8013120, -6271700, 22098636, -13037984, -17814771, 11310805, 33365942, -644957}},
+	 {{-32974266, -4465072, 18111683, 2154625, 14954795, 4798009, -3259061, 12428751, 25722868, 2714570},
+	  {14134763, -16116526, -24826619, 5686595, 21509100, 8838323, 16173581, 7663365, 29278159, -5355352},
+	  {18510301, 3961511, -11468754, -16618301, 18529647, 6637747, 13759887, 4672914, 23515940, -10684891}},
+	 {{27904950, 1608654, -13549242, -8540807, -11883798, 10271815, -23754076, -14338908, 17942785, 7826255},
+	  {-18467976, -1573028, -25081541, 15375978, -16199131, -1347431, -4412440, -7730061, -31906857, -9430643},
+	  {25072237, 1500222, -3088604, -4737418, -25894309, -6138752, 33072553, -6844327, 28172273, 11721412}},
+	 {{13741524, -4733740, -19333541, -13340306, 150636, -5247831, -16324928, -6277952, 8009862, -16203814},
+	  {-16913917, -8642301, 18052388, -16607760, -21876, 4492852, -6740552, -12972666, -16411988, 16264931},
+	  {9549233, 16429244, -16192996, -7340635, 9172636, -13710373, -28331818, -6369267, 14383365, 2043558}},
+	 {{13104928, 3084084, 5850489, -11924989, -13742495, 14948524, -13913296, -14541929, -9725267, 15360557},
+	  {3940013, 12346354, -21449612, -3061188, -24376464, 4213691, 76144, -10454733, -4746772, 6110082},
+	  {28950947, 11961260, -25607246, 14229152, -11944854, 15410061, 33043489, -6603599, -3618164, -6471119}},
+	 {{14677147, 13570951, -28539737, -11716300, -9618645, -1725619, 5160975, 13564073, 25125283, 4793532},
+	  {16930194, 3411452, -30235397, -1473089, -9220157, -2038275, -12595805, -13452310, 7519731, -7196439},
+	  {32328523, -1901883, 17139168, -9655095, -8749698, 13605148, 7309572, -3787889, 33365768, 9196243}},
+	 {{-25405750, 8891237, -30734782, -13361858, -19915363, 16293033, 17446589, -4856586, -16517930, -16373622},
+	  {15889837, 8039133, -83388, 16238915, -11708698, -5011677, 27891558, -6290297, 14327509, 12371378},
+	  {-12626270, -8009011, -25049758, -9421293, 30879587, -11632970, -23113152, -12877263, -5731429, 16423654}},
+	 {{-4602736, -12704357, 26662116, 5745605, -17135601, -7688239, 33546601, -7278004, -8409889, -10366282},
+	  {-19452547, -3323559, 20324244, 15544858, -2970508, 16040249, -28285855, -10721181, 8468161, 6317400},
+	  {12944441, 9919811, -8425213, 14244690, 28045327, 13957376, 16358122, -3789068, -26657346, 14718183}}},
+	{{{26097572, 3350008, -9557599, -2284712, 7805213, -6457576, -6919653, -1576579, -16926991, 9042538},
+	  {-23601864, -3067436, 12722274, -4660072, -4967003, 10499561, -17382557, 14631683, -23163793, 12828179},
+	  {-23458984, 5723875, -3485747, -8498172, -1982407, -10234021, -32307965, 15956641, 12338397, 6761738}},
+	 {{6677213, 726861, -26122445, 10611336, -29277956, 7779672, -4217841, 4894184, -28618878, 7628978},
+	  {28290798, 16113289, 19919037, 2206831, -12074017, -8459109, -3710266, 15705229, -29651603, -2839365},
+	  {-6123319, 9178761, 33426743, -5071362, 24591569, 14849878, -21589785, -9942553, 14684825, -299742}},
+	 {{18022038, 875863, -22665937, -13021575, -17585585, -8403108, -12352569, -6298149, -27421117, 4665429},
+	  {-22618662, -640634, 12785741, -14102332, 506231, -10019667, 20678759, -10360888, -4020150, -635623},
+	  {-21548226, 5524912, 15577320, -9285952, -28568309, -1551507, 19962744, -16201776, 16968677, -3413569}},
+	 {{-12037840, -251777, 30838986, 14131505, 9602323, 10519277, -38836, -156924, -32721299, -11261440},
+	  {11816216, 15458474, 15542737, -233201, -17399936, -8676000, -24840165, -4021874, 1041625, -11628909},
+	  {-10000197, -5113360, -20794994, 8493370, 2264207, 10035643, 11376786, 385114, -4922741, 15371245}},
+	 {{-32786770, 11218309, 26543431, 16522276, -20355625, -7622632, 11099628, 8953155, 3301218, 2973639},
+	  {16358643, 4118774, -5398769, 4201162, -12466629, -3856806, -13738962, 4659398, -19703003, -3893456},
+	  {26863513, -5459718, -6193708, 1682129, 33406711, -2409148, -27014348, 7748464, -19772920, 4905877}},
+	 {{14277974, 3625638, 5491314, -9761716, -12170907, 11197916, 10047149, -15624739, 5551067, -14121793},
+	  {-28039856, 12540194, 17841047, 11116355, 20214643, -16701026, 9518421, -11299114, -22635002, -12507765},
+	  {15935509, 13598704, -431091, -1622572, 9752925, 6329903, -31965926, 8282193, -6376941, -14717809}},
+	 {{31271230, 6469405, 20334323, 13766332, -10637397, -14517300, 26609788, 15412797, 22697833, 10347270},
+	  {14396448, 821971, 15445570, -412487, -7343669, 8015803, -5583835, -14940957, 19218438, -8307047},
+	  {-30314955, 7361841, -12557292, 2972863, -14268068, -1921164, 30642097, -16000607, 1081607, -514098}},
+	 {{22616336, -10772650, -17037572, -15275857, 30238260, -11244130, 30651752, 4420061, -9420255, 11776461},
+	  {13839791, -9382014, 25316433, -1534569, 21131600, 16154535, 27948630, -195366, -25540316, 9088781},
+	  {791632, -12796323, -20202364, -5170248, -6436901, 2776786, -10651720, 4754002, -18480456, 7783726}}},
+	{{{-13540348, 12938372, 25407120, 7742920, -30158040, 1484980, 16947502, 11903525, 33066549, -6445213},
+	  {33146326, -5412713, 1912480, 10078700, 3484063, -382957, -20550515, 6014130, -10363440, 13588078},
+	  {-4088945, -10379524, 30105311, 2020908, -14098026, -16248871, 28851630, 13690016, 3146015, 9955687}},
+	 {{6025971, 3924188, -27030415, 15132719, -15619385, -1630278, -10212271, 4905002, -8110797, -635203},
+	  {-3764356, 16230832, 2067111, 6083762, -23919854, 15414196, -3178326, 4396584, 11221162, 818081},
+	  {-12258069, 13214804, -29092090, 1814020, 5569541, -1947898, -33193260, -15623252, 27857759, 12040321}},
+	 {{18541325, -9009947, -14071576, 3216781, -4739833, -10400311, 21107655, 15747273, -18407033, -5716598},
+	  {29521046, -14867120, -27822214, 13254196, 25634420, 12557588, 12396114, -5213934, -25887108, -6304656},
+	  {-27002314, 4112197, -7785524, -1026430, 8195436, -9573896, 33107374, -4935235, -13208213, 4106939}},
+	 {{-11810863, 6344514, 12829072, 15672373, -26057379, -15350258, 27421144, 285372, 18272750, -3763401},
+	  {15104787, -3352711, 30128536, -6558480, -22997352, -15368846, 20763344, 8276584, -21480740, -12777945},
+	  {2989439, -2582066, -32585609, 8368591, -20385932, -7589874, -27773714, -10730898, 784256, -11258748}},
+	 {{-24898003, 947638, 26594912, -15280840, 14054368, 13489772, 21434311, 505806, 11801685, 1243742},
+	  {-6715337, 596705, -9937676, -10444882, -8853873, -3990638, -11694426, -5012686, -5186612, 4899451},
+	  {27351124, 12996148, 24693635, 4102205, 32045841, -12525321, 29905233, 10271436, 6748908, 5316231}},
+	 {{24463336, -15275649, 8003437, -10071619, -28063497, 16077593, 607592, 211720, 8058651, 7022693},
+	  {6269520, 1756175, -18136682, -14019480, 16144410, -16230706, -6627869, 892227, -32082198, -10584084},
+	  {-31499129, 15704581, -11078695, -6289039, 17270896, 4251987, 7418784, -16425334, -7430433, -8576109}},
+	 {{-25336536, 8852963, -12543846, 9681054, 28469296, 9497121, 3353471, -3092011, 9160153, 3195282},
+	  {32432746, 13493163, -7871153, -13202150, 7051303, -16422145, -3077170, -2789016, 23847874, -7164465},
+	  {28695747, -15862937, 24290998, 3622348, -22613852, -10973276, 23781033, 13679304, 18902742, -1027654}},
+	 {{-18459838, -14796549, -1832465, 3793042, 16587584, 9603345, -26684440, 7886335, 32871324, 11711892},
+	  {9576066, -12530750, 7501038, -12015329, 9409214, -7584601, -26183396, -5290411, -9217713, -2626041},
+	  {27365330, -11164821, -18495855, 8020855, 24926529, -4310846, -4292554, -6220518, -2452895, 8660818}}},
+	{{{27347487, -4378104, 13951940, 755437, -21260462, -14460873, 7003338, -7870091, -13469633, -10479098},
+	  {5419534, -2977092, -18145940, 13760467, 4750588, 6224853, -23277517, 7872963, 32601623, -8789216},
+	  {14802284, 172963, -8008457, 3483553, -23724722, 4182862, 24400962, 13906448, -17954318, -10173774}},
+	 {{-30117510, -11922174, 6183831, 326262, 291791, 16097586, 19024757, -6381505, 14873558, 3128759},
+	  {-16824563, -11237931, -14768110, 9358045, -5126155, 9908711, -24459613, -16037896, 8436933, -13969783},
+	  {-3426466, 2693382, -11110984, -14662795, 23072183, -7781964, -25065304, -12016991, 1352623, -4198608}},
+	 {{-2976942, -6322673, -9607318, 10621196, 9854913, 15680687, -29633182, -12649370, -1913318, 4680381},
+	  {31656850, 4154427, 20995602, -1900504, 27211018, -8944364, -22348199, -12145155, 12213052, 7175034},
+	  {1128419, 3107700, 19067576, -14022830, 4459957, -10913658, -945324, 13201319, -3955227, 8983711}},
+	 {{12789575, -6714952, -20545709, -4463798, 22858218, -13568753, -17534964, 4059722, -14682328, -8473153},
+	  {-29997106, 3378898, -28235714, -11684972, 20249792, 9165882, 10367899, -7883022, -19322428, -11689760},
+	  {-8815171, -1569695, 24556425, 6653461, 4454969, -16485044, 25198715, 10269037, 32802487, 6420418}},
+	 {{21739643, 16680760, 20654535, 6213573, 11876934, -1843622, -21210565, -12068399, 3481841, 11581973},
+	  {-28570177, -11542594, 23340118, -10782667, 31546454, -4508433, -19794231, -652819, -32403577, -7237606},
+	  {-16667430, 8634253, -9812997, -2552749, -3908762, -2057664, -7882081, -7370052, -5357229, 16136098}},
+	 {{-29097653, 3706219, -25190906, -16463636, -24878474, -7549752, 19125696, -16372648, 20879734, 597826},
+	  {21450635, 15666499, 12030421, 12879056, -24284829, 2130325, 19743151, 2950084, 31855037, 1249814},
+	  {7500563, 5383822, -10123112, 8556703, -18858858, -3735199, 23514785, 1161048, 28777718, 7976394}},
+	 {{-1892256, 11940011, -15965928, -13281278, 16066845, -11707761, -6657711, -9390012, 21313571, 3946793},
+	  {-9885112, 206992, -25672901, -1464831, 28769191, 9693275, 20926292, -15974250, 31622612, -3645236},
+	  {-21698976, -7798867, 8920646, -16730977, 29231211, -14648501, 24417923, -3726193, 30270348, 4018508}},
+	 {{27593565, 3082844, -9705344, 3428328, -23621558, 9885237, 27733891, -9271688, -26265884, 2885388},
+	  {-32758020, 16378611, -13076838, 15959129, 11879100, -14841009, -17416298, 8639323, -11956777, 10036781},
+	  {-8753250, -5517129, 10993691, -1191586, 27337008, -1901566, 12811823, -9493943, 1516880, -15980247}}},
+	{{{-4704801, -9979315, 19323501, 10569839, 5654973, 7580745, 7140397, 1464396, -10316882, 12528492},
+	  {16424647, -6597537, 1109449, 10923747, -26592848, -9532142, -12978053, -14741569, 12605798, -12200134},
+	  {-29225520, 1500463, -296709, 5522181, 22665010, 266242, 32378976, -6261957, 23737528, 7519751}},
+	 {{25228404, 10387020, 33100102, 5191381, 15562553, -16737713, -8356447, -14493775, 24732224, -9595679},
+	  {768266, 4865957, 15278199, -2657606, 15010332, 2695024, 12828161, 7420257, 18056540, 9806727},
+	  {20378415, -4624389, 14481844, -15125827, -28480122, 4186685, -20922984, -670304, 12953324, 11092491}},
+	 {{26173251, -8417765, -31666478, 6132323, -11504536, -3782279, -14332487, -12914331, 12836796, -14253365},
+	  {-29309734, 7527438, 1979511, -13765448, -14998236, -13850026, 18391297, 13241673, -24395705, 5073738},
+	  {-25768784, -13997605, -23911229, -15585855, 5575260, -7432646, -29173704, 14510971, 32529425, -10868373}},
+	 {{19323658, 479739, -8971812, -6440813, -3965325, 2321651, 12489007, 8678119, -30849267, 8943597},
+	  {5207884, -16318826, -8090785, 2364250, -25830253, 4153021, 22309251, 2970879, -18782013, 7328182},
+	  {11281054, 4701418, 23621589, 12280241, -24978682, -10447590, -6626225, 4391939, 8715622, 13196232}},
+	 {{-22007837, -11095745, -16471075, 9096693, 27085700, 8055797, 10230337, 5515722, -9694301, -4435435},
+	  {28516787, -15585370, -6364438, 5406562, -5713714, -16672135, 15941662, 262492, 174944, -16116582},
+	  {-22010834, -14047536, -6441066, 1619398, -20930021, -3609572, 21475041, -13609149, 30272802, 14967702}},
+	 {{1003737, -7196489, -12608312, 4240929, -10590303, -3734932, -2706637, 16667861, 19730822, -3304712},
+	  {-15475278, 13704678, 26377519, -16321687, -18219020, -13871392, -21833014, -11022612, -24649279, -15796730},
+	  {21604770, -7841000, 8671718, -9163491, -22658170, 6954713, -29429465, -7459954, -1707715, -11472043}},
+	 {{-12723760, -11188912, 7605781, 7399888, -21907828, 7456186, -3662301, 6980253, -16071855, 12514792},
+	  {-20847708, -431642, -4712390, -9540398, -25989727, 5221993, -8292282, 14827453, -9740730, 16743893},
+	  {3130904, -9976555, -612329, 9006397, 21267953, -9120442, -16578816, 932604, -1682295, 9693037}},
+	 {{10910639, 8168764, 6070614, -1798170, -18938903, 16057386, -32997354, -3968061, -20816089, 8318312},
+	  {14396650, -3471968, 18045042, -8918583, 18588348, -6001448, 25320497, -3394872, -16921288, 4206147},
+	  {-31934018, -8085465, 2158308, -509544, 1667027, 6140796, 418421, 6810155, 9627752, -2060675}}},
+	{{{24352625, 1328599, -12529411, 8165058, 18990037, -8336635, 25619082, 3053906, 25329875, 8587888},
+	  {-32796527, -9053843, 31184821, -7186714, -18915416, -14943010, 9654398, -9610165, 32044276, -39701},
+	  {30070107, -9549137, 27088917, 15016362, 26951987, -810281, -3474217, -8227987, -3949668, -14024983}},
+	 {{-11806419, -173649, -12464592, 1152840, -4824925, -9262854, -4978528, 13193919, 24250680, 7400827},
+	  {20829278, -9636220, 24437799, -7088904, -15281705, 3121955, -6492412, -7539205, -7905894, -15247884},
+	  {-10011436, -2057499, 19785967, -5493387, -10120811, 1619619, -19191754, -12873687, 24641699, -8908842}},
+	 {{-26047598, 13067320, 27964977, -4255321, 11168447, 10002348, 814919, 6738778, 7052475, -15074737},
+	  {-30829333, 5150883, 12889977, -8051212, -17962688, -4139351, 15324771, -8171327, -23819247, -1720393},
+	  {-16270638, 592023, 26810369, 10951416, -23962012, 5714745, 18295436, -10229052, -18302860, -19975}},
+	 {{4484088, 16063954, 1418838, -8611635, 18502484, 13659027, 31121908, 11389956, 14431251, -9566786},
+	  {-17905044, -16582473, 25347505, -8168023, -9167780, -4867114, -29257349, 14338558, 20768491, 16071604},
+	  {26687752, 11243061, 10434081, 8961364, -916635, -6300932, 10654496, -12453832, -1501679, -7259393}},
+	 {{18056402, 7194941, -25049061, -1486752, 5449946, 93148, 24728970, -4505739, 18707714, -5983627},
+	  {30671183, -640585, -15993892, -8768144, -9997991, -980521, -14259225, -13929065, 29496099, 3890342},
+	  {-7515681, 9419646, -22875859, -12414404, 32315364, 2344492, 18250118, 10187515, 6280594, -15048451}},
+	 {{12956011, -13886543, 20813214, 2166619, -24743327, 15585087, 19416000, 8539561, -9592191, -1982328},
+	  {-24425824, 9042657, 28751672, 11390961, -20814337, 6975459, 19101839, -5291352, -2532184, 5688409},
+	  {10835324, 10850702, 22244211, 4993684, 21720569, 4436868, -7875437, -2988823, -1121172, -16550549}},
+	 {{-16302426, 8675, 569677, -3259298, 8977139, -12030541, -11426836, 11530805, 25829700, 8081522},
+	  {32020938, 4748714, 30127804, -4696562, 33281840, 9991040, -32780602, 3081745, 33190066, 3195868},
+	  {6410544, 5809933, -16371785, 9246855, 21628508, -1499240, -6475720, 10721360, -16254950, -11324142}},
+	 {{32309335, 13080586, 2650412, -13951196, 2613675, 3115245, 15784580, 8018518, 25436951, -6498666},
+	  {7683611, -5943303, -2132605, -366046, -18253626, 67117, 24546684, -16666535, -20420396, -7870317},
+	  {21472752, 14331475, 14838395, 5470498, 18372800, -15949632, 4941523, -2644875, -30354861, 14589181}}},
+	{{{-4297888, -14639733, 32872306, 12410766, -17358724, 6728320, 25705225, -696502, -7136439, -3151367},
+	  {-26565503, -14610058, -17985988, -13618253, 16156013, -10115934, -16069209, 14988626, 27131518, 16366556},
+	  {17464707, -1166206, 9022475, 11033475, 23557454, -9662624, -30845972, -9463523, 30917462, 2988448}},
+	 {{-26749878, 16610658, -26201026, -3444447, -15089845, -8719569, 28052291, -10269299, 20492619, -16144321},
+	  {-31666475, -5568222, -10411053, -14255300, 16973427, -11731632, 29563696, -596825, 13689977, 6200734},
+	  {820524, -11540306, -8660346, 4358353, -4246616, -11051189, 2101295, 10036330, 15019159, 6437841}},
+	 {{10111843, 7586482, 25694693, -6240766, -12804870, -10390207, 14571872, 7708450, 18925351, 13548784},
+	  {22436740, -15585521, -17119075, 8418270, 23485847, 16330649, 18629992, 9246807, 5956550, 9926573},
+	  {3768953, -14620871, 7509537, 9704728, -22836328, -10084641, -9186495, 2212369, -17869519, 3465772}},
+	 {{16971081, -16030051, -18854159, 16167316, 9738504, 10480839, -27835122, 4762746, -23314520, -8540516},
+	  {-10912998, -2713314, 24952893, -15999846, -7086199, 7387083, -14726107, 8032083, -23544864, -6267450},
+	  {-23802727, 9717706, -25971473, -2309696, 26432690, 9948486, 8148236, -6021635, -15641227, -10942405}},
+	 {{-18657236, -538502, 30417008, -3370748, 21296945, -3674004, 17397197, -5759915, 3649901, 8608755},
+	  {-13419136, 1163511, 10552753, -12252087, -11628335, 764242, 22165507, -4049314, 25853393, 6922671},
+	  {28351068, 134843, 8433852, -11083420, 25196180, -15277357, 7921303, -1375769, -19638536, -11739926}},
+	 {{-6731323, 9449542, -7182869, -3882058, -27856591, -9872136, -5635792, -15668201, 1886940, -12500762},
+	  {-17131156, 11841296, -27277252, -13045827, -22953941, -14771133, -19265904, 12234784, 864363, 16478856},
+	  {24901885, -641493, 12481892, -15190026, -3521352, 3664500, -8584243, -7823336, 24715272, 1600601}},
+	 {{-13493314, 12071957, 24155591, -2465319, -747260, -2460241, -21436914, 4355433, 11086839, -11620000},
+	  {16332177, 9318291, 12296329, -4103752, -19709525, 9139672, -2997761, 574807, 27000740, -13070693},
+	  {13936565, -9327301, -734399, 13626977, 31237304, 13753320, -17103295, 7655355, -32919895, -5036059}},
+	 {{-15016316, 4302890, 16300234, 12804255, -10063471, -11558554, -19686643, -15685382, -30874551, -1915982},
+	  {-26284224, -5777814, 5667797, -8796744, 26108657, 12770369, 9469776, -9331543, 4176315, 1019046},
+	  {-15308160, 3175053, 23678748, -16739405, -18173109, 774464, 12061465, 4877261, -14379358, 13552193}}},
+	{{{24965184, 8622546, -27633202, -9435537, -17896851, -16686129, -24861192, 16434787, -17155690, 12829510},
+	  {13786729, 12497005, 9020566, 1747605, 31194637, 4168047, 27814797, -4884850, 19097142, 11962842},
+	  {21967776, 13297582, -31435833, 210194, -8636673, -11984852, 16329795, 4864888, 11458472, 4332668}},
+	 {{2503733, 13040018, 6327259, 10989378, -1841566, -14708097, -32081205, -5796748, 11888156, -13574421},
+	  {15973154, -3782710, -13206421, -6597566, -10509537, -10960026, 26304524, 9393207, -33214640, -4657596},
+	  {24594630, -15920316, -33038524, -8461211, 7040392, 3168192, 5017290, 6338095, 17890687, 8802970}},
+	 {{-10541540, -1784346, 21660858, 15507213, -30231333, -8334526, -26712552, -5285945, 11610305, 9037929},
+	  {26137956, -13914277, -21327429, -7347323, -31251774, -839026, 23596519, -10420781, 26686033, -13175823},
+	  {-25840751, 12602141, -28987311, -1017424, 18928928, 16303004, 23754156, 8734320, -11645615, -1764626}},
+	 {{16053908, -1050266, -25601375, 9679256, -16867845, 16312883, 28705694, -16047431, -21766848, 1317951},
+	  {33455773, -10943066, -22459545, -6488120, 7722331, 4025769, -26246774, 10271547, 26870080, 14967080},
+	  {-28089827, 16623329, -2733867, 15230610, 6014759, 6380454, 13816836, -4311465, -29763549, -14093905}},
+	 {{16065018, 10926868, 16449443, 6274760, -20269, -10108456, -429046, 6527913, 11043563, -1321890},
+	  {21542816, 10601642, 26201248, -16052836, 786013, 4575489, -20531512, -3786748, -22463868, 5820805},
+	  {29246595, 428512, 8710401, 5721120, -1842545, 16753836, 16314879, -6213864, 28883346, 1775613}},
+	 {{-22523610, 7033375, -24076479, -7528829, 15515820, -6459198, -9841943, -2139112, -13572343, 16101878},
+	  {15508310, -1064978, -19582449, -313882, -18957000, 5604185, -25283528, -6446414, -15446702, -14903726},
+	  {30799104, 12815104, -6686164, -10911631, 11548197, 4758565, -3660908, 11073514, 22154348, -16592412}},
+	 {{5486369, -7576545, -30933443, -9528078, 18473515, 12572960, -19578556, 9704124, 25910492, -2514458},
+	  {-3472317, 1693731, -14598471, -9502629, -8685195, 5127746, -19671149, -6414552, 18218875, -7542671},
+	  {20570412, 10097889, -5281088, -4745147, 12899554, -7451509, 5470768, 10018175, 5762412, -2346407}},
+	 {{17527971, -3690975, -24455394, -14883794, -5597142, 15401291, 25636367, 10152510, -23607276, -14270526},
+	  {5792107, 8624116, 4562050, -16359577, 31868109, -12721236, -28831452, -10751402, -6899194, 13792986},
+	  {26013000, 8673374, -5989651, 10203714, -27608180, -8041490, -2278982, 1124978, 27362795, -10644818}}},
+	{{{24435985, 6803775, -31076339, -7466654, -2894164, -12329268, -19100843, 10407537, -28170996, 2213612},
+	  {18228012, -1434622, 9568248, 2505439, 15240861, 1670408, -17280607, -129824, -30061126, -64143},
+	  {12121468, -3513346, 5838290, 7696672, -28957891, -12953190, 32330746, -12832963, 27555048, 15344032}},
+	 {{-15502674, -4758179, -12677782, -14088054, 21647236, -7268682, -9474634, 11700859, 22625030, -3010874},
+	  {24614287, -13827705, -14878600, -1597235, -20400181, -11358936, 28662354, 14114259, -13992151, 16301806},
+	  {-30651192, -5483651, 26521927, 6679271, 22069101, -15013918, -4864663, 8664649, -11180994, 5490425}},
+	 {{-15306729, -442564, 28635781, 5377975, -5373156, -15004035, -15406209, -4357913, -22747970, 16526065},
+	  {20822113, -6188604, 32540264, 13771973, 23886683, -3901060, 1676229, 8413065, 20024146, 4278883},
+	  {-26359243, -13123502, 1605295, 8035605, -2262553, -5777163, 13522571, 4065557, 26090054, -11996430}},
+	 {{7302951, 9355424, 32095859, 13407875, 9663034, 9992348, 22928563, 16294812, 18243239, -8708266},
+	  {-32892183, 12942272, 24985516, 13685744, -28464483, 7866274, 6738050, -6526590, -6738780, -15512276},
+	  {-13102947, 14148798, -27535613, 10308190, 21128353, -5188718, 19150915, 1636084, 977139, -1089628}},
+	 {{-7191083, 128809, 16664280, -6956071, 4676481, 3133678, 32363521, -10117988, -1613966, -9405540},
+	  {28146810, -6218447, 2036329, -9458421, 26869407, -9444320, -5313800, 3912481, 19469052, -2456848},
+	  {-31084776, 6391081, -2655687, 9556761, -28192263, 5339359, -24291352, 796670, 12140779, 6488114}},
+	 {{-32499157, -3227499, -3434699, 9612896, 12150648, -10123471, 5056069, -2577756, -21283972, -8219786},
+	  {-30532296, 10721493, 27384468, 16424765, -6937715, 2844780, 18369502, -3099603, 20772418, 7056030},
+	  {-3993002, -8501138, -8119162, -13872790, -15645302, -5269938, -12193818, 129264, -5509087, -13762575}},
+	 {{18990918, -5067159, -24400829, -10745577, -29516847, -7740507, 11768591, -4322403, -22024281, 1520886},
+	  {13980793, -14168161, 13448862, -14323102, 17965834, -12736782, -8092432, -12472253, 26096327, -1399422},
+	  {28072503, -6944822, 9930927, -9041398, 15575371, -14560508, -2957350, -5258860, -3308938, -4654517}},
+	 {{-32500182, 1412287, -7747611, 6135730, 4614329, 7563620, -5489379, 10474628, -21224069, -5230466},
+	  {8560429, -9329595, -13807881, 1957120, -24666863, -8499412, 8695, -13373220, -19647079, -219309},
+	  {22661684, 16113540, -25999245, -15778215, -25487591, -14866420, -3845119, 12153291, 23157079, 11668071}}},
+	{{{30283185, 4383202, 22967501, -387033, 9852954, 11041809, -21302635, 13387175, 29710915, 8055145},
+	  {13782788, 9305080, -20035329, -4002775, 31073249, 6387206, -27640322, 10961325, -30423344, -9431107},
+	  {9030081, -11032459, -11043720, 11935823, 2915780, 11537369, -21175322, -9154321, 20060320, -12132404}},
+	 {{-7473855, 2742926, 24276647, -1049148, 11278694, -5066538, 22377578, 2585351, 3637392, 5608671},
+	  {-4982601, -2975897, -22094057, 401244, 18947681, 4355532, 14361699, -6722950, -31256486, -6952726},
+	  {10683396, -4260836, 3466573, -4922582, 29529689, -3946156, -375125, 4055997, 10497319, -4006242}},
+	 {{22436957, 4057215, -6526789, 9898849, -15029043, 6313850, -26974730, 8021732, 18572257, 2558573},
+	  {-17738456, 8564143, -12738216, -16723620, 10398780, 15408137, -13666720, 4569786, -7373906, 16188608},
+	  {24527845, -14054699, 8524884, -1633071, -9740944, -13004302, -33253844, -16066047, 24642551, 7179894}},
+	 {{30429994, -216234, 30704612, -571952, -12606181, -15618020, -17893081, 6740728, -25240723, -3864886},
+	  {-9195030, 16508302, 25913965, -9065451, 2648704, 15048293, 31540336, 8324372, -11698505, -13789141},
+	  {-31039174, -5234994, -2897067, -11185068, -21188609, 14599195, 7771290, 5541721, 8437454, 6092695}},
+	 {{-11768569, -6109175, -17703064, -8175960, -6504972, -10365343, -19789471, 5931465, -19186974, -4036910},
+	  {2568367, -9658571, 9293695, 14794064, 24400907, 13513196, 3609251, -1311951, -9615122, 16523198},
+	  {-599246, -14482257, 23088791, -15757240, 15336159, -10948025, 23869165, 15219459, -18974826, 12918865}},
+	 {{-19741416, -4712459, -27220937, -6201926, 11938682, 3830263, 24685920, -9895118, 7404618, -9521658},
+	  {-16916228, 7989777, 25317470, -1304424, -12027452, -9153514, 28441059, -15979695, -11717202, -12604504},
+	  {-3748323, 6077355, 15681315, -14598566, -6187760, -6559629, -18847217, 1649015, 18006785, 14830027}},
+	 {{-6115746, -16492143, 10763431, 9754868, 32298822, 5289729, 2772466, 10458574, 28985509, -9591678},
+	  {20076303, -127350, 31749646, 11446629, -18314212, 6643674, -1434404, 1082171, 29030305, -16359190},
+	  {29003024, 4128248, 23902668, -5628173, 9880423, 3357212, -9833642, -10689666, -16041418, -5256843}},
+	 {{-5470531, 5611945, 10662137, -14183034, 31767159, 1273192, 2239623, 9503555, -26306797, 11890023},
+	  {-23019221, 7043464, 1219064, -7659901, 14018226, -6179289, -18071667, -779312, -6281568, -337223},
+	  {27446006, 16615761, -22494590, -14636773, 28716333, -12039889, 31863669, 9828177, 30058085, -4866476}}},
+	{{{-22629278, 6097630, -1080948, -10622197, 10786996, -13886971, 18019972, 8508278, 4612382, 724305},
+	  {11986035, 14818868, 8991685, -14770622, 7473691, 9834166, -1853039, -182314, -330773, -14185782},
+	  {25115657, -7300120, -27297806, -13459303, -31116745, 14941193, -24046851, 8933824, -22641511, -16224773}},
+	 {{-17531748, -8630599, -31189292, 10090815, -9062041, -12355979, 13314409, 6612842, 17283625, -8166367},
+	  {-29454724, -4215867, 18170889, -11901801, -1126870, -6987073, 17222487, -11495193, -23154860, 3027911},
+	  {26537449, -10225392, 1755292, 1635894, -16094688, 9091476, 1624054, 669519, 21452227, 6624706}},
+	 {{-29452013, -7998399, -6503952, -11703326, 17333823, -1732402, 14761159, 8528856, 5075903, 439672},
+	  {8212815, 11871930, -30812525, 2521080, -10357831, 5730021, -14739090, 2313546, 6351197, -14068516},
+	  {11488841, -486512, -8935889, -8008170, -5248794, -15737243, -20604349, -10495123, -14285126, -15062211}},
+	 {{-24953117, -14919961, 14367201, 3216886, 3478602, -9855190, 17835340, -14225247, -14388837, 10678411},
+	  {18027421, 11936051, -10735728, -10371816, 3337120, 277552, -2374004, 2681937, -2541177, 362648},
+	  {7346992, 1720412, 15482626, -14286418, 17239270, -11710162, 25503202, 3218149, 15457990, 15141478}},
+	 {{16061194, 14328985, -13448390, -11731464, 26888640, -10106173, 31686196, 13446758, 26972767, 12191018},
+	  {-31745239, 8053883, 6603193, -4958116, -12432918, -3962573, 14497027, -10023498, 12751897, 2306762},
+	  {22706930, 12702394, 8224889, -4151018, 9724867, -2202343, 13301283, -1375339, -2412293, 13976629}},
+	 {{-11540758, -7905418, -17182934, -8154119, -7026415, 7329102, 17812992, 1104242, -17409369, 16226538},
+	  {12469577, -4962420, 4682765, 2566792, 25215186, 4760426, -1080840, -14533491, -32019287, -1276606},
+	  {-31105608, -6067523, 26018705, 3151710, -21924736, -16246799, -16510792, -3950852, -26519404, -4155007}},
+	 {{-18157234, -2515875, 8344033, -9704850, -15948824, -11956111, 4402884, -6579925, -2281899, 15954356},
+	  {-21460875, 7653007, 7756053, -414321, -14307453, 6631249, -22447103, 5219807, -2194235, 12931729},
+	  {-21425694, -16349890, -28226219, 4106805, -13114817, 9267486, -5723075, -12970842, -27848957, -8545688}},
+	 {{31907294, -13468739, -28960470, -3191723, -779137, -8515737, 23400970, -1271502, -8047205, -11250797},
+	  {-10904050, 3224922, 14676923, -9393782, 18421009, -11082627, -22325014, 12533847, -4189782, -7986283},
+	  {-11173739, 14816855, 3207503, 2996543, -20080232, -2452992, -2668235, -14717169, 8348423, 13182917}}},
+	{{{11476243, -7406704, -27216401, -5282008, -30308315, 1284191, -7894899, 15327927, 4085242, 1652522},
+	  {-30252873, 5715348, 16594838, -895549, 7588415, 8136338, -20266077, 2180244, 24945099, 15070917},
+	  {4281926, 7871083, -12813132, -3167909, -26145086, 8620959, 30895191, -1412237, 4567028, -12433143}},
+	 {{25185539, -16216017, 9682755, -6135229, -5192300, -15130426, 27694168, -15116306, -24034047, 5766535},
+	  {23288591, -6328342, -20976527, -6639657, 14620307, 4976265, 23956924, -311897, 1396070, -5801282},
+	  {-25713536, -7075913, -4421642, 15695713, 29552118, 1542629, 5495519, -592947, 25254996, -7697787}},
+	 {{25979775, -9749933, -4506469, -8653351, 9324938, 47064, 26590441, 3730171, 31444300, 587530},
+	  {20494629, 4055894, -13406590, -9394632, 25839450, -11574150, 28259883, -7791181, -28612109, 1011631},
+	  {-22860482, 6403548, -11816647, -3206309, 32729994, 4488526, 6386042, -6933394, -11264355, 1894151}},
+	 {{31331407, 14254822, -9167990, -14823116, -29479640, 14516554, -13722411, -12728535, -1292201, 11846395},
+	  {16453460, -5949624, 8378253, -15350347, 9900577, 5704168, -28192047, -3124075, 29432830, -5083066},
+	  {-14374236, 3690074, 675143, 10379782, 13231924, 16015813, -32498341, 14608361, 28884974, 846463}},
+	 {{6124497, -10221521, 15710912, 12770982, -26787195, -3822168, -26313987, 62645, 4522656, -327278},
+	  {19696852, -12080188, -29724631, 605208, -22634622, -16624522, -28973282, -14673822, -7617994, -12389284},
+	  {30402812, 11909369, 24423604, -7539954, 28093013, 1392349, 16677689, -7022989, 23720058, -4110011}},
+	 {{22869552, 15019951, 8386140, 5923500, 2413230, 3857423, 31178861, 2050111, -9333516, -6661958},
+	  {-648846, 9313398, 5545200, -4057822, 32548296, -3616551, -8103278, -1300813, 18165712, 15993572},
+	  {32544671, 11592008, 32159318, 10974770, 16445589, -13678373, 25856704, 11412806, -32157895, -9270850}},
+	 {{24498413, 4649649, -3509712, -12200553, -3472035, -9847129, -27891808, -5678060, 2659997, -6741739},
+	  {3467622, 45246, -14445146, -13766784, 28980752, -14204387, -32845495, -11472656, 26736207, -11075557},
+	  {9305115, 4353218, -31925840, 4408188, 30037138, 5044380, -15505384, -5627499, -9522109, 5539030}},
+	 {{13485311, -16694838, -26646378, -13721969, 3780628, -824407, 7543988, -962880, -16472551, -13333745},
+	  {30116859, -15713270, -15801570, 10724719, 1206128, -1785734, -10699765, 963160, 19524485, 13651852},
+	  {-33263820, 2413188, 31616108, 4297182, -5703321, 3634115, 23067855, 14732585, -24415443, 6397475}}},
+	{{{32305808, -13351389, -3846694, 14275858, 14054948, -14118134, -32831080, -12783304, 2202902, -10423998},
+	  {11777178, 13027715, 12934784, -11779343, -25928467, 7345137, -16347595, 13744345, 13416906, -9181968},
+	  {10019803, -11136837, -11508204, 9984721, -26911349, -6234649, -33294684, 2783269, -7288601, 8787593}},
+	 {{1794661, -16153544, 20991280, 15449294, -27631172, -742980, 17973861, -7206849, 26446453, -7593900},
+	  {-4966767, -8525926, 8246728, -11100570, 33311484, 6307876, -7639156, 289538, -4667715, 10251720},
+	  {17458736, 6665743, 12141356, -991699, -11881150, 5043093, 6908220, -2552755, 15186593, -1958007}},
+	 {{32844966, 7917544, 26429782, -739811, -31011082, 1892512, -7447789, -3498108, -14833120, -575007},
+	  {30900784, -360635, 17778287, -7076107, -11361356, -2950526, -8165625, -3773597, -29119533, 272303},
+	  {-1460730, -2189383, 3780212, -957865, -1524045, 1343301, -24135596, -16605569, 31295596, 4695324}},
+	 {{-29720171, -10070821, -14556348, 6704653, -11843534, -8689096, 1331764, 11481223, -10676697, 16243362},
+	  {32250863, -16055229, 14522414, 11029691, 14954539, 14327002, 21598285, -10227241, 33232427, -5520730},
+	  {31484866, 11696123, 25711989, -1133353, -26217736, 6792259, -25527353, -9518965, 24594859, 5543420}},
+	 {{18573799, 2834169, -31705080, 6653143, -3766734, 15322557, -22655378, -748529, 1026632, -12006534},
+	  {-19954582, 8592606, -32293435, 12936229, 20810905, -6420696, -17682005, -2830613, -12299873, -2269794},
+	  {-1412913, 9473425, -3484882, 7324166, 2749592, 3829953, -12725104, 8362376, -26335188, -5184795}},
+	 {{-3053228, -5285107, -17574254, -4017747, -16767799, 6211780, -537487, 4736838, -28007532, 4620245},
+	  {-32556445, -11096240, -2700934, -13108301, 11453618, -14046868, -471950, -14086897, -4710310, -4600486},
+	  {-28781665, -9509822, 8619419, 6857564, 22760481, 5904120, 7464496, -12859654, -16818399, 12224011}},
+	 {{-1046031, -11221126, 19680089, 1171913, -14888790, -2858912, 31952258, -8742587, -7356032, -2730512},
+	  {23242914, 4115123, -4506056, -16757460, 11473432, -8232604, -9250920, 3468640, -3564772, 8120310},
+	  {-20635693, -13701320, 14149130, 10264371, -33272554, -6117696, 5071713, -16288107, -10716719, 5328206}},
+	 {{-6882024, 14671035, 12017712, 8955179, 25818693, -3395336, 8375774, -6862408, 19735539, 14961612},
+	  {15029337, -15252798, -103395, 4422077, -18613474, -1330295, -28025914, -16735033, 18309985, 16123254},
+	  {8593789, 11837261, 19318275, -15618521, 18917923, 13175582, 3564028, -16299983, 9345501, -158896}}},
+	{{{6241101, 8572046, 16299456, -477231, 7043202, 12101924, -13842733, -15166345, 26384670, 14406747},
+	  {-30857648, -3016308, -7477276, 5015162, 24474945, -11859590, -21725808, 11221804, -30967043, -2296561},
+	  {7890592, 14932782, -7814270, -149340, 29770168, -2547579, -11561452, 7246398, -21596346, 9586374}},
+	 {{-12818646, -3795435, 7362316, 13082088, -13923277, -9870432, 7041161, -6184176, 19346696, 2404110},
+	  {22821346, 7734872, -16389458, 14830385, 17107668, -5706411, -21946638, 6043917, -27555183, 14488435},
+	  {25377224, 16744651, 17912244, -3291119, -28778530, 9633526, 17843836, 3634552, 8272728, 9418866}},
+	 {{-9341726, -443706, 10832779, 265377, 1902353, 3374527, -27049758, -10930460, 17831970, -12614738},
+	  {32045668, 14905231, -18003090, -9672180, -5989229, 12656872, -4781313, -1539844, 32032430, 6539265},
+	  {-2637532, 5858601, -32466097, -11662453, -22243422, 10343035, 9337756, -13396963, 16547532, -7167575}},
+	 {{30387034, -4284966, 19058595, 11280348, -28278483, 4358167, 18064499, -617144, -31859562, 976102},
+	  {20079440, 9278103, -5653134, -714839, 12843291, 11080601, 21939691, 11875838, 21722163, 16094351},
+	  {-29369706, 11005484, -29397107, -6052775, -8825673, 13923059, -14107968, -16742054, -17149241, -5104440}},
+	 {{-5794484, 12608776, 10369051, -9830373, -31665226, 6428417, 6472250, -5011634, 2721393, 11293599},
+	  {-32446280, 4578827, 16887621, -775953, -11063827, -10694200, -21137468, 12463008, -2305658, 12073930},
+	  {-15587335, -10144960, 1115590, -6278201, 26979368, -12533455, -25177299, 3314382, 26131076, 2935896}},
+	 {{11031675, -12022463, 5099592, 4517165, 32293559, 15776054, -17064172, -2832891, -17636202, 11239500},
+	  {-740698, 8270583, -8862902, 1381493, 6560137, 10989217, 13676335, -768175, -4341242, 14463747},
+	  {17546322, 4814624, -17509869, 9458660, 6869565, 15584704, 7011063, 14564844, 31488527, -3010331}},
+	 {{-20172792, 9884713, -21445169, -15267305, 27613730, -9059481, 18320667, -5550345, 21455294, 11136844},
+	  {-2625224, -110409, 14397092, 5765493, 9731137, 5077016, 15294589, -13980081, -8709176, -14452283},
+	  {9216453, 11060898, -74812, -10671045, -7383142, 1557938, -4863238, -4535733, -20790112, -7509908}},
+	 {{-7231387, 14044194, 14507764, 1889294, 14935233, 15842638, -28391623, 8847956, 19091033, -4791018},
+	  {-17168174, -12156975, -4098311, 7136291, -13427932, -5779261, -16713770, -8087975, 8231381, -13111259},
+	  {11034783, 12549555, -660515, 8797019, -10984279, -5029915, 31016300, -3758732, -33402893, 8821577}}},
+	{{{3939664, 5712038, 17675331, -4011938, -30018664, -14082242, 29072632, 13322010, -22161146, -2618165},
+	  {5895949, -11915391, 6971190, -14931404, 7207125, -15622899, -27728491, -9041264, 14038511, -13541776},
+	  {18604207, -10929, -21101215, -13388442, 876464, 6156662, -10836003, 15810080, 32371294, 7716184}},
+	 {{-14829370, -10358861, -11993685, -5253524, -1546336, -10794249, 20827564, -3153820, -31839159, -3710413},
+	  {22129501, 861671, -29738137, 9635058, -16963912, 5676918, -22196395, 11748367, -1994664, -4596207},
+	  {-26288700, -11156549, 7517221, 7939697, 13899335, 16744581, -16338237, -244671, 29303015, -16047395}},
+	 {{10666096, 2830004, 2512848, 12496756, 26515062, 7664761, -19856217, 6900186, -27449120, 2124096},
+	  {-8561158, 16442355, 26491570, -15779346, 15596107, -10012903, 30498557, -10685992, 4981550, -14097564},
+	  {-33159879, -7880088, 15453571, -6796690, 22993669, -1932838, -1045198, -4641881, 18553883, 14635476}},
+	 {{1768758, 2063429, -14007999, -13849325, 22041207, 11378551, -11270654, 1533558, -8808700, 9634152},
+	  {28989815, -7106236, 11551711, 2041440, 4325157, 6117290, -11636099, 14494334, 7024610, -14139531},
+	  {5078206, -12156118, -6256963, 3987341, 28884427, 3919252, 6885953, -1545874, 26919821, 4290997}},
+	 {{15399133, 6645563, -24453668, 7574922, -15513410, 15348741, 11613463, 3527338, 26268, 1298538},
+	  {-17264175, 6950721, -14374541, 988938, -17545725, 6581720, -28822091, 14369456, -10428437, -10034202},
+	  {-10636948, -15801753, -32251582, -8190895, 10543882, 12080353, 16691351, -6351575, 446227, -8733976}},
+	 {{-6703339, -3027979, -13433451, -9440261, 2862045, -14521189, -28732997, 10487461, -3334535, -15656981},
+	  {-6345721, 2213329, 10931206, -7151684, -1593084, 1831545, 12648235, 8272798, -27617808, -1218727},
+	  {16763325, 4673102, 2833638, -16199422, 9361555, -1754993, 10078983, 12791413, 28459055, 16014176}},
+	 {{-25650743, 851827, 4915431, -3786522, -18625392, -3245598, -26504782, 9164704, 24416234, 6646807},
+	  {13657299, 11061091, -32427662, 9128878, 23365275, -12914849, -18926502, -9962964, -16078878, 13101575},
+	  {-7035539, -12575717, 28295290, -4069668, 1236154, -2640950, -15726079, 9595411, -25832252, -14132583}},
+	 {{1072952, -14386186, -13697409, -6051410, -9539771, -11776161, -9914294, 967599, 23727628, 6243597},
+	  {3900475, 710394, -28192003, -11137569, 16103196, -11737451, 25117491, -2805132, 11555798, 10297883},
+	  {-24875460, -13589319, 12351448, -12080292, 20930441, -305354, 8862708, 6378932, -19163609, 1151449}}},
+	{{{30526305, -16207948, 9912231, 11178716, 763935, 12997221, -6825276, 9428063, 9780770, -11045898},
+	  {-12222341, 55037, -9236760, -8241871, 32611673, 16328377, -14165514, -8859283, 21096128, 15837088},
+	  {18709324, -3689207, -20297305, -5789376, -19874298, -12922552, 8143142, -7541949, -33298346, -8989495}},
+	 {{-1272470, 4587312, 7823775, -16523749, -13164672, -4627991, 25899521, 3628276, -29167376, -16534655},
+	  {-11472608, -3034287, 14443374, -15170078, 17973452, 8208609, 23910348, 11546655, -19349311, -13848663},
+	  {-23188571, 11285442, -25106610, -39583, -6387178, 14175661, 28855059, 1370906, -9278852, -10367399}},
+	 {{6142754, 7957897, -27392772, 6671310, 19329934, 3513389, 32870210, 8163286, 20977124, 15125824},
+	  {-9616727, -8319228, 10375775, -5593630, -27002334, -6595111, 31271621, -834574, -10342829, -2179208},
+	  {32682236, -15611114, -16860200, 6555415, 28223396, 846546, -18648590, 5404993, 24369684, 8792437}},
+	 {{18383195, 15008157, 2763760, 11085497, -30654185, -15704262, -33294069, -1826077, 9666248, -13859951},
+	  {-16591192, 11459730, -28359960, -11671918, -5107398, 12738963, -13625075, -5054107, -19263651, 15430032},
+	  {-13794919, 5841957, -22981817, -1488504, 15150117, 11981282, 29460687, 1538238, 12528991, -16643210}},
+	 {{3368840, 11325776, 5562545, 7562924, 31159303, -8293081, 21911750, -1642196, 3642715, 10354878},
+	  {16876865, 5861265, 22471953, -2063960, 9511824, 15438797, -20668505, 2626192, -14651220, -6909064},
+	  {-17035433, -10714702, -3819158, 14021768, 20971160, 10099757, -20099445, -7651759, -31026047, 10789695}},
+	 {{4525558, 7104939, -27276113, 13632079, -17813509, -13504253, -6439646, -15096634, 32222291, 1591414},
+	  {22970279, -4827668, 26743044, -15973307, 31509423, 7354884, -14797837, 3709798, 18854811, -7294517},
+	  {-4730253, 3895118, 4668738, 8908301, 8786139, 8867706, 1937581, 14539777, -23257328, 4062083}},
+	 {{13974168, 15694507, 30439475, -3046188, 33096940, 1277192, -31931940, -4904232, 7457138, -8455767},
+	  {728506, -2803788, 11222208, -1372145, -27171254, 8545557, 7067397, 13084747, -32856560, 13336084},
+	  {-8239024, 9754105, -18648548, 11721319, -21268233, -1062762, -32352839, 4270789, -5315465, -3844661}},
+	 {{11553454, -14197121, 30699139, 7140243, -6024422, -13045573, 17129123, 13516336, -9820115, 10100777},
+	  {-22552368, -11112803, -2767422, -15079034, 16512792, -6815068, -20448129, 1901416, 142426, 2723200},
+	  {26269676, -477830, 33551015, -14677382, -23148599, 9207617, -21160194, -7941682, 31552126, -5651183}}},
+	{{{-26171765, -9849767, -24850121, 1333662, 10862903, 6312283, 5445731, 4840157, 3249200, -16339046},
+	  {-6105643, -12706718, 21164561, -7783684, 13729165, -9257026, -233861, 859102, -13941008, 12978029},
+	  {-1893979, -2431340, -33477518, -4868858, 11484623, -8198911, 95391, 11594527, 25751101, 998192}},
+	 {{11115726, 13704930, -1608143, -14896332, 8418499, -11001567, 6219741, -4205670, 30189756, -15961956},
+	  {8811378, -134672, 17392490, -9051694, 6535692, -6733728, 3404042, 10487467, 19335116, -12872394},
+	  {16137777, 3333047, 33448241, -10623792, 27859863, -9902353, 11406652, -12128437, 25259456, 4304656}},
+	 {{22236975, -6503556, -5954034, -15171139, -21931632, 2288886, -22223685, 16250601, -3453322, 16027176},
+	  {19268454, 15250422, -20204583, -2070587, 16617736, 5324668, -22503124, -4001981, 16412514, -11056828},
+	  {8381443, -6232497, -11904555, 13496051, -8444313, -11186469, 20994058, -6230165, -801412, -15323239}},
+	 {{-23245105, -9006205, 5520246, 3715791, 15012708, 9481940, 26056737, -10077162, 11992902, -3235474},
+	  {22768359, 1091475, 6576688, -6387430, 3587570, 7673930, -32177279, 11146678, 14527955, 12585263},
+	  {27811239, 15616350, -32240399, -5389177, -26208591, -6241421, -15743337, -1107706, 11317022, -3011441}},
+	 {{-20740665, 10948738, 21039471, 1797553, 9324988, -3136757, 32009462, 9735733, -7900763, 9353241},
+	  {26407586, 5571433, 8595672, -15557873, -33325084, -12304173, -5745015, 825218, 5885320, 3417184},
+	  {12388237, 6116491, -8457610, 3137955, 30458895, -13242726, 1972932, 2208929, -4497717, 11594945}},
+	 {{-17480671, -4366167, -18204968, 12882181, -33020424, 5946981, 27965122, 1555716, -14427638, 2386312},
+	  {-19510827, -1550706, -9542753, 9007358, -3760299, 4643873, 8190592, -15510604, 28630980, 14774960},
+	  {17835307, 14602409, 17361775, -10504970, -14969037, -5783395, 26580518, -2171260, 11871561, -12503163}},
+	 {{-8717181, -16734525, 29482188, 9476476, -2297507, -3261282, 27725282, 2543777, 13419914, 3029682},
+	  {7467750, 14690104, 24985150, -14610735, -10519992, 1558601, 9498818, 4312619, -25320942, -2344174},
+	  {-23341760, 7660358, 28763288, -11900417, 20581954, -16565750, 17311584, -5465123, 13709591, -7813382}},
+	 {{-22474559, -9775872, 9979593, -6009841, -2288629, 4460809, -20203445, 2587288, 4822268, -15914442},
+	  {-15622984, 16630219, -20008931, -2316223, -5552202, -14579393, 10940510, -8583086, -17074839, -8785749},
+	  {11991854, -323802, -16544536, -5546199, -1080202, -14548366, -12058677, 2619729, 17577368, -7959372}}},
+	{{{-10286928, 5863751, 24819839, -3359809, 22685243, 8668428, 4333488, -12439900, -26662998, 9765491},
+	  {9485223, 4635504, -1342389, 924712, -13910599, 15881090, 1225773, 4445275, -18841782, 11244362},
+	  {-15398638, -8255456, 31497898, 3553347, 15454652, 5071419, 4495808, 852964, 31701964, -13006870}},
+	 {{-9174156, -10939635, -29921688, -1291585, -33385601, 1431557, -591194, 6358916, 3874380, 5456256},
+	  {30937097, 15154860, -17546795, 13038174, -1038243, 2741942, 9440070, 8211005, 27114608, 3099760},
+	  {-22593146, 4842992, -28800031, -5110088, -8813356, -3809968, -24101791, -3670670, -33432052, 13577425}},
+	 {{32027722, -14450632, 17203594, 4340103, 12230934, 8102829, 19827816, -15858969, 27343400, -10937292},
+	  {-13279203, 1706844, 5635136, -14571528, -15908460, -1703233, -25664299, 16608939, -31491030, 2258466},
+	  {-25806435, -12880232, -26798671, 4768388, -14552258, 758123, -9793050, -14036604, 29370678, 14877426}},
+	 {{-31778110, 9937098, 18185209, -9263999, -16503063, -9096519, -11531178, 16017089, -8497006, -432391},
+	  {-33188219, -15370285, 16777182, 4298700, -10377179, 5476959, -20984256, -8077060, 14943017, -16294124},
+	  {-31500346, 4117707, 7830302, 226806, 11521408, 8592261, 6289224, 1001460, 29360258, -13853309}},
+	 {{5872082, -4304762, -5528775, 12591154, -4271966, 7606715, 22416423, 12357081, -11749257, -1789453},
+	  {-22872825, 11969526, 31171636, -9115604, 21881204, -1249809, -11543861, -1098584, -31446295, 5483516},
+	  {-13844248, 5637726, 12482792, -6433144, -27370840, 12707337, -216822, -13992862, 3070215, 962399}},
+	 {{983082, 2815907, 5909933, -16769585, 26026458, -2698861, 23188360, 15470762, -1855901, -476338},
+	  {7553204, 7900154, -29764317, -3160128, -11031293, -15890028, 1187400, -10628757, 14159803, 3037222},
+	  {30724173, 5546876, -25339787, 6482116, 4191846, 14688781, 31121390, -7954751, 29603223, 546506}},
+	 {{3195057, 890916, -29818339, -2031221, 25963324, -8195044, -19627475, -14685071, 19177335, 8951632},
+	  {-24107078, -7635746, 15147467, -8182006, -30108896, 15341508, 6382867, -10375808, 30505259, -16700229},
+	  {1197368, -14102167, -14968886, 14112011, 31508209, -14882858, 12060611, 12607889, -8069971, -15783697}},
+	 {{-3912237, -15762635, -18588163, -3642364, -5027028, 11615911, -4100957, -6863004, -7828193, 3822685},
+	  {-9965867, 736384, 16696364, -6812898, 21827263, 9562889, -13020349, -2137346, 15805979, 9703961},
+	  {-4418017, 9953846, -5019311, -1814762, -10275208, 8664654, -23579453, -14577570, 3443216, -2199328}}},
+	{{{-29757103, 11552286, -29171871, -8865124, 3550467, -9704439, -13567666, -3449763, 5370292, -12693263},
+	  {-14404091, 16602377, 7656628, -4776042, -1104959, 8746668, 12221810, -10553084, -14332664, -13010636},
+	  {-16734334, 12410768, 12472561, 10154264, 27566992, -4256173, 1332817, -16242737, 150358, 153066}},
+	 {{32866981, -4830516, -22851074, -10322740, 20465835, 6770442, -7542420, -6913143, 23362042, -8657902},
+	  {2694705, 7110824, 31787018, -1372789, 30410934, 4377862, 32626242, 12830002, 18695034, -9954676},
+	  {32853408, 10167960, 23154879, -8864933, -3259860, 657283, 13298577, 14968584, 11610985, -13913251}},
+	 {{-16382777, 4942556, 15916369, 5384485, -15110311, -13748963, 5211707, -5128628, -10834480, -10241919},
+	  {-1221658, 6675935, -28744718, 13071990, 10880296, 3559817, -11725180, 13048333, 19987922, 307541},
+	  {-12619350, 9703839, 29028606, 12251913, -1216279, 979199, -18058926, -2006805, 31495141, 2705517}},
+	 {{22453185, -7943019, 25309182, -14087062, -26533146, 6159115, -14152736, 16349060, -16814254, 10130381},
+	  {-27618824, -1539239, 28941041, 8485921, -24992171, 262775, 23032716, -3915544, -16879584, 12611008},
+	  {5503548, -14325845, 806701, 13975375, -24863079, -13813024, 6488201, -9938623, -19717736, 5484901}},
+	 {{969545, 8657697, -8556248, -14361580, 14872974, -6910549, 13728991, -3929265, 15665055, -11207258},
+	  {26718379, 4795370, -7320424, -11366766, -20382783, 10654067, 20301180, -9571739, -10329838, 11348902},
+	  {19854831, 13411464, 15792922, -14683245, 28955759, 6368069, 10376150, -5285019, 25734803, 13574790}},
+	 {{-6767492, 14218289, 8383722, 16627549, 8078649, -1525884, 18688817, -289676, -21682382, -203478},
+	  {-21971500, 11542932, -23971816, -14362164, -29558996, 15601305, -14260064, -5397801, -33194586, -5284019},
+	  {32518366, -11115377, 14041406, 4147477, 8731177, 2624461, -28913220, 336469, 15599186, -14615872}},
+	 {{-5562939, -10158700, 19220330, 12862537, -26908467, 7539227, 32617786, 6576169, -9275984, -1396086},
+	  {-7001035, 15800466, -8319446, -6725606, -5665007, -9225024, 21019848, -9234441, 29067432, -15187738},
+	  {-5466415, 11752415, -7607574, -16123974, 4443882, -916328, 31203847, -3229732, -32858551, -7765613}},
+	 {{5041587, -12366207, -20818550, -5083921, 21388919, 5920553, -20149162, 5278297, -15864706, -12977520},
+	  {29496779, -4411912, 6252319, -14532813, 14900028, 4857731, 4934166, -2868514, 16615004, -11022470},
+	  {-10152, -3615821, 15293437, -8115062, 20450817, 13722415, -17814732, -2419456, 16065468, -2589563}}}};
+
+#endif
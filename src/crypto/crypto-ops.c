@@ -57,6 +57,250 @@ uint64_t load_4(const unsigned char *in)
 	return result;
 }
 
+#if CRYPTO_OPS_FE64
+
+/* 64-bit field arithmetic, after curve25519-donna-c64.
+   h = h[0] + 2^51 h[1] + 2^102 h[2] + 2^153 h[3] + 2^204 h[4]. Every operation
+   carries its result, so limbs stay below 2^52 and products fit in 128 bits. */
+
+typedef unsigned __int128 fe_uint128;
+
+static const uint64_t fe_mask51 = (((uint64_t)1) << 51) - 1;
+
+static uint64_t load_8(const unsigned char *in)
+{
+	return load_4(in) | (load_4(in + 4) << 32);
+}
+
+static void store_8(unsigned char *out, uint64_t in)
+{
+	int i;
+	for(i = 0; i < 8; ++i)
+	{
+		out[i] = (unsigned char)(in >> (8 * i));
+	}
+}
+
+static void fe_carry(fe h, uint64_t h0, uint64_t h1, uint64_t h2, uint64_t h3, uint64_t h4)
+{
+	h1 += h0 >> 51;
+	h0 &= fe_mask51;
+	h2 += h1 >> 51;
+	h1 &= fe_mask51;
+	h3 += h2 >> 51;
+	h2 &= fe_mask51;
+	h4 += h3 >> 51;
+	h3 &= fe_mask51;
+	h0 += (h4 >> 51) * 19;
+	h4 &= fe_mask51;
+	h[0] = h0;
+	h[1] = h1;
+	h[2] = h2;
+	h[3] = h3;
+	h[4] = h4;
+}
+
+static void fe_carry_wide(fe h, fe_uint128 r0, fe_uint128 r1, fe_uint128 r2, fe_uint128 r3, fe_uint128 r4)
+{
+	uint64_t c;
+	r1 += (uint64_t)(r0 >> 51);
+	r2 += (uint64_t)(r1 >> 51);
+	r3 += (uint64_t)(r2 >> 51);
+	r4 += (uint64_t)(r3 >> 51);
+	c = (uint64_t)(r4 >> 51);
+	h[0] = ((uint64_t)r0 & fe_mask51) + c * 19;
+	h[1] = ((uint64_t)r1 & fe_mask51) + (h[0] >> 51);
+	h[0] &= fe_mask51;
+	h[2] = (uint64_t)r2 & fe_mask51;
+	h[3] = (uint64_t)r3 & fe_mask51;
+	h[4] = (uint64_t)r4 & fe_mask51;
+}
+
+static void fe_0(fe h)
+{
+	h[0] = 0;
+	h[1] = 0;
+	h[2] = 0;
+	h[3] = 0;
+	h[4] = 0;
+}
+
+static void fe_1(fe h)
+{
+	h[0] = 1;
+	h[1] = 0;
+	h[2] = 0;
+	h[3] = 0;
+	h[4] = 0;
+}
+
+void fe_add(fe h, const fe f, const fe g)
+{
+	fe_carry(h, f[0] + g[0], f[1] + g[1], f[2] + g[2], f[3] + g[3], f[4] + g[4]);
+}
+
+/*
+h = f - g, computed as f + 4p - g so no limb goes negative
+*/
+
+static void fe_sub(fe h, const fe f, const fe g)
+{
+	fe_carry(h, (f[0] + 0x1fffffffffffb4) - g[0], (f[1] + 0x1ffffffffffffc) - g[1], (f[2] + 0x1ffffffffffffc) - g[2],
+			 (f[3] + 0x1ffffffffffffc) - g[3], (f[4] + 0x1ffffffffffffc) - g[4]);
+}
+
+static void fe_neg(fe h, const fe f)
+{
+	fe zero;
+	fe_0(zero);
+	fe_sub(h, zero, f);
+}
+
+/*
+Replace (f,g) with (g,g) if b == 1;
+replace (f,g) with (f,g) if b == 0.
+
+Preconditions: b in {0,1}.
+*/
+
+static void fe_cmov(fe f, const fe g, unsigned int b)
+{
+	const uint64_t mask = (uint64_t)0 - b;
+	f[0] ^= mask & (f[0] ^ g[0]);
+	f[1] ^= mask & (f[1] ^ g[1]);
+	f[2] ^= mask & (f[2] ^ g[2]);
+	f[3] ^= mask & (f[3] ^ g[3]);
+	f[4] ^= mask & (f[4] ^ g[4]);
+}
+
+static void fe_copy(fe h, const fe f)
+{
+	h[0] = f[0];
+	h[1] = f[1];
+	h[2] = f[2];
+	h[3] = f[3];
+	h[4] = f[4];
+}
+
+/*
+h = f * g
+Can overlap h with f or g.
+*/
+
+static void fe_mul(fe h, const fe f, const fe g)
+{
+	const uint64_t f0 = f[0], f1 = f[1], f2 = f[2], f3 = f[3], f4 = f[4];
+	const uint64_t g0 = g[0], g1 = g[1], g2 = g[2], g3 = g[3], g4 = g[4];
+	const uint64_t g1_19 = 19 * g1, g2_19 = 19 * g2, g3_19 = 19 * g3, g4_19 = 19 * g4;
+
+	fe_uint128 r0 = (fe_uint128)f0 * g0 + (fe_uint128)f1 * g4_19 + (fe_uint128)f2 * g3_19 + (fe_uint128)f3 * g2_19 + (fe_uint128)f4 * g1_19;
+	fe_uint128 r1 = (fe_uint128)f0 * g1 + (fe_uint128)f1 * g0 + (fe_uint128)f2 * g4_19 + (fe_uint128)f3 * g3_19 + (fe_uint128)f4 * g2_19;
+	fe_uint128 r2 = (fe_uint128)f0 * g2 + (fe_uint128)f1 * g1 + (fe_uint128)f2 * g0 + (fe_uint128)f3 * g4_19 + (fe_uint128)f4 * g3_19;
+	fe_uint128 r3 = (fe_uint128)f0 * g3 + (fe_uint128)f1 * g2 + (fe_uint128)f2 * g1 + (fe_uint128)f3 * g0 + (fe_uint128)f4 * g4_19;
+	fe_uint128 r4 = (fe_uint128)f0 * g4 + (fe_uint128)f1 * g3 + (fe_uint128)f2 * g2 + (fe_uint128)f3 * g1 + (fe_uint128)f4 * g0;
+
+	fe_carry_wide(h, r0, r1, r2, r3, r4);
+}
+
+/*
+h = f * f, times 2 if dbl
+Can overlap h with f.
+*/
+
+static void fe_sq_inner(fe h, const fe f, int dbl)
+{
+	const uint64_t f0 = f[0], f1 = f[1], f2 = f[2], f3 = f[3], f4 = f[4];
+	const uint64_t f0_2 = 2 * f0, f1_2 = 2 * f1;
+	const uint64_t f1_38 = 38 * f1, f2_38 = 38 * f2, f3_38 = 38 * f3;
+	const uint64_t f3_19 = 19 * f3, f4_19 = 19 * f4;
+
+	fe_uint128 r0 = (fe_uint128)f0 * f0 + (fe_uint128)f1_38 * f4 + (fe_uint128)f2_38 * f3;
+	fe_uint128 r1 = (fe_uint128)f0_2 * f1 + (fe_uint128)f2_38 * f4 + (fe_uint128)f3_19 * f3;
+	fe_uint128 r2 = (fe_uint128)f0_2 * f2 + (fe_uint128)f1 * f1 + (fe_uint128)f3_38 * f4;
+	fe_uint128 r3 = (fe_uint128)f0_2 * f3 + (fe_uint128)f1_2 * f2 + (fe_uint128)f4_19 * f4;
+	fe_uint128 r4 = (fe_uint128)f0_2 * f4 + (fe_uint128)f1_2 * f3 + (fe_uint128)f2 * f2;
+
+	if(dbl)
+	{
+		r0 <<= 1;
+		r1 <<= 1;
+		r2 <<= 1;
+		r3 <<= 1;
+		r4 <<= 1;
+	}
+
+	fe_carry_wide(h, r0, r1, r2, r3, r4);
+}
+
+static void fe_sq(fe h, const fe f)
+{
+	fe_sq_inner(h, f, 0);
+}
+
+/*
+h = 2 * f * f
+Can overlap h with f.
+*/
+
+static void fe_sq2(fe h, const fe f)
+{
+	fe_sq_inner(h, f, 1);
+}
+
+/*
+Fully reduce h mod p and write it little-endian.
+*/
+
+void fe_tobytes(unsigned char *s, const fe h)
+{
+	fe t;
+	uint64_t q;
+
+	fe_carry(t, h[0], h[1], h[2], h[3], h[4]);
+	fe_carry(t, t[0], t[1], t[2], t[3], t[4]);
+
+	/* t < 2^255 + small; q = 1 iff t >= p */
+	q = (t[0] + 19) >> 51;
+	q = (t[1] + q) >> 51;
+	q = (t[2] + q) >> 51;
+	q = (t[3] + q) >> 51;
+	q = (t[4] + q) >> 51;
+
+	/* t - q * p = t + 19 q - 2^255 q */
+	t[0] += 19 * q;
+	t[1] += t[0] >> 51;
+	t[0] &= fe_mask51;
+	t[2] += t[1] >> 51;
+	t[1] &= fe_mask51;
+	t[3] += t[2] >> 51;
+	t[2] &= fe_mask51;
+	t[4] += t[3] >> 51;
+	t[3] &= fe_mask51;
+	t[4] &= fe_mask51;
+
+	store_8(s, t[0] | (t[1] << 51));
+	store_8(s + 8, (t[1] >> 13) | (t[2] << 38));
+	store_8(s + 16, (t[2] >> 26) | (t[3] << 25));
+	store_8(s + 24, (t[3] >> 39) | (t[4] << 12));
+}
+
+/*
+Read a little-endian number, bit 255 is ignored unless top_bit is set
+*/
+
+static void fe_frombytes(fe h, const unsigned char *s, int top_bit)
+{
+	const uint64_t w0 = load_8(s);
+	const uint64_t w1 = load_8(s + 8);
+	const uint64_t w2 = load_8(s + 16);
+	const uint64_t w3 = load_8(s + 24);
+
+	fe_carry(h, w0 & fe_mask51, ((w0 >> 51) | (w1 << 13)) & fe_mask51, ((w1 >> 38) | (w2 << 26)) & fe_mask51,
+			 ((w2 >> 25) | (w3 << 39)) & fe_mask51, top_bit ? w3 >> 12 : (w3 >> 12) & fe_mask51);
+}
+
+#else
+
 /* From fe_0.c */
 
 /*
@@ -250,6 +494,8 @@ static void fe_copy(fe h, const fe f)
 	h[9] = f9;
 }
 
+#endif
+
 /* From fe_invert.c */
 
 void fe_invert(fe out, const fe z)
@@ -351,6 +597,26 @@ static int fe_isnonzero(const fe f)
 		   1;
 }
 
+#if CRYPTO_OPS_FE64
+/*
+Whether f is 0 mod p, variable time. Two carries leave f below 2^255 + small
+with a unique limb form, so the only multiples of p it can be are 0 and p,
+which saves the full reduction and the encoding of fe_isnonzero.
+*/
+
+static int fe_iszero_vartime(const fe f)
+{
+	fe t;
+	fe_carry(t, f[0], f[1], f[2], f[3], f[4]);
+	fe_carry(t, t[0], t[1], t[2], t[3], t[4]);
+	if((t[0] | t[1] | t[2] | t[3] | t[4]) == 0)
+		return 1;
+	return t[0] == fe_mask51 - 18 && t[1] == fe_mask51 && t[2] == fe_mask51 && t[3] == fe_mask51 && t[4] == fe_mask51;
+}
+#endif
+
+#if !CRYPTO_OPS_FE64
+
 /* From fe_mul.c */
 
 /*
@@ -1228,6 +1494,77 @@ void fe_tobytes(unsigned char *s, const fe h)
 	s[31] = h9 >> 18;
 }
 
+/* From fe_frombytes.c, bit 255 is ignored unless top_bit is set */
+
+static void fe_frombytes(fe h, const unsigned char *s, int top_bit)
+{
+	int64_t h0 = load_4(s);
+	int64_t h1 = load_3(s + 4) << 6;
+	int64_t h2 = load_3(s + 7) << 5;
+	int64_t h3 = load_3(s + 10) << 3;
+	int64_t h4 = load_3(s + 13) << 2;
+	int64_t h5 = load_4(s + 16);
+	int64_t h6 = load_3(s + 20) << 7;
+	int64_t h7 = load_3(s + 23) << 5;
+	int64_t h8 = load_3(s + 26) << 4;
+	int64_t h9 = (load_3(s + 29) & (top_bit ? 16777215 : 8388607)) << 2;
+	int64_t carry0;
+	int64_t carry1;
+	int64_t carry2;
+	int64_t carry3;
+	int64_t carry4;
+	int64_t carry5;
+	int64_t carry6;
+	int64_t carry7;
+	int64_t carry8;
+	int64_t carry9;
+
+	carry9 = (h9 + (int64_t)(1 << 24)) >> 25;
+	h0 += carry9 * 19;
+	h9 -= carry9 << 25;
+	carry1 = (h1 + (int64_t)(1 << 24)) >> 25;
+	h2 += carry1;
+	h1 -= carry1 << 25;
+	carry3 = (h3 + (int64_t)(1 << 24)) >> 25;
+	h4 += carry3;
+	h3 -= carry3 << 25;
+	carry5 = (h5 + (int64_t)(1 << 24)) >> 25;
+	h6 += carry5;
+	h5 -= carry5 << 25;
+	carry7 = (h7 + (int64_t)(1 << 24)) >> 25;
+	h8 += carry7;
+	h7 -= carry7 << 25;
+
+	carry0 = (h0 + (int64_t)(1 << 25)) >> 26;
+	h1 += carry0;
+	h0 -= carry0 << 26;
+	carry2 = (h2 + (int64_t)(1 << 25)) >> 26;
+	h3 += carry2;
+	h2 -= carry2 << 26;
+	carry4 = (h4 + (int64_t)(1 << 25)) >> 26;
+	h5 += carry4;
+	h4 -= carry4 << 26;
+	carry6 = (h6 + (int64_t)(1 << 25)) >> 26;
+	h7 += carry6;
+	h6 -= carry6 << 26;
+	carry8 = (h8 + (int64_t)(1 << 25)) >> 26;
+	h9 += carry8;
+	h8 -= carry8 << 26;
+
+	h[0] = h0;
+	h[1] = h1;
+	h[2] = h2;
+	h[3] = h3;
+	h[4] = h4;
+	h[5] = h5;
+	h[6] = h6;
+	h[7] = h7;
+	h[8] = h8;
+	h[9] = h9;
+}
+
+#endif
+
 /* From ge_add.c */
 
 void ge_add(ge_p1p1 *r, const ge_p3 *p, const ge_cached *q)
@@ -1438,6 +1775,25 @@ void ge_double_scalarmult_base_vartime_p3(ge_p3 *r3, const unsigned char *a, con
 
 /* From ge_frombytes.c, modified */
 
+/* Return 1 if the low 255 bits of s are below p, bit 255 is the sign of x */
+
+static int fe_bytes_canonical(const unsigned char *s)
+{
+	int i;
+	if((s[31] & 0x7f) != 0x7f || s[0] < 0xed)
+	{
+		return 1;
+	}
+	for(i = 1; i < 31; ++i)
+	{
+		if(s[i] != 0xff)
+		{
+			return 1;
+		}
+	}
+	return 0;
+}
+
 int ge_frombytes_vartime(ge_p3 *h, const unsigned char *s)
 {
 	fe u;
@@ -1445,81 +1801,13 @@ int ge_frombytes_vartime(ge_p3 *h, const unsigned char *s)
 	fe vxx;
 	fe check;
 
-	/* From fe_frombytes.c */
-
-	int64_t h0 = load_4(s);
-	int64_t h1 = load_3(s + 4) << 6;
-	int64_t h2 = load_3(s + 7) << 5;
-	int64_t h3 = load_3(s + 10) << 3;
-	int64_t h4 = load_3(s + 13) << 2;
-	int64_t h5 = load_4(s + 16);
-	int64_t h6 = load_3(s + 20) << 7;
-	int64_t h7 = load_3(s + 23) << 5;
-	int64_t h8 = load_3(s + 26) << 4;
-	int64_t h9 = (load_3(s + 29) & 8388607) << 2;
-	int64_t carry0;
-	int64_t carry1;
-	int64_t carry2;
-	int64_t carry3;
-	int64_t carry4;
-	int64_t carry5;
-	int64_t carry6;
-	int64_t carry7;
-	int64_t carry8;
-	int64_t carry9;
-
 	/* Validate the number to be canonical */
-	if(h9 == 33554428 && h8 == 268435440 && h7 == 536870880 && h6 == 2147483520 &&
-	   h5 == 4294967295 && h4 == 67108860 && h3 == 134217720 && h2 == 536870880 &&
-	   h1 == 1073741760 && h0 >= 4294967277)
+	if(!fe_bytes_canonical(s))
 	{
 		return -1;
 	}
 
-	carry9 = (h9 + (int64_t)(1 << 24)) >> 25;
-	h0 += carry9 * 19;
-	h9 -= carry9 << 25;
-	carry1 = (h1 + (int64_t)(1 << 24)) >> 25;
-	h2 += carry1;
-	h1 -= carry1 << 25;
-	carry3 = (h3 + (int64_t)(1 << 24)) >> 25;
-	h4 += carry3;
-	h3 -= carry3 << 25;
-	carry5 = (h5 + (int64_t)(1 << 24)) >> 25;
-	h6 += carry5;
-	h5 -= carry5 << 25;
-	carry7 = (h7 + (int64_t)(1 << 24)) >> 25;
-	h8 += carry7;
-	h7 -= carry7 << 25;
-
-	carry0 = (h0 + (int64_t)(1 << 25)) >> 26;
-	h1 += carry0;
-	h0 -= carry0 << 26;
-	carry2 = (h2 + (int64_t)(1 << 25)) >> 26;
-	h3 += carry2;
-	h2 -= carry2 << 26;
-	carry4 = (h4 + (int64_t)(1 << 25)) >> 26;
-	h5 += carry4;
-	h4 -= carry4 << 26;
-	carry6 = (h6 + (int64_t)(1 << 25)) >> 26;
-	h7 += carry6;
-	h6 -= carry6 << 26;
-	carry8 = (h8 + (int64_t)(1 << 25)) >> 26;
-	h9 += carry8;
-	h8 -= carry8 << 26;
-
-	h->Y[0] = h0;
-	h->Y[1] = h1;
-	h->Y[2] = h2;
-	h->Y[3] = h3;
-	h->Y[4] = h4;
-	h->Y[5] = h5;
-	h->Y[6] = h6;
-	h->Y[7] = h7;
-	h->Y[8] = h8;
-	h->Y[9] = h9;
-
-	/* End fe_frombytes.c */
+	fe_frombytes(h->Y, s, 0);
 
 	fe_1(h->Z);
 	fe_sq(u, h->Y);
@@ -1755,21 +2043,21 @@ static void ge_precomp_cmov(ge_precomp *t, const ge_precomp *u, unsigned char b)
 	fe_cmov(t->xy2d, u->xy2d, b);
 }
 
-static void select(ge_precomp *t, int pos, signed char b)
+static void select(ge_precomp *t, const ge_precomp *row, signed char b)
 {
 	ge_precomp minust;
 	unsigned char bnegative = negative(b);
 	unsigned char babs = b - (((-bnegative) & b) << 1);
 
 	ge_precomp_0(t);
-	ge_precomp_cmov(t, &ge_base[pos][0], equal(babs, 1));
-	ge_precomp_cmov(t, &ge_base[pos][1], equal(babs, 2));
-	ge_precomp_cmov(t, &ge_base[pos][2], equal(babs, 3));
-	ge_precomp_cmov(t, &ge_base[pos][3], equal(babs, 4));
-	ge_precomp_cmov(t, &ge_base[pos][4], equal(babs, 5));
-	ge_precomp_cmov(t, &ge_base[pos][5], equal(babs, 6));
-	ge_precomp_cmov(t, &ge_base[pos][6], equal(babs, 7));
-	ge_precomp_cmov(t, &ge_base[pos][7], equal(babs, 8));
+	ge_precomp_cmov(t, &row[0], equal(babs, 1));
+	ge_precomp_cmov(t, &row[1], equal(babs, 2));
+	ge_precomp_cmov(t, &row[2], equal(babs, 3));
+	ge_precomp_cmov(t, &row[3], equal(babs, 4));
+	ge_precomp_cmov(t, &row[4], equal(babs, 5));
+	ge_precomp_cmov(t, &row[5], equal(babs, 6));
+	ge_precomp_cmov(t, &row[6], equal(babs, 7));
+	ge_precomp_cmov(t, &row[7], equal(babs, 8));
 	fe_copy(minust.yplusx, t->yminusx);
 	fe_copy(minust.yminusx, t->yplusx);
 	fe_neg(minust.xy2d, t->xy2d);
@@ -1777,15 +2065,15 @@ static void select(ge_precomp *t, int pos, signed char b)
 }
 
 /*
-h = a * B
+h = a * P
 where a = a[0]+256*a[1]+...+256^31 a[31]
-B is the Ed25519 base point (x,4/5) with x positive.
+and table[i][j] = (j+1)*256^i*P
 
 Preconditions:
   a[31] <= 127
 */
 
-void ge_scalarmult_base(ge_p3 *h, const unsigned char *a)
+static void ge_scalarmult_table(ge_p3 *h, const unsigned char *a, const ge_precomp table[32][8])
 {
 	signed char e[64];
 	signed char carry;
@@ -1816,7 +2104,7 @@ void ge_scalarmult_base(ge_p3 *h, const unsigned char *a)
 	ge_p3_0(h);
 	for(i = 1; i < 64; i += 2)
 	{
-		select(&t, i / 2, e[i]);
+		select(&t, table[i / 2], e[i]);
 		ge_madd(&r, h, &t);
 		ge_p1p1_to_p3(h, &r);
 	}
@@ -1832,12 +2120,39 @@ void ge_scalarmult_base(ge_p3 *h, const unsigned char *a)
 
 	for(i = 0; i < 64; i += 2)
 	{
-		select(&t, i / 2, e[i]);
+		select(&t, table[i / 2], e[i]);
 		ge_madd(&r, h, &t);
 		ge_p1p1_to_p3(h, &r);
 	}
 }
 
+/*
+h = a * B
+where a = a[0]+256*a[1]+...+256^31 a[31]
+B is the Ed25519 base point (x,4/5) with x positive.
+
+Preconditions:
+  a[31] <= 127
+*/
+
+void ge_scalarmult_base(ge_p3 *h, const unsigned char *a)
+{
+	ge_scalarmult_table(h, a, ge_base);
+}
+
+/*
+h = a * H
+where H is the ringct amount generator, see ge_p3_H
+
+Preconditions:
+  a[31] <= 127
+*/
+
+void ge_scalarmult_H(ge_p3 *h, const unsigned char *a)
+{
+	ge_scalarmult_table(h, a, ge_H);
+}
+
 /* From ge_sub.c */
 
 /*
@@ -2557,73 +2872,7 @@ void ge_fromfe_frombytes_vartime(ge_p2 *r, const unsigned char *s)
 	fe u, v, w, x, y, z;
 	unsigned char sign;
 
-	/* From fe_frombytes.c */
-
-	int64_t h0 = load_4(s);
-	int64_t h1 = load_3(s + 4) << 6;
-	int64_t h2 = load_3(s + 7) << 5;
-	int64_t h3 = load_3(s + 10) << 3;
-	int64_t h4 = load_3(s + 13) << 2;
-	int64_t h5 = load_4(s + 16);
-	int64_t h6 = load_3(s + 20) << 7;
-	int64_t h7 = load_3(s + 23) << 5;
-	int64_t h8 = load_3(s + 26) << 4;
-	int64_t h9 = load_3(s + 29) << 2;
-	int64_t carry0;
-	int64_t carry1;
-	int64_t carry2;
-	int64_t carry3;
-	int64_t carry4;
-	int64_t carry5;
-	int64_t carry6;
-	int64_t carry7;
-	int64_t carry8;
-	int64_t carry9;
-
-	carry9 = (h9 + (int64_t)(1 << 24)) >> 25;
-	h0 += carry9 * 19;
-	h9 -= carry9 << 25;
-	carry1 = (h1 + (int64_t)(1 << 24)) >> 25;
-	h2 += carry1;
-	h1 -= carry1 << 25;
-	carry3 = (h3 + (int64_t)(1 << 24)) >> 25;
-	h4 += carry3;
-	h3 -= carry3 << 25;
-	carry5 = (h5 + (int64_t)(1 << 24)) >> 25;
-	h6 += carry5;
-	h5 -= carry5 << 25;
-	carry7 = (h7 + (int64_t)(1 << 24)) >> 25;
-	h8 += carry7;
-	h7 -= carry7 << 25;
-
-	carry0 = (h0 + (int64_t)(1 << 25)) >> 26;
-	h1 += carry0;
-	h0 -= carry0 << 26;
-	carry2 = (h2 + (int64_t)(1 << 25)) >> 26;
-	h3 += carry2;
-	h2 -= carry2 << 26;
-	carry4 = (h4 + (int64_t)(1 << 25)) >> 26;
-	h5 += carry4;
-	h4 -= carry4 << 26;
-	carry6 = (h6 + (int64_t)(1 << 25)) >> 26;
-	h7 += carry6;
-	h6 -= carry6 << 26;
-	carry8 = (h8 + (int64_t)(1 << 25)) >> 26;
-	h9 += carry8;
-	h8 -= carry8 << 26;
-
-	u[0] = h0;
-	u[1] = h1;
-	u[2] = h2;
-	u[3] = h3;
-	u[4] = h4;
-	u[5] = h5;
-	u[6] = h6;
-	u[7] = h7;
-	u[8] = h8;
-	u[9] = h9;
-
-	/* End fe_frombytes.c */
+	fe_frombytes(u, s, 1);
 
 	fe_sq2(v, u); /* 2 * u^2 */
 	fe_1(w);
@@ -4748,6 +4997,15 @@ int sc_isnonzero(const unsigned char *s)
 int ge_p3_is_point_at_infinity(const ge_p3 *p)
 {
 	// X = 0 and Y == Z
+#if CRYPTO_OPS_FE64
+	// radix 2^51 limbs are not kept reduced, an identity coming out of ge_sub
+	// can have limbs of p rather than 0, so compare the values mod p
+	fe y_z;
+	if(!fe_iszero_vartime(p->X) || !fe_iszero_vartime(p->T))
+		return 0;
+	fe_sub(y_z, p->Y, p->Z);
+	return fe_iszero_vartime(y_z);
+#else
 	int n;
 	for (n = 0; n < 10; ++n)
 	{
@@ -4757,4 +5015,5 @@ int ge_p3_is_point_at_infinity(const ge_p3 *p)
 		return 0;
 	}
 	return 1;
+#endif
 }
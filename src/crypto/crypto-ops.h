@@ -22,7 +22,15 @@
 
 /* From fe.h */
 
+/* Field elements are 5 limbs of 51 bits on compilers with 128-bit integers,
+   otherwise (or with CRYPTO_OPS_REF10) the 10 limbs of 25.5 bits of ref10 */
+#if !defined(CRYPTO_OPS_REF10) && defined(__SIZEOF_INT128__)
+#define CRYPTO_OPS_FE64 1
+typedef uint64_t fe[5];
+#else
+#define CRYPTO_OPS_FE64 0
 typedef int32_t fe[10];
+#endif
 
 /* From ge.h */
 
@@ -136,6 +144,8 @@ extern const fe fe_fffb3;
 extern const fe fe_fffb4;
 extern const ge_p3 ge_p3_identity;
 extern const ge_p3 ge_p3_H;
+extern const ge_precomp ge_H[32][8];
+void ge_scalarmult_H(ge_p3 *, const unsigned char *);
 void ge_fromfe_frombytes_vartime(ge_p2 *, const unsigned char *);
 void sc_0(unsigned char *);
 void sc_reduce32(unsigned char *);
@@ -75,4 +75,5 @@ enum
 };
 
 void cn_fast_hash(const void *data, size_t length, char *hash);
+void cn_fast_hash_multi(const void *const *data, const size_t *length, char *const *hash, size_t count);
 void tree_hash(const char (*hashes)[HASH_SIZE], size_t count, char *root_hash);
@@ -29,3 +29,8 @@ void cn_fast_hash(const void* data, size_t length, char* hash)
 {
 	keccak((const uint8_t*)data, length, (uint8_t*)hash, 32);
 }
+
+void cn_fast_hash_multi(const void *const *data, const size_t *length, char *const *hash, size_t count)
+{
+	keccak_multi((const uint8_t *const *)data, length, (uint8_t *const *)hash, count, 32);
+}
@@ -65,6 +65,11 @@ inline hash cn_fast_hash(const void *data, std::size_t length)
 	return h;
 }
 
+inline void cn_fast_hash_multi(const void *const *data, const std::size_t *length, hash *const *hashes, std::size_t count)
+{
+	cn_fast_hash_multi(data, length, reinterpret_cast<char *const *>(hashes), count);
+}
+
 inline void tree_hash(const hash *hashes, std::size_t count, hash &root_hash)
 {
 	tree_hash(reinterpret_cast<const char(*)[HASH_SIZE]>(hashes), count, reinterpret_cast<char *>(&root_hash));
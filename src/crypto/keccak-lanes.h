@@ -0,0 +1,166 @@
+// keccak-lanes.h
+// Multi-buffer keccak, included by keccak.c once per lane count with
+// KECCAK_LANES, KECCAK_VEC, KECCAK_FN and KECCAK_ATTR defined. Each state
+// word is a vector holding that word for KECCAK_LANES independent hashes,
+// so the permutation below is keccakf() applied to all of them at once.
+
+typedef uint64_t KECCAK_VEC __attribute__((vector_size(KECCAK_LANES * 8)));
+
+KECCAK_ATTR static void KECCAK_FN(const uint8_t *const *in, const size_t *inlen, uint8_t *const *md, size_t cnt, int mdlen)
+{
+	KECCAK_VEC st[25];
+	uint64_t out[KECCAK_LANES][25];
+	uint8_t temp[KECCAK_LANES][144];
+	size_t blocks[KECCAK_LANES];
+	size_t i, l, b, rsiz, rsizw, max_blocks = 0;
+
+	rsiz = 200 == mdlen ? HASH_DATA_AREA : 200 - 2 * mdlen;
+	rsizw = rsiz / 8;
+
+	memset(st, 0, sizeof(st));
+
+	// pad the last block of each input up front, lanes run out of input at
+	// different blocks and keep permuting until the longest one is done
+	for(l = 0; l < cnt; l++)
+	{
+		size_t tail = inlen[l] % rsiz;
+		blocks[l] = inlen[l] / rsiz + 1;
+		if(blocks[l] > max_blocks)
+			max_blocks = blocks[l];
+
+		memcpy(temp[l], in[l] + inlen[l] - tail, tail);
+		temp[l][tail++] = 1;
+		memset(temp[l] + tail, 0, rsiz - tail);
+		temp[l][rsiz - 1] |= 0x80;
+	}
+
+	for(b = 0; b < max_blocks; b++)
+	{
+		for(l = 0; l < cnt; l++)
+		{
+			const uint8_t *p;
+			if(b >= blocks[l])
+				continue;
+
+			p = b + 1 == blocks[l] ? temp[l] : in[l] + b * rsiz;
+			for(i = 0; i < rsizw; i++)
+			{
+				uint64_t w;
+				memcpy(&w, p + i * 8, 8);
+				st[i][l] ^= w;
+			}
+		}
+
+		for(size_t round = 0; round < 24; round++)
+		{
+			KECCAK_VEC t0, t1, bc0, bc1, bc2, bc3, bc4;
+			// Theta
+			bc0 = st[0] ^ st[5] ^ st[10] ^ st[15] ^ st[20];
+			bc1 = st[1] ^ st[6] ^ st[11] ^ st[16] ^ st[21];
+			bc2 = st[2] ^ st[7] ^ st[12] ^ st[17] ^ st[22];
+			bc3 = st[3] ^ st[8] ^ st[13] ^ st[18] ^ st[23];
+			bc4 = st[4] ^ st[9] ^ st[14] ^ st[19] ^ st[24];
+
+			t0 = bc0;
+			t1 = bc1;
+			bc0 ^= ROTL64(bc2, 1);
+			bc1 ^= ROTL64(bc3, 1);
+			bc2 ^= ROTL64(bc4, 1);
+			bc3 ^= ROTL64(t0 , 1);
+			bc4 ^= ROTL64(t1 , 1);
+
+			// Rho Pi
+			t0 = st[1] ^ bc0;
+			st[ 0] ^= bc4;
+			st[ 1] = ROTL64(st[ 6] ^ bc0, 44);
+			st[ 6] = ROTL64(st[ 9] ^ bc3, 20);
+			st[ 9] = ROTL64(st[22] ^ bc1, 61);
+			st[22] = ROTL64(st[14] ^ bc3, 39);
+			st[14] = ROTL64(st[20] ^ bc4, 18);
+			st[20] = ROTL64(st[ 2] ^ bc1, 62);
+			st[ 2] = ROTL64(st[12] ^ bc1, 43);
+			st[12] = ROTL64(st[13] ^ bc2, 25);
+			st[13] = ROTL64(st[19] ^ bc3,  8);
+			st[19] = ROTL64(st[23] ^ bc2, 56);
+			st[23] = ROTL64(st[15] ^ bc4, 41);
+			st[15] = ROTL64(st[ 4] ^ bc3, 27);
+			st[ 4] = ROTL64(st[24] ^ bc3, 14);
+			st[24] = ROTL64(st[21] ^ bc0,  2);
+			st[21] = ROTL64(st[ 8] ^ bc2, 55);
+			st[ 8] = ROTL64(st[16] ^ bc0, 45);
+			st[16] = ROTL64(st[ 5] ^ bc4, 36);
+			st[ 5] = ROTL64(st[ 3] ^ bc2, 28);
+			st[ 3] = ROTL64(st[18] ^ bc2, 21);
+			st[18] = ROTL64(st[17] ^ bc1, 15);
+			st[17] = ROTL64(st[11] ^ bc0, 10);
+			st[11] = ROTL64(st[ 7] ^ bc1,  6);
+			st[ 7] = ROTL64(st[10] ^ bc4,  3);
+			st[10] = ROTL64(t0, 1);
+
+			//  Chi
+			bc0 = st[ 0];
+			bc1 = st[ 1];
+			st[ 0] ^= (~st[ 1]) & st[ 2];
+			st[ 1] ^= (~st[ 2]) & st[ 3];
+			st[ 2] ^= (~st[ 3]) & st[ 4];
+			st[ 3] ^= (~st[ 4]) & bc0;
+			st[ 4] ^= (~bc0) & bc1;
+
+			bc0 = st[ 5];
+			bc1 = st[ 6];
+			st[ 5] ^= (~st[ 6]) & st[ 7];
+			st[ 6] ^= (~st[ 7]) & st[ 8];
+			st[ 7] ^= (~st[ 8]) & st[ 9];
+			st[ 8] ^= (~st[ 9]) & bc0;
+			st[ 9] ^= (~bc0) & bc1;
+
+			bc0 = st[10];
+			bc1 = st[11];
+			st[10] ^= (~st[11]) & st[12];
+			st[11] ^= (~st[12]) & st[13];
+			st[12] ^= (~st[13]) & st[14];
+			st[13] ^= (~st[14]) & bc0;
+			st[14] ^= (~bc0) & bc1;
+
+			bc0 = st[15];
+			bc1 = st[16];
+			st[15] ^= (~st[16]) & st[17];
+			st[16] ^= (~st[17]) & st[18];
+			st[17] ^= (~st[18]) & st[19];
+			st[18] ^= (~st[19]) & bc0;
+			st[19] ^= (~bc0) & bc1;
+
+			bc0 = st[20];
+			bc1 = st[21];
+			bc2 = st[22];
+			bc3 = st[23];
+			bc4 = st[24];
+
+			st[20] ^= (~bc1) & bc2;
+			st[21] ^= (~bc2) & bc3;
+			st[22] ^= (~bc3) & bc4;
+			st[23] ^= (~bc4) & bc0;
+			st[24] ^= (~bc0) & bc1;
+
+			//  Iota
+			st[0] ^= keccakf_rndc[round];
+		}
+
+		for(l = 0; l < cnt; l++)
+		{
+			if(b + 1 != blocks[l])
+				continue;
+			for(i = 0; i < 25; i++)
+				out[l][i] = st[i][l];
+		}
+	}
+
+	// written last so md may alias the inputs
+	for(l = 0; l < cnt; l++)
+		memcpy(md[l], out[l], mdlen);
+}
+
+#undef KECCAK_LANES
+#undef KECCAK_VEC
+#undef KECCAK_FN
+#undef KECCAK_ATTR
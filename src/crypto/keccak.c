@@ -176,3 +176,86 @@ void keccak(const uint8_t *in, size_t inlen, uint8_t *md, int mdlen)
 
 	memcpy(md, st, mdlen);
 }
+
+// The lane counts map to SSE2 (or NEON), AVX2 and AVX-512 registers. GCC
+// vector extensions lower them to whatever the target has, so the wider
+// ones are only picked when the CPU supports them.
+#if defined(__GNUC__)
+#define KECCAK_LANES 2
+#define KECCAK_VEC keccak_vec2
+#define KECCAK_FN keccak_x2
+#define KECCAK_ATTR
+#include "keccak-lanes.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define KECCAK_HAS_X86_LANES
+#define KECCAK_LANES 4
+#define KECCAK_VEC keccak_vec4
+#define KECCAK_FN keccak_x4
+#define KECCAK_ATTR __attribute__((target("avx2")))
+#include "keccak-lanes.h"
+
+#define KECCAK_LANES 8
+#define KECCAK_VEC keccak_vec8
+#define KECCAK_FN keccak_x8
+#define KECCAK_ATTR __attribute__((target("avx512f")))
+#include "keccak-lanes.h"
+#endif
+#endif
+
+size_t keccak_max_lanes(void)
+{
+#if defined(KECCAK_HAS_X86_LANES)
+	if(__builtin_cpu_supports("avx512f"))
+		return 8;
+	else if(__builtin_cpu_supports("avx2"))
+		return 4;
+	return 2;
+#elif defined(__GNUC__)
+	return 2;
+#else
+	return 1;
+#endif
+}
+
+void keccak_multi(const uint8_t *const *in, const size_t *inlen, uint8_t *const *md, size_t count, int mdlen)
+{
+	keccak_multi_lanes(in, inlen, md, count, mdlen, keccak_max_lanes());
+}
+
+void keccak_multi_lanes(const uint8_t *const *in, const size_t *inlen, uint8_t *const *md, size_t count, int mdlen, size_t lanes)
+{
+	if(mdlen <= 0 || (mdlen > 100 && sizeof(state_t) != (size_t)mdlen))
+	{
+		local_abort("Bad keccak use");
+	}
+	if(lanes == 0 || lanes > keccak_max_lanes())
+	{
+		local_abort("Bad keccak lane count");
+	}
+
+	while(count > 0)
+	{
+		size_t cnt = count < lanes ? count : lanes;
+
+		// a short tail goes to the narrowest lanes it fills
+#if defined(KECCAK_HAS_X86_LANES)
+		if(cnt > 4)
+			keccak_x8(in, inlen, md, cnt, mdlen);
+		else if(cnt > 2)
+			keccak_x4(in, inlen, md, cnt, mdlen);
+		else
+#endif
+#if defined(__GNUC__)
+		if(cnt > 1)
+			keccak_x2(in, inlen, md, cnt, mdlen);
+		else
+#endif
+			keccak(in[0], inlen[0], md[0], mdlen);
+
+		in += cnt;
+		inlen += cnt;
+		md += cnt;
+		count -= cnt;
+	}
+}
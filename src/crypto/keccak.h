@@ -14,6 +14,17 @@ extern "C" {
 // compute a keccak hash (md) of given byte length from "in"
 void keccak(const uint8_t *in, size_t inlen, uint8_t *md, int mdlen);
 
+// compute count keccak hashes, in[i] of inlen[i] bytes into md[i], running
+// several of them side by side in SIMD lanes where the CPU allows
+void keccak_multi(const uint8_t *const *in, const size_t *inlen, uint8_t *const *md, size_t count, int mdlen);
+
+// the widest lane count keccak_multi uses on this CPU: 1, 2, 4 or 8
+size_t keccak_max_lanes(void);
+
+// keccak_multi using at most the given number of lanes, no more than
+// keccak_max_lanes(), so each width can be tested
+void keccak_multi_lanes(const uint8_t *const *in, const size_t *inlen, uint8_t *const *md, size_t count, int mdlen, size_t lanes);
+
 // update the state
 void keccakf(uint64_t st[25]);
 
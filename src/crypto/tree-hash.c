@@ -80,21 +80,35 @@ void tree_hash(const char (*hashes)[HASH_SIZE], size_t count, char *root_hash)
 		ints = alloca(ints_size);
 		memset(ints, 0, ints_size); // allocate, and zero out as extra protection for using uninitialized mem
 
+		// the pairs of each level are hashed in one cn_fast_hash_multi call
+		const void **in = alloca(cnt * sizeof(*in));
+		char **out = alloca(cnt * sizeof(*out));
+		size_t *len = alloca(cnt * sizeof(*len));
+		size_t k, pairs = count - cnt;
+
 		memcpy(ints, hashes, (2 * cnt - count) * HASH_SIZE);
 
-		for(i = 2 * cnt - count, j = 2 * cnt - count; j < cnt; i += 2, ++j)
+		for(k = 0, i = 2 * cnt - count, j = 2 * cnt - count; k < pairs; i += 2, ++j, ++k)
 		{
-			cn_fast_hash(hashes[i], 64, ints[j]);
+			in[k] = hashes[i];
+			out[k] = ints[j];
+			len[k] = 64;
 		}
 		assert(i == count);
+		cn_fast_hash_multi(in, len, out, pairs);
 
+		// the outputs land below the inputs still to be read, and each
+		// batch of lanes reads all its inputs before writing
 		while(cnt > 2)
 		{
 			cnt >>= 1;
 			for(i = 0, j = 0; j < cnt; i += 2, ++j)
 			{
-				cn_fast_hash(ints[i], 64, ints[j]);
+				in[j] = ints[i];
+				out[j] = ints[j];
+				len[j] = 64;
 			}
+			cn_fast_hash_multi(in, len, out, cnt);
 		}
 
 		cn_fast_hash(ints[0], 64, root_hash);
@@ -805,12 +805,19 @@ bool calculate_transaction_hash(const transaction &t, crypto::hash &res, size_t
 {
 	// v2 transactions hash different parts together, than hash the set of those hashes
 	crypto::hash hashes[3];
-
-	// prefix
-	get_transaction_prefix_hash(t, hashes[0]);
+	std::string blobs[3];
 
 	transaction &tt = const_cast<transaction &>(t);
 
+	// prefix
+	{
+		std::ostringstream ss;
+		binary_archive<true> ba(ss);
+		bool r = ::serialization::serialize(ba, static_cast<transaction_prefix &>(tt));
+		CHECK_AND_ASSERT_MES(r, false, "Failed to serialize transaction prefix");
+		blobs[0] = ss.str();
+	}
+
 	// base rct
 	{
 		std::stringstream ss;
@@ -819,10 +826,11 @@ bool calculate_transaction_hash(const transaction &t, crypto::hash &res, size_t
 		const size_t outputs = t.vout.size();
 		bool r = tt.rct_signatures.serialize_rctsig_base(ba, inputs, outputs);
 		CHECK_AND_ASSERT_MES(r, false, "Failed to serialize rct signatures base");
-		cryptonote::get_blob_hash(ss.str(), hashes[1]);
+		blobs[1] = ss.str();
 	}
 
 	// prunable rct
+	size_t nhashes = 2;
 	if(t.rct_signatures.type == rct::RCTTypeNull)
 	{
 		hashes[2] = crypto::null_hash;
@@ -836,9 +844,16 @@ bool calculate_transaction_hash(const transaction &t, crypto::hash &res, size_t
 		const size_t mixin = t.vin.empty() ? 0 : t.vin[0].type() == typeid(txin_to_key) ? boost::get<txin_to_key>(t.vin[0]).key_offsets.size() - 1 : 0;
 		bool r = tt.rct_signatures.p.serialize_rctsig_prunable(ba, t.rct_signatures.type, inputs, outputs, mixin);
 		CHECK_AND_ASSERT_MES(r, false, "Failed to serialize rct signatures prunable");
-		cryptonote::get_blob_hash(ss.str(), hashes[2]);
+		blobs[2] = ss.str();
+		nhashes = 3;
 	}
 
+	// the parts are independent, so they are hashed side by side
+	const void *data[3] = {blobs[0].data(), blobs[1].data(), blobs[2].data()};
+	size_t lengths[3] = {blobs[0].size(), blobs[1].size(), blobs[2].size()};
+	crypto::hash *outs[3] = {&hashes[0], &hashes[1], &hashes[2]};
+	crypto::cn_fast_hash_multi(data, lengths, outs, nhashes);
+
 	// the tx hash is the hash of the 3 hashes
 	res = cn_fast_hash(hashes, sizeof(hashes));
 
@@ -115,6 +115,26 @@ bool check_hash(const crypto::hash &hash, difficulty_type difficulty)
 	return !carry;
 }
 
+// the tail of next_difficulty_v1, shared with difficulty_window
+static difficulty_type weighted_difficulty(difficulty_type total_work, uint64_t weighted_timespans, size_t length, size_t target_seconds)
+{
+	uint64_t target = ((length + 1) / 2) * target_seconds;
+	uint64_t minimum_timespan = target_seconds * length / 2;
+	if(weighted_timespans < minimum_timespan)
+		weighted_timespans = minimum_timespan;
+
+	assert(total_work > 0);
+
+	uint64_t low, high;
+	mul(total_work, target, low, high);
+	if(high != 0)
+		return 0;
+
+	if(low / weighted_timespans == 0)
+		return 1;
+	return low / weighted_timespans;
+}
+
   /*
   # Tom Harold (Degnr8) WT
   # Modified by Zawy to be a weighted-Weighted Harmonic Mean (WWHM)
@@ -151,7 +171,6 @@ bool check_hash(const crypto::hash &hash, difficulty_type difficulty)
 		}
 
 		uint64_t weighted_timespans = 0;
-		uint64_t target;
 
 		for (size_t i = 1; i < length; i++) {
 			uint64_t timespan;
@@ -165,25 +184,96 @@ bool check_hash(const crypto::hash &hash, difficulty_type difficulty)
 			}
 			weighted_timespans += i * timespan;
 		}
-		target = ((length + 1) / 2) * target_seconds;
 
-    uint64_t minimum_timespan = target_seconds * length / 2;
-    if (weighted_timespans < minimum_timespan) {
-      weighted_timespans = minimum_timespan;
-    }
+    return weighted_difficulty(cumulative_difficulties.back() - cumulative_difficulties.front(), weighted_timespans, length, target_seconds);
+  }
 
-    difficulty_type total_work = cumulative_difficulties.back() - cumulative_difficulties.front();
-    assert(total_work > 0);
+difficulty_window::difficulty_window(size_t window, size_t target_seconds) : m_window(window), m_target_seconds(target_seconds), m_timespans(0), m_weighted_timespans(0)
+{
+	assert(window > 0 && window <= common_config::DIFFICULTY_BLOCKS_COUNT_V1);
+}
 
-    uint64_t low, high;
-    mul(total_work, target, low, high);
-    if (high != 0) {
-      return 0;
-    }
+uint64_t difficulty_window::timespan(uint64_t older, uint64_t newer) const
+{
+	if(older >= newer)
+		return 1;
+	return std::min<uint64_t>(newer - older, 10 * m_target_seconds);
+}
 
-    if (low / weighted_timespans == 0) {
-      return 1;
-    }
-    return low / weighted_timespans;
-  }
+void difficulty_window::push_back(uint64_t timestamp, difficulty_type cumulative_difficulty)
+{
+	if(full())
+		pop_front();
+
+	if(!m_timestamps.empty())
+	{
+		uint64_t span = timespan(m_timestamps.back(), timestamp);
+		m_timespans += span;
+		m_weighted_timespans += m_timestamps.size() * span;
+	}
+	m_timestamps.push_back(timestamp);
+	m_cumulative_difficulties.push_back(cumulative_difficulty);
+}
+
+void difficulty_window::push_front(uint64_t timestamp, difficulty_type cumulative_difficulty)
+{
+	if(full())
+		pop_back();
+
+	if(!m_timestamps.empty())
+	{
+		// the new span gets weight 1, every other one moves up by one
+		uint64_t span = timespan(timestamp, m_timestamps.front());
+		m_timespans += span;
+		m_weighted_timespans += m_timespans;
+	}
+	m_timestamps.push_front(timestamp);
+	m_cumulative_difficulties.push_front(cumulative_difficulty);
+}
+
+void difficulty_window::pop_back()
+{
+	assert(!m_timestamps.empty());
+	uint64_t timestamp = m_timestamps.back();
+	m_timestamps.pop_back();
+	m_cumulative_difficulties.pop_back();
+
+	if(!m_timestamps.empty())
+	{
+		uint64_t span = timespan(m_timestamps.back(), timestamp);
+		m_timespans -= span;
+		m_weighted_timespans -= m_timestamps.size() * span;
+	}
+}
+
+void difficulty_window::pop_front()
+{
+	assert(!m_timestamps.empty());
+	uint64_t timestamp = m_timestamps.front();
+	m_timestamps.pop_front();
+	m_cumulative_difficulties.pop_front();
+
+	if(!m_timestamps.empty())
+	{
+		// the dropped span had weight 1, every other one moves down by one
+		m_weighted_timespans -= m_timespans;
+		m_timespans -= timespan(timestamp, m_timestamps.front());
+	}
+}
+
+void difficulty_window::clear()
+{
+	m_timestamps.clear();
+	m_cumulative_difficulties.clear();
+	m_timespans = 0;
+	m_weighted_timespans = 0;
+}
+
+difficulty_type difficulty_window::next_difficulty() const
+{
+	size_t length = m_timestamps.size();
+	if(length <= 1)
+		return 1;
+	return weighted_difficulty(m_cumulative_difficulties.back() - m_cumulative_difficulties.front(), m_weighted_timespans, length, m_target_seconds);
+}
 }
@@ -21,9 +21,11 @@
 #pragma once
 
 #include <cstdint>
+#include <deque>
 #include <vector>
 
 #include "crypto/hash.h"
+#include "cryptonote_config.h"
 
 namespace cryptonote
 {
@@ -43,6 +45,79 @@ typedef std::uint64_t difficulty_type;
    */
 bool check_hash(const crypto::hash &hash, difficulty_type difficulty);
 difficulty_type next_difficulty_v1(std::vector<std::uint64_t> timestamps, std::vector<difficulty_type> cumulative_difficulties, size_t target_seconds);
+
+/**
+   * @brief sliding window of block timestamps and cumulative difficulties
+   *
+   * Keeps the weighted timespan sum of next_difficulty_v1 up to date as
+   * blocks enter and leave the window, so moving the window by a block and
+   * getting the next difficulty are O(1) instead of a pass over the window.
+   * next_difficulty() returns the same value as next_difficulty_v1 called
+   * with the window's contents.
+   */
+class difficulty_window
+{
+  public:
+	/**
+	 * @brief creates an empty window
+	 *
+	 * @param window the number of blocks kept, must not be larger than DIFFICULTY_BLOCKS_COUNT_V1
+	 * @param target_seconds the target block time
+	 */
+	difficulty_window(size_t window = common_config::DIFFICULTY_BLOCKS_COUNT_V2, size_t target_seconds = common_config::DIFFICULTY_TARGET);
+
+	/**
+	 * @brief adds a block after the newest one, dropping the oldest one if the window is full
+	 */
+	void push_back(uint64_t timestamp, difficulty_type cumulative_difficulty);
+
+	/**
+	 * @brief adds a block before the oldest one, dropping the newest one if the window is full
+	 *
+	 * This is how a window is rolled back after its newest block was popped:
+	 * pop_back() that block, then push_front() the one that comes back in.
+	 */
+	void push_front(uint64_t timestamp, difficulty_type cumulative_difficulty);
+
+	/**
+	 * @brief removes the newest block
+	 */
+	void pop_back();
+
+	/**
+	 * @brief removes the oldest block
+	 */
+	void pop_front();
+
+	/**
+	 * @brief removes all blocks
+	 */
+	void clear();
+
+	/**
+	 * @brief gets the difficulty for the block after the newest one
+	 *
+	 * @return the next difficulty, 0 on overflow
+	 */
+	difficulty_type next_difficulty() const;
+
+	size_t size() const { return m_timestamps.size(); }
+	bool empty() const { return m_timestamps.empty(); }
+	bool full() const { return m_timestamps.size() >= m_window; }
+	const std::deque<uint64_t> &timestamps() const { return m_timestamps; }
+	const std::deque<difficulty_type> &cumulative_difficulties() const { return m_cumulative_difficulties; }
+
+  private:
+	uint64_t timespan(uint64_t older, uint64_t newer) const;
+
+	size_t m_window;
+	size_t m_target_seconds;
+	std::deque<uint64_t> m_timestamps;
+	std::deque<difficulty_type> m_cumulative_difficulties;
+	uint64_t m_timespans;		   // sum of the clamped timespans
+	uint64_t m_weighted_timespans; // same, the i-th one weighted by i
+};
+
 template<size_t N>
 void interpolate_timestamps(std::vector<uint64_t>& timestamps);
 }
@@ -112,10 +112,11 @@ static const struct
 };
 
 //------------------------------------------------------------------
-Blockchain::Blockchain(tx_memory_pool &tx_pool) : m_db(), m_tx_pool(tx_pool), m_hardfork(NULL), m_timestamps_and_difficulties_height(0), m_current_block_cumul_sz_limit(0), m_current_block_cumul_sz_median(0),
+Blockchain::Blockchain(tx_memory_pool &tx_pool) : m_db(), m_tx_pool(tx_pool), m_hardfork(NULL), m_timestamps_and_difficulties_height(0), m_current_block_cumul_sz_limit(0), m_current_block_cumul_sz_median(0), m_block_sizes(CRYPTONOTE_REWARD_BLOCKS_WINDOW), m_block_sizes_height(0),
 												  m_enforce_dns_checkpoints(false), m_max_prepare_blocks_threads(4), m_db_blocks_per_sync(1), m_db_sync_mode(db_async), m_db_default_sync(false), m_fast_sync(true), m_show_time_stats(false), m_sync_counter(0), m_cancel(false)
 {
 	LOG_PRINT_L3("Blockchain::" << __func__);
+	m_rct_ver_cache_salt = crypto::rand<crypto::hash>();
 }
 //------------------------------------------------------------------
 bool Blockchain::have_tx(const crypto::hash &id) const
@@ -414,6 +415,22 @@ bool Blockchain::init(BlockchainDB *db, const network_type nettype, bool offline
 	if(!top_block_timestamp)
 		timestamp_diff = time(NULL) - 1341378000;
 
+	// only when asked for, let the db flush commits from its own writer thread
+	// every m_db_blocks_per_sync blocks; otherwise store_blockchain is called
+	// or queued on the async service
+	if(m_db_sync_mode == db_writebehind)
+	{
+		if(m_db->set_write_behind(true))
+		{
+			MINFO("Database commits are synced in the background");
+		}
+		else
+		{
+			MWARNING("The database can't sync in the background, syncing asynchronously instead");
+			m_db_sync_mode = db_async;
+		}
+	}
+
 	// create general purpose async service queue
 
 	m_async_work_idle = std::unique_ptr<boost::asio::io_service::work>(new boost::asio::io_service::work(m_async_service));
@@ -567,10 +584,9 @@ block Blockchain::pop_block_from_blockchain()
 	LOG_PRINT_L3("Blockchain::" << __func__);
 	CRITICAL_REGION_LOCAL(m_blockchain_lock);
 
-	m_timestamps_and_difficulties_height = 0;
-
 	block popped_block;
 	std::vector<transaction> popped_txs;
+	bool window_at_top = m_timestamps_and_difficulties_height == m_db->height() && m_difficulty_window_top == m_db->top_block_hash();
 
 	try
 	{
@@ -580,15 +596,46 @@ block Blockchain::pop_block_from_blockchain()
 	// so we re-throw
 	catch(const std::exception &e)
 	{
+		m_timestamps_and_difficulties_height = 0;
 		LOG_ERROR("Error popping block from blockchain: " << e.what());
 		throw;
 	}
 	catch(...)
 	{
+		m_timestamps_and_difficulties_height = 0;
 		LOG_ERROR("Error popping block from blockchain, throwing!");
 		throw;
 	}
 
+	// roll the difficulty window back with the chain: drop the popped block
+	// and take back the one that fell off the front when it was added
+	uint64_t height = m_db->height();
+	if(window_at_top && !m_difficulty_window.empty())
+	{
+		try
+		{
+			m_difficulty_window.pop_back();
+			if(height > common_config::DIFFICULTY_BLOCKS_COUNT_V2)
+			{
+				uint64_t index = height - common_config::DIFFICULTY_BLOCKS_COUNT_V2;
+				m_difficulty_window.push_front(m_db->get_block_timestamp(index), m_db->get_block_cumulative_difficulty(index));
+			}
+			m_timestamps_and_difficulties_height = height;
+			m_difficulty_window_top = m_db->top_block_hash();
+		}
+		catch(...)
+		{
+			// the window is half rolled back, make the next lookup rebuild it
+			m_timestamps_and_difficulties_height = 0;
+			LOG_ERROR("Error rolling back the difficulty window, throwing!");
+			throw;
+		}
+	}
+	else
+	{
+		m_timestamps_and_difficulties_height = 0;
+	}
+
 	// return transactions from popped block to the tx_pool
 	for(transaction &tx : popped_txs)
 	{
@@ -782,53 +829,30 @@ difficulty_type Blockchain::get_difficulty_for_next_block()
 {
 	LOG_PRINT_L3("Blockchain::" << __func__);
 	CRITICAL_REGION_LOCAL(m_blockchain_lock);
-	std::vector<uint64_t> timestamps;
-	std::vector<difficulty_type> difficulties;
 	uint64_t height = m_db->height();
+	crypto::hash top_hash = m_db->top_block_hash();
 
-	size_t block_count;
-	block_count = common_config::DIFFICULTY_BLOCKS_COUNT_V2;
-
-	// ND: Speedup
-	// 1. Keep a list of the last 735 (or less) blocks that is used to compute difficulty,
-	//    then when the next block difficulty is queried, push the latest height data and
-	//    pop the oldest one from the list. This only requires 1x read per height instead
-	//    of doing 735 (DIFFICULTY_BLOCKS_COUNT).
-	if(m_timestamps_and_difficulties_height != 0 && ((height - m_timestamps_and_difficulties_height) == 1) && timestamps.size() >= block_count && m_difficulties.size() >= block_count)
+	// The window is kept for the last height it was asked for and moved
+	// along with the chain: a block added on top of it is pushed onto it,
+	// and pop_block_from_blockchain() rolls it back. Asking again with the
+	// same top block reads nothing, anything else reloads the window.
+	if(m_timestamps_and_difficulties_height == 0 || height != m_timestamps_and_difficulties_height || top_hash != m_difficulty_window_top)
 	{
-		uint64_t index = height - 1;
-		m_timestamps.push_back(m_db->get_block_timestamp(index));
-		m_difficulties.push_back(m_db->get_block_cumulative_difficulty(index));
-
-		while(m_timestamps.size() > block_count)
-			m_timestamps.erase(m_timestamps.begin());
-		while(m_difficulties.size() > block_count)
-			m_difficulties.erase(m_difficulties.begin());
-
-		m_timestamps_and_difficulties_height = height;
-		timestamps = m_timestamps;
-		difficulties = m_difficulties;
-	}
-	else
-	{
-		size_t offset = height - std::min<size_t>(height, block_count);
-		if(offset == 0)
-			++offset;
-
-		timestamps.clear();
-		difficulties.clear();
-		for(; offset < height; offset++)
+		if(m_timestamps_and_difficulties_height != 0 && height == m_timestamps_and_difficulties_height + 1 && m_db->get_block_hash_from_height(height - 2) == m_difficulty_window_top)
+		{
+			uint64_t index = height - 1;
+			m_difficulty_window.push_back(m_db->get_block_timestamp(index), m_db->get_block_cumulative_difficulty(index));
+		}
+		else
 		{
-			timestamps.push_back(m_db->get_block_timestamp(offset));
-			difficulties.push_back(m_db->get_block_cumulative_difficulty(offset));
+			get_difficulty_window(height - 1, m_difficulty_window);
 		}
 
 		m_timestamps_and_difficulties_height = height;
-		m_timestamps = timestamps;
-		m_difficulties = difficulties;
+		m_difficulty_window_top = top_hash;
 	}
 
-	return next_difficulty_v1(timestamps, difficulties, common_config::DIFFICULTY_TARGET);
+	return m_difficulty_window.next_difficulty();
 }
 
 //------------------------------------------------------------------
@@ -846,8 +870,6 @@ bool Blockchain::rollback_blockchain_switching(std::list<block> &original_chain,
 		return true;
 	}
 
-	m_timestamps_and_difficulties_height = 0;
-
 	// remove blocks from blockchain until we get back to where we should be.
 	while(m_db->height() != rollback_height)
 	{
@@ -899,8 +921,6 @@ bool Blockchain::switch_to_alternative_blockchain(std::list<blocks_ext_by_hash::
 	LOG_PRINT_L3("Blockchain::" << __func__);
 	CRITICAL_REGION_LOCAL(m_blockchain_lock);
 
-	m_timestamps_and_difficulties_height = 0;
-
 	// if empty alt chain passed (not sure how that could happen), return false
 	CHECK_AND_ASSERT_MES(alt_chain.size(), false, "switch_to_alternative_blockchain: empty chain passed");
 
@@ -967,6 +987,12 @@ bool Blockchain::switch_to_alternative_blockchain(std::list<blocks_ext_by_hash::
 		}
 	}
 
+	// popping blocks drops the PoW hashes precomputed for the current batch,
+	// keep them around along with the ones cached on the alt blocks, so
+	// the blocks we are about to connect don't get hashed a second time
+	std::unordered_map<crypto::hash, crypto::hash> longhashes;
+	longhashes.swap(m_blocks_longhash_table);
+
 	// pop blocks from the blockchain until the top block is the parent
 	// of the front block of the alt chain.
 	std::list<block> disconnected_chain;
@@ -976,6 +1002,10 @@ bool Blockchain::switch_to_alternative_blockchain(std::list<blocks_ext_by_hash::
 		disconnected_chain.push_front(b);
 	}
 
+	for(auto it : alt_chain)
+		longhashes.emplace(it->first, it->second.proof_of_work);
+	m_blocks_longhash_table.swap(longhashes);
+
 	auto split_height = m_db->height();
 
 	//connecting new alternative chain
@@ -1043,72 +1073,24 @@ bool Blockchain::switch_to_alternative_blockchain(std::list<blocks_ext_by_hash::
 	return true;
 }
 //------------------------------------------------------------------
-// This function calculates the difficulty target for the block being added to
-// an alternate chain.
-difficulty_type Blockchain::get_next_difficulty_for_alternative_chain(const std::list<blocks_ext_by_hash::iterator> &alt_chain, block_extended_info &bei) const
+// This function gets the timestamps and cumulative difficulties of the
+// DIFFICULTY_BLOCKS_COUNT blocks ending with the main chain block at
+// top_height, skipping the genesis block. An alternate block forking off
+// the main chain at that height starts from this window.
+void Blockchain::get_difficulty_window(uint64_t top_height, difficulty_window &window) const
 {
 	LOG_PRINT_L3("Blockchain::" << __func__);
-	std::vector<uint64_t> timestamps;
-	std::vector<difficulty_type> cumulative_difficulties;
-
-	size_t block_count;
-	block_count = common_config::DIFFICULTY_BLOCKS_COUNT_V2;
-
-	timestamps.reserve(block_count);
-	cumulative_difficulties.reserve(block_count);
-
-	// if the alt chain isn't long enough to calculate the difficulty target
-	// based on its blocks alone, need to get more blocks from the main chain
-	if(alt_chain.size() < block_count)
-	{
-		CRITICAL_REGION_LOCAL(m_blockchain_lock);
-
-		// Figure out start and stop offsets for main chain blocks
-		size_t main_chain_stop_offset = alt_chain.size() ? alt_chain.front()->second.height : bei.height;
-		size_t main_chain_count = block_count - std::min(block_count, alt_chain.size());
-		main_chain_count = std::min(main_chain_count, main_chain_stop_offset);
-		size_t main_chain_start_offset = main_chain_stop_offset - main_chain_count;
-
-		if(!main_chain_start_offset)
-			++main_chain_start_offset; //skip genesis block
-
-		// get difficulties and timestamps from relevant main chain blocks
-		for(; main_chain_start_offset < main_chain_stop_offset; ++main_chain_start_offset)
-		{
-			timestamps.push_back(m_db->get_block_timestamp(main_chain_start_offset));
-			cumulative_difficulties.push_back(m_db->get_block_cumulative_difficulty(main_chain_start_offset));
-		}
+	CRITICAL_REGION_LOCAL(m_blockchain_lock);
 
-		// make sure we haven't accidentally grabbed too many blocks...maybe don't need this check?
-		CHECK_AND_ASSERT_MES((alt_chain.size() + timestamps.size()) <= block_count, false, "Internal error, alt_chain.size()[" << alt_chain.size()
-																															   << "] + vtimestampsec.size()[" << timestamps.size() << "] NOT <= DIFFICULTY_WINDOW[]" << block_count);
+	size_t block_count = common_config::DIFFICULTY_BLOCKS_COUNT_V2;
+	uint64_t stop_offset = top_height + 1;
+	uint64_t start_offset = stop_offset - std::min<uint64_t>(block_count, stop_offset);
+	if(!start_offset)
+		++start_offset; //skip genesis block
 
-		for(auto it : alt_chain)
-		{
-			timestamps.push_back(it->second.bl.timestamp);
-			cumulative_difficulties.push_back(it->second.cumulative_difficulty);
-		}
-	}
-	// if the alt chain is long enough for the difficulty calc, grab difficulties
-	// and timestamps from it alone
-	else
-	{
-		timestamps.resize(block_count);
-		cumulative_difficulties.resize(block_count);
-		size_t count = 0;
-		size_t max_i = timestamps.size() - 1;
-		// get difficulties and timestamps from most recent blocks in alt chain
-		for(auto it : boost::adaptors::reverse(alt_chain))
-		{
-			timestamps[max_i - count] = it->second.bl.timestamp;
-			cumulative_difficulties[max_i - count] = it->second.cumulative_difficulty;
-			count++;
-			if(count >= block_count)
-				break;
-		}
-	}
-
-	return next_difficulty_v1(timestamps, cumulative_difficulties, common_config::DIFFICULTY_TARGET);
+	window.clear();
+	for(; start_offset < stop_offset; ++start_offset)
+		window.push_back(m_db->get_block_timestamp(start_offset), m_db->get_block_cumulative_difficulty(start_offset));
 }
 //------------------------------------------------------------------
 // This function does a sanity check on basic things that all miner
@@ -1180,10 +1162,7 @@ bool Blockchain::validate_miner_transaction_v2(const block &b, uint64_t height,
 
 	partial_block_reward = false;
 
-	std::vector<size_t> last_blocks_sizes;
-	get_last_n_blocks_sizes(last_blocks_sizes, CRYPTONOTE_REWARD_BLOCKS_WINDOW);
-
-	if(!get_block_reward(m_nettype, epee::misc_utils::median(last_blocks_sizes), cumulative_block_size, already_generated_coins, base_reward, m_db->height()))
+	if(!get_block_reward(m_nettype, get_block_sizes_median(), cumulative_block_size, already_generated_coins, base_reward, m_db->height()))
 	{
 		MERROR_VER("block size " << cumulative_block_size << " is bigger than allowed for this blockchain");
 		return false;
@@ -1223,10 +1202,7 @@ bool Blockchain::validate_miner_transaction_v1(const block &b, size_t cumulative
 		money_in_use += o.amount;
 	partial_block_reward = false;
 
-	std::vector<size_t> last_blocks_sizes;
-	get_last_n_blocks_sizes(last_blocks_sizes, CRYPTONOTE_REWARD_BLOCKS_WINDOW);
-
-	if(!get_block_reward(m_nettype, epee::misc_utils::median(last_blocks_sizes), cumulative_block_size, already_generated_coins, base_reward, m_db->height()))
+	if(!get_block_reward(m_nettype, get_block_sizes_median(), cumulative_block_size, already_generated_coins, base_reward, m_db->height()))
 	{
 		MERROR_VER("block size " << cumulative_block_size << " is bigger than allowed for this blockchain");
 		return false;
@@ -1248,25 +1224,61 @@ bool Blockchain::validate_miner_transaction_v1(const block &b, size_t cumulative
 	return true;
 }
 //------------------------------------------------------------------
-// get the block sizes of the last <count> blocks, and return by reference <sz>.
-void Blockchain::get_last_n_blocks_sizes(std::vector<size_t> &sz, size_t count) const
+uint64_t Blockchain::get_block_sizes_median()
 {
 	LOG_PRINT_L3("Blockchain::" << __func__);
 	CRITICAL_REGION_LOCAL(m_blockchain_lock);
-	auto h = m_db->height();
+	const uint64_t h = m_db->height();
 
 	// this function is meaningless for an empty blockchain...granted it should never be empty
 	if(h == 0)
-		return;
+	{
+		m_block_sizes.clear();
+		m_block_sizes_ids.clear();
+		m_block_sizes_height = 0;
+		return 0;
+	}
 
 	m_db->block_txn_start(true);
-	// add size of last <count> blocks to vector <sz> (or less, if blockchain size < count)
-	size_t start_offset = h - std::min<size_t>(h, count);
-	for(size_t i = start_offset; i < h; i++)
+	const size_t count = m_block_sizes_ids.size();
+	const size_t window = m_block_sizes.capacity();
+	if(count && h == m_block_sizes_height && m_db->top_block_hash() == m_block_sizes_ids.back())
+	{
+		// nothing changed
+	}
+	else if(count && h == m_block_sizes_height + 1 && m_db->get_block_hash_from_height(h - 2) == m_block_sizes_ids.back())
+	{
+		// one block added on top of the window
+		m_block_sizes.push_back(m_db->get_block_size(h - 1));
+		m_block_sizes_ids.push_back(m_db->get_block_hash_from_height(h - 1));
+		if(m_block_sizes_ids.size() > window)
+			m_block_sizes_ids.pop_front();
+	}
+	else if(count > 1 && h + 1 == m_block_sizes_height && m_db->top_block_hash() == m_block_sizes_ids[count - 2])
+	{
+		// top block popped, the block before the window moves back in
+		m_block_sizes.pop_back();
+		m_block_sizes_ids.pop_back();
+		if(h >= window)
+		{
+			m_block_sizes.push_front(m_db->get_block_size(h - window));
+			m_block_sizes_ids.push_front(m_db->get_block_hash_from_height(h - window));
+		}
+	}
+	else
 	{
-		sz.push_back(m_db->get_block_size(i));
+		m_block_sizes.clear();
+		m_block_sizes_ids.clear();
+		for(uint64_t i = h - std::min<uint64_t>(h, window); i < h; i++)
+		{
+			m_block_sizes.push_back(m_db->get_block_size(i));
+			m_block_sizes_ids.push_back(m_db->get_block_hash_from_height(i));
+		}
 	}
+	m_block_sizes_height = h;
 	m_db->block_txn_stop();
+
+	return m_block_sizes.median();
 }
 //------------------------------------------------------------------
 uint64_t Blockchain::get_current_cumulative_blocksize_limit() const
@@ -1422,30 +1434,6 @@ bool Blockchain::create_block_template(block &b, const account_public_address &m
 	return false;
 }
 //------------------------------------------------------------------
-// for an alternate chain, get the timestamps from the main chain to complete
-// the needed number of timestamps for the BLOCKCHAIN_TIMESTAMP_CHECK_WINDOW.
-bool Blockchain::complete_timestamps_vector(uint64_t start_top_height, std::vector<uint64_t> &timestamps)
-{
-	LOG_PRINT_L3("Blockchain::" << __func__);
-
-	uint64_t window_size = common_config::BLOCKCHAIN_TIMESTAMP_CHECK_WINDOW_V2;
-
-	if(timestamps.size() >= window_size)
-		return true;
-
-	CRITICAL_REGION_LOCAL(m_blockchain_lock);
-	size_t need_elements = window_size - timestamps.size();
-	CHECK_AND_ASSERT_MES(start_top_height < m_db->height(), false, "internal error: passed start_height not < "
-																	   << " m_db->height() -- " << start_top_height << " >= " << m_db->height());
-	size_t stop_offset = start_top_height > need_elements ? start_top_height - need_elements : 0;
-	while(start_top_height != stop_offset)
-	{
-		timestamps.push_back(m_db->get_block_timestamp(start_top_height));
-		--start_top_height;
-	}
-	return true;
-}
-//------------------------------------------------------------------
 // If a block is to be added and its parent block is not the current
 // main chain top block, then we need to see if we know about its parent block.
 // If its parent block is part of a known forked chain, then we need to see
@@ -1456,7 +1444,6 @@ bool Blockchain::handle_alternative_block(const block &b, const crypto::hash &id
 {
 	LOG_PRINT_L3("Blockchain::" << __func__);
 	CRITICAL_REGION_LOCAL(m_blockchain_lock);
-	m_timestamps_and_difficulties_height = 0;
 	uint64_t block_height = get_block_height(b);
 	if(0 == block_height)
 	{
@@ -1497,11 +1484,9 @@ bool Blockchain::handle_alternative_block(const block &b, const crypto::hash &id
 		//build alternative subchain, front -> mainchain, back -> alternative head
 		blocks_ext_by_hash::iterator alt_it = it_prev; //m_alternative_chains.find()
 		std::list<blocks_ext_by_hash::iterator> alt_chain;
-		std::vector<uint64_t> timestamps;
 		while(alt_it != m_alternative_chains.end())
 		{
 			alt_chain.push_front(alt_it);
-			timestamps.push_back(alt_it->second.bl.timestamp);
 			alt_it = m_alternative_chains.find(alt_it->second.bl.prev_id);
 		}
 
@@ -1523,7 +1508,6 @@ bool Blockchain::handle_alternative_block(const block &b, const crypto::hash &id
 			// make sure block connects correctly to the main chain
 			auto h = m_db->get_block_hash_from_height(alt_chain.front()->second.height - 1);
 			CHECK_AND_ASSERT_MES(h == alt_chain.front()->second.bl.prev_id, false, "alternative chain has wrong connection to main chain");
-			complete_timestamps_vector(m_db->get_block_height(alt_chain.front()->second.bl.prev_id), timestamps);
 		}
 		// if block not associated with known alternate chain
 		else
@@ -1531,13 +1515,22 @@ bool Blockchain::handle_alternative_block(const block &b, const crypto::hash &id
 			// if block parent is not part of main chain or an alternate chain,
 			// we ignore it
 			CHECK_AND_ASSERT_MES(parent_in_main, false, "internal error: broken imperative condition: parent_in_main");
-
-			complete_timestamps_vector(m_db->get_block_height(b.prev_id), timestamps);
 		}
 
+		// the difficulty window ending with the parent block, cached on the
+		// parent if it is an alt block, read from the main chain otherwise
+		difficulty_window window;
+		if(alt_chain.size())
+			window = it_prev->second.difficulty;
+		else
+			get_difficulty_window(m_db->get_block_height(b.prev_id), window);
+
 		// verify that the block's timestamp is within the acceptable range
 		// (not earlier than the median of the last X blocks)
-		if(!check_block_timestamp(timestamps, b))
+		static_assert(common_config::DIFFICULTY_BLOCKS_COUNT_V2 >= common_config::BLOCKCHAIN_TIMESTAMP_CHECK_WINDOW_V2, "timestamp window must fit in the difficulty window");
+		size_t timestamp_window = std::min<size_t>(window.size(), common_config::BLOCKCHAIN_TIMESTAMP_CHECK_WINDOW_V2);
+		std::vector<uint64_t> median_timestamps(window.timestamps().end() - timestamp_window, window.timestamps().end());
+		if(!check_block_timestamp(median_timestamps, b))
 		{
 			MERROR_VER("Block with id: " << id << std::endl
 										 << " for alternative chain, has invalid timestamp: " << b.timestamp);
@@ -1559,10 +1552,14 @@ bool Blockchain::handle_alternative_block(const block &b, const crypto::hash &id
 		}
 
 		// Check the block's hash against the difficulty target for its alt chain
-		difficulty_type current_diff = get_next_difficulty_for_alternative_chain(alt_chain, bei);
+		difficulty_type current_diff = window.next_difficulty();
 		CHECK_AND_ASSERT_MES(current_diff, false, "!!!!!!! DIFFICULTY OVERHEAD !!!!!!!");
 		crypto::hash proof_of_work = null_hash;
-		get_block_longhash(m_nettype, bei.bl, m_pow_ctx, proof_of_work);
+		auto it_pow = m_blocks_longhash_table.find(id);
+		if(it_pow != m_blocks_longhash_table.end())
+			proof_of_work = it_pow->second;
+		else
+			get_block_longhash(m_nettype, bei.bl, m_pow_ctx, proof_of_work);
 		if(!check_hash(proof_of_work, current_diff))
 		{
 			MERROR_VER("Block with id: " << id << std::endl
@@ -1593,6 +1590,11 @@ bool Blockchain::handle_alternative_block(const block &b, const crypto::hash &id
 			bei.cumulative_difficulty = m_db->get_block_cumulative_difficulty(m_db->get_block_height(b.prev_id));
 		}
 		bei.cumulative_difficulty += current_diff;
+		bei.proof_of_work = proof_of_work;
+
+		// this block's window is its parent's, shifted by one
+		bei.difficulty = std::move(window);
+		bei.difficulty.push_back(b.timestamp, bei.cumulative_difficulty);
 
 		// add block to alternate blocks storage,
 		// as well as the current "alt chain" container
@@ -2887,6 +2889,10 @@ bool Blockchain::check_tx_inputs(transaction &tx, tx_verification_context &tvc,
 	// obviously, the original and simple rct APIs use a mixRing that's indexes
 	// in opposite orders, because it'd be too simple otherwise...
 	const rct::rctSig &rv = tx.rct_signatures;
+	crypto::hash rct_ver_key = null_hash;
+	if(rv.type != rct::RCTTypeNull)
+		rct_ver_key = get_rct_ver_cache_key(get_transaction_hash(tx), rv.mixRing);
+
 	switch(rv.type)
 	{
 	case rct::RCTTypeNull:
@@ -2946,10 +2952,15 @@ bool Blockchain::check_tx_inputs(transaction &tx, tx_verification_context &tvc,
 			}
 		}
 
-		if(!rct::verRctNonSemanticsSimple(rv))
+		// a tx seen in the pool has usually been checked against the same ring already
+		if(!m_rct_ver_cache.has(rct_ver_key))
 		{
-			MERROR_VER("Failed to check ringct signatures!");
-			return false;
+			if(!rct::verRctNonSemanticsSimple(rv))
+			{
+				MERROR_VER("Failed to check ringct signatures!");
+				return false;
+			}
+			m_rct_ver_cache.add(rct_ver_key);
 		}
 		break;
 	}
@@ -3005,10 +3016,14 @@ bool Blockchain::check_tx_inputs(transaction &tx, tx_verification_context &tvc,
 			}
 		}
 
-		if(!rct::verRct(rv, false))
+		if(!m_rct_ver_cache.has(rct_ver_key))
 		{
-			MERROR_VER("Failed to check ringct signatures!");
-			return false;
+			if(!rct::verRct(rv, false))
+			{
+				MERROR_VER("Failed to check ringct signatures!");
+				return false;
+			}
+			m_rct_ver_cache.add(rct_ver_key);
 		}
 		break;
 	}
@@ -3020,6 +3035,28 @@ bool Blockchain::check_tx_inputs(transaction &tx, tx_verification_context &tvc,
 	return true;
 }
 
+//------------------------------------------------------------------
+crypto::hash Blockchain::get_rct_ver_cache_key(const crypto::hash &tx_hash, const rct::ctkeyM &mix_ring) const
+{
+	std::string data;
+	size_t keys = 0;
+	for(const auto &ring : mix_ring)
+		keys += ring.size();
+	data.reserve(2 * sizeof(crypto::hash) + keys * sizeof(rct::ctkey));
+
+	data.append((const char *)&m_rct_ver_cache_salt, sizeof(m_rct_ver_cache_salt));
+	data.append((const char *)&tx_hash, sizeof(tx_hash));
+	for(const auto &ring : mix_ring)
+	{
+		for(const rct::ctkey &key : ring)
+		{
+			data.append((const char *)&key.dest, sizeof(key.dest));
+			data.append((const char *)&key.mask, sizeof(key.mask));
+		}
+	}
+	return crypto::cn_fast_hash(data.data(), data.size());
+}
+
 //------------------------------------------------------------------
 void Blockchain::check_ring_signature(const crypto::hash &tx_prefix_hash, const crypto::key_image &key_image, const std::vector<rct::ctkey> &pubkeys, const std::vector<crypto::signature> &sig, uint64_t &result)
 {
@@ -3634,10 +3671,7 @@ bool Blockchain::update_next_cumulative_size_limit()
 	uint64_t full_reward_zone = get_min_block_size();
 
 	LOG_PRINT_L3("Blockchain::" << __func__);
-	std::vector<size_t> sz;
-	get_last_n_blocks_sizes(sz, CRYPTONOTE_REWARD_BLOCKS_WINDOW);
-
-	uint64_t median = epee::misc_utils::median(sz);
+	uint64_t median = get_block_sizes_median();
 	m_current_block_cumul_sz_median = median;
 	if(median <= full_reward_zone)
 		median = full_reward_zone;
@@ -3806,7 +3840,12 @@ bool Blockchain::cleanup_handle_incoming_blocks(bool force_sync)
 		}
 		else if(m_db_blocks_per_sync && m_sync_counter >= m_db_blocks_per_sync)
 		{
-			if(m_db_sync_mode == db_async)
+			if(m_db_sync_mode == db_writebehind)
+			{
+				m_sync_counter = 0;
+				m_db->request_sync();
+			}
+			else if(m_db_sync_mode == db_async)
 			{
 				m_sync_counter = 0;
 				m_async_service.dispatch(boost::bind(&Blockchain::store_blockchain, this));
@@ -3843,8 +3882,7 @@ bool Blockchain::cleanup_handle_incoming_blocks(bool force_sync)
 }
 
 //------------------------------------------------------------------
-//FIXME: unused parameter txs
-void Blockchain::output_scan_worker(const uint64_t amount, const std::vector<uint64_t> &offsets, std::vector<output_data_t> &outputs, std::unordered_map<crypto::hash, cryptonote::transaction> &txs) const
+void Blockchain::output_scan_worker(const uint64_t amount, const std::vector<uint64_t> &offsets, std::vector<output_data_t> &outputs) const
 {
 	try
 	{
@@ -4010,6 +4048,7 @@ bool Blockchain::prepare_handle_incoming_blocks(const std::list<block_complete_e
 		return true;
 
 	bool blocks_exist = false;
+	bool alt_batch = false;
 	tools::threadpool &tpool = tools::threadpool::getInstance();
 	uint64_t threads = tpool.get_max_concurrency();
 
@@ -4042,11 +4081,31 @@ bool Blockchain::prepare_handle_incoming_blocks(const std::list<block_complete_e
 				// check first block and skip all blocks if its not chained properly
 				if(i == 0 && j == 0)
 				{
+					// a batch extending a known fork gets its PoW hashed in
+					// parallel too, handle_alternative_block picks it up
 					crypto::hash tophash = m_db->top_block_hash();
 					if(block.prev_id != tophash)
 					{
-						MDEBUG("Skipping prepare blocks. New blocks don't belong to chain.");
-						return true;
+						// the parent's height, where handle_alternative_block would place it
+						uint64_t alt_height;
+						auto alt_prev = m_alternative_chains.find(block.prev_id);
+						if(alt_prev != m_alternative_chains.end())
+							alt_height = alt_prev->second.height + 1;
+						else if(m_db->block_exists(block.prev_id, &alt_height))
+							++alt_height;
+						else
+						{
+							MDEBUG("Skipping prepare blocks. New blocks don't belong to chain.");
+							return true;
+						}
+
+						// don't spend PoW hashing on blocks handle_alternative_block turns away
+						if(get_block_height(block) != alt_height || !m_checkpoints.is_alternative_block_allowed(m_db->height(), alt_height))
+						{
+							MDEBUG("Skipping prepare blocks. Alternative blocks at height " << alt_height << " are not allowed.");
+							return true;
+						}
+						alt_batch = true;
 					}
 				}
 				if(have_block(get_block_hash(block)))
@@ -4113,6 +4172,14 @@ bool Blockchain::prepare_handle_incoming_blocks(const std::list<block_complete_e
 		return true;
 	}
 
+	// the scan table is built against the main chain, which alt blocks
+	// aren't verified against until they cause a reorg
+	if(alt_batch)
+	{
+		MDEBUG("Skipping scan table. New blocks are on an alternative chain.");
+		return true;
+	}
+
 	m_fake_scan_time = 0;
 	m_fake_pow_calc_time = 0;
 
@@ -4150,12 +4217,13 @@ bool Blockchain::prepare_handle_incoming_blocks(const std::list<block_complete_e
 
 		for(const auto &tx_blob : entry.txs)
 		{
-			crypto::hash tx_hash = null_hash;
 			crypto::hash tx_prefix_hash = null_hash;
 			transaction tx;
 
-			if(!parse_and_validate_tx_from_blob(tx_blob, tx, tx_hash, tx_prefix_hash))
+			// only the prefix hash is needed here, the full tx hash is left for later
+			if(!parse_and_validate_tx_from_blob(tx_blob, tx))
 				SCAN_TABLE_QUIT("Could not parse tx from incoming blocks.");
+			get_transaction_prefix_hash(tx, tx_prefix_hash);
 
 			auto its = m_scan_table.find(tx_prefix_hash);
 			if(its != m_scan_table.end())
@@ -4213,33 +4281,62 @@ bool Blockchain::prepare_handle_incoming_blocks(const std::list<block_complete_e
 		offsets.second.erase(last, offsets.second.end());
 	}
 
-	// [output] stores all transactions for each tx_out_index::hash found
-	std::vector<std::unordered_map<crypto::hash, cryptonote::transaction>> transactions(amounts.size());
-
 	threads = tpool.get_max_concurrency();
 	if(!m_db->can_thread_bulk_indices())
 		threads = 1;
 
-	if(threads > 1)
+	// All rct ring members are amount 0, so scanning per amount leaves one
+	// thread with nearly all the work. Split each amount's sorted offsets into
+	// contiguous chunks instead, each chunk is then read in index order.
+	struct scan_chunk
 	{
-		tools::threadpool::waiter waiter;
-
-		for(size_t i = 0; i < amounts.size(); i++)
+		uint64_t amount;
+		std::vector<uint64_t> offsets;
+		std::vector<output_data_t> outputs;
+	};
+	constexpr size_t min_chunk_size = 256;
+	std::vector<scan_chunk> chunks;
+	for(const auto &offsets : offset_map)
+	{
+		size_t nchunks = std::min<size_t>(threads, (offsets.second.size() + min_chunk_size - 1) / min_chunk_size);
+		nchunks = std::max<size_t>(nchunks, 1);
+		size_t chunk_size = (offsets.second.size() + nchunks - 1) / nchunks;
+		for(size_t start = 0; start < offsets.second.size(); start += chunk_size)
 		{
-			uint64_t amount = amounts[i];
-			tpool.submit(&waiter, boost::bind(&Blockchain::output_scan_worker, this, amount, std::cref(offset_map[amount]), std::ref(tx_map[amount]), std::ref(transactions[i])));
+			auto first = offsets.second.begin() + start;
+			auto last = offsets.second.begin() + std::min(start + chunk_size, offsets.second.size());
+			chunks.push_back({offsets.first, std::vector<uint64_t>(first, last), {}});
 		}
+	}
+
+	if(threads > 1 && chunks.size() > 1)
+	{
+		tools::threadpool::waiter waiter;
+
+		for(auto &chunk : chunks)
+			tpool.submit(&waiter, boost::bind(&Blockchain::output_scan_worker, this, chunk.amount, std::cref(chunk.offsets), std::ref(chunk.outputs)));
 		waiter.wait();
 	}
 	else
 	{
-		for(size_t i = 0; i < amounts.size(); i++)
-		{
-			uint64_t amount = amounts[i];
-			output_scan_worker(amount, offset_map[amount], tx_map[amount], transactions[i]);
-		}
+		for(auto &chunk : chunks)
+			output_scan_worker(chunk.amount, chunk.offsets, chunk.outputs);
 	}
 
+	// stitch the chunks back together, an output missing from one chunk means
+	// every later one is missing too, so the rest of that amount is dropped
+	std::unordered_set<uint64_t> short_amounts;
+	for(auto &chunk : chunks)
+	{
+		if(short_amounts.count(chunk.amount))
+			continue;
+		auto &outputs = tx_map[chunk.amount];
+		outputs.insert(outputs.end(), chunk.outputs.begin(), chunk.outputs.end());
+		if(chunk.outputs.size() < chunk.offsets.size())
+			short_amounts.insert(chunk.amount);
+	}
+	chunks.clear();
+
 	int total_txs = 0;
 
 	// now generate a table for each tx_prefix and k_image hashes
@@ -4250,12 +4347,13 @@ bool Blockchain::prepare_handle_incoming_blocks(const std::list<block_complete_e
 
 		for(const auto &tx_blob : entry.txs)
 		{
-			crypto::hash tx_hash = null_hash;
 			crypto::hash tx_prefix_hash = null_hash;
 			transaction tx;
 
-			if(!parse_and_validate_tx_from_blob(tx_blob, tx, tx_hash, tx_prefix_hash))
+			// only the prefix hash is needed here, the full tx hash is left for later
+			if(!parse_and_validate_tx_from_blob(tx_blob, tx))
 				SCAN_TABLE_QUIT("Could not parse tx from incoming blocks.");
+			get_transaction_prefix_hash(tx, tx_prefix_hash);
 
 			++total_txs;
 			auto its = m_scan_table.find(tx_prefix_hash);
@@ -4267,25 +4365,17 @@ bool Blockchain::prepare_handle_incoming_blocks(const std::list<block_complete_e
 				const txin_to_key &in_to_key = boost::get<txin_to_key>(txin);
 				auto needed_offsets = relative_output_offsets_to_absolute(in_to_key.key_offsets);
 
+				// offset_map holds each ring member once, sorted, and tx_map the
+				// output read for it at the same position
+				const std::vector<uint64_t> &offsets = offset_map[in_to_key.amount];
+				const std::vector<output_data_t> &found = tx_map[in_to_key.amount];
 				std::vector<output_data_t> outputs;
 				for(const uint64_t &offset_needed : needed_offsets)
 				{
-					size_t pos = 0;
-					bool found = false;
-
-					for(const uint64_t &offset_found : offset_map[in_to_key.amount])
-					{
-						if(offset_needed == offset_found)
-						{
-							found = true;
-							break;
-						}
-
-						++pos;
-					}
-
-					if(found && pos < tx_map[in_to_key.amount].size())
-						outputs.push_back(tx_map[in_to_key.amount].at(pos));
+					auto it = std::lower_bound(offsets.begin(), offsets.end(), offset_needed);
+					size_t pos = it - offsets.begin();
+					if(it != offsets.end() && *it == offset_needed && pos < found.size())
+						outputs.push_back(found[pos]);
 					else
 						break;
 				}
@@ -33,6 +33,8 @@
 
 #include "blockchain_db/blockchain_db.h"
 #include "checkpoints/checkpoints.h"
+#include "common/data_cache.h"
+#include "common/rolling_median.h"
 #include "common/util.h"
 #include "crypto/hash.h"
 #include "cryptonote_basic/cryptonote_basic.h"
@@ -58,7 +60,8 @@ enum blockchain_db_sync_mode
 	db_defaultsync, //!< user didn't specify, use db_async
 	db_sync,		//!< handle syncing calls instead of the backing db, synchronously
 	db_async,		//!< handle syncing calls instead of the backing db, asynchronously
-	db_nosync		//!< Leave syncing up to the backing db (safest, but slowest because of disk I/O)
+	db_nosync,		//!< Leave syncing up to the backing db (safest, but slowest because of disk I/O)
+	db_writebehind	//!< the backing db syncs from its own thread when asked to, without blocking commits
 };
 
 /************************************************************************/
@@ -88,6 +91,8 @@ class Blockchain
 		size_t block_cumulative_size;		   //!< the size (in bytes) of the block
 		difficulty_type cumulative_difficulty; //!< the accumulated difficulty after that block
 		uint64_t already_generated_coins;	  //!< the total coins minted after that block
+		crypto::hash proof_of_work;			   //!< the PoW hash, kept so a reorg does not compute it again
+		difficulty_window difficulty;		   //!< the difficulty window ending with that block
 	};
 
 	/**
@@ -888,12 +893,9 @@ class Blockchain
      *
      * @param amount the amount
      * @param offsets the indices (indexed to the amount) of the outputs
-     * @param outputs return-by-reference the outputs collected
-     * @param txs unused, candidate for removal
+     * @param outputs return-by-reference the outputs collected, stops short at the first missing one
      */
-	void output_scan_worker(const uint64_t amount, const std::vector<uint64_t> &offsets,
-							std::vector<output_data_t> &outputs, std::unordered_map<crypto::hash,
-																					cryptonote::transaction> &txs) const;
+	void output_scan_worker(const uint64_t amount, const std::vector<uint64_t> &offsets, std::vector<output_data_t> &outputs) const;
 
 	/**
      * @brief computes the "short" and "long" hashes for a set of blocks
@@ -963,12 +965,20 @@ class Blockchain
 	transactions_container m_transactions;
 	size_t m_current_block_cumul_sz_limit;
 	size_t m_current_block_cumul_sz_median;
+	// sizes and ids of the last CRYPTONOTE_REWARD_BLOCKS_WINDOW blocks, see get_block_sizes_median
+	tools::rolling_median<uint64_t> m_block_sizes;
+	std::deque<crypto::hash> m_block_sizes_ids;
+	uint64_t m_block_sizes_height;
 
 	// metadata containers
 	std::unordered_map<crypto::hash, std::unordered_map<crypto::key_image, std::vector<output_data_t>>> m_scan_table;
 	std::unordered_map<crypto::hash, crypto::hash> m_blocks_longhash_table;
 	std::unordered_map<crypto::hash, std::unordered_map<crypto::key_image, bool>> m_check_txin_table;
 
+	// rct signatures that already passed, keyed by get_rct_ver_cache_key
+	tools::data_cache<crypto::hash, 8192> m_rct_ver_cache;
+	crypto::hash m_rct_ver_cache_salt;
+
 	// SHA-3 hashes for each block and for fast pow checking
 	std::vector<crypto::hash> m_blocks_hash_of_hashes;
 	std::vector<crypto::hash> m_blocks_hash_check;
@@ -988,8 +998,8 @@ class Blockchain
 	uint64_t m_fake_pow_calc_time;
 	uint64_t m_fake_scan_time;
 	uint64_t m_sync_counter;
-	std::vector<uint64_t> m_timestamps;
-	std::vector<difficulty_type> m_difficulties;
+	difficulty_window m_difficulty_window;
+	crypto::hash m_difficulty_window_top;
 	uint64_t m_timestamps_and_difficulties_height;
 
 	boost::asio::io_service m_async_service;
@@ -1147,14 +1157,16 @@ class Blockchain
 	bool handle_alternative_block(const block &b, const crypto::hash &id, block_verification_context &bvc);
 
 	/**
-     * @brief gets the difficulty requirement for a new block on an alternate chain
+     * @brief gets the difficulty window ending with a main chain block
      *
-     * @param alt_chain the chain to be added to
-     * @param bei the block being added (and metadata, see ::block_extended_info)
+     * This is the window an alternate block forking off the main chain at
+     * top_height is checked against. Alternate blocks cache their own window
+     * in ::block_extended_info so their children don't need to read it again.
      *
-     * @return the difficulty requirement
+     * @param top_height the height of the last block of the window
+     * @param window return-by-reference the window
      */
-	difficulty_type get_next_difficulty_for_alternative_chain(const std::list<blocks_ext_by_hash::iterator> &alt_chain, block_extended_info &bei) const;
+	void get_difficulty_window(uint64_t top_height, difficulty_window &window) const;
 
 	/**
      * @brief sanity checks a miner transaction before validating an entire block
@@ -1203,14 +1215,15 @@ class Blockchain
 	bool rollback_blockchain_switching(std::list<block> &original_chain, uint64_t rollback_height);
 
 	/**
-     * @brief gets recent block sizes for median calculation
+     * @brief gets the median size of the last CRYPTONOTE_REWARD_BLOCKS_WINDOW blocks
      *
-     * get the block sizes of the last <count> blocks, and return by reference <sz>.
+     * The window is moved a block at a time when a single block was added to
+     * or popped from the db since the last call, and reloaded from the db
+     * otherwise (first call, reorgs, tools writing to the db directly).
      *
-     * @param sz return-by-reference the list of sizes
-     * @param count the number of blocks to get sizes for
+     * @return the median block size, 0 for an empty blockchain
      */
-	void get_last_n_blocks_sizes(std::vector<size_t> &sz, size_t count) const;
+	uint64_t get_block_sizes_median();
 
 	/**
      * @brief adds the given output to the requested set of random outputs
@@ -1319,19 +1332,6 @@ class Blockchain
      */
 	uint64_t get_adjusted_time() const;
 
-	/**
-     * @brief finish an alternate chain's timestamp window from the main chain
-     *
-     * for an alternate chain, get the timestamps from the main chain to complete
-     * the needed number of timestamps for the BLOCKCHAIN_TIMESTAMP_CHECK_WINDOW.
-     *
-     * @param start_height the alternate chain's attachment height to the main chain
-     * @param timestamps return-by-value the timestamps set to be populated
-     *
-     * @return true unless start_height is greater than the current blockchain height
-     */
-	bool complete_timestamps_vector(uint64_t start_height, std::vector<uint64_t> &timestamps);
-
 	/**
      * @brief calculate the block size limit for the next block to be added
      *
@@ -1350,6 +1350,21 @@ class Blockchain
      */
 	bool check_for_double_spend(const transaction &tx, key_images_container &keys_this_block) const;
 
+	/**
+     * @brief gets the key a tx's rct signatures are cached under once checked
+     *
+     * The signatures are only a function of the tx and of the ring members its
+     * inputs resolved to, so both go into the key. If a reorg changes the ring
+     * members the key changes too and the signatures are checked again. The
+     * key is salted per process so it can't be targeted from outside.
+     *
+     * @param tx_hash the hash of the tx
+     * @param mix_ring the ring members, as expanded into the rct signatures
+     *
+     * @return the cache key
+     */
+	crypto::hash get_rct_ver_cache_key(const crypto::hash &tx_hash, const rct::ctkeyM &mix_ring) const;
+
 	/**
      * @brief validates a transaction input's ring signature
      *
@@ -405,6 +405,8 @@ bool core::init(const boost::program_options::variables_map &vm, const char *con
 				sync_mode = db_sync_mode_is_default ? db_defaultsync : db_sync;
 			else if(options[1] == "async")
 				sync_mode = db_sync_mode_is_default ? db_defaultsync : db_async;
+			else if(options[1] == "writebehind")
+				sync_mode = db_sync_mode_is_default ? db_defaultsync : db_writebehind;
 		}
 
 		if(options.size() >= 3 && !safemode)
@@ -589,20 +591,57 @@ bool core::handle_incoming_tx_post(const blobdata &tx_blob, tx_verification_cont
 	{
 		LOG_PRINT_L1("WRONG TRANSACTION BLOB, Failed to check tx " << tx_hash << " semantic, rejected");
 		tvc.m_verifivation_failed = true;
-		bad_semantics_txes_lock.lock();
-		bad_semantics_txes[0].insert(tx_hash);
-		if(bad_semantics_txes[0].size() >= BAD_SEMANTICS_TXES_MAX_SIZE)
-		{
-			std::swap(bad_semantics_txes[0], bad_semantics_txes[1]);
-			bad_semantics_txes[0].clear();
-		}
-		bad_semantics_txes_lock.unlock();
+		add_bad_semantics_tx(tx_hash);
 		return false;
 	}
 
 	return true;
 }
 //-----------------------------------------------------------------------------------------------
+void core::add_bad_semantics_tx(const crypto::hash &tx_hash)
+{
+	bad_semantics_txes_lock.lock();
+	bad_semantics_txes[0].insert(tx_hash);
+	if(bad_semantics_txes[0].size() >= BAD_SEMANTICS_TXES_MAX_SIZE)
+	{
+		std::swap(bad_semantics_txes[0], bad_semantics_txes[1]);
+		bad_semantics_txes[0].clear();
+	}
+	bad_semantics_txes_lock.unlock();
+}
+//-----------------------------------------------------------------------------------------------
+void core::check_tx_rct_semantics_batch(const std::vector<const transaction *> &txs, std::vector<bool> &valid) const
+{
+	valid.assign(txs.size(), true);
+
+	// ranges of txs still to check, a failing range is split in two
+	std::vector<std::pair<size_t, size_t>> ranges;
+	if(!txs.empty())
+		ranges.emplace_back(0, txs.size());
+
+	std::vector<const rct::rctSig *> rvv;
+	while(!ranges.empty())
+	{
+		const size_t begin = ranges.back().first, end = ranges.back().second;
+		ranges.pop_back();
+
+		rvv.clear();
+		for(size_t i = begin; i < end; ++i)
+			rvv.push_back(&txs[i]->rct_signatures);
+		if(rct::verRctSemanticsSimple(rvv))
+			continue;
+
+		if(end - begin == 1)
+		{
+			valid[begin] = false;
+			continue;
+		}
+		const size_t mid = begin + (end - begin) / 2;
+		ranges.emplace_back(mid, end);
+		ranges.emplace_back(begin, mid);
+	}
+}
+//-----------------------------------------------------------------------------------------------
 bool core::handle_incoming_txs(const std::list<blobdata> &tx_blobs, std::vector<tx_verification_context> &tvc, bool keeped_by_block, bool relayed, bool do_not_relay)
 {
 	TRY_ENTRY();
@@ -615,6 +654,7 @@ bool core::handle_incoming_txs(const std::list<blobdata> &tx_blobs, std::vector<
 		crypto::hash prefix_hash;
 		bool in_txpool;
 		bool in_blockchain;
+		bool check_rct;
 	};
 	std::vector<result> results(tx_blobs.size());
 
@@ -651,6 +691,9 @@ bool core::handle_incoming_txs(const std::list<blobdata> &tx_blobs, std::vector<
 		}
 		else
 		{
+			const uint8_t rct_type = results[i].tx.rct_signatures.type;
+			results[i].check_rct = (rct_type == rct::RCTTypeSimple || rct_type == rct::RCTTypeBulletproof) &&
+								   !(keeped_by_block && get_blockchain_storage().is_within_compiled_block_hash_area());
 			m_threadpool.submit(&waiter, [&, i, it] {
 				try
 				{
@@ -666,6 +709,31 @@ bool core::handle_incoming_txs(const std::list<blobdata> &tx_blobs, std::vector<
 	}
 	waiter.wait();
 
+	// the rct semantics of all the txes are checked in one batch
+	std::vector<size_t> rct_indices;
+	std::vector<const transaction *> rct_txs;
+	for(size_t i = 0; i < tx_blobs.size(); i++)
+	{
+		if(results[i].res && results[i].check_rct)
+		{
+			rct_indices.push_back(i);
+			rct_txs.push_back(&results[i].tx);
+		}
+	}
+	std::vector<bool> rct_valid;
+	check_tx_rct_semantics_batch(rct_txs, rct_valid);
+	for(size_t n = 0; n < rct_indices.size(); n++)
+	{
+		if(rct_valid[n])
+			continue;
+		const size_t i = rct_indices[n];
+		LOG_PRINT_L1("WRONG TRANSACTION BLOB, Failed to check tx " << results[i].hash << " rct semantics, rejected");
+		MERROR_VER("rct signature semantics check failed");
+		tvc[i].m_verifivation_failed = true;
+		results[i].res = false;
+		add_bad_semantics_tx(results[i].hash);
+	}
+
 	bool ok = true;
 	it = tx_blobs.begin();
 	for(size_t i = 0; i < tx_blobs.size(); i++, ++it)
@@ -783,13 +851,7 @@ bool core::check_tx_semantic(const transaction &tx, bool keeped_by_block) const
 		return false;
 	case rct::RCTTypeSimple:
 	case rct::RCTTypeBulletproof:
-		// Use inefficient version for now - we will be scrapping the whole system
-		// and there is very little point in polishing turds
-		if(!rct::verRctSemanticsSimple(rv))
-		{
-			MERROR_VER("rct signature semantics check failed");
-			return false;
-		}
+		// checked in batches by check_tx_rct_semantics_batch
 		break;
 	case rct::RCTTypeFull:
 		if(!rct::verRct(rv, true))
@@ -1204,6 +1266,11 @@ bool core::get_pool_transaction_hashes(std::vector<crypto::hash> &txs, bool incl
 	return true;
 }
 //-----------------------------------------------------------------------------------------------
+bool core::get_pool_transaction_changes(uint64_t since, std::vector<crypto::hash> &added, std::vector<crypto::hash> &removed, uint64_t &revision, bool include_sensitive_data) const
+{
+	return m_mempool.get_transaction_changes(since, added, removed, revision, include_sensitive_data);
+}
+//-----------------------------------------------------------------------------------------------
 bool core::get_pool_transaction_stats(struct txpool_stats &stats, bool include_sensitive_data) const
 {
 	m_mempool.get_transaction_stats(stats, include_sensitive_data);
@@ -436,6 +436,13 @@ class core : public i_miner_handler
       */
 	bool get_pool_transaction_hashes(std::vector<crypto::hash> &txs, bool include_unrelayed_txes = true) const;
 
+	/**
+      * @copydoc tx_memory_pool::get_transaction_changes
+      *
+      * @note see tx_memory_pool::get_transaction_changes
+      */
+	bool get_pool_transaction_changes(uint64_t since, std::vector<crypto::hash> &added, std::vector<crypto::hash> &removed, uint64_t &revision, bool include_unrelayed_txes = true) const;
+
 	/**
       * @copydoc tx_memory_pool::get_transactions
       * @param include_unrelayed_txes include unrelayed txes in result
@@ -838,6 +845,9 @@ class core : public i_miner_handler
       *                   tx not too large,
       *                   each input has a different key image.
       *
+      * The range proofs and sums of simple rct signatures are not checked
+      * here, see check_tx_rct_semantics_batch.
+      *
       * @param tx the transaction to check
       * @param keeped_by_block if the transaction has been in a block
       *
@@ -845,6 +855,25 @@ class core : public i_miner_handler
       */
 	bool check_tx_semantic(const transaction &tx, bool keeped_by_block) const;
 
+	/**
+      * @brief checks the simple rct signature semantics of a batch of transactions
+      *
+      * All the range proofs are verified at once, so the bulletproofs of every
+      * transaction share a single multiexp. If the batch fails, it is split in
+      * halves until the failing transactions are found.
+      *
+      * @param txs the transactions to check, all with simple rct signatures
+      * @param valid return-by-reference, the result for each transaction
+      */
+	void check_tx_rct_semantics_batch(const std::vector<const transaction *> &txs, std::vector<bool> &valid) const;
+
+	/**
+      * @brief remembers a transaction that failed semantic checks, so it is rejected early next time
+      *
+      * @param tx_hash the transaction hash
+      */
+	void add_bad_semantics_tx(const crypto::hash &tx_hash);
+
 	bool handle_incoming_tx_pre(const blobdata &tx_blob, tx_verification_context &tvc, cryptonote::transaction &tx, crypto::hash &tx_hash, crypto::hash &tx_prefixt_hash, bool keeped_by_block, bool relayed, bool do_not_relay);
 	bool handle_incoming_tx_post(const blobdata &tx_blob, tx_verification_context &tvc, cryptonote::transaction &tx, crypto::hash &tx_hash, crypto::hash &tx_prefixt_hash, bool keeped_by_block, bool relayed, bool do_not_relay);
 
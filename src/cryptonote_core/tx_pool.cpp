@@ -55,6 +55,7 @@ namespace
 time_t const MIN_RELAY_TIME = (60 * 5);		 // only start re-relaying transactions after that many seconds
 time_t const MAX_RELAY_TIME = (60 * 60 * 4); // at most that many seconds between resends
 float const ACCEPT_THRESHOLD = 1.0f;
+size_t const MAX_POOL_CHANGES = 50000; // changes kept for callers asking by revision
 
 // a kind of increasing backoff within min/max bounds
 uint64_t get_relay_delay(time_t now, time_t received)
@@ -103,7 +104,8 @@ class LockedTXN
 }
 //---------------------------------------------------------------------------------
 //---------------------------------------------------------------------------------
-tx_memory_pool::tx_memory_pool(Blockchain &bchs) : m_blockchain(bchs), m_txpool_max_size(DEFAULT_TXPOOL_MAX_SIZE), m_txpool_size(0)
+tx_memory_pool::tx_memory_pool(Blockchain &bchs) : m_pool_revision((uint64_t(crypto::rand<uint32_t>()) + 1) << 32), m_pool_changes_base(m_pool_revision),
+													m_blockchain(bchs), m_txpool_max_size(DEFAULT_TXPOOL_MAX_SIZE), m_txpool_size(0)
 {
 }
 //---------------------------------------------------------------------------------
@@ -275,6 +277,7 @@ bool tx_memory_pool::add_tx(transaction &tx, /*const crypto::hash& tx_prefix_has
 
 	tvc.m_verifivation_failed = false;
 	m_txpool_size += blob_size;
+	record_pool_change(id, true, do_not_relay);
 
 	MINFO("Transaction added to pool: txid " << id << " bytes: " << blob_size << " fee/byte: " << (fee / (double)blob_size));
 
@@ -344,6 +347,7 @@ void tx_memory_pool::prune(size_t bytes)
 			MINFO("Pruning tx " << txid << " from txpool: size: " << it->first.second << ", fee/byte: " << it->first.first);
 			m_blockchain.remove_txpool_tx(txid);
 			m_txpool_size -= txblob.size();
+			record_pool_change(txid, false, meta.do_not_relay);
 			remove_transaction_keyimages(tx);
 			MINFO("Pruned tx " << txid << " from txpool: size: " << it->first.second << ", fee/byte: " << it->first.first);
 			m_txs_by_fee_and_receive_time.erase(it--);
@@ -440,6 +444,7 @@ bool tx_memory_pool::take_tx(const crypto::hash &id, transaction &tx, size_t &bl
 		// remove first, in case this throws, so key images aren't removed
 		m_blockchain.remove_txpool_tx(id);
 		m_txpool_size -= blob_size;
+		record_pool_change(id, false, do_not_relay);
 		remove_transaction_keyimages(tx);
 	}
 	catch(const std::exception &e)
@@ -469,8 +474,8 @@ bool tx_memory_pool::remove_stuck_transactions()
 {
 	CRITICAL_REGION_LOCAL(m_transactions_lock);
 	CRITICAL_REGION_LOCAL1(m_blockchain);
-	std::unordered_set<crypto::hash> remove;
-	m_blockchain.for_all_txpool_txes([this, &remove](const crypto::hash &txid, const txpool_tx_meta_t &meta, const cryptonote::blobdata *) {
+	std::unordered_set<crypto::hash> remove, unrelayed;
+	m_blockchain.for_all_txpool_txes([this, &remove, &unrelayed](const crypto::hash &txid, const txpool_tx_meta_t &meta, const cryptonote::blobdata *) {
 		uint64_t tx_age = time(nullptr) - meta.receive_time;
 
 		if((tx_age > CRYPTONOTE_MEMPOOL_TX_LIVETIME && !meta.kept_by_block) ||
@@ -488,6 +493,8 @@ bool tx_memory_pool::remove_stuck_transactions()
 			}
 			m_timed_out_transactions.insert(txid);
 			remove.insert(txid);
+			if(meta.do_not_relay)
+				unrelayed.insert(txid);
 		}
 		return true;
 	},
@@ -512,6 +519,7 @@ bool tx_memory_pool::remove_stuck_transactions()
 					// remove first, so we only remove key images if the tx removal succeeds
 					m_blockchain.remove_txpool_tx(txid);
 					m_txpool_size -= bd.size();
+					record_pool_change(txid, false, unrelayed.count(txid) > 0);
 					remove_transaction_keyimages(tx);
 				}
 			}
@@ -621,6 +629,41 @@ void tx_memory_pool::get_transaction_hashes(std::vector<crypto::hash> &txs, bool
 									 false, include_unrelayed_txes);
 }
 //------------------------------------------------------------------
+bool tx_memory_pool::get_transaction_changes(uint64_t since, std::vector<crypto::hash> &added, std::vector<crypto::hash> &removed, uint64_t &revision, bool include_unrelayed_txes) const
+{
+	CRITICAL_REGION_LOCAL(m_transactions_lock);
+	revision = m_pool_revision;
+	if(since < m_pool_changes_base || since > m_pool_revision)
+	{
+		get_transaction_hashes(added, include_unrelayed_txes);
+		return false;
+	}
+
+	// revisions are consecutive, so the changes after since start at a known index.
+	// Only the last change to each transaction matters to the caller.
+	std::unordered_map<crypto::hash, bool> last;
+	for(auto it = m_pool_changes.begin() + (since - m_pool_changes_base); it != m_pool_changes.end(); ++it)
+	{
+		if(!include_unrelayed_txes && it->do_not_relay)
+			continue;
+		last[it->txid] = it->added;
+	}
+	for(const auto &e : last)
+		(e.second ? added : removed).push_back(e.first);
+	return true;
+}
+//------------------------------------------------------------------
+void tx_memory_pool::record_pool_change(const crypto::hash &txid, bool added, bool do_not_relay)
+{
+	m_pool_changes.push_back({txid, added, do_not_relay});
+	++m_pool_revision;
+	if(m_pool_changes.size() > MAX_POOL_CHANGES)
+	{
+		m_pool_changes.pop_front();
+		++m_pool_changes_base;
+	}
+}
+//------------------------------------------------------------------
 void tx_memory_pool::get_transaction_backlog(std::vector<tx_backlog_entry> &backlog, bool include_unrelayed_txes) const
 {
 	CRITICAL_REGION_LOCAL(m_transactions_lock);
@@ -1161,10 +1204,10 @@ size_t tx_memory_pool::validate()
 	CRITICAL_REGION_LOCAL(m_transactions_lock);
 	CRITICAL_REGION_LOCAL1(m_blockchain);
 	size_t tx_size_limit = common_config::TRANSACTION_SIZE_LIMIT;
-	std::unordered_set<crypto::hash> remove;
+	std::unordered_set<crypto::hash> remove, unrelayed;
 
 	m_txpool_size = 0;
-	m_blockchain.for_all_txpool_txes([this, &remove, tx_size_limit](const crypto::hash &txid, const txpool_tx_meta_t &meta, const cryptonote::blobdata *) {
+	m_blockchain.for_all_txpool_txes([this, &remove, &unrelayed, tx_size_limit](const crypto::hash &txid, const txpool_tx_meta_t &meta, const cryptonote::blobdata *) {
 		m_txpool_size += meta.blob_size;
 		if(meta.blob_size > tx_size_limit)
 		{
@@ -1176,6 +1219,8 @@ size_t tx_memory_pool::validate()
 			LOG_PRINT_L1("Transaction " << txid << " is in the blockchain, removing it from pool");
 			remove.insert(txid);
 		}
+		if(meta.do_not_relay && remove.count(txid) > 0)
+			unrelayed.insert(txid);
 		return true;
 	},
 									 false);
@@ -1198,6 +1243,7 @@ size_t tx_memory_pool::validate()
 				// remove tx from db first
 				m_blockchain.remove_txpool_tx(txid);
 				m_txpool_size -= txblob.size();
+				record_pool_change(txid, false, unrelayed.count(txid) > 0);
 				remove_transaction_keyimages(tx);
 				auto sorted_it = find_tx_in_sorted_container(txid);
 				if(sorted_it == m_txs_by_fee_and_receive_time.end())
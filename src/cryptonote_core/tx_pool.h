@@ -23,6 +23,7 @@
 
 #include <boost/serialization/version.hpp>
 #include <boost/utility.hpp>
+#include <deque>
 #include <queue>
 #include <set>
 #include <unordered_map>
@@ -243,6 +244,23 @@ class tx_memory_pool : boost::noncopyable
      */
 	void get_transaction_hashes(std::vector<crypto::hash> &txs, bool include_unrelayed_txes = true) const;
 
+	/**
+     * @brief get the transactions added to and removed from the pool since a revision
+     *
+     * Every change to the pool bumps its revision. The most recent changes are
+     * kept, so a caller that saw one of those revisions only needs the difference.
+     *
+     * @param since the revision the caller last saw
+     * @param added return-by-reference the hashes added since, or the whole pool
+     * @param removed return-by-reference the hashes removed since
+     * @param revision return-by-reference the current revision
+     * @param include_unrelayed_txes include unrelayed txes in the result
+     *
+     * @return true if added and removed are the changes since that revision,
+     *         false if that revision is unknown and added is the whole pool
+     */
+	bool get_transaction_changes(uint64_t since, std::vector<crypto::hash> &added, std::vector<crypto::hash> &removed, uint64_t &revision, bool include_unrelayed_txes = true) const;
+
 	/**
      * @brief get (size, fee, receive time) for all transaction in the pool
      *
@@ -510,6 +528,11 @@ class tx_memory_pool : boost::noncopyable
      */
 	void prune(size_t bytes = 0);
 
+	/**
+     * @brief bump the pool revision and log a transaction added or removed
+     */
+	void record_pool_change(const crypto::hash &txid, bool added, bool do_not_relay);
+
 	//TODO: confirm the below comments and investigate whether or not this
 	//      is the desired behavior
 	//! map key images to transactions which spent them
@@ -540,6 +563,19 @@ class tx_memory_pool : boost::noncopyable
 	//!< container for transactions organized by fee per size and receive time
 	sorted_tx_container m_txs_by_fee_and_receive_time;
 
+	//! a transaction entering or leaving the pool
+	struct pool_change
+	{
+		crypto::hash txid;
+		bool added;
+		bool do_not_relay;
+	};
+
+	//! the latest changes to the pool, the last one made at m_pool_revision
+	std::deque<pool_change> m_pool_changes;
+	uint64_t m_pool_revision; //!< starts at a random point, so revisions from before a restart are not taken for ours
+	uint64_t m_pool_changes_base; //!< revision the oldest change in m_pool_changes applies on top of
+
 	/**
      * @brief get an iterator to a transaction in the sorted container
      *
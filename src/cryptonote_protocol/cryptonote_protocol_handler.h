@@ -86,6 +86,7 @@ class t_cryptonote_protocol_handler : public i_cryptonote_protocol, cryptonote_p
 	bool on_idle();
 	bool init(const boost::program_options::variables_map &vm);
 	bool deinit();
+	static int get_traffic_class(int command);
 	void set_p2p_endpoint(nodetool::i_p2p_endpoint<connection_context> *p2p);
 	//bool process_handshake_data(const blobdata& data, cryptonote_connection_context& context);
 	bool process_payload_sync_data(const CORE_SYNC_DATA &hshd, cryptonote_connection_context &context, bool is_inital);
@@ -64,10 +64,34 @@ t_cryptonote_protocol_handler<t_core>::t_cryptonote_protocol_handler(t_core &rco
 template <class t_core>
 bool t_cryptonote_protocol_handler<t_core>::init(const boost::program_options::variables_map &vm)
 {
+	epee::net_utils::network_throttle_manager::set_traffic_classifier(&t_cryptonote_protocol_handler<t_core>::get_traffic_class);
 	return true;
 }
 //------------------------------------------------------------------------------------------------------------------------
 template <class t_core>
+int t_cryptonote_protocol_handler<t_core>::get_traffic_class(int command)
+{
+	// Blocks and the objects a syncing peer asked for go out ahead of tx relay,
+	// p2p commands (peer lists, pings) fall back to traffic_class_other
+	switch(command)
+	{
+	case NOTIFY_NEW_BLOCK::ID:
+	case NOTIFY_NEW_FLUFFY_BLOCK::ID:
+	case NOTIFY_REQUEST_FLUFFY_MISSING_TX::ID:
+		return epee::net_utils::traffic_class_block;
+	case NOTIFY_REQUEST_GET_OBJECTS::ID:
+	case NOTIFY_RESPONSE_GET_OBJECTS::ID:
+	case NOTIFY_REQUEST_CHAIN::ID:
+	case NOTIFY_RESPONSE_CHAIN_ENTRY::ID:
+		return epee::net_utils::traffic_class_sync;
+	case NOTIFY_NEW_TRANSACTIONS::ID:
+		return epee::net_utils::traffic_class_relay;
+	default:
+		return epee::net_utils::traffic_class_other;
+	}
+}
+//------------------------------------------------------------------------------------------------------------------------
+template <class t_core>
 bool t_cryptonote_protocol_handler<t_core>::deinit()
 {
 	return true;
@@ -326,11 +350,12 @@ int t_cryptonote_protocol_handler<t_core>::handle_notify_new_block(int command,
 	std::list<block_complete_entry> blocks;
 	blocks.push_back(arg.b);
 	m_core.prepare_handle_incoming_blocks(blocks);
-	for(auto tx_blob_it = arg.b.txs.begin(); tx_blob_it != arg.b.txs.end(); tx_blob_it++)
+	// all the txes go in one call so their range proofs are verified in one batch
+	std::vector<cryptonote::tx_verification_context> tvc(arg.b.txs.size());
+	m_core.handle_incoming_txs(arg.b.txs, tvc, true, true, false);
+	for(const cryptonote::tx_verification_context &tx_tvc : tvc)
 	{
-		cryptonote::tx_verification_context tvc = AUTO_VAL_INIT(tvc);
-		m_core.handle_incoming_tx(*tx_blob_it, tvc, true, true, false);
-		if(tvc.m_verifivation_failed)
+		if(tx_tvc.m_verifivation_failed)
 		{
 			LOG_PRINT_CCONTEXT_L1("Block verification failed: transaction verification failed, dropping connection");
 			drop_connection(context, false, false);
@@ -421,6 +446,8 @@ int t_cryptonote_protocol_handler<t_core>::handle_notify_new_fluffy_block(int co
 
 		transaction tx;
 		crypto::hash tx_hash;
+		// txes not in the pool yet, verified together once all are checked
+		std::list<cryptonote::blobdata> new_tx_blobs;
 
 		for(auto &tx_blob : arg.b.txs)
 		{
@@ -481,21 +508,7 @@ int t_cryptonote_protocol_handler<t_core>::handle_notify_new_fluffy_block(int co
 				if(!m_core.pool_has_tx(tx_hash))
 				{
 					MDEBUG("Incoming tx " << tx_hash << " not in pool, adding");
-					cryptonote::tx_verification_context tvc = AUTO_VAL_INIT(tvc);
-					if(!m_core.handle_incoming_tx(tx_blob, tvc, true, true, false) || tvc.m_verifivation_failed)
-					{
-						LOG_PRINT_CCONTEXT_L1("Block verification failed: transaction verification failed, dropping connection");
-						drop_connection(context, false, false);
-						m_core.resume_mine();
-						return 1;
-					}
-
-					//
-					// future todo:
-					// tx should only not be added to pool if verification failed, but
-					// maybe in the future could not be added for other reasons
-					// according to monero-moo so keep track of these separately ..
-					//
+					new_tx_blobs.push_back(tx_blob);
 				}
 			}
 			else
@@ -511,6 +524,28 @@ int t_cryptonote_protocol_handler<t_core>::handle_notify_new_fluffy_block(int co
 			}
 		}
 
+		if(!new_tx_blobs.empty())
+		{
+			std::vector<cryptonote::tx_verification_context> tvc(new_tx_blobs.size());
+			bool r = m_core.handle_incoming_txs(new_tx_blobs, tvc, true, true, false);
+			for(size_t i = 0; r && i < tvc.size(); ++i)
+				r = !tvc[i].m_verifivation_failed;
+			if(!r)
+			{
+				LOG_PRINT_CCONTEXT_L1("Block verification failed: transaction verification failed, dropping connection");
+				drop_connection(context, false, false);
+				m_core.resume_mine();
+				return 1;
+			}
+
+			//
+			// future todo:
+			// tx should only not be added to pool if verification failed, but
+			// maybe in the future could not be added for other reasons
+			// according to monero-moo so keep track of these separately ..
+			//
+		}
+
 		// The initial size equality check could have been fooled if the sender
 		// gave us the number of transactions we asked for, but not the right
 		// ones. This check make sure the transactions we asked for were the
@@ -730,17 +765,19 @@ int t_cryptonote_protocol_handler<t_core>::handle_notify_new_transactions(int co
 		return 1;
 	}
 
-	for(auto tx_blob_it = arg.txs.begin(); tx_blob_it != arg.txs.end();)
+	// all the txes go in one call so their range proofs are verified in one batch
+	std::vector<cryptonote::tx_verification_context> tvc(arg.txs.size());
+	m_core.handle_incoming_txs(arg.txs, tvc, false, true, false);
+	size_t i = 0;
+	for(auto tx_blob_it = arg.txs.begin(); tx_blob_it != arg.txs.end(); ++i)
 	{
-		cryptonote::tx_verification_context tvc = AUTO_VAL_INIT(tvc);
-		m_core.handle_incoming_tx(*tx_blob_it, tvc, false, true, false);
-		if(tvc.m_verifivation_failed)
+		if(tvc[i].m_verifivation_failed)
 		{
 			LOG_PRINT_CCONTEXT_L1("Tx verification failed, dropping connection");
 			drop_connection(context, false, false);
 			return 1;
 		}
-		if(tvc.m_should_be_relayed)
+		if(tvc[i].m_should_be_relayed)
 			++tx_blob_it;
 		else
 			arg.txs.erase(tx_blob_it++);
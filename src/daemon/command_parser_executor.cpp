@@ -661,6 +661,22 @@ bool t_command_parser_executor::sync_info(const std::vector<std::string> &args)
 	return m_executor.sync_info();
 }
 
+bool t_command_parser_executor::print_db_stats(const std::vector<std::string> &args)
+{
+	if(args.size() != 0)
+		return false;
+
+	return m_executor.print_db_stats();
+}
+
+bool t_command_parser_executor::print_net_stats(const std::vector<std::string> &args)
+{
+	if(args.size() != 0)
+		return false;
+
+	return m_executor.print_net_stats();
+}
+
 bool t_command_parser_executor::version(const std::vector<std::string> &args)
 {
 	std::cout << "ombre '" << RYO_RELEASE_NAME << "' (" << RYO_VERSION_FULL << ")" << std::endl;
@@ -122,6 +122,10 @@ class t_command_parser_executor final
 
 	bool sync_info(const std::vector<std::string> &args);
 
+	bool print_db_stats(const std::vector<std::string> &args);
+
+	bool print_net_stats(const std::vector<std::string> &args);
+
 	bool version(const std::vector<std::string> &args);
 };
 
@@ -114,6 +114,10 @@ t_command_server::t_command_server(
 		"relay_tx", std::bind(&t_command_parser_executor::relay_tx, &m_parser, p::_1), "relay_tx <txid>", "Relay a given transaction by its <txid>.");
 	m_command_lookup.set_handler(
 		"sync_info", std::bind(&t_command_parser_executor::sync_info, &m_parser, p::_1), "Print information about the blockchain sync state.");
+	m_command_lookup.set_handler(
+		"db_stats", std::bind(&t_command_parser_executor::print_db_stats, &m_parser, p::_1), "Print database size, per-table page usage and open readers.");
+	m_command_lookup.set_handler(
+		"print_net_stats", std::bind(&t_command_parser_executor::print_net_stats, &m_parser, p::_1), "Print network traffic per traffic class.");
 	m_command_lookup.set_handler(
 		"version", std::bind(&t_command_parser_executor::version, &m_parser, p::_1), "Print version information.");
 }
@@ -1848,4 +1848,102 @@ bool t_rpc_command_executor::sync_info()
 	return true;
 }
 
+bool t_rpc_command_executor::print_db_stats()
+{
+	cryptonote::COMMAND_RPC_GET_DB_STATS::request req;
+	cryptonote::COMMAND_RPC_GET_DB_STATS::response res;
+	std::string fail_message = "Unsuccessful";
+	epee::json_rpc::error error_resp;
+
+	if(m_is_rpc)
+	{
+		if(!m_rpc_client->json_rpc_request(req, res, "get_db_stats", fail_message.c_str()))
+		{
+			return true;
+		}
+	}
+	else
+	{
+		if(!m_rpc_server->on_get_db_stats(req, res, error_resp) || res.status != CORE_RPC_STATUS_OK)
+		{
+			tools::fail_msg_writer() << make_error(fail_message, error_resp.message.empty() ? res.status : error_resp.message);
+			return true;
+		}
+	}
+
+	const uint64_t MiB = 1024 * 1024;
+	tools::success_msg_writer() << "Database: " << res.db_type << ", " << res.used_size / MiB << " MiB used of " << res.map_size / MiB << " MiB mapped ("
+								<< (res.map_size ? 100.0 * res.used_size / res.map_size : 0.0) << "%), page size " << res.page_size;
+	if(res.bytes_per_block)
+		tools::success_msg_writer() << "Growth: " << res.bytes_per_block << " bytes per block, room for " << (res.map_size - res.used_size) / res.bytes_per_block << " blocks";
+	tools::success_msg_writer() << "Last txn: " << res.last_txn_id;
+
+	tools::msg_writer() << boost::format("%-20s %6s %10s %12s %12s %14s %10s") % "table" % "depth" % "branch" % "leaf" % "overflow" % "entries" % "MiB";
+	for(const auto &t : res.tables)
+	{
+		const uint64_t pages = t.branch_pages + t.leaf_pages + t.overflow_pages;
+		tools::msg_writer() << boost::format("%-20s %6u %10u %12u %12u %14u %10.1f") % t.name % t.depth % t.branch_pages % t.leaf_pages % t.overflow_pages % t.entries % (pages * res.page_size / (double)MiB);
+	}
+
+	size_t active = 0;
+	for(const auto &r : res.readers)
+		if(r.txn_id)
+			++active;
+	tools::msg_writer() << res.readers.size() << " reader slots of " << res.max_readers << ", " << active << " holding a snapshot";
+	for(const auto &r : res.readers)
+	{
+		if(r.txn_id)
+			tools::msg_writer() << "  pid " << r.pid << ", thread " << std::hex << r.thread << std::dec << ": txn " << r.txn_id << ", " << r.txns_behind << " txns behind";
+	}
+
+	return true;
+}
+
+bool t_rpc_command_executor::print_net_stats()
+{
+	cryptonote::COMMAND_RPC_GET_NET_STATS::request req;
+	cryptonote::COMMAND_RPC_GET_NET_STATS::response res;
+	std::string fail_message = "Unsuccessful";
+	epee::json_rpc::error error_resp;
+
+	if(m_is_rpc)
+	{
+		if(!m_rpc_client->json_rpc_request(req, res, "get_net_stats", fail_message.c_str()))
+		{
+			return true;
+		}
+	}
+	else
+	{
+		if(!m_rpc_server->on_get_net_stats(req, res, error_resp) || res.status != CORE_RPC_STATUS_OK)
+		{
+			tools::fail_msg_writer() << make_error(fail_message, error_resp.message.empty() ? res.status : error_resp.message);
+			return true;
+		}
+	}
+
+	const uint64_t now = time(NULL);
+	const uint64_t seconds = now > res.start_time ? now - res.start_time : 1;
+	tools::success_msg_writer() << "Traffic since " << get_human_time_ago(res.start_time, now);
+
+	cryptonote::COMMAND_RPC_GET_NET_STATS::traffic_class total = {"total", 0, 0, 0, 0, 0};
+	tools::msg_writer() << boost::format("%-8s %12s %14s %10s %12s %14s %10s %12s") % "class" % "packets in" % "bytes in" % "kB/s in" % "packets out" % "bytes out" % "kB/s out" % "avg wait ms";
+	auto print_class = [seconds](const cryptonote::COMMAND_RPC_GET_NET_STATS::traffic_class &c) {
+		tools::msg_writer() << boost::format("%-8s %12u %14u %10.1f %12u %14u %10.1f %12.1f") % c.name % c.packets_in % c.bytes_in % (c.bytes_in / 1024.0 / seconds) %
+								   c.packets_out % c.bytes_out % (c.bytes_out / 1024.0 / seconds) % (c.packets_out ? c.queued_ms / (double)c.packets_out : 0.0);
+	};
+	for(const auto &c : res.classes)
+	{
+		print_class(c);
+		total.packets_in += c.packets_in;
+		total.bytes_in += c.bytes_in;
+		total.packets_out += c.packets_out;
+		total.bytes_out += c.bytes_out;
+		total.queued_ms += c.queued_ms;
+	}
+	print_class(total);
+
+	return true;
+}
+
 } // namespace daemonize
@@ -135,6 +135,10 @@ class t_rpc_command_executor final
 	bool relay_tx(const std::string &txid);
 
 	bool sync_info();
+
+	bool print_db_stats();
+
+	bool print_net_stats();
 };
 
 } // namespace daemonize
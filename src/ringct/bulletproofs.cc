@@ -89,15 +89,6 @@ static void sub_acc_p3(ge_p3 *acc_p3, const rct::key &point)
 	ge_p1p1_to_p3(acc_p3, &p1);
 }
 
-static rct::key scalarmultKey(const ge_p3 &P, const rct::key &a)
-{
-	ge_p2 R;
-	ge_scalarmult(&R, a.bytes, &P);
-	rct::key aP;
-	ge_tobytes(aP.bytes, &R);
-	return aP;
-}
-
 /* Given a scalar, construct a vector of powers */
 static rct::keyV vector_powers(const rct::key &x, size_t n)
 {
@@ -134,74 +125,20 @@ static rct::key vector_power_sum(const rct::key &x, size_t n)
 }
 
 /* Given two scalar arrays, construct the inner product */
-static rct::key inner_product(const rct::keyV &a, const rct::keyV &b)
+static rct::key inner_product(const rct::key *a, const rct::key *b, size_t n)
 {
-	CHECK_AND_ASSERT_THROW_MES(a.size() == b.size(), "Incompatible sizes of a and b");
 	rct::key res = rct::zero();
-	for(size_t i = 0; i < a.size(); ++i)
+	for(size_t i = 0; i < n; ++i)
 	{
 		sc_muladd(res.bytes, a[i].bytes, b[i].bytes, res.bytes);
 	}
 	return res;
 }
 
-/* Given two scalar arrays, construct the Hadamard product */
-static rct::keyV hadamard(const rct::keyV &a, const rct::keyV &b)
-{
-	CHECK_AND_ASSERT_THROW_MES(a.size() == b.size(), "Incompatible sizes of a and b");
-	rct::keyV res(a.size());
-	for(size_t i = 0; i < a.size(); ++i)
-	{
-		sc_mul(res[i].bytes, a[i].bytes, b[i].bytes);
-	}
-	return res;
-}
-
-/* Given two curvepoint arrays, construct the Hadamard product */
-static rct::keyV hadamard2(const rct::keyV &a, const rct::keyV &b)
-{
-	CHECK_AND_ASSERT_THROW_MES(a.size() == b.size(), "Incompatible sizes of a and b");
-	rct::keyV res(a.size());
-	for(size_t i = 0; i < a.size(); ++i)
-	{
-		rct::addKeys(res[i], a[i], b[i]);
-	}
-	return res;
-}
-
-/* Add two vectors */
-static rct::keyV vector_add(const rct::keyV &a, const rct::keyV &b)
-{
-	CHECK_AND_ASSERT_THROW_MES(a.size() == b.size(), "Incompatible sizes of a and b");
-	rct::keyV res(a.size());
-	for(size_t i = 0; i < a.size(); ++i)
-	{
-		sc_add(res[i].bytes, a[i].bytes, b[i].bytes);
-	}
-	return res;
-}
-
-/* Subtract two vectors */
-static rct::keyV vector_subtract(const rct::keyV &a, const rct::keyV &b)
+static rct::key inner_product(const rct::keyV &a, const rct::keyV &b)
 {
 	CHECK_AND_ASSERT_THROW_MES(a.size() == b.size(), "Incompatible sizes of a and b");
-	rct::keyV res(a.size());
-	for(size_t i = 0; i < a.size(); ++i)
-	{
-		sc_sub(res[i].bytes, a[i].bytes, b[i].bytes);
-	}
-	return res;
-}
-
-/* Multiply a scalar and a vector */
-static rct::keyV vector_scalar(const rct::keyV &a, const rct::key &x)
-{
-	rct::keyV res(a.size());
-	for(size_t i = 0; i < a.size(); ++i)
-	{
-		sc_mul(res[i].bytes, a[i].bytes, x.bytes);
-	}
-	return res;
+	return inner_product(a.data(), b.data(), a.size());
 }
 
 /* Create a vector from copies of a single value */
@@ -210,26 +147,28 @@ static rct::keyV vector_dup(const rct::key &x, size_t N)
 	return rct::keyV(N, x);
 }
 
-/* Exponentiate a curve vector by a scalar */
-static rct::keyV vector_scalar2(const rct::keyV &a, const rct::key &x)
+/* Fold the two halves of a scalar vector in place: a[i] = a[i] * x + a[i + n] * y */
+static void vector_fold(rct::key *a, size_t n, const rct::key &x, const rct::key &y)
 {
-	rct::keyV res(a.size());
-	for(size_t i = 0; i < a.size(); ++i)
+	rct::key tmp;
+	for(size_t i = 0; i < n; ++i)
 	{
-		rct::scalarmultKey(res[i], a[i], x);
+		sc_mul(tmp.bytes, a[i + n].bytes, y.bytes);
+		sc_muladd(a[i].bytes, a[i].bytes, x.bytes, tmp.bytes);
 	}
-	return res;
 }
 
-/* Get the sum of a vector's elements */
-static rct::key vector_sum(const rct::keyV &a)
+/* Fold the two halves of a curvepoint vector in place: P[i] = P[i] * x + P[i + n] * y
+ * Variable time, the points and the challenges are public */
+static void vector_fold(ge_p3 *P, size_t n, const rct::key &x, const rct::key &y)
 {
-	rct::key res = rct::zero();
-	for(size_t i = 0; i < a.size(); ++i)
+	ge_dsmp lo, hi;
+	for(size_t i = 0; i < n; ++i)
 	{
-		sc_add(res.bytes, res.bytes, a[i].bytes);
+		ge_dsm_precomp(lo, &P[i]);
+		ge_dsm_precomp(hi, &P[i + n]);
+		ge_double_scalarmult_precomp_vartime2_p3(&P[i], x.bytes, lo, y.bytes, hi);
 	}
-	return res;
 }
 
 inline rct::key sm(rct::key y, int n, const rct::key &x)
@@ -294,20 +233,40 @@ static rct::key invert(const rct::key &x)
 	return inv;
 }
 
-/* Compute the slice of a vector */
-static rct::keyV slice(const rct::keyV &a, size_t start, size_t stop)
+/* Invert a vector of nonzero scalars in place with a single inversion (Montgomery's trick) */
+static void invert(rct::keyV &x)
 {
-	CHECK_AND_ASSERT_THROW_MES(start < a.size(), "Invalid start index");
-	CHECK_AND_ASSERT_THROW_MES(stop <= a.size(), "Invalid stop index");
-	CHECK_AND_ASSERT_THROW_MES(start < stop, "Invalid start/stop indices");
-	rct::keyV res(stop - start);
-	for(size_t i = start; i < stop; ++i)
+	if(x.empty())
+		return;
+
+	rct::keyV prefix(x.size());
+	rct::key acc = rct::identity();
+	for(size_t i = 0; i < x.size(); ++i)
 	{
-		res[i - start] = a[i];
+		prefix[i] = acc;
+		sc_mul(acc.bytes, acc.bytes, x[i].bytes);
+	}
+
+	acc = invert(acc);
+	rct::key tmp;
+	for(size_t i = x.size(); i-- > 0;)
+	{
+		sc_mul(tmp.bytes, acc.bytes, x[i].bytes);
+		sc_mul(x[i].bytes, acc.bytes, prefix[i].bytes);
+		acc = tmp;
 	}
-	return res;
 }
 
+// Working set of the prover, allocated once per proof. l and r are built in a and b, and
+// the inner product rounds fold a, b, G and H in place instead of slicing new vectors.
+struct bp_prove_scratch
+{
+	rct::keyV aL, aR, sL, sR, a, b;
+	std::vector<ge_p3> G, H;
+
+	explicit bp_prove_scratch(size_t MN) : aL(MN), aR(MN), sL(MN), sR(MN), a(MN), b(MN), G(MN), H(MN) {}
+};
+
 static rct::key hash_cache_mash(rct::key &hash_cache, const rct::key &mash0, const rct::key &mash1)
 {
 	rct::keyV data;
@@ -344,253 +303,7 @@ static rct::key hash_cache_mash(rct::key &hash_cache, const rct::key &mash0, con
 /* Given a value v (0..2^N-1) and a mask gamma, construct a range proof */
 Bulletproof bulletproof_PROVE(const rct::key &sv, const rct::key &gamma)
 {
-	PERF_TIMER_UNIT(PROVE, 1000000);
-
-	constexpr size_t logN = 6; // log2(64)
-	constexpr size_t N = 1 << logN;
-
-	bp_cache exp_cache;
-	rct::key V;
-	rct::keyV aL(N), aR(N);
-
-	PERF_TIMER_START_BP(PROVE_v);
-	rct::addKeys2(V, gamma, sv, rct::H);
-	V = rct::scalarmultKey(V, INV_EIGHT);
-	PERF_TIMER_STOP(PROVE_v);
-
-	PERF_TIMER_START_BP(PROVE_aLaR);
-	for(size_t i = N; i-- > 0;)
-	{
-		if(sv[i / 8] & (((uint64_t)1) << (i % 8)))
-		{
-			aL[i] = rct::identity();
-		}
-		else
-		{
-			aL[i] = rct::zero();
-		}
-		sc_sub(aR[i].bytes, aL[i].bytes, rct::identity().bytes);
-	}
-	PERF_TIMER_STOP(PROVE_aLaR);
-
-	rct::key hash_cache = rct::hash_to_scalar(V);
-
-// DEBUG: Test to ensure this recovers the value
-#ifndef NDEBUG
-	uint64_t test_aL = 0, test_aR = 0;
-	for(size_t i = 0; i < N; ++i)
-	{
-		if(aL[i] == rct::identity())
-			test_aL += ((uint64_t)1) << i;
-		if(aR[i] == rct::zero())
-			test_aR += ((uint64_t)1) << i;
-	}
-	uint64_t v_test = 0;
-	for(int n = 0; n < 8; ++n)
-		v_test |= (((uint64_t)sv[n]) << (8 * n));
-	CHECK_AND_ASSERT_THROW_MES(test_aL == v_test, "test_aL failed");
-	CHECK_AND_ASSERT_THROW_MES(test_aR == v_test, "test_aR failed");
-#endif
-
-try_again:
-	PERF_TIMER_START_BP(PROVE_step1);
-	// PAPER LINES 38-39
-	rct::key alpha = rct::skGen();
-	rct::key ve = exp_cache.vector_exponent(aL, aR);
-	rct::key A;
-	rct::addKeys(A, ve, rct::scalarmultBase(alpha));
-	A = rct::scalarmultKey(A, INV_EIGHT);
-
-	// PAPER LINES 40-42
-	rct::keyV sL = rct::skvGen(N), sR = rct::skvGen(N);
-	rct::key rho = rct::skGen();
-	ve = exp_cache.vector_exponent(sL, sR);
-	rct::key S;
-	rct::addKeys(S, ve, rct::scalarmultBase(rho));
-	S = rct::scalarmultKey(S, INV_EIGHT);
-
-	// PAPER LINES 43-45
-	rct::key y = hash_cache_mash(hash_cache, A, S);
-	if(y == rct::zero())
-	{
-		PERF_TIMER_STOP(PROVE_step1);
-		MINFO("y is 0, trying again");
-		goto try_again;
-	}
-	rct::key z = hash_cache = rct::hash_to_scalar(y);
-	if(z == rct::zero())
-	{
-		PERF_TIMER_STOP(PROVE_step1);
-		MINFO("z is 0, trying again");
-		goto try_again;
-	}
-
-	// Polynomial construction before PAPER LINE 46
-	rct::key t0 = rct::zero();
-	rct::key t1 = rct::zero();
-	rct::key t2 = rct::zero();
-
-	const auto yN = vector_powers(y, N);
-
-	rct::key ip1y = vector_sum(yN);
-	rct::key tmp;
-	sc_muladd(t0.bytes, z.bytes, ip1y.bytes, t0.bytes);
-
-	rct::key zsq;
-	sc_mul(zsq.bytes, z.bytes, z.bytes);
-	sc_muladd(t0.bytes, zsq.bytes, sv.bytes, t0.bytes);
-
-	rct::key k = rct::zero();
-	sc_mulsub(k.bytes, zsq.bytes, ip1y.bytes, k.bytes);
-
-	rct::key zcu;
-	sc_mul(zcu.bytes, zsq.bytes, z.bytes);
-	sc_mulsub(k.bytes, zcu.bytes, ip12.bytes, k.bytes);
-	sc_add(t0.bytes, t0.bytes, k.bytes);
-
-// DEBUG: Test the value of t0 has the correct form
-#ifndef NDEBUG
-	rct::key test_t0 = rct::zero();
-	rct::key iph = inner_product(aL, hadamard(aR, yN));
-	sc_add(test_t0.bytes, test_t0.bytes, iph.bytes);
-	rct::key ips = inner_product(vector_subtract(aL, aR), yN);
-	sc_muladd(test_t0.bytes, z.bytes, ips.bytes, test_t0.bytes);
-	rct::key ipt = inner_product(twoN, aL);
-	sc_muladd(test_t0.bytes, zsq.bytes, ipt.bytes, test_t0.bytes);
-	sc_add(test_t0.bytes, test_t0.bytes, k.bytes);
-	CHECK_AND_ASSERT_THROW_MES(t0 == test_t0, "t0 check failed");
-#endif
-	PERF_TIMER_STOP(PROVE_step1);
-
-	PERF_TIMER_START_BP(PROVE_step2);
-	const auto HyNsR = hadamard(yN, sR);
-	const auto vpIz = vector_dup(z, N);
-	const auto vp2zsq = vector_scalar(twoN, zsq);
-	const auto aL_vpIz = vector_subtract(aL, vpIz);
-	const auto aR_vpIz = vector_add(aR, vpIz);
-
-	rct::key ip1 = inner_product(aL_vpIz, HyNsR);
-	sc_add(t1.bytes, t1.bytes, ip1.bytes);
-
-	rct::key ip2 = inner_product(sL, vector_add(hadamard(yN, aR_vpIz), vp2zsq));
-	sc_add(t1.bytes, t1.bytes, ip2.bytes);
-
-	rct::key ip3 = inner_product(sL, HyNsR);
-	sc_add(t2.bytes, t2.bytes, ip3.bytes);
-
-	// PAPER LINES 47-48
-	rct::key tau1 = rct::skGen(), tau2 = rct::skGen();
-
-	rct::key T1 = rct::addKeys(rct::scalarmultH(t1), rct::scalarmultBase(tau1));
-	T1 = rct::scalarmultKey(T1, INV_EIGHT);
-	rct::key T2 = rct::addKeys(rct::scalarmultH(t2), rct::scalarmultBase(tau2));
-	T2 = rct::scalarmultKey(T2, INV_EIGHT);
-
-	// PAPER LINES 49-51
-	rct::key x = hash_cache_mash(hash_cache, z, T1, T2);
-	if(x == rct::zero())
-	{
-		PERF_TIMER_STOP(PROVE_step2);
-		MINFO("x is 0, trying again");
-		goto try_again;
-	}
-
-	// PAPER LINES 52-53
-	rct::key taux = rct::zero();
-	sc_mul(taux.bytes, tau1.bytes, x.bytes);
-	rct::key xsq;
-	sc_mul(xsq.bytes, x.bytes, x.bytes);
-	sc_muladd(taux.bytes, tau2.bytes, xsq.bytes, taux.bytes);
-	sc_muladd(taux.bytes, gamma.bytes, zsq.bytes, taux.bytes);
-	rct::key mu;
-	sc_muladd(mu.bytes, x.bytes, rho.bytes, alpha.bytes);
-
-	// PAPER LINES 54-57
-	rct::keyV l = vector_add(aL_vpIz, vector_scalar(sL, x));
-	rct::keyV r = vector_add(hadamard(yN, vector_add(aR_vpIz, vector_scalar(sR, x))), vp2zsq);
-	PERF_TIMER_STOP(PROVE_step2);
-
-	PERF_TIMER_START_BP(PROVE_step3);
-	rct::key t = inner_product(l, r);
-
-// DEBUG: Test if the l and r vectors match the polynomial forms
-#ifndef NDEBUG
-	rct::key test_t;
-	sc_muladd(test_t.bytes, t1.bytes, x.bytes, t0.bytes);
-	sc_muladd(test_t.bytes, t2.bytes, xsq.bytes, test_t.bytes);
-	CHECK_AND_ASSERT_THROW_MES(test_t == t, "test_t check failed");
-#endif
-
-	// PAPER LINES 32-33
-	rct::key x_ip = hash_cache_mash(hash_cache, x, taux, mu, t);
-
-	// These are used in the inner product rounds
-	size_t nprime = N;
-	rct::keyV Gprime(N);
-	rct::keyV Hprime(N);
-	rct::keyV aprime(N);
-	rct::keyV bprime(N);
-	const rct::key yinv = invert(y);
-	rct::key yinvpow = rct::identity();
-	for(size_t i = 0; i < N; ++i)
-	{
-		Gprime[i] = multiexp_cache::Gi(i);
-		Hprime[i] = scalarmultKey(multiexp_cache::Hi_p3(i), yinvpow);
-		sc_mul(yinvpow.bytes, yinvpow.bytes, yinv.bytes);
-		aprime[i] = l[i];
-		bprime[i] = r[i];
-	}
-	rct::keyV L(logN);
-	rct::keyV R(logN);
-	int round = 0;
-	rct::keyV w(logN); // this is the challenge x in the inner product protocol
-	PERF_TIMER_STOP(PROVE_step3);
-
-	PERF_TIMER_START_BP(PROVE_step4);
-	// PAPER LINE 13
-	while(nprime > 1)
-	{
-		// PAPER LINE 15
-		nprime /= 2;
-
-		// PAPER LINES 16-17
-		rct::key cL = inner_product(slice(aprime, 0, nprime), slice(bprime, nprime, bprime.size()));
-		rct::key cR = inner_product(slice(aprime, nprime, aprime.size()), slice(bprime, 0, nprime));
-
-		// PAPER LINES 18-19
-		L[round] = exp_cache.vector_exponent_custom(slice(Gprime, nprime, Gprime.size()), slice(Hprime, 0, nprime), slice(aprime, 0, nprime), slice(bprime, nprime, bprime.size()));
-		sc_mul(tmp.bytes, cL.bytes, x_ip.bytes);
-		rct::addKeys(L[round], L[round], rct::scalarmultH(tmp));
-		L[round] = rct::scalarmultKey(L[round], INV_EIGHT);
-		R[round] = exp_cache.vector_exponent_custom(slice(Gprime, 0, nprime), slice(Hprime, nprime, Hprime.size()), slice(aprime, nprime, aprime.size()), slice(bprime, 0, nprime));
-		sc_mul(tmp.bytes, cR.bytes, x_ip.bytes);
-		rct::addKeys(R[round], R[round], rct::scalarmultH(tmp));
-		R[round] = rct::scalarmultKey(R[round], INV_EIGHT);
-
-		// PAPER LINES 21-22
-		w[round] = hash_cache_mash(hash_cache, L[round], R[round]);
-		if(w[round] == rct::zero())
-		{
-			PERF_TIMER_STOP(PROVE_step4);
-			MINFO("w[round] is 0, trying again");
-			goto try_again;
-		}
-
-		// PAPER LINES 24-25
-		const rct::key winv = invert(w[round]);
-		Gprime = hadamard2(vector_scalar2(slice(Gprime, 0, nprime), winv), vector_scalar2(slice(Gprime, nprime, Gprime.size()), w[round]));
-		Hprime = hadamard2(vector_scalar2(slice(Hprime, 0, nprime), w[round]), vector_scalar2(slice(Hprime, nprime, Hprime.size()), winv));
-
-		// PAPER LINES 28-29
-		aprime = vector_add(vector_scalar(slice(aprime, 0, nprime), w[round]), vector_scalar(slice(aprime, nprime, aprime.size()), winv));
-		bprime = vector_add(vector_scalar(slice(bprime, 0, nprime), winv), vector_scalar(slice(bprime, nprime, bprime.size()), w[round]));
-
-		++round;
-	}
-	PERF_TIMER_STOP(PROVE_step4);
-
-	// PAPER LINE 58 (with inclusions from PAPER LINE 8 and PAPER LINE 20)
-	return Bulletproof(V, A, S, T1, T2, taux, mu, L, R, aprime[0], bprime[0], t);
+	return bulletproof_PROVE(rct::keyV(1, sv), rct::keyV(1, gamma));
 }
 
 Bulletproof bulletproof_PROVE(uint64_t v, const rct::key &gamma)
@@ -633,13 +346,16 @@ Bulletproof bulletproof_PROVE(const rct::keyV &sv, const rct::keyV &gamma)
 	const size_t MN = M * N;
 
 	rct::keyV V(sv.size());
-	rct::keyV aL(MN), aR(MN);
+	bp_prove_scratch scratch(MN);
+	rct::keyV &aL = scratch.aL, &aR = scratch.aR, &sL = scratch.sL, &sR = scratch.sR;
+	rct::key *a = scratch.a.data(), *b = scratch.b.data();
+	ge_p3 *G = scratch.G.data(), *H = scratch.H.data();
 	rct::key tmp;
 
 	PERF_TIMER_START_BP(PROVE_v);
 	for(size_t i = 0; i < sv.size(); ++i)
 	{
-		rct::addKeys2(V[i], gamma[i], sv[i], rct::H);
+		rct::addKeys_aGbH(V[i], gamma[i], sv[i]);
 		V[i] = rct::scalarmultKey(V[i], INV_EIGHT);
 	}
 	PERF_TIMER_STOP(PROVE_v);
@@ -649,19 +365,16 @@ Bulletproof bulletproof_PROVE(const rct::keyV &sv, const rct::keyV &gamma)
 	{
 		for(size_t i = N; i-- > 0;)
 		{
-			if(j >= sv.size())
-			{
-				aL[j * N + i] = rct::zero();
-			}
-			else if(sv[j][i / 8] & (((uint64_t)1) << (i % 8)))
+			if(j < sv.size() && (sv[j][i / 8] & (((uint64_t)1) << (i % 8))))
 			{
 				aL[j * N + i] = rct::identity();
+				aR[j * N + i] = rct::zero();
 			}
 			else
 			{
 				aL[j * N + i] = rct::zero();
+				aR[j * N + i] = MINUS_ONE;
 			}
-			sc_sub(aR[j * N + i].bytes, aL[j * N + i].bytes, rct::identity().bytes);
 		}
 	}
 	PERF_TIMER_STOP(PROVE_aLaR);
@@ -699,7 +412,11 @@ try_again:
 	A = rct::scalarmultKey(A, INV_EIGHT);
 
 	// PAPER LINES 40-42
-	rct::keyV sL = rct::skvGen(MN), sR = rct::skvGen(MN);
+	for(size_t i = 0; i < MN; ++i)
+	{
+		sL[i] = rct::skGen();
+		sR[i] = rct::skGen();
+	}
 	rct::key rho = rct::skGen();
 	ve = exp_cache.vector_exponent(sL, sR);
 	rct::key S;
@@ -722,50 +439,44 @@ try_again:
 		goto try_again;
 	}
 
-	// Polynomial construction by coefficients
-	const auto zMN = vector_dup(z, MN);
-	rct::keyV l0 = vector_subtract(aL, zMN);
-	const rct::keyV &l1 = sL;
-
-	// This computes the ugly sum/concatenation from PAPER LINE 65
-	rct::keyV zero_twos(MN);
+	// Polynomial construction by coefficients, l(X) = l0 + l1 * X and r(X) = r0 + r1 * X
+	// with l0 in a, l1 = sL, r0 in b and r1 = y^MN o sR kept in sR
 	const rct::keyV zpow = vector_powers(z, M + 2);
+	rct::key ypow = rct::identity();
 	for(size_t i = 0; i < MN; ++i)
 	{
-		zero_twos[i] = rct::zero();
-		for(size_t j = 1; j <= M; ++j)
-		{
-			if(i >= (j - 1) * N && i < j * N)
-			{
-				CHECK_AND_ASSERT_THROW_MES(1 + j < zpow.size(), "invalid zpow index");
-				CHECK_AND_ASSERT_THROW_MES(i - (j - 1) * N < twoN.size(), "invalid twoN index");
-				sc_muladd(zero_twos[i].bytes, zpow[1 + j].bytes, twoN[i - (j - 1) * N].bytes, zero_twos[i].bytes);
-			}
-		}
-	}
+		sc_sub(a[i].bytes, aL[i].bytes, z.bytes);
+
+		// This is the ugly sum/concatenation from PAPER LINE 65
+		rct::key zero_twos;
+		sc_mul(zero_twos.bytes, zpow[2 + i / N].bytes, twoN[i % N].bytes);
+		sc_add(tmp.bytes, aR[i].bytes, z.bytes);
+		sc_muladd(b[i].bytes, tmp.bytes, ypow.bytes, zero_twos.bytes);
 
-	rct::keyV r0 = vector_add(aR, zMN);
-	const auto yMN = vector_powers(y, MN);
-	r0 = hadamard(r0, yMN);
-	r0 = vector_add(r0, zero_twos);
-	rct::keyV r1 = hadamard(yMN, sR);
+		sc_mul(sR[i].bytes, sR[i].bytes, ypow.bytes);
+		sc_mul(ypow.bytes, ypow.bytes, y.bytes);
+	}
 
 	// Polynomial construction before PAPER LINE 46
-	rct::key t1_1 = inner_product(l0, r1);
-	rct::key t1_2 = inner_product(l1, r0);
+	rct::key t1_1 = inner_product(a, sR.data(), MN);
+	rct::key t1_2 = inner_product(sL.data(), b, MN);
 	rct::key t1;
 	sc_add(t1.bytes, t1_1.bytes, t1_2.bytes);
-	rct::key t2 = inner_product(l1, r1);
+	rct::key t2 = inner_product(sL, sR);
 
+#ifndef NDEBUG
+	const rct::key t0 = inner_product(a, b, MN);
+#endif
 	PERF_TIMER_STOP(PROVE_step1);
 
 	PERF_TIMER_START_BP(PROVE_step2);
 	// PAPER LINES 47-48
 	rct::key tau1 = rct::skGen(), tau2 = rct::skGen();
 
-	rct::key T1 = rct::addKeys(rct::scalarmultH(t1), rct::scalarmultBase(tau1));
+	rct::key T1, T2;
+	rct::addKeys_aGbH(T1, tau1, t1);
 	T1 = rct::scalarmultKey(T1, INV_EIGHT);
-	rct::key T2 = rct::addKeys(rct::scalarmultH(t2), rct::scalarmultBase(tau2));
+	rct::addKeys_aGbH(T2, tau2, t2);
 	T2 = rct::scalarmultKey(T2, INV_EIGHT);
 
 	// PAPER LINES 49-51
@@ -791,20 +502,20 @@ try_again:
 	rct::key mu;
 	sc_muladd(mu.bytes, x.bytes, rho.bytes, alpha.bytes);
 
-	// PAPER LINES 54-57
-	rct::keyV l = l0;
-	l = vector_add(l, vector_scalar(l1, x));
-	rct::keyV r = r0;
-	r = vector_add(r, vector_scalar(r1, x));
+	// PAPER LINES 54-57, l and r replace l0 and r0 in place
+	for(size_t i = 0; i < MN; ++i)
+	{
+		sc_muladd(a[i].bytes, sL[i].bytes, x.bytes, a[i].bytes);
+		sc_muladd(b[i].bytes, sR[i].bytes, x.bytes, b[i].bytes);
+	}
 	PERF_TIMER_STOP(PROVE_step2);
 
 	PERF_TIMER_START_BP(PROVE_step3);
-	rct::key t = inner_product(l, r);
+	rct::key t = inner_product(a, b, MN);
 
 // DEBUG: Test if the l and r vectors match the polynomial forms
 #ifndef NDEBUG
 	rct::key test_t;
-	const rct::key t0 = inner_product(l0, r0);
 	sc_muladd(test_t.bytes, t1.bytes, x.bytes, t0.bytes);
 	sc_muladd(test_t.bytes, t2.bytes, xsq.bytes, test_t.bytes);
 	CHECK_AND_ASSERT_THROW_MES(test_t == t, "test_t check failed");
@@ -819,21 +530,15 @@ try_again:
 		goto try_again;
 	}
 
-	// These are used in the inner product rounds
+	// These are used in the inner product rounds, a and b already hold l and r
 	size_t nprime = MN;
-	rct::keyV Gprime(MN);
-	rct::keyV Hprime(MN);
-	rct::keyV aprime(MN);
-	rct::keyV bprime(MN);
 	const rct::key yinv = invert(y);
 	rct::key yinvpow = rct::identity();
 	for(size_t i = 0; i < MN; ++i)
 	{
-		Gprime[i] = multiexp_cache::Gi(i);
-		Hprime[i] = scalarmultKey(multiexp_cache::Hi_p3(i), yinvpow);
+		G[i] = multiexp_cache::Gi_p3(i);
+		ge_double_scalarmult_base_vartime_p3(&H[i], yinvpow.bytes, &multiexp_cache::Hi_p3(i), rct::zero().bytes);
 		sc_mul(yinvpow.bytes, yinvpow.bytes, yinv.bytes);
-		aprime[i] = l[i];
-		bprime[i] = r[i];
 	}
 	rct::keyV L(logMN);
 	rct::keyV R(logMN);
@@ -849,18 +554,29 @@ try_again:
 		nprime /= 2;
 
 		// PAPER LINES 16-17
-		rct::key cL = inner_product(slice(aprime, 0, nprime), slice(bprime, nprime, bprime.size()));
-		rct::key cR = inner_product(slice(aprime, nprime, aprime.size()), slice(bprime, 0, nprime));
+		rct::key cL = inner_product(a, b + nprime, nprime);
+		rct::key cR = inner_product(a + nprime, b, nprime);
 
-		// PAPER LINES 18-19
-		L[round] = exp_cache.vector_exponent_custom(slice(Gprime, nprime, Gprime.size()), slice(Hprime, 0, nprime), slice(aprime, 0, nprime), slice(bprime, nprime, bprime.size()));
+		// PAPER LINES 18-19, the H term goes into the same multiexp
+		exp_cache.clear_pad(2 * nprime + 1);
+		for(size_t i = 0; i < nprime; ++i)
+		{
+			exp_cache.me_pad.emplace_back(a[i], G[nprime + i]);
+			exp_cache.me_pad.emplace_back(b[nprime + i], H[i]);
+		}
 		sc_mul(tmp.bytes, cL.bytes, x_ip.bytes);
-		rct::addKeys(L[round], L[round], rct::scalarmultH(tmp));
-		L[round] = rct::scalarmultKey(L[round], INV_EIGHT);
-		R[round] = exp_cache.vector_exponent_custom(slice(Gprime, 0, nprime), slice(Hprime, nprime, Hprime.size()), slice(aprime, nprime, aprime.size()), slice(bprime, 0, nprime));
+		exp_cache.me_pad.emplace_back(tmp, ge_p3_H);
+		L[round] = rct::scalarmultKey(exp_cache.multiexp(), INV_EIGHT);
+
+		exp_cache.clear_pad(2 * nprime + 1);
+		for(size_t i = 0; i < nprime; ++i)
+		{
+			exp_cache.me_pad.emplace_back(a[nprime + i], G[i]);
+			exp_cache.me_pad.emplace_back(b[i], H[nprime + i]);
+		}
 		sc_mul(tmp.bytes, cR.bytes, x_ip.bytes);
-		rct::addKeys(R[round], R[round], rct::scalarmultH(tmp));
-		R[round] = rct::scalarmultKey(R[round], INV_EIGHT);
+		exp_cache.me_pad.emplace_back(tmp, ge_p3_H);
+		R[round] = rct::scalarmultKey(exp_cache.multiexp(), INV_EIGHT);
 
 		// PAPER LINES 21-22
 		w[round] = hash_cache_mash(hash_cache, L[round], R[round]);
@@ -871,21 +587,24 @@ try_again:
 			goto try_again;
 		}
 
-		// PAPER LINES 24-25
+		// PAPER LINES 24-25, the points are not needed after the last round
 		const rct::key winv = invert(w[round]);
-		Gprime = hadamard2(vector_scalar2(slice(Gprime, 0, nprime), winv), vector_scalar2(slice(Gprime, nprime, Gprime.size()), w[round]));
-		Hprime = hadamard2(vector_scalar2(slice(Hprime, 0, nprime), w[round]), vector_scalar2(slice(Hprime, nprime, Hprime.size()), winv));
+		if(nprime > 1)
+		{
+			vector_fold(G, nprime, winv, w[round]);
+			vector_fold(H, nprime, w[round], winv);
+		}
 
 		// PAPER LINES 28-29
-		aprime = vector_add(vector_scalar(slice(aprime, 0, nprime), w[round]), vector_scalar(slice(aprime, nprime, aprime.size()), winv));
-		bprime = vector_add(vector_scalar(slice(bprime, 0, nprime), winv), vector_scalar(slice(bprime, nprime, bprime.size()), w[round]));
+		vector_fold(a, nprime, w[round], winv);
+		vector_fold(b, nprime, winv, w[round]);
 
 		++round;
 	}
 	PERF_TIMER_STOP(PROVE_step4);
 
 	// PAPER LINE 58 (with inclusions from PAPER LINE 8 and PAPER LINE 20)
-	return Bulletproof(V, A, S, T1, T2, taux, mu, L, R, aprime[0], bprime[0], t);
+	return Bulletproof(V, A, S, T1, T2, taux, mu, L, R, a[0], b[0], t);
 }
 
 Bulletproof bulletproof_PROVE(const std::vector<uint64_t> &v, const rct::keyV &gamma)
@@ -1052,10 +771,11 @@ bool bulletproof_VERIFY(const std::vector<const Bulletproof *> &proofs)
 		rct::key ypow = rct::identity();
 
 		PERF_TIMER_START_BP(VERIFY_line_24_25_invert);
-		const rct::key yinv = invert(y);
-		rct::keyV winv(rounds);
-		for(size_t i = 0; i < rounds; ++i)
-			winv[i] = invert(w[i]);
+		rct::keyV winv(w);
+		winv.push_back(y);
+		invert(winv);
+		const rct::key yinv = winv.back();
+		winv.pop_back();
 		PERF_TIMER_STOP(VERIFY_line_24_25_invert);
 
 		for(size_t i = 0; i < MN; ++i)
@@ -107,8 +107,7 @@ tuple<key, key> skpkGen()
 //generates C =aG + bH from b, a is given..
 void genC(key &C, const key &a, ryo_amount amount)
 {
-	key bH = scalarmultH(d2h(amount));
-	addKeys1(C, a, bH);
+	addKeys_aGbH(C, a, d2h(amount));
 }
 
 //generates a <secret , public> / Pedersen commitment to the amount
@@ -142,10 +141,8 @@ key zeroCommit(ryo_amount amount)
 
 key commit(ryo_amount amount, const key &mask)
 {
-	key c = scalarmultBase(mask);
-	key am = d2h(amount);
-	key bH = scalarmultH(am);
-	addKeys(c, c, bH);
+	key c;
+	addKeys_aGbH(c, mask, d2h(amount));
 	return c;
 }
 
@@ -217,12 +214,10 @@ key scalarmult8(const key & P)
 //Computes aH where H= toPoint(cn_fast_hash(G)), G the basepoint
 key scalarmultH(const key &a)
 {
-	ge_p3 A;
-	ge_p2 R;
-	CHECK_AND_ASSERT_THROW_MES_L1(ge_frombytes_vartime(&A, H.bytes) == 0, "ge_frombytes_vartime failed at " + boost::lexical_cast<std::string>(__LINE__));
-	ge_scalarmult(&R, a.bytes, &A);
+	ge_p3 R;
+	ge_scalarmult_H(&R, a.bytes);
 	key aP;
-	ge_tobytes(aP.bytes, &R);
+	ge_p3_tobytes(aP.bytes, &R);
 	return aP;
 }
 
@@ -290,6 +285,24 @@ void addKeys2(key &aGbB, const key &a, const key &b, const key &B)
 	ge_tobytes(aGbB.bytes, &rv);
 }
 
+//addKeys_aGbH
+//aGbH = aG + bH where a, b are scalars, G is the basepoint and H the amount generator
+void addKeys_aGbH(key &aGbH, const key &a, const key &b)
+{
+	key ar, br;
+	sc_reduce32copy(ar.bytes, a.bytes);
+	sc_reduce32copy(br.bytes, b.bytes);
+	ge_p3 aG, bH;
+	ge_scalarmult_base(&aG, ar.bytes);
+	ge_scalarmult_H(&bH, br.bytes);
+	ge_cached cached;
+	ge_p3_to_cached(&cached, &bH);
+	ge_p1p1 p1;
+	ge_add(&p1, &aG, &cached);
+	ge_p1p1_to_p3(&aG, &p1);
+	ge_p3_tobytes(aGbH.bytes, &aG);
+}
+
 //Does some precomputation to make addKeys3 more efficient
 // input B a curve point and output a ge_dsmp which has precomputation applied
 void precomp(ge_dsmp rv, const key &B)
@@ -123,6 +123,9 @@ rct::key addKeys(const keyV &A);
 void addKeys1(key &aGB, const key &a, const key &B);
 //aGbB = aG + bB where a, b are scalars, G is the basepoint and B is a point
 void addKeys2(key &aGbB, const key &a, const key &b, const key &B);
+//aGbH = aG + bH where a, b are scalars, G is the basepoint and H the amount generator
+//uses the fixed base tables of G and H, and unlike addKeys2 runs in constant time
+void addKeys_aGbH(key &aGbH, const key &a, const key &b);
 //Does some precomputation to make addKeys3 more efficient
 // input B a curve point and output a ge_dsmp which has precomputation applied
 void precomp(ge_dsmp rv, const key &B);
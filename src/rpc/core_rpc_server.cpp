@@ -709,6 +709,8 @@ bool core_rpc_server::on_is_key_image_spent(const COMMAND_RPC_IS_KEY_IMAGE_SPENT
 		res.status = "Failed";
 		return true;
 	}
+	// read after the check, so a block spending one of them is below it
+	res.height = m_core.get_current_blockchain_height();
 	res.spent_status.clear();
 	for(size_t n = 0; n < spent_status.size(); ++n)
 		res.spent_status.push_back(spent_status[n] ? COMMAND_RPC_IS_KEY_IMAGE_SPENT::SPENT_IN_BLOCKCHAIN : COMMAND_RPC_IS_KEY_IMAGE_SPENT::UNSPENT);
@@ -999,6 +1001,18 @@ bool core_rpc_server::on_get_transaction_pool_hashes(const COMMAND_RPC_GET_TRANS
 	return true;
 }
 //------------------------------------------------------------------------------------------------------------------------------
+bool core_rpc_server::on_get_transaction_pool_changes(const COMMAND_RPC_GET_TRANSACTION_POOL_CHANGES::request &req, COMMAND_RPC_GET_TRANSACTION_POOL_CHANGES::response &res, bool request_has_rpc_origin)
+{
+	PERF_TIMER(on_get_transaction_pool_changes);
+	bool r;
+	if(use_bootstrap_daemon_if_necessary<COMMAND_RPC_GET_TRANSACTION_POOL_CHANGES>(invoke_http_mode::JON, "/get_transaction_pool_changes.bin", req, res, r))
+		return r;
+
+	res.full = !m_core.get_pool_transaction_changes(req.revision, res.added_tx_hashes, res.removed_tx_hashes, res.revision, !request_has_rpc_origin || !m_restricted);
+	res.status = CORE_RPC_STATUS_OK;
+	return true;
+}
+//------------------------------------------------------------------------------------------------------------------------------
 bool core_rpc_server::on_get_transaction_pool_stats(const COMMAND_RPC_GET_TRANSACTION_POOL_STATS::request &req, COMMAND_RPC_GET_TRANSACTION_POOL_STATS::response &res, bool request_has_rpc_origin)
 {
 	PERF_TIMER(on_get_transaction_pool_stats);
@@ -2151,6 +2165,58 @@ bool core_rpc_server::on_get_output_distribution(const COMMAND_RPC_GET_OUTPUT_DI
 	return true;
 }
 //------------------------------------------------------------------------------------------------------------------------------
+bool core_rpc_server::on_get_db_stats(const COMMAND_RPC_GET_DB_STATS::request &req, COMMAND_RPC_GET_DB_STATS::response &res, epee::json_rpc::error &error_resp)
+{
+	PERF_TIMER(on_get_db_stats);
+	const BlockchainDB &db = m_core.get_blockchain_storage().get_db();
+	db_stats_t stats;
+	try
+	{
+		if(!db.get_db_stats(stats))
+		{
+			error_resp.code = CORE_RPC_ERROR_CODE_INTERNAL_ERROR;
+			error_resp.message = "Database type " + db.get_db_name() + " does not report statistics";
+			return false;
+		}
+	}
+	catch(const std::exception &e)
+	{
+		error_resp.code = CORE_RPC_ERROR_CODE_INTERNAL_ERROR;
+		error_resp.message = std::string("Failed to get database statistics: ") + e.what();
+		return false;
+	}
+
+	res.db_type = db.get_db_name();
+	res.page_size = stats.page_size;
+	res.map_size = stats.map_size;
+	res.used_size = stats.used_size;
+	res.last_txn_id = stats.last_txn_id;
+	res.bytes_per_block = stats.bytes_per_block;
+	res.max_readers = stats.max_readers;
+	for(const auto &t : stats.tables)
+		res.tables.push_back({t.name, t.depth, t.branch_pages, t.leaf_pages, t.overflow_pages, t.entries});
+	for(const auto &r : stats.readers)
+		res.readers.push_back({r.pid, r.thread, r.txn_id, r.txns_behind});
+
+	res.status = CORE_RPC_STATUS_OK;
+	return true;
+}
+//------------------------------------------------------------------------------------------------------------------------------
+bool core_rpc_server::on_get_net_stats(const COMMAND_RPC_GET_NET_STATS::request &req, COMMAND_RPC_GET_NET_STATS::response &res, epee::json_rpc::error &error_resp)
+{
+	PERF_TIMER(on_get_net_stats);
+	const std::vector<epee::net_utils::traffic_class_stats> stats = epee::net_utils::network_throttle_manager::get_traffic_stats();
+	res.start_time = epee::net_utils::network_throttle_manager::get_traffic_stats_start_time();
+	for(size_t i = 0; i < stats.size(); ++i)
+	{
+		const auto &c = stats[i];
+		res.classes.push_back({epee::net_utils::get_traffic_class_name(i), c.packets_in, c.bytes_in, c.packets_out, c.bytes_out, c.queued_ms});
+	}
+
+	res.status = CORE_RPC_STATUS_OK;
+	return true;
+}
+//------------------------------------------------------------------------------------------------------------------------------
 
 const command_line::arg_descriptor<std::string, false, true, 2> core_rpc_server::arg_rpc_bind_port = {
 	"rpc-bind-port", "Port for RPC server", std::to_string(config<MAINNET>::RPC_DEFAULT_PORT), {{&cryptonote::arg_testnet_on, &cryptonote::arg_stagenet_on}}, [](std::array<bool, 2> testnet_stagenet, bool defaulted, std::string val) -> std::string {
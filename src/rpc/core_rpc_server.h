@@ -94,6 +94,7 @@ class core_rpc_server : public epee::http_server_impl_base<core_rpc_server>
 	MAP_URI_AUTO_JON2_IF("/set_log_categories", on_set_log_categories, COMMAND_RPC_SET_LOG_CATEGORIES, !m_restricted)
 	MAP_URI_AUTO_JON2("/get_transaction_pool", on_get_transaction_pool, COMMAND_RPC_GET_TRANSACTION_POOL)
 	MAP_URI_AUTO_JON2("/get_transaction_pool_hashes.bin", on_get_transaction_pool_hashes, COMMAND_RPC_GET_TRANSACTION_POOL_HASHES)
+	MAP_URI_AUTO_JON2("/get_transaction_pool_changes.bin", on_get_transaction_pool_changes, COMMAND_RPC_GET_TRANSACTION_POOL_CHANGES)
 	MAP_URI_AUTO_JON2("/get_transaction_pool_stats", on_get_transaction_pool_stats, COMMAND_RPC_GET_TRANSACTION_POOL_STATS)
 	MAP_URI_AUTO_JON2_IF("/stop_daemon", on_stop_daemon, COMMAND_RPC_STOP_DAEMON, !m_restricted)
 	MAP_URI_AUTO_JON2("/get_info", on_get_info, COMMAND_RPC_GET_INFO)
@@ -137,6 +138,8 @@ class core_rpc_server : public epee::http_server_impl_base<core_rpc_server>
 	MAP_JON_RPC_WE_IF("sync_info", on_sync_info, COMMAND_RPC_SYNC_INFO, !m_restricted)
 	MAP_JON_RPC_WE("get_txpool_backlog", on_get_txpool_backlog, COMMAND_RPC_GET_TRANSACTION_POOL_BACKLOG)
 	MAP_JON_RPC_WE("get_output_distribution", on_get_output_distribution, COMMAND_RPC_GET_OUTPUT_DISTRIBUTION)
+	MAP_JON_RPC_WE_IF("get_db_stats", on_get_db_stats, COMMAND_RPC_GET_DB_STATS, !m_restricted)
+	MAP_JON_RPC_WE_IF("get_net_stats", on_get_net_stats, COMMAND_RPC_GET_NET_STATS, !m_restricted)
 	END_JSON_RPC_MAP()
 	END_URI_MAP2()
 
@@ -164,6 +167,7 @@ class core_rpc_server : public epee::http_server_impl_base<core_rpc_server>
 	bool on_set_log_categories(const COMMAND_RPC_SET_LOG_CATEGORIES::request &req, COMMAND_RPC_SET_LOG_CATEGORIES::response &res);
 	bool on_get_transaction_pool(const COMMAND_RPC_GET_TRANSACTION_POOL::request &req, COMMAND_RPC_GET_TRANSACTION_POOL::response &res, bool request_has_rpc_origin = true);
 	bool on_get_transaction_pool_hashes(const COMMAND_RPC_GET_TRANSACTION_POOL_HASHES::request &req, COMMAND_RPC_GET_TRANSACTION_POOL_HASHES::response &res, bool request_has_rpc_origin = true);
+	bool on_get_transaction_pool_changes(const COMMAND_RPC_GET_TRANSACTION_POOL_CHANGES::request &req, COMMAND_RPC_GET_TRANSACTION_POOL_CHANGES::response &res, bool request_has_rpc_origin = true);
 	bool on_get_transaction_pool_stats(const COMMAND_RPC_GET_TRANSACTION_POOL_STATS::request &req, COMMAND_RPC_GET_TRANSACTION_POOL_STATS::response &res, bool request_has_rpc_origin = true);
 	bool on_stop_daemon(const COMMAND_RPC_STOP_DAEMON::request &req, COMMAND_RPC_STOP_DAEMON::response &res);
 	bool on_get_limit(const COMMAND_RPC_GET_LIMIT::request &req, COMMAND_RPC_GET_LIMIT::response &res);
@@ -196,6 +200,8 @@ class core_rpc_server : public epee::http_server_impl_base<core_rpc_server>
 	bool on_sync_info(const COMMAND_RPC_SYNC_INFO::request &req, COMMAND_RPC_SYNC_INFO::response &res, epee::json_rpc::error &error_resp);
 	bool on_get_txpool_backlog(const COMMAND_RPC_GET_TRANSACTION_POOL_BACKLOG::request &req, COMMAND_RPC_GET_TRANSACTION_POOL_BACKLOG::response &res, epee::json_rpc::error &error_resp);
 	bool on_get_output_distribution(const COMMAND_RPC_GET_OUTPUT_DISTRIBUTION::request &req, COMMAND_RPC_GET_OUTPUT_DISTRIBUTION::response &res, epee::json_rpc::error &error_resp);
+	bool on_get_db_stats(const COMMAND_RPC_GET_DB_STATS::request &req, COMMAND_RPC_GET_DB_STATS::response &res, epee::json_rpc::error &error_resp);
+	bool on_get_net_stats(const COMMAND_RPC_GET_NET_STATS::request &req, COMMAND_RPC_GET_NET_STATS::response &res, epee::json_rpc::error &error_resp);
 	//-----------------------
 
   private:
@@ -39,7 +39,7 @@ namespace cryptonote
 // advance which version they will stop working with
 // Don't go over 32767 for any of these
 #define CORE_RPC_VERSION_MAJOR 1
-#define CORE_RPC_VERSION_MINOR 19
+#define CORE_RPC_VERSION_MINOR 23
 #define MAKE_CORE_RPC_VERSION(major, minor) (((major) << 16) | (minor))
 #define CORE_RPC_VERSION MAKE_CORE_RPC_VERSION(CORE_RPC_VERSION_MAJOR, CORE_RPC_VERSION_MINOR)
 
@@ -625,11 +625,13 @@ struct COMMAND_RPC_IS_KEY_IMAGE_SPENT
 	struct response
 	{
 		std::vector<int> spent_status;
+		uint64_t height; // chain height once spent_status was read, no key image was spent in a block at or above it
 		std::string status;
 		bool untrusted;
 
 		BEGIN_KV_SERIALIZE_MAP()
 		KV_SERIALIZE(spent_status)
+		KV_SERIALIZE_OPT(height, (uint64_t)0)
 		KV_SERIALIZE(status)
 		KV_SERIALIZE(untrusted)
 		END_KV_SERIALIZE_MAP()
@@ -1474,6 +1476,37 @@ struct COMMAND_RPC_GET_TRANSACTION_POOL_HASHES
 	};
 };
 
+struct COMMAND_RPC_GET_TRANSACTION_POOL_CHANGES
+{
+	struct request
+	{
+		uint64_t revision;
+
+		BEGIN_KV_SERIALIZE_MAP()
+		KV_SERIALIZE(revision)
+		END_KV_SERIALIZE_MAP()
+	};
+
+	struct response
+	{
+		std::string status;
+		uint64_t revision;
+		bool full; // the revision asked from is unknown, added_tx_hashes is the whole pool
+		std::vector<crypto::hash> added_tx_hashes;
+		std::vector<crypto::hash> removed_tx_hashes;
+		bool untrusted;
+
+		BEGIN_KV_SERIALIZE_MAP()
+		KV_SERIALIZE(status)
+		KV_SERIALIZE(revision)
+		KV_SERIALIZE(full)
+		KV_SERIALIZE_CONTAINER_POD_AS_BLOB(added_tx_hashes)
+		KV_SERIALIZE_CONTAINER_POD_AS_BLOB(removed_tx_hashes)
+		KV_SERIALIZE(untrusted)
+		END_KV_SERIALIZE_MAP()
+	};
+};
+
 struct tx_backlog_entry
 {
 	uint64_t blob_size;
@@ -2179,4 +2212,115 @@ struct COMMAND_RPC_GET_OUTPUT_DISTRIBUTION
 		END_KV_SERIALIZE_MAP()
 	};
 };
+
+struct COMMAND_RPC_GET_DB_STATS
+{
+	struct request
+	{
+		BEGIN_KV_SERIALIZE_MAP()
+		END_KV_SERIALIZE_MAP()
+	};
+
+	struct table
+	{
+		std::string name;
+		uint64_t depth;
+		uint64_t branch_pages;
+		uint64_t leaf_pages;
+		uint64_t overflow_pages;
+		uint64_t entries;
+
+		BEGIN_KV_SERIALIZE_MAP()
+		KV_SERIALIZE(name)
+		KV_SERIALIZE(depth)
+		KV_SERIALIZE(branch_pages)
+		KV_SERIALIZE(leaf_pages)
+		KV_SERIALIZE(overflow_pages)
+		KV_SERIALIZE(entries)
+		END_KV_SERIALIZE_MAP()
+	};
+
+	struct reader
+	{
+		uint64_t pid;
+		uint64_t thread;
+		uint64_t txn_id;
+		uint64_t txns_behind;
+
+		BEGIN_KV_SERIALIZE_MAP()
+		KV_SERIALIZE(pid)
+		KV_SERIALIZE(thread)
+		KV_SERIALIZE(txn_id)
+		KV_SERIALIZE(txns_behind)
+		END_KV_SERIALIZE_MAP()
+	};
+
+	struct response
+	{
+		std::string status;
+		std::string db_type;
+		uint64_t page_size;
+		uint64_t map_size;
+		uint64_t used_size;
+		uint64_t last_txn_id;
+		uint64_t bytes_per_block;
+		uint64_t max_readers;
+		std::vector<table> tables;
+		std::vector<reader> readers;
+
+		BEGIN_KV_SERIALIZE_MAP()
+		KV_SERIALIZE(status)
+		KV_SERIALIZE(db_type)
+		KV_SERIALIZE(page_size)
+		KV_SERIALIZE(map_size)
+		KV_SERIALIZE(used_size)
+		KV_SERIALIZE(last_txn_id)
+		KV_SERIALIZE(bytes_per_block)
+		KV_SERIALIZE(max_readers)
+		KV_SERIALIZE(tables)
+		KV_SERIALIZE(readers)
+		END_KV_SERIALIZE_MAP()
+	};
+};
+
+struct COMMAND_RPC_GET_NET_STATS
+{
+	struct request
+	{
+		BEGIN_KV_SERIALIZE_MAP()
+		END_KV_SERIALIZE_MAP()
+	};
+
+	struct traffic_class
+	{
+		std::string name;
+		uint64_t packets_in;
+		uint64_t bytes_in;
+		uint64_t packets_out;
+		uint64_t bytes_out;
+		uint64_t queued_ms;
+
+		BEGIN_KV_SERIALIZE_MAP()
+		KV_SERIALIZE(name)
+		KV_SERIALIZE(packets_in)
+		KV_SERIALIZE(bytes_in)
+		KV_SERIALIZE(packets_out)
+		KV_SERIALIZE(bytes_out)
+		KV_SERIALIZE(queued_ms)
+		END_KV_SERIALIZE_MAP()
+	};
+
+	struct response
+	{
+		std::string status;
+		uint64_t start_time;
+		std::vector<traffic_class> classes;
+
+		BEGIN_KV_SERIALIZE_MAP()
+		KV_SERIALIZE(status)
+		KV_SERIALIZE(start_time)
+		KV_SERIALIZE(classes)
+		END_KV_SERIALIZE_MAP()
+	};
+};
 }
@@ -86,69 +86,83 @@ void TransactionHistoryImpl::refresh()
 	// for "write" access, locking exclusively
 	boost::unique_lock<boost::shared_mutex> lock(m_historyMutex);
 
-	// TODO: configurable values;
-	uint64_t min_height = 0;
-	uint64_t max_height = (uint64_t)-1;
 	uint64_t wallet_height = m_wallet->blockChainHeight();
 
-	// delete old transactions;
-	for(auto t : m_history)
-		delete t;
-	m_history.clear();
+	// drop the pending and pool transactions, they are rebuilt below
+	for(size_t i = m_confirmed; i < m_history.size(); ++i)
+		delete m_history[i];
+	m_history.resize(m_confirmed);
 
 	// transactions are stored in wallet2:
 	// - confirmed_transfer_details   - out transfers
 	// - unconfirmed_transfer_details - pending out transfers
 	// - payment_details              - input transfers
-
-	// payments are "input transactions";
-	// one input transaction contains only one transfer. e.g. <transaction_id> - <100XMR>
-
-	std::list<std::pair<crypto::hash, tools::wallet2::payment_details>> in_payments;
-	m_wallet->m_wallet->get_payments(in_payments, min_height, max_height);
-	for(std::list<std::pair<crypto::hash, tools::wallet2::payment_details>>::const_iterator i = in_payments.begin(); i != in_payments.end(); ++i)
+	//
+	// confirmed ones only change through wallet2's event log, so just what
+	// was added or removed since the last refresh is applied here
+	std::vector<tools::wallet2::transfer_event> events;
+	if(!m_wallet->m_wallet->get_transfer_events(m_cursor, 0, nullptr, events, m_cursor))
 	{
-		const tools::wallet2::payment_details &pd = i->second;
-		std::string payment_id = string_tools::pod_to_hex(i->first);
-		if(payment_id.substr(16).find_first_not_of('0') == std::string::npos)
-			payment_id = payment_id.substr(0, 16);
-		TransactionInfoImpl *ti = new TransactionInfoImpl();
-		ti->m_paymentid = payment_id;
-		ti->m_amount = pd.m_amount;
-		ti->m_direction = TransactionInfo::Direction_In;
-		ti->m_hash = string_tools::pod_to_hex(pd.m_tx_hash);
-		ti->m_blockheight = pd.m_block_height;
-		ti->m_subaddrIndex = {pd.m_subaddr_index.minor};
-		ti->m_subaddrAccount = pd.m_subaddr_index.major;
-		ti->m_label = m_wallet->m_wallet->get_subaddress_label(pd.m_subaddr_index);
-		ti->m_timestamp = pd.m_timestamp;
-		ti->m_confirmations = (wallet_height > pd.m_block_height) ? wallet_height - pd.m_block_height : 0;
-		ti->m_unlock_time = pd.m_unlock_time;
-		m_history.push_back(ti);
+		for(auto t : m_history)
+			delete t;
+		m_history.clear();
 	}
 
-	// confirmed output transactions
-	// one output transaction may contain more than one money transfer, e.g.
-	// <transaction_id>:
-	//    transfer1: 100XMR to <address_1>
-	//    transfer2: 50XMR  to <address_2>
-	//    fee: fee charged per transaction
-	//
-
-	std::list<std::pair<crypto::hash, tools::wallet2::confirmed_transfer_details>> out_payments;
-	m_wallet->m_wallet->get_payments_out(out_payments, min_height, max_height);
-
-	for(std::list<std::pair<crypto::hash, tools::wallet2::confirmed_transfer_details>>::const_iterator i = out_payments.begin();
-		i != out_payments.end(); ++i)
+	for(const auto &e : events)
 	{
+		if(e.removed)
+		{
+			TransactionInfo::Direction direction = e.payment ? TransactionInfo::Direction_In : TransactionInfo::Direction_Out;
+			std::string hash = string_tools::pod_to_hex(e.payment ? e.payment->second.m_tx_hash : e.tx->first);
+			auto itr = std::find_if(m_history.begin(), m_history.end(), [&](const TransactionInfo *ti) {
+				return ti->direction() == direction && ti->hash() == hash &&
+					   (!e.payment || (ti->subaddrAccount() == e.payment->second.m_subaddr_index.major && ti->amount() == e.payment->second.m_amount));
+			});
+			if(itr != m_history.end())
+			{
+				delete *itr;
+				m_history.erase(itr);
+			}
+			continue;
+		}
 
-		const crypto::hash &hash = i->first;
-		const tools::wallet2::confirmed_transfer_details &pd = i->second;
+		if(e.payment)
+		{
+			// payments are "input transactions";
+			// one input transaction contains only one transfer. e.g. <transaction_id> - <100XMR>
+			const tools::wallet2::payment_details &pd = e.payment->second;
+			std::string payment_id = string_tools::pod_to_hex(e.payment->first);
+			if(payment_id.substr(16).find_first_not_of('0') == std::string::npos)
+				payment_id = payment_id.substr(0, 16);
+			TransactionInfoImpl *ti = new TransactionInfoImpl();
+			ti->m_paymentid = payment_id;
+			ti->m_amount = pd.m_amount;
+			ti->m_direction = TransactionInfo::Direction_In;
+			ti->m_hash = string_tools::pod_to_hex(pd.m_tx_hash);
+			ti->m_blockheight = pd.m_block_height;
+			ti->m_subaddrIndex = {pd.m_subaddr_index.minor};
+			ti->m_subaddrAccount = pd.m_subaddr_index.major;
+			ti->m_label = m_wallet->m_wallet->get_subaddress_label(pd.m_subaddr_index);
+			ti->m_timestamp = pd.m_timestamp;
+			ti->m_unlock_time = pd.m_unlock_time;
+			m_history.push_back(ti);
+			continue;
+		}
+
+		// confirmed output transactions
+		// one output transaction may contain more than one money transfer, e.g.
+		// <transaction_id>:
+		//    transfer1: 100XMR to <address_1>
+		//    transfer2: 50XMR  to <address_2>
+		//    fee: fee charged per transaction
+		//
+		const crypto::hash &hash = e.tx->first;
+		const tools::wallet2::confirmed_transfer_details &pd = e.tx->second;
 
 		uint64_t change = pd.m_change == (uint64_t)-1 ? 0 : pd.m_change; // change may not be known
 		uint64_t fee = pd.m_amount_in - pd.m_amount_out;
 
-		std::string payment_id = string_tools::pod_to_hex(i->second.m_payment_id);
+		std::string payment_id = string_tools::pod_to_hex(pd.m_payment_id);
 		if(payment_id.substr(16).find_first_not_of('0') == std::string::npos)
 			payment_id = payment_id.substr(0, 16);
 
@@ -163,7 +177,6 @@ void TransactionHistoryImpl::refresh()
 		ti->m_subaddrAccount = pd.m_subaddr_account;
 		ti->m_label = pd.m_subaddr_indices.size() == 1 ? m_wallet->m_wallet->get_subaddress_label({pd.m_subaddr_account, *pd.m_subaddr_indices.begin()}) : "";
 		ti->m_timestamp = pd.m_timestamp;
-		ti->m_confirmations = (wallet_height > pd.m_block_height) ? wallet_height - pd.m_block_height : 0;
 
 		// single output transaction might contain multiple transfers
 		for(const auto &d : pd.m_dests)
@@ -173,6 +186,14 @@ void TransactionHistoryImpl::refresh()
 		m_history.push_back(ti);
 	}
 
+	// confirmations are the only thing that moves on kept entries
+	m_confirmed = m_history.size();
+	for(auto t : m_history)
+	{
+		TransactionInfoImpl *ti = static_cast<TransactionInfoImpl *>(t);
+		ti->m_confirmations = (wallet_height > ti->m_blockheight) ? wallet_height - ti->m_blockheight : 0;
+	}
+
 	// unconfirmed output transactions
 	std::list<std::pair<crypto::hash, tools::wallet2::unconfirmed_transfer_details>> upayments_out;
 	m_wallet->m_wallet->get_unconfirmed_payments_out(upayments_out);
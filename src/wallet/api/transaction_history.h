@@ -39,7 +39,11 @@ class TransactionHistoryImpl : public TransactionHistory
 
   private:
 	// TransactionHistory is responsible of memory management
+	// confirmed transactions come first and are kept between refreshes,
+	// pending and pool ones after them are rebuilt every time
 	std::vector<TransactionInfo *> m_history;
+	size_t m_confirmed = 0;
+	uint64_t m_cursor = 0;
 	WalletImpl *m_wallet;
 	mutable boost::shared_mutex m_historyMutex;
 };
@@ -20,6 +20,7 @@
 #include "misc_language.h"
 #include "misc_log_ex.h"
 #include "wallet_errors.h"
+#include <algorithm>
 #include <boost/algorithm/string.hpp>
 #include <boost/filesystem.hpp>
 #include <boost/range/adaptor/transformed.hpp>
@@ -185,7 +186,7 @@ enum
 namespace tools
 {
 
-ringdb::ringdb(std::string filename, const std::string &genesis) : filename(filename)
+ringdb::ringdb(std::string filename, const std::string &genesis, bool bulk) : filename(filename), bulk(bulk)
 {
 	MDB_txn *txn;
 	bool tx_active = false;
@@ -198,7 +199,7 @@ ringdb::ringdb(std::string filename, const std::string &genesis) : filename(file
 	dbr = mdb_env_set_maxdbs(env, 2);
 	THROW_WALLET_EXCEPTION_IF(dbr, tools::error::wallet_internal_error, "Failed to set max env dbs: " + std::string(mdb_strerror(dbr)));
 	const std::string actual_filename = get_rings_filename(filename);
-	dbr = mdb_env_open(env, actual_filename.c_str(), 0, 0664);
+	dbr = mdb_env_open(env, actual_filename.c_str(), bulk ? MDB_NOSYNC : 0, 0664);
 	THROW_WALLET_EXCEPTION_IF(dbr, tools::error::wallet_internal_error, "Failed to open rings database file '" + actual_filename + "': " + std::string(mdb_strerror(dbr)));
 
 	dbr = mdb_txn_begin(env, NULL, 0, &txn);
@@ -221,34 +222,50 @@ ringdb::ringdb(std::string filename, const std::string &genesis) : filename(file
 
 ringdb::~ringdb()
 {
+	if(bulk)
+		mdb_env_sync(env, 1);
 	mdb_dbi_close(env, dbi_rings);
 	mdb_dbi_close(env, dbi_blackballs);
 	mdb_env_close(env);
 }
 
 bool ringdb::add_rings(const crypto::chacha_key &chacha_key, const cryptonote::transaction_prefix &tx)
+{
+	return add_rings(chacha_key, std::vector<const cryptonote::transaction_prefix *>(1, &tx));
+}
+
+bool ringdb::add_rings(const crypto::chacha_key &chacha_key, const std::vector<const cryptonote::transaction_prefix *> &txes)
 {
 	MDB_txn *txn;
 	int dbr;
 	bool tx_active = false;
 
-	dbr = resize_env(env, filename.c_str(), get_ring_data_size(tx.vin.size()));
+	size_t n_inputs = 0;
+	for(const cryptonote::transaction_prefix *tx : txes)
+		n_inputs += tx->vin.size();
+	if(n_inputs == 0)
+		return true;
+
+	dbr = resize_env(env, filename.c_str(), get_ring_data_size(n_inputs));
 	THROW_WALLET_EXCEPTION_IF(dbr, tools::error::wallet_internal_error, "Failed to set env map size");
 	dbr = mdb_txn_begin(env, NULL, 0, &txn);
 	THROW_WALLET_EXCEPTION_IF(dbr, tools::error::wallet_internal_error, "Failed to create LMDB transaction: " + std::string(mdb_strerror(dbr)));
 	epee::misc_utils::auto_scope_leave_caller txn_dtor = epee::misc_utils::create_scope_leave_handler([&]() {if (tx_active) mdb_txn_abort(txn); });
 	tx_active = true;
 
-	for(const auto &in : tx.vin)
+	for(const cryptonote::transaction_prefix *tx : txes)
 	{
-		if(in.type() != typeid(cryptonote::txin_to_key))
-			continue;
-		const auto &txin = boost::get<cryptonote::txin_to_key>(in);
-		const uint32_t ring_size = txin.key_offsets.size();
-		if(ring_size == 1)
-			continue;
-
-		store_relative_ring(txn, dbi_rings, txin.k_image, txin.key_offsets, chacha_key);
+		for(const auto &in : tx->vin)
+		{
+			if(in.type() != typeid(cryptonote::txin_to_key))
+				continue;
+			const auto &txin = boost::get<cryptonote::txin_to_key>(in);
+			const uint32_t ring_size = txin.key_offsets.size();
+			if(ring_size == 1)
+				continue;
+
+			store_relative_ring(txn, dbi_rings, txin.k_image, txin.key_offsets, chacha_key);
+		}
 	}
 
 	dbr = mdb_txn_commit(txn);
@@ -302,55 +319,100 @@ bool ringdb::remove_rings(const crypto::chacha_key &chacha_key, const cryptonote
 }
 
 bool ringdb::get_ring(const crypto::chacha_key &chacha_key, const crypto::key_image &key_image, std::vector<uint64_t> &outs)
+{
+	std::vector<std::vector<uint64_t>> rings;
+	get_rings(chacha_key, std::vector<crypto::key_image>(1, key_image), rings);
+	if(rings[0].empty())
+		return false;
+	outs = std::move(rings[0]);
+	return true;
+}
+
+bool ringdb::get_rings(const crypto::chacha_key &chacha_key, const std::vector<crypto::key_image> &key_images, std::vector<std::vector<uint64_t>> &outs)
 {
 	MDB_txn *txn;
+	MDB_cursor *cursor;
 	int dbr;
 	bool tx_active = false;
 
+	outs.clear();
+	outs.resize(key_images.size());
+	if(key_images.empty())
+		return true;
+
 	dbr = resize_env(env, filename.c_str(), 0);
 	THROW_WALLET_EXCEPTION_IF(dbr, tools::error::wallet_internal_error, "Failed to set env map size: " + std::string(mdb_strerror(dbr)));
-	dbr = mdb_txn_begin(env, NULL, 0, &txn);
+	dbr = mdb_txn_begin(env, NULL, MDB_RDONLY, &txn);
 	THROW_WALLET_EXCEPTION_IF(dbr, tools::error::wallet_internal_error, "Failed to create LMDB transaction: " + std::string(mdb_strerror(dbr)));
 	epee::misc_utils::auto_scope_leave_caller txn_dtor = epee::misc_utils::create_scope_leave_handler([&]() {if (tx_active) mdb_txn_abort(txn); });
 	tx_active = true;
 
-	MDB_val key, data;
-	std::string key_ciphertext = encrypt(key_image, chacha_key);
-	key.mv_data = (void *)key_ciphertext.data();
-	key.mv_size = key_ciphertext.size();
-	dbr = mdb_get(txn, dbi_rings, &key, &data);
-	THROW_WALLET_EXCEPTION_IF(dbr && dbr != MDB_NOTFOUND, tools::error::wallet_internal_error, "Failed to look for key image in LMDB table: " + std::string(mdb_strerror(dbr)));
-	if(dbr == MDB_NOTFOUND)
-		return false;
-	THROW_WALLET_EXCEPTION_IF(data.mv_size <= 0, tools::error::wallet_internal_error, "Invalid ring data size");
+	dbr = mdb_cursor_open(txn, dbi_rings, &cursor);
+	THROW_WALLET_EXCEPTION_IF(dbr, tools::error::wallet_internal_error, "Failed to create cursor for rings table: " + std::string(mdb_strerror(dbr)));
+	epee::misc_utils::auto_scope_leave_caller cursor_dtor = epee::misc_utils::create_scope_leave_handler([&]() { mdb_cursor_close(cursor); });
+
+	// look the keys up in table order, so the cursor walks the tree forward
+	std::vector<std::string> keys_ciphertext;
+	keys_ciphertext.reserve(key_images.size());
+	for(const crypto::key_image &key_image : key_images)
+		keys_ciphertext.push_back(encrypt(key_image, chacha_key));
+	std::vector<size_t> order(key_images.size());
+	for(size_t i = 0; i < order.size(); ++i)
+		order[i] = i;
+	std::sort(order.begin(), order.end(), [&keys_ciphertext](size_t a, size_t b) {
+		const MDB_val va = {keys_ciphertext[a].size(), (void *)keys_ciphertext[a].data()};
+		const MDB_val vb = {keys_ciphertext[b].size(), (void *)keys_ciphertext[b].data()};
+		return compare_hash32(&va, &vb) < 0;
+	});
+
+	for(size_t i : order)
+	{
+		const crypto::key_image &key_image = key_images[i];
+		MDB_val key, data;
+		key.mv_data = (void *)keys_ciphertext[i].data();
+		key.mv_size = keys_ciphertext[i].size();
+		dbr = mdb_cursor_get(cursor, &key, &data, MDB_SET_KEY);
+		THROW_WALLET_EXCEPTION_IF(dbr && dbr != MDB_NOTFOUND, tools::error::wallet_internal_error, "Failed to look for key image in LMDB table: " + std::string(mdb_strerror(dbr)));
+		if(dbr == MDB_NOTFOUND)
+			continue;
+		THROW_WALLET_EXCEPTION_IF(data.mv_size <= 0, tools::error::wallet_internal_error, "Invalid ring data size");
 
-	std::string data_plaintext = decrypt(std::string((const char *)data.mv_data, data.mv_size), key_image, chacha_key);
-	outs = decompress_ring(data_plaintext);
-	MDEBUG("Found ring for key image " << key_image << ":");
-	MDEBUG("Relative: " << boost::join(outs | boost::adaptors::transformed([](uint64_t out) { return std::to_string(out); }), " "));
-	outs = cryptonote::relative_output_offsets_to_absolute(outs);
-	MDEBUG("Absolute: " << boost::join(outs | boost::adaptors::transformed([](uint64_t out) { return std::to_string(out); }), " "));
+		std::string data_plaintext = decrypt(std::string((const char *)data.mv_data, data.mv_size), key_image, chacha_key);
+		std::vector<uint64_t> &ring = outs[i];
+		ring = decompress_ring(data_plaintext);
+		MDEBUG("Found ring for key image " << key_image << ":");
+		MDEBUG("Relative: " << boost::join(ring | boost::adaptors::transformed([](uint64_t out) { return std::to_string(out); }), " "));
+		ring = cryptonote::relative_output_offsets_to_absolute(ring);
+		MDEBUG("Absolute: " << boost::join(ring | boost::adaptors::transformed([](uint64_t out) { return std::to_string(out); }), " "));
+	}
 
-	dbr = mdb_txn_commit(txn);
-	THROW_WALLET_EXCEPTION_IF(dbr, tools::error::wallet_internal_error, "Failed to commit txn getting ring from database: " + std::string(mdb_strerror(dbr)));
-	tx_active = false;
 	return true;
 }
 
 bool ringdb::set_ring(const crypto::chacha_key &chacha_key, const crypto::key_image &key_image, const std::vector<uint64_t> &outs, bool relative)
+{
+	return set_rings(chacha_key, {std::make_pair(key_image, outs)}, relative);
+}
+
+bool ringdb::set_rings(const crypto::chacha_key &chacha_key, const std::vector<std::pair<crypto::key_image, std::vector<uint64_t>>> &rings, bool relative)
 {
 	MDB_txn *txn;
 	int dbr;
 	bool tx_active = false;
 
-	dbr = resize_env(env, filename.c_str(), outs.size() * 64);
+	size_t n_outs = 0;
+	for(const auto &ring : rings)
+		n_outs += ring.second.size();
+
+	dbr = resize_env(env, filename.c_str(), n_outs * 64);
 	THROW_WALLET_EXCEPTION_IF(dbr, tools::error::wallet_internal_error, "Failed to set env map size: " + std::string(mdb_strerror(dbr)));
 	dbr = mdb_txn_begin(env, NULL, 0, &txn);
 	THROW_WALLET_EXCEPTION_IF(dbr, tools::error::wallet_internal_error, "Failed to create LMDB transaction: " + std::string(mdb_strerror(dbr)));
 	epee::misc_utils::auto_scope_leave_caller txn_dtor = epee::misc_utils::create_scope_leave_handler([&]() {if (tx_active) mdb_txn_abort(txn); });
 	tx_active = true;
 
-	store_relative_ring(txn, dbi_rings, key_image, relative ? outs : cryptonote::absolute_output_offsets_to_relative(outs), chacha_key);
+	for(const auto &ring : rings)
+		store_relative_ring(txn, dbi_rings, ring.first, relative ? ring.second : cryptonote::absolute_output_offsets_to_relative(ring.second), chacha_key);
 
 	dbr = mdb_txn_commit(txn);
 	THROW_WALLET_EXCEPTION_IF(dbr, tools::error::wallet_internal_error, "Failed to commit txn setting ring to database: " + std::string(mdb_strerror(dbr)));
@@ -358,7 +420,7 @@ bool ringdb::set_ring(const crypto::chacha_key &chacha_key, const crypto::key_im
 	return true;
 }
 
-bool ringdb::blackball_worker(const crypto::public_key &output, int op)
+bool ringdb::blackball_worker(const std::vector<crypto::public_key> &outputs, int op)
 {
 	MDB_txn *txn;
 	MDB_cursor *cursor;
@@ -366,7 +428,11 @@ bool ringdb::blackball_worker(const crypto::public_key &output, int op)
 	bool tx_active = false;
 	bool ret = true;
 
-	dbr = resize_env(env, filename.c_str(), 32 * 2); // a pubkey, and some slack
+	THROW_WALLET_EXCEPTION_IF(op == BLACKBALL_QUERY && outputs.size() != 1, tools::error::wallet_internal_error, "Blackball query only supports one output");
+	if(op != BLACKBALL_CLEAR && outputs.empty())
+		return true;
+
+	dbr = resize_env(env, filename.c_str(), 32 * 2 * outputs.size()); // a pubkey, and some slack
 	THROW_WALLET_EXCEPTION_IF(dbr, tools::error::wallet_internal_error, "Failed to set env map size: " + std::string(mdb_strerror(dbr)));
 	dbr = mdb_txn_begin(env, NULL, 0, &txn);
 	THROW_WALLET_EXCEPTION_IF(dbr, tools::error::wallet_internal_error, "Failed to create LMDB transaction: " + std::string(mdb_strerror(dbr)));
@@ -375,24 +441,38 @@ bool ringdb::blackball_worker(const crypto::public_key &output, int op)
 
 	MDB_val key = zerokeyval;
 	MDB_val data;
-	data.mv_data = (void *)&output;
-	data.mv_size = sizeof(output);
 
 	switch(op)
 	{
 	case BLACKBALL_BLACKBALL:
-		MDEBUG("Blackballing output " << output);
-		dbr = mdb_put(txn, dbi_blackballs, &key, &data, MDB_NODUPDATA);
-		if(dbr == MDB_KEYEXIST)
-			dbr = 0;
+		for(const crypto::public_key &output : outputs)
+		{
+			MDEBUG("Blackballing output " << output);
+			data.mv_data = (void *)&output;
+			data.mv_size = sizeof(output);
+			dbr = mdb_put(txn, dbi_blackballs, &key, &data, MDB_NODUPDATA);
+			if(dbr == MDB_KEYEXIST)
+				dbr = 0;
+			if(dbr)
+				break;
+		}
 		break;
 	case BLACKBALL_UNBLACKBALL:
-		MDEBUG("Unblackballing output " << output);
-		dbr = mdb_del(txn, dbi_blackballs, &key, &data);
-		if(dbr == MDB_NOTFOUND)
-			dbr = 0;
+		for(const crypto::public_key &output : outputs)
+		{
+			MDEBUG("Unblackballing output " << output);
+			data.mv_data = (void *)&output;
+			data.mv_size = sizeof(output);
+			dbr = mdb_del(txn, dbi_blackballs, &key, &data);
+			if(dbr == MDB_NOTFOUND)
+				dbr = 0;
+			if(dbr)
+				break;
+		}
 		break;
 	case BLACKBALL_QUERY:
+		data.mv_data = (void *)&outputs[0];
+		data.mv_size = sizeof(outputs[0]);
 		dbr = mdb_cursor_open(txn, dbi_blackballs, &cursor);
 		THROW_WALLET_EXCEPTION_IF(dbr, tools::error::wallet_internal_error, "Failed to create cursor for blackballs table: " + std::string(mdb_strerror(dbr)));
 		dbr = mdb_cursor_get(cursor, &key, &data, MDB_GET_BOTH);
@@ -418,21 +498,37 @@ bool ringdb::blackball_worker(const crypto::public_key &output, int op)
 
 bool ringdb::blackball(const crypto::public_key &output)
 {
-	return blackball_worker(output, BLACKBALL_BLACKBALL);
+	return blackball_worker(std::vector<crypto::public_key>(1, output), BLACKBALL_BLACKBALL);
+}
+
+bool ringdb::blackball(const std::vector<crypto::public_key> &outputs)
+{
+	return blackball_worker(outputs, BLACKBALL_BLACKBALL);
 }
 
 bool ringdb::unblackball(const crypto::public_key &output)
 {
-	return blackball_worker(output, BLACKBALL_UNBLACKBALL);
+	return blackball_worker(std::vector<crypto::public_key>(1, output), BLACKBALL_UNBLACKBALL);
+}
+
+bool ringdb::unblackball(const std::vector<crypto::public_key> &outputs)
+{
+	return blackball_worker(outputs, BLACKBALL_UNBLACKBALL);
 }
 
 bool ringdb::blackballed(const crypto::public_key &output)
 {
-	return blackball_worker(output, BLACKBALL_QUERY);
+	return blackball_worker(std::vector<crypto::public_key>(1, output), BLACKBALL_QUERY);
 }
 
 bool ringdb::clear_blackballs()
 {
-	return blackball_worker(crypto::public_key(), BLACKBALL_CLEAR);
+	return blackball_worker(std::vector<crypto::public_key>(), BLACKBALL_CLEAR);
+}
+
+void ringdb::sync()
+{
+	int dbr = mdb_env_sync(env, 1);
+	THROW_WALLET_EXCEPTION_IF(dbr, tools::error::wallet_internal_error, "Failed to sync rings database: " + std::string(mdb_strerror(dbr)));
 }
 }
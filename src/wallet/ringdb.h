@@ -30,24 +30,38 @@ namespace tools
 class ringdb
 {
   public:
-	ringdb(std::string filename, const std::string &genesis);
+	// bulk opens the environment without syncing each commit, for tools that
+	// write a lot of data at once: call sync() at checkpoints, a crash before
+	// that may lose the most recent writes. It is MDB_NOSYNC alone: wallets
+	// open the same environment at the same time, and MDB_WRITEMAP would let
+	// a stray write from any of them corrupt the map
+	ringdb(std::string filename, const std::string &genesis, bool bulk = false);
 	~ringdb();
 
 	bool add_rings(const crypto::chacha_key &chacha_key, const cryptonote::transaction_prefix &tx);
+	bool add_rings(const crypto::chacha_key &chacha_key, const std::vector<const cryptonote::transaction_prefix *> &txes);
 	bool remove_rings(const crypto::chacha_key &chacha_key, const cryptonote::transaction_prefix &tx);
 	bool get_ring(const crypto::chacha_key &chacha_key, const crypto::key_image &key_image, std::vector<uint64_t> &outs);
+	// outs[i] is left empty when key_images[i] has no ring
+	bool get_rings(const crypto::chacha_key &chacha_key, const std::vector<crypto::key_image> &key_images, std::vector<std::vector<uint64_t>> &outs);
 	bool set_ring(const crypto::chacha_key &chacha_key, const crypto::key_image &key_image, const std::vector<uint64_t> &outs, bool relative);
+	bool set_rings(const crypto::chacha_key &chacha_key, const std::vector<std::pair<crypto::key_image, std::vector<uint64_t>>> &rings, bool relative);
 
 	bool blackball(const crypto::public_key &output);
+	bool blackball(const std::vector<crypto::public_key> &outputs);
 	bool unblackball(const crypto::public_key &output);
+	bool unblackball(const std::vector<crypto::public_key> &outputs);
 	bool blackballed(const crypto::public_key &output);
 	bool clear_blackballs();
 
+	void sync();
+
   private:
-	bool blackball_worker(const crypto::public_key &output, int op);
+	bool blackball_worker(const std::vector<crypto::public_key> &outputs, int op);
 
   private:
 	std::string filename;
+	bool bulk;
 	MDB_env *env;
 	MDB_dbi dbi_rings;
 	MDB_dbi dbi_blackballs;
@@ -97,8 +97,15 @@ using namespace cryptonote;
 
 #define FEE_ESTIMATE_GRACE_BLOCKS 10 // estimate fee valid for that many blocks
 
+#define OUTPUT_DISTRIBUTION_CACHE_DEPTH 10 // blocks this close to the wallet's top are refetched, not cached
+
 #define SECOND_OUTPUT_RELATEDNESS_THRESHOLD 0.0f
 
+#define GET_OUTS_MAX_REQUESTED 5000 // outputs a restricted daemon serves in one get_outs.bin request
+
+#define TRANSFER_EVENTS_MIN_DEAD ((size_t)10000) // stale transfer events kept before the log is trimmed
+#define TRANSFER_EVENT_SEQ_BITS 40 // low bits of a transfer event cursor, the epoch of the log is above them
+
 #define SUBADDRESS_LOOKAHEAD_MAJOR 50
 #define SUBADDRESS_LOOKAHEAD_MINOR 200
 
@@ -175,7 +182,7 @@ std::string get_size_string(const cryptonote::blobdata &tx)
 	return get_size_string(tx.size());
 }
 
-std::unique_ptr<tools::wallet2> make_basic(const boost::program_options::variables_map &vm, const options &opts, const std::function<boost::optional<tools::password_container>(const char *, bool)> &password_prompter)
+std::unique_ptr<tools::wallet2> make_basic(const boost::program_options::variables_map &vm, const options &opts, const std::function<boost::optional<tools::password_container>(const char *, bool)> &password_prompter, bool ringdb = true)
 {
 	const bool testnet = command_line::get_arg(vm, opts.testnet);
 	const bool stagenet = command_line::get_arg(vm, opts.stagenet);
@@ -228,8 +235,11 @@ std::unique_ptr<tools::wallet2> make_basic(const boost::program_options::variabl
 		wallet->set_force_network();
 
 	wallet->init(std::move(daemon_address), std::move(login));
-	boost::filesystem::path ringdb_path = command_line::get_arg(vm, opts.shared_ringdb_dir);
-	wallet->set_ring_database(ringdb_path.string());
+	if(ringdb)
+	{
+		boost::filesystem::path ringdb_path = command_line::get_arg(vm, opts.shared_ringdb_dir);
+		wallet->set_ring_database(ringdb_path.string());
+	}
 	return wallet;
 }
 
@@ -516,6 +526,14 @@ void drop_from_short_history(std::list<crypto::hash> &short_chain_history, size_
 	}
 }
 
+size_t varint_size(uint64_t v)
+{
+	size_t bytes = 1;
+	for(; v >= 0x80; v >>= 7)
+		++bytes;
+	return bytes;
+}
+
 size_t estimate_rct_tx_size(int n_inputs, int mixin, int n_outputs, size_t extra_size, bool bulletproof)
 {
 	size_t size = 0;
@@ -665,7 +683,7 @@ std::unique_ptr<wallet2> wallet2::make_from_json(const boost::program_options::v
 }
 
 std::pair<std::unique_ptr<wallet2>, password_container> wallet2::make_from_file(
-	const boost::program_options::variables_map &vm, const std::string &wallet_file, const std::function<boost::optional<tools::password_container>(const char *, bool)> &password_prompter)
+	const boost::program_options::variables_map &vm, const std::string &wallet_file, const std::function<boost::optional<tools::password_container>(const char *, bool)> &password_prompter, bool ringdb)
 {
 	const options opts{};
 	auto pwd = get_password(vm, opts, password_prompter, false);
@@ -673,7 +691,7 @@ std::pair<std::unique_ptr<wallet2>, password_container> wallet2::make_from_file(
 	{
 		return {nullptr, password_container{}};
 	}
-	auto wallet = make_basic(vm, opts, password_prompter);
+	auto wallet = make_basic(vm, opts, password_prompter, ringdb);
 	if(wallet)
 	{
 		wallet->load(wallet_file, pwd->password());
@@ -708,6 +726,8 @@ bool wallet2::init(std::string daemon_address, boost::optional<epee::net_utils::
 	m_upper_transaction_size_limit = upper_transaction_size_limit;
 	m_daemon_address = std::move(daemon_address);
 	m_daemon_login = std::move(daemon_login);
+	m_pool_hashes.clear();
+	m_pool_revision = 0;
 	return m_http_client.set_server(get_daemon_address(), get_daemon_login(), ssl);
 }
 //----------------------------------------------------------------------------------------------------
@@ -948,16 +968,225 @@ void wallet2::set_spent(size_t idx, uint64_t height)
 {
 	transfer_details &td = m_transfers[idx];
 	LOG_PRINT_L2("Setting SPENT at " << height << ": ki " << td.m_key_image << ", amount " << print_money(td.m_amount));
+	unindex_transfer(idx);
 	td.m_spent = true;
 	td.m_spent_height = height;
+	index_transfer(idx);
 }
 //----------------------------------------------------------------------------------------------------
 void wallet2::set_unspent(size_t idx)
 {
 	transfer_details &td = m_transfers[idx];
 	LOG_PRINT_L2("Setting UNSPENT: ki " << td.m_key_image << ", amount " << print_money(td.m_amount));
+	unindex_transfer(idx);
 	td.m_spent = false;
 	td.m_spent_height = 0;
+	index_transfer(idx);
+}
+//----------------------------------------------------------------------------------------------------
+// The first local chain height at which is_transfer_unlocked() is true
+uint64_t wallet2::get_transfer_unlock_height(const transfer_details &td) const
+{
+	static_assert(CRYPTONOTE_LOCKED_TX_ALLOWED_DELTA_BLOCKS > 0, "unlock height would overflow");
+	uint64_t unlock_height = td.m_block_height + CRYPTONOTE_DEFAULT_TX_SPENDABLE_AGE;
+	if(td.m_tx.unlock_time >= CRYPTONOTE_LOCKED_TX_ALLOWED_DELTA_BLOCKS)
+		unlock_height = std::max<uint64_t>(unlock_height, td.m_tx.unlock_time - CRYPTONOTE_LOCKED_TX_ALLOWED_DELTA_BLOCKS + 1);
+	return unlock_height;
+}
+//----------------------------------------------------------------------------------------------------
+// Adds a transfer to the balance and unlock indices. A transfer has to be
+// unindexed before its amount, subaddress, height or spent state change,
+// and indexed again after.
+void wallet2::index_transfer(size_t idx)
+{
+	const transfer_details &td = m_transfers[idx];
+	m_transfers_by_unlock_height.emplace(get_transfer_unlock_height(td), idx);
+	if(!td.m_spent)
+	{
+		subaddress_balance &balance = m_unspent_balances[td.m_subaddr_index.major][td.m_subaddr_index.minor];
+		balance.amount += td.amount();
+		++balance.count;
+	}
+}
+//----------------------------------------------------------------------------------------------------
+void wallet2::unindex_transfer(size_t idx)
+{
+	const transfer_details &td = m_transfers[idx];
+	if(!m_transfers_by_unlock_height.erase(std::make_pair(get_transfer_unlock_height(td), idx)))
+		return; // not indexed yet
+
+	if(!td.m_spent)
+	{
+		auto major = m_unspent_balances.find(td.m_subaddr_index.major);
+		THROW_WALLET_EXCEPTION_IF(major == m_unspent_balances.end(), error::wallet_internal_error, "Unspent transfer missing from balance index");
+		auto minor = major->second.find(td.m_subaddr_index.minor);
+		THROW_WALLET_EXCEPTION_IF(minor == major->second.end(), error::wallet_internal_error, "Unspent transfer missing from balance index");
+		minor->second.amount -= td.amount();
+		if(--minor->second.count == 0)
+		{
+			major->second.erase(minor);
+			if(major->second.empty())
+				m_unspent_balances.erase(major);
+		}
+	}
+}
+//----------------------------------------------------------------------------------------------------
+void wallet2::index_confirmed_tx(const confirmed_transfer_container::value_type &tx)
+{
+	m_confirmed_txs_by_height.emplace(tx.second.m_block_height, &tx);
+	add_transfer_event(nullptr, &tx);
+}
+//----------------------------------------------------------------------------------------------------
+void wallet2::unindex_confirmed_tx(const confirmed_transfer_container::value_type &tx)
+{
+	auto range = m_confirmed_txs_by_height.equal_range(tx.second.m_block_height);
+	for(auto it = range.first; it != range.second; ++it)
+	{
+		if(it->second == &tx)
+		{
+			m_confirmed_txs_by_height.erase(it);
+			break;
+		}
+	}
+
+	auto copy = std::make_shared<const confirmed_transfer_container::value_type>(tx);
+	remove_transfer_event(&tx, copy, nullptr, copy.get());
+}
+//----------------------------------------------------------------------------------------------------
+void wallet2::index_payment(const payment_container::value_type &payment)
+{
+	m_payments_by_height.emplace(payment.second.m_block_height, &payment);
+	add_transfer_event(&payment, nullptr);
+}
+//----------------------------------------------------------------------------------------------------
+void wallet2::unindex_payment(const payment_container::value_type &payment)
+{
+	auto range = m_payments_by_height.equal_range(payment.second.m_block_height);
+	for(auto it = range.first; it != range.second; ++it)
+	{
+		if(it->second == &payment)
+		{
+			m_payments_by_height.erase(it);
+			break;
+		}
+	}
+
+	auto copy = std::make_shared<const payment_container::value_type>(payment);
+	remove_transfer_event(&payment, copy, copy.get(), nullptr);
+}
+//----------------------------------------------------------------------------------------------------
+void wallet2::add_transfer_event(const payment_container::value_type *payment, const confirmed_transfer_container::value_type *tx)
+{
+	transfer_event event = {++m_transfer_event_seq, false, payment, tx, nullptr};
+	m_transfer_event_seqs[payment ? (const void *)payment : (const void *)tx] = event.seq;
+	m_transfer_events.push_back(std::move(event));
+	trim_transfer_events();
+}
+//----------------------------------------------------------------------------------------------------
+// Logs the removal of an entry that is about to be erased. Its add event is
+// kept, so sequence numbers stay dense, but no longer points at it.
+void wallet2::remove_transfer_event(const void *entry, const std::shared_ptr<const void> &copy, const payment_container::value_type *payment, const confirmed_transfer_container::value_type *tx)
+{
+	auto it = m_transfer_event_seqs.find(entry);
+	if(it == m_transfer_event_seqs.end())
+		return;
+
+	transfer_event &added = m_transfer_events[it->second - m_transfer_events_start];
+	added.payment = nullptr;
+	added.tx = nullptr;
+	m_transfer_event_seqs.erase(it);
+
+	transfer_event event = {++m_transfer_event_seq, true, payment, tx, copy};
+	m_transfer_events.push_back(std::move(event));
+	trim_transfer_events();
+}
+//----------------------------------------------------------------------------------------------------
+// Removals, and the add events they leave pointing at nothing, only matter
+// to cursors that have not caught up with them. Once they outnumber the live
+// entries, the log is started over from those, and older cursors see a reset.
+void wallet2::trim_transfer_events()
+{
+	const size_t live = m_transfer_event_seqs.size();
+	if(m_transfer_events.size() - live <= std::max(live, TRANSFER_EVENTS_MIN_DEAD))
+		return;
+	MDEBUG("Trimming the transfer event log: " << m_transfer_events.size() << " events, " << live << " live");
+	relog_transfer_events();
+}
+//----------------------------------------------------------------------------------------------------
+void wallet2::reset_transfer_events()
+{
+	m_transfer_events.clear();
+	m_transfer_event_seqs.clear();
+	// skip a number, a cursor at the last event of the previous log must not
+	// look like one at the start of this one
+	++m_transfer_event_seq;
+	m_transfer_events_start = m_transfer_event_seq + 1;
+	// only the last number survives a save, events logged after it and lost
+	// with the process reuse numbers, the epoch tells their cursors apart
+	const uint64_t previous_epoch = m_transfer_events_epoch;
+	do
+		m_transfer_events_epoch = crypto::rand<uint64_t>() >> TRANSFER_EVENT_SEQ_BITS;
+	while(m_transfer_events_epoch == 0 || m_transfer_events_epoch == previous_epoch);
+}
+//----------------------------------------------------------------------------------------------------
+void wallet2::rebuild_indices()
+{
+	m_unspent_balances.clear();
+	m_transfers_by_unlock_height.clear();
+	m_payments_by_height.clear();
+	m_confirmed_txs_by_height.clear();
+
+	for(size_t i = 0; i < m_transfers.size(); ++i)
+		index_transfer(i);
+	for(const auto &payment : m_payments)
+		m_payments_by_height.emplace(payment.second.m_block_height, &payment);
+	for(const auto &tx : m_confirmed_txs)
+		m_confirmed_txs_by_height.emplace(tx.second.m_block_height, &tx);
+
+	relog_transfer_events();
+}
+//----------------------------------------------------------------------------------------------------
+void wallet2::relog_transfer_events()
+{
+	reset_transfer_events();
+
+	// log what is there in chain order
+	auto in = m_payments_by_height.begin();
+	auto out = m_confirmed_txs_by_height.begin();
+	while(in != m_payments_by_height.end() || out != m_confirmed_txs_by_height.end())
+	{
+		if(out == m_confirmed_txs_by_height.end() || (in != m_payments_by_height.end() && in->first <= out->first))
+			add_transfer_event((in++)->second, nullptr);
+		else
+			add_transfer_event(nullptr, (out++)->second);
+	}
+}
+//----------------------------------------------------------------------------------------------------
+uint64_t wallet2::get_transfer_events_cursor() const
+{
+	return (m_transfer_events_epoch << TRANSFER_EVENT_SEQ_BITS) | m_transfer_event_seq;
+}
+//----------------------------------------------------------------------------------------------------
+bool wallet2::get_transfer_events(uint64_t cursor, size_t max_count, const std::function<bool(const transfer_event &)> &filter, std::vector<transfer_event> &events, uint64_t &next_cursor) const
+{
+	const uint64_t seq = cursor & (((uint64_t)1 << TRANSFER_EVENT_SEQ_BITS) - 1);
+	bool reset = cursor != 0 && ((cursor >> TRANSFER_EVENT_SEQ_BITS) != m_transfer_events_epoch || seq + 1 < m_transfer_events_start || seq > m_transfer_event_seq);
+	size_t i = reset || cursor == 0 ? 0 : seq + 1 - m_transfer_events_start;
+
+	events.clear();
+	uint64_t next_seq = m_transfer_events_start - 1 + i;
+	for(; i < m_transfer_events.size() && (max_count == 0 || events.size() < max_count); ++i)
+	{
+		const transfer_event &event = m_transfer_events[i];
+		next_seq = event.seq;
+		if(!event.payment && !event.tx)
+			continue; // removed since, the removal comes later
+		if(filter && !filter(event))
+			continue;
+		events.push_back(event);
+	}
+	next_cursor = (m_transfer_events_epoch << TRANSFER_EVENT_SEQ_BITS) | next_seq;
+	return !reset;
 }
 //----------------------------------------------------------------------------------------------------
 void wallet2::check_acc_out_precomp(const tx_out &o, const crypto::key_derivation &derivation, const std::vector<crypto::key_derivation> &additional_derivations, size_t i, tx_scan_info_t &tx_scan_info) const
@@ -1304,6 +1533,7 @@ void wallet2::process_new_transaction(const crypto::hash &txid, const cryptonote
 					if(!pool)
 					{
 						transfer_details &td = m_transfers[kit->second];
+						unindex_transfer(kit->second);
 						td.m_block_height = height;
 						td.m_internal_output_index = o;
 						td.m_global_output_index = o_indices[o];
@@ -1335,6 +1565,7 @@ void wallet2::process_new_transaction(const crypto::hash &txid, const cryptonote
 							if(m_multisig_rescan_info && m_multisig_rescan_info->front().size() >= m_transfers.size())
 								update_multisig_rescan_info(*m_multisig_rescan_k, *m_multisig_rescan_info, m_transfers.size() - 1);
 						}
+						index_transfer(kit->second);
 						THROW_WALLET_EXCEPTION_IF(td.get_public_key() != tx_scan_info[o].in_ephemeral.pub, error::wallet_internal_error, "Inconsistent public keys");
 						THROW_WALLET_EXCEPTION_IF(td.m_spent, error::wallet_internal_error, "Inconsistent spent status");
 
@@ -1372,7 +1603,9 @@ void wallet2::process_new_transaction(const crypto::hash &txid, const cryptonote
 					//   1) the same output pub key was used as destination multiple times,
 					//   2) the wallet set the highest amount among them to transfer_details::m_amount, and
 					//   3) the wallet somehow spent that output with an amount smaller than the above amount, causing inconsistency
+					unindex_transfer(it->second);
 					td.m_amount = amount;
+					index_transfer(it->second);
 				}
 			}
 			else
@@ -1507,7 +1740,10 @@ void wallet2::process_new_transaction(const crypto::hash &txid, const cryptonote
 					m_callback->on_unconfirmed_money_received(height, txid, tx, payment.m_amount, payment.m_subaddr_index);
 			}
 			else
-				m_payments.emplace(payment_id, payment);
+			{
+				auto it = m_payments.emplace(payment_id, payment);
+				index_payment(*it);
+			}
 			LOG_PRINT_L2("Payment found in " << (pool ? "pool" : "block") << ": " << payment_id << " / " << payment.m_tx_hash << " / " << payment.m_amount);
 		}
 	}
@@ -1525,7 +1761,9 @@ void wallet2::process_unconfirmed(const crypto::hash &txid, const cryptonote::tr
 		{
 			try
 			{
-				m_confirmed_txs.insert(std::make_pair(txid, confirmed_transfer_details(unconf_it->second, height)));
+				auto entry = m_confirmed_txs.insert(std::make_pair(txid, confirmed_transfer_details(unconf_it->second, height)));
+				if(entry.second)
+					index_confirmed_tx(*entry.first);
 			}
 			catch(...)
 			{
@@ -1540,6 +1778,8 @@ void wallet2::process_unconfirmed(const crypto::hash &txid, const cryptonote::tr
 void wallet2::process_outgoing(const crypto::hash &txid, const cryptonote::transaction &tx, uint64_t height, uint64_t ts, uint64_t spent, uint64_t received, uint32_t subaddr_account, const std::set<uint32_t> &subaddr_indices)
 {
 	std::pair<std::unordered_map<crypto::hash, confirmed_transfer_details>::iterator, bool> entry = m_confirmed_txs.insert(std::make_pair(txid, confirmed_transfer_details()));
+	if(!entry.second)
+		unindex_confirmed_tx(*entry.first);
 	// fill with the info we know, some info might already be there
 	if(entry.second)
 	{
@@ -1572,46 +1812,39 @@ void wallet2::process_outgoing(const crypto::hash &txid, const cryptonote::trans
 	entry.first->second.m_block_height = height;
 	entry.first->second.m_timestamp = ts;
 	entry.first->second.m_unlock_time = tx.unlock_time;
+	index_confirmed_tx(*entry.first);
 
 	add_rings(tx);
 }
 //----------------------------------------------------------------------------------------------------
-void wallet2::process_new_blockchain_entry(const cryptonote::block &b, const cryptonote::block_complete_entry &bche, const crypto::hash &bl_id, uint64_t height, const cryptonote::COMMAND_RPC_GET_BLOCKS_FAST::block_output_indices &o_indices)
+void wallet2::process_new_blockchain_entry(const parsed_block &pb, uint64_t height, const cryptonote::COMMAND_RPC_GET_BLOCKS_FAST::block_output_indices &o_indices)
 {
+	const cryptonote::block &b = pb.block;
 	size_t txidx = 0;
-	THROW_WALLET_EXCEPTION_IF(bche.txs.size() + 1 != o_indices.indices.size(), error::wallet_internal_error,
-							  "block transactions=" + std::to_string(bche.txs.size()) +
+	THROW_WALLET_EXCEPTION_IF(b.tx_hashes.size() + 1 != o_indices.indices.size(), error::wallet_internal_error,
+							  "block transactions=" + std::to_string(b.tx_hashes.size()) +
 								  " not match with daemon response size=" + std::to_string(o_indices.indices.size()));
 
 	//handle transactions from new block
-
-	//optimization if m_explicit_refresh_from_block_height is false: seeking only for blocks that are not older then the wallet creation time plus 1 day. 1 day is for possible user incorrect time setup
-	if(!m_explicit_refresh_from_block_height || (b.timestamp + 60 * 60 * 24 > m_account.get_createtime() && height >= m_refresh_from_block_height))
+	if(wants_block_txes(height, b))
 	{
 		TIME_MEASURE_START(miner_tx_handle_time);
 		process_new_transaction(get_transaction_hash(b.miner_tx), b.miner_tx, o_indices.indices[txidx++].indices, height, b.timestamp, true, false, false);
 		TIME_MEASURE_FINISH(miner_tx_handle_time);
 
 		TIME_MEASURE_START(txs_handle_time);
-		THROW_WALLET_EXCEPTION_IF(bche.txs.size() != b.tx_hashes.size(), error::wallet_internal_error, "Wrong amount of transactions for block");
-		size_t idx = 0;
-		for(const auto &txblob : bche.txs)
-		{
-			cryptonote::transaction tx;
-			bool r = parse_and_validate_tx_base_from_blob(txblob, tx);
-			THROW_WALLET_EXCEPTION_IF(!r, error::tx_parse_error, txblob);
-			process_new_transaction(b.tx_hashes[idx], tx, o_indices.indices[txidx++].indices, height, b.timestamp, false, false, false);
-			++idx;
-		}
+		THROW_WALLET_EXCEPTION_IF(pb.txes.size() != b.tx_hashes.size(), error::wallet_internal_error, "Wrong amount of transactions for block");
+		for(size_t idx = 0; idx < pb.txes.size(); ++idx)
+			process_new_transaction(b.tx_hashes[idx], pb.txes[idx], o_indices.indices[txidx++].indices, height, b.timestamp, false, false, false);
 		TIME_MEASURE_FINISH(txs_handle_time);
-		LOG_PRINT_L2("Processed block: " << bl_id << ", height " << height << ", " << miner_tx_handle_time + txs_handle_time << "(" << miner_tx_handle_time << "/" << txs_handle_time << ")ms");
+		LOG_PRINT_L2("Processed block: " << pb.hash << ", height " << height << ", " << miner_tx_handle_time + txs_handle_time << "(" << miner_tx_handle_time << "/" << txs_handle_time << ")ms");
 	}
 	else
 	{
 		if(!(height % 100))
 			LOG_PRINT_L2("Skipped block by timestamp, height: " << height << ", block time " << b.timestamp << ", account time " << m_account.get_createtime());
 	}
-	m_blockchain.push_back(bl_id);
+	m_blockchain.push_back(pb.hash);
 	++m_local_bc_height;
 
 	if(0 != m_callback)
@@ -1651,11 +1884,51 @@ void wallet2::get_short_chain_history(std::list<crypto::hash> &ids) const
 		ids.push_back(m_blockchain.genesis());
 }
 //----------------------------------------------------------------------------------------------------
-void wallet2::parse_block_round(const cryptonote::blobdata &blob, cryptonote::block &bl, crypto::hash &bl_id, bool &error) const
+bool wallet2::wants_block_txes(uint64_t height, const cryptonote::block &b) const
 {
-	error = !cryptonote::parse_and_validate_block_from_blob(blob, bl);
-	if(!error)
-		bl_id = get_block_hash(bl);
+	//optimization if m_explicit_refresh_from_block_height is false: seeking only for blocks that are not older then the wallet creation time plus 1 day. 1 day is for possible user incorrect time setup
+	return !m_explicit_refresh_from_block_height || (b.timestamp + 60 * 60 * 24 > m_account.get_createtime() && height >= m_refresh_from_block_height);
+}
+//----------------------------------------------------------------------------------------------------
+void wallet2::parse_block_round(const cryptonote::block_complete_entry &bche, uint64_t height, const std::function<bool(uint64_t, const cryptonote::block &)> &wants_txes, parsed_block &pb, bool &error)
+{
+	error = !cryptonote::parse_and_validate_block_from_blob(bche.block, pb.block);
+	if(error)
+		return;
+	pb.hash = get_block_hash(pb.block);
+	if(!wants_txes(height, pb.block))
+		return;
+	pb.txes.resize(bche.txs.size());
+	size_t idx = 0;
+	for(const auto &txblob : bche.txs)
+	{
+		if(!parse_and_validate_tx_base_from_blob(txblob, pb.txes[idx++]))
+		{
+			error = true;
+			return;
+		}
+	}
+}
+//----------------------------------------------------------------------------------------------------
+void wallet2::parse_blocks(uint64_t start_height, const std::list<cryptonote::block_complete_entry> &blocks, const std::function<bool(uint64_t, const cryptonote::block &)> &wants_txes, std::vector<parsed_block> &parsed)
+{
+	tools::threadpool &tpool = tools::threadpool::getInstance();
+	tools::threadpool::waiter waiter;
+	std::deque<bool> errors(blocks.size());
+	parsed.clear();
+	parsed.resize(blocks.size());
+
+	size_t i = 0;
+	for(const auto &bche : blocks)
+	{
+		tpool.submit(&waiter, boost::bind(&wallet2::parse_block_round, std::cref(bche), start_height + i, std::cref(wants_txes), std::ref(parsed[i]), std::ref(errors[i])));
+		++i;
+	}
+	waiter.wait();
+
+	i = 0;
+	for(const auto &bche : blocks)
+		THROW_WALLET_EXCEPTION_IF(errors[i++], error::block_parse_error, bche.block);
 }
 //----------------------------------------------------------------------------------------------------
 void wallet2::pull_blocks(uint64_t start_height, uint64_t &blocks_start_height, const std::list<crypto::hash> &short_chain_history, std::list<cryptonote::block_complete_entry> &blocks, std::vector<cryptonote::COMMAND_RPC_GET_BLOCKS_FAST::block_output_indices> &o_indices)
@@ -1727,105 +2000,44 @@ void wallet2::pull_hashes(uint64_t start_height, uint64_t &blocks_start_height,
 }
 //----------------------------------------------------------------------------------------------------
 void wallet2::process_blocks(uint64_t start_height, const std::list<cryptonote::block_complete_entry> &blocks, const std::vector<cryptonote::COMMAND_RPC_GET_BLOCKS_FAST::block_output_indices> &o_indices, uint64_t &blocks_added)
+{
+	std::vector<parsed_block> parsed;
+	parse_blocks(start_height, blocks, [this](uint64_t height, const cryptonote::block &b) { return wants_block_txes(height, b); }, parsed);
+	process_parsed_blocks(start_height, parsed, o_indices, blocks_added);
+}
+//----------------------------------------------------------------------------------------------------
+void wallet2::process_parsed_blocks(uint64_t start_height, const std::vector<parsed_block> &blocks, const std::vector<cryptonote::COMMAND_RPC_GET_BLOCKS_FAST::block_output_indices> &o_indices, uint64_t &blocks_added)
 {
 	size_t current_index = start_height;
 	blocks_added = 0;
-	size_t tx_o_indices_idx = 0;
 
 	THROW_WALLET_EXCEPTION_IF(blocks.size() != o_indices.size(), error::wallet_internal_error, "size mismatch");
 	THROW_WALLET_EXCEPTION_IF(!m_blockchain.is_in_bounds(current_index), error::wallet_internal_error, "Index out of bounds of hashchain");
 
-	tools::threadpool &tpool = tools::threadpool::getInstance();
-	int threads = tpool.get_max_concurrency();
-	if(threads > 1)
+	for(size_t i = 0; i < blocks.size(); ++i)
 	{
-		std::vector<crypto::hash> round_block_hashes(threads);
-		std::vector<cryptonote::block> round_blocks(threads);
-		std::deque<bool> error(threads);
-		size_t blocks_size = blocks.size();
-		std::list<block_complete_entry>::const_iterator blocki = blocks.begin();
-		for(size_t b = 0; b < blocks_size; b += threads)
+		const parsed_block &pb = blocks[i];
+		if(current_index >= m_blockchain.size())
 		{
-			size_t round_size = std::min((size_t)threads, blocks_size - b);
-			tools::threadpool::waiter waiter;
-
-			std::list<block_complete_entry>::const_iterator tmpblocki = blocki;
-			for(size_t i = 0; i < round_size; ++i)
-			{
-				tpool.submit(&waiter, boost::bind(&wallet2::parse_block_round, this, std::cref(tmpblocki->block),
-												  std::ref(round_blocks[i]), std::ref(round_block_hashes[i]), std::ref(error[i])));
-				++tmpblocki;
-			}
-			waiter.wait();
-			tmpblocki = blocki;
-			for(size_t i = 0; i < round_size; ++i)
-			{
-				THROW_WALLET_EXCEPTION_IF(error[i], error::block_parse_error, tmpblocki->block);
-				++tmpblocki;
-			}
-			for(size_t i = 0; i < round_size; ++i)
-			{
-				const crypto::hash &bl_id = round_block_hashes[i];
-				cryptonote::block &bl = round_blocks[i];
-
-				if(current_index >= m_blockchain.size())
-				{
-					process_new_blockchain_entry(bl, *blocki, bl_id, current_index, o_indices[b + i]);
-					++blocks_added;
-				}
-				else if(bl_id != m_blockchain[current_index])
-				{
-					//split detected here !!!
-					THROW_WALLET_EXCEPTION_IF(current_index == start_height, error::wallet_internal_error,
-											  "wrong daemon response: split starts from the first block in response " + string_tools::pod_to_hex(bl_id) +
-												  " (height " + std::to_string(start_height) + "), local block id at this height: " +
-												  string_tools::pod_to_hex(m_blockchain[current_index]));
-
-					detach_blockchain(current_index);
-					process_new_blockchain_entry(bl, *blocki, bl_id, current_index, o_indices[b + i]);
-				}
-				else
-				{
-					LOG_PRINT_L2("Block is already in blockchain: " << string_tools::pod_to_hex(bl_id));
-				}
-				++current_index;
-				++blocki;
-			}
+			process_new_blockchain_entry(pb, current_index, o_indices[i]);
+			++blocks_added;
 		}
-	}
-	else
-	{
-		for(auto &bl_entry : blocks)
+		else if(pb.hash != m_blockchain[current_index])
 		{
-			cryptonote::block bl;
-			bool r = cryptonote::parse_and_validate_block_from_blob(bl_entry.block, bl);
-			THROW_WALLET_EXCEPTION_IF(!r, error::block_parse_error, bl_entry.block);
-
-			crypto::hash bl_id = get_block_hash(bl);
-			if(current_index >= m_blockchain.size())
-			{
-				process_new_blockchain_entry(bl, bl_entry, bl_id, current_index, o_indices[tx_o_indices_idx]);
-				++blocks_added;
-			}
-			else if(bl_id != m_blockchain[current_index])
-			{
-				//split detected here !!!
-				THROW_WALLET_EXCEPTION_IF(current_index == start_height, error::wallet_internal_error,
-										  "wrong daemon response: split starts from the first block in response " + string_tools::pod_to_hex(bl_id) +
-											  " (height " + std::to_string(start_height) + "), local block id at this height: " +
-											  string_tools::pod_to_hex(m_blockchain[current_index]));
+			//split detected here !!!
+			THROW_WALLET_EXCEPTION_IF(current_index == start_height, error::wallet_internal_error,
+									  "wrong daemon response: split starts from the first block in response " + string_tools::pod_to_hex(pb.hash) +
+										  " (height " + std::to_string(start_height) + "), local block id at this height: " +
+										  string_tools::pod_to_hex(m_blockchain[current_index]));
 
-				detach_blockchain(current_index);
-				process_new_blockchain_entry(bl, bl_entry, bl_id, current_index, o_indices[tx_o_indices_idx]);
-			}
-			else
-			{
-				LOG_PRINT_L2("Block is already in blockchain: " << string_tools::pod_to_hex(bl_id));
-			}
-
-			++current_index;
-			++tx_o_indices_idx;
+			detach_blockchain(current_index);
+			process_new_blockchain_entry(pb, current_index, o_indices[i]);
 		}
+		else
+		{
+			LOG_PRINT_L2("Block is already in blockchain: " << string_tools::pod_to_hex(pb.hash));
+		}
+		++current_index;
 	}
 }
 //----------------------------------------------------------------------------------------------------
@@ -1897,35 +2109,68 @@ void wallet2::remove_obsolete_pool_txs(const std::vector<crypto::hash> &tx_hashe
 }
 
 //----------------------------------------------------------------------------------------------------
-void wallet2::update_pool_state(bool refreshed)
+bool wallet2::update_pool_hashes()
 {
-	MDEBUG("update_pool_state start");
+	uint32_t rpc_version;
+	boost::optional<std::string> result = m_node_rpc_proxy.get_rpc_version(rpc_version);
+	if(!!result || rpc_version < MAKE_CORE_RPC_VERSION(1, 22))
+		return false;
 
-	// get the pool state
-	cryptonote::COMMAND_RPC_GET_TRANSACTION_POOL_HASHES::request req;
-	cryptonote::COMMAND_RPC_GET_TRANSACTION_POOL_HASHES::response res;
+	cryptonote::COMMAND_RPC_GET_TRANSACTION_POOL_CHANGES::request req;
+	cryptonote::COMMAND_RPC_GET_TRANSACTION_POOL_CHANGES::response res;
+	req.revision = m_pool_revision;
 	m_daemon_rpc_mutex.lock();
-	bool r = epee::net_utils::invoke_http_json("/get_transaction_pool_hashes.bin", req, res, m_http_client, rpc_timeout);
+	bool r = epee::net_utils::invoke_http_json("/get_transaction_pool_changes.bin", req, res, m_http_client, rpc_timeout);
 	m_daemon_rpc_mutex.unlock();
-	THROW_WALLET_EXCEPTION_IF(!r, error::no_connection_to_daemon, "get_transaction_pool_hashes.bin");
-	THROW_WALLET_EXCEPTION_IF(res.status == CORE_RPC_STATUS_BUSY, error::daemon_busy, "get_transaction_pool_hashes.bin");
+	THROW_WALLET_EXCEPTION_IF(!r, error::no_connection_to_daemon, "get_transaction_pool_changes.bin");
+	THROW_WALLET_EXCEPTION_IF(res.status == CORE_RPC_STATUS_BUSY, error::daemon_busy, "get_transaction_pool_changes.bin");
 	THROW_WALLET_EXCEPTION_IF(res.status != CORE_RPC_STATUS_OK, error::get_tx_pool_error);
+
+	if(res.full)
+	{
+		MDEBUG("Daemon sent the whole pool, " << res.added_tx_hashes.size() << " txes at revision " << res.revision);
+		m_pool_hashes.clear();
+	}
+	for(const crypto::hash &txid : res.removed_tx_hashes)
+		m_pool_hashes.erase(txid);
+	m_pool_hashes.insert(res.added_tx_hashes.begin(), res.added_tx_hashes.end());
+	m_pool_revision = res.revision;
+	return true;
+}
+//----------------------------------------------------------------------------------------------------
+void wallet2::update_pool_state(bool refreshed)
+{
+	MDEBUG("update_pool_state start");
+
+	// get the pool state, as the changes since we last looked if the daemon keeps them
+	std::vector<crypto::hash> tx_hashes;
+	if(update_pool_hashes())
+	{
+		tx_hashes.assign(m_pool_hashes.begin(), m_pool_hashes.end());
+	}
+	else
+	{
+		cryptonote::COMMAND_RPC_GET_TRANSACTION_POOL_HASHES::request req;
+		cryptonote::COMMAND_RPC_GET_TRANSACTION_POOL_HASHES::response res;
+		m_daemon_rpc_mutex.lock();
+		bool r = epee::net_utils::invoke_http_json("/get_transaction_pool_hashes.bin", req, res, m_http_client, rpc_timeout);
+		m_daemon_rpc_mutex.unlock();
+		THROW_WALLET_EXCEPTION_IF(!r, error::no_connection_to_daemon, "get_transaction_pool_hashes.bin");
+		THROW_WALLET_EXCEPTION_IF(res.status == CORE_RPC_STATUS_BUSY, error::daemon_busy, "get_transaction_pool_hashes.bin");
+		THROW_WALLET_EXCEPTION_IF(res.status != CORE_RPC_STATUS_OK, error::get_tx_pool_error);
+		tx_hashes = std::move(res.tx_hashes);
+		m_pool_hashes.clear();
+		m_pool_revision = 0;
+	}
 	MDEBUG("update_pool_state got pool");
 
 	// remove any pending tx that's not in the pool
+	const std::unordered_set<crypto::hash> pool_hashes(tx_hashes.begin(), tx_hashes.end());
 	std::unordered_map<crypto::hash, wallet2::unconfirmed_transfer_details>::iterator it = m_unconfirmed_txs.begin();
 	while(it != m_unconfirmed_txs.end())
 	{
 		const crypto::hash &txid = it->first;
-		bool found = false;
-		for(const auto &it2 : res.tx_hashes)
-		{
-			if(it2 == txid)
-			{
-				found = true;
-				break;
-			}
-		}
+		bool found = pool_hashes.count(txid) > 0;
 		auto pit = it++;
 		if(!found)
 		{
@@ -1974,13 +2219,13 @@ void wallet2::update_pool_state(bool refreshed)
 	// the in transfers list instead (or nowhere if it just
 	// disappeared without being mined)
 	if(refreshed)
-		remove_obsolete_pool_txs(res.tx_hashes);
+		remove_obsolete_pool_txs(tx_hashes);
 
 	MDEBUG("update_pool_state done second loop");
 
 	// gather txids of new pool txes to us
 	std::vector<std::pair<crypto::hash, bool>> txids;
-	for(const auto &txid : res.tx_hashes)
+	for(const auto &txid : tx_hashes)
 	{
 		bool txid_found_in_up = false;
 		for(const auto &up : m_unconfirmed_payments)
@@ -2334,6 +2579,18 @@ bool wallet2::refresh(uint64_t &blocks_fetched, bool &received_money, bool &ok)
 //----------------------------------------------------------------------------------------------------
 bool wallet2::get_output_distribution(uint64_t &start_height, std::vector<uint64_t> &distribution)
 {
+	// the cached copy is only good while the block it ends at is still ours,
+	// blocks trimmed off the hashchain are below the checkpoints and can't go
+	if(!m_rct_distribution.empty())
+	{
+		const uint64_t top = m_rct_distribution_start + m_rct_distribution.size() - 1;
+		if(top >= m_blockchain.size() || (m_blockchain.is_in_bounds(top) && m_blockchain[top] != m_rct_distribution_top))
+		{
+			MDEBUG("Cached rct distribution ends at block " << top << ", which is no longer in our chain, dropping it");
+			clear_output_distribution_cache();
+		}
+	}
+
 	uint32_t rpc_version;
 	boost::optional<std::string> result = m_node_rpc_proxy.get_rpc_version(rpc_version);
 	// no error
@@ -2364,7 +2621,8 @@ bool wallet2::get_output_distribution(uint64_t &start_height, std::vector<uint64
 	cryptonote::COMMAND_RPC_GET_OUTPUT_DISTRIBUTION::request req = AUTO_VAL_INIT(req);
 	cryptonote::COMMAND_RPC_GET_OUTPUT_DISTRIBUTION::response res = AUTO_VAL_INIT(res);
 	req.amounts.push_back(0);
-	req.from_height = 0;
+	// ask from the last cached block so the overlap tells us the daemon agrees with the cache
+	req.from_height = m_rct_distribution.empty() ? 0 : m_rct_distribution_start + m_rct_distribution.size() - 1;
 	req.cumulative = true;
 	m_daemon_rpc_mutex.lock();
 	bool r = net_utils::invoke_http_json_rpc("/json_rpc", "get_output_distribution", req, res, m_http_client, rpc_timeout);
@@ -2394,11 +2652,47 @@ bool wallet2::get_output_distribution(uint64_t &start_height, std::vector<uint64
 		MWARNING("Failed to request output distribution: results are not for amount 0");
 		return false;
 	}
-	start_height = res.distributions[0].start_height;
-	distribution = std::move(res.distributions[0].distribution);
+
+	std::vector<uint64_t> &fetched = res.distributions[0].distribution;
+	if(!m_rct_distribution.empty())
+	{
+		if(res.distributions[0].start_height != req.from_height || fetched.empty() || fetched.front() != m_rct_distribution.back())
+		{
+			MDEBUG("Daemon rct distribution does not extend our cached copy, refetching it all");
+			clear_output_distribution_cache();
+			return get_output_distribution(start_height, distribution);
+		}
+		start_height = m_rct_distribution_start;
+		distribution = m_rct_distribution;
+		distribution.insert(distribution.end(), fetched.begin() + 1, fetched.end());
+	}
+	else
+	{
+		start_height = res.distributions[0].start_height;
+		distribution = std::move(fetched);
+	}
+
+	// keep what is deep enough in our own chain not to be reorganized away on the next call
+	if(!distribution.empty() && m_blockchain.size() > start_height + OUTPUT_DISTRIBUTION_CACHE_DEPTH)
+	{
+		const uint64_t top = std::min<uint64_t>(start_height + distribution.size(), m_blockchain.size() - OUTPUT_DISTRIBUTION_CACHE_DEPTH) - 1;
+		if(m_blockchain.is_in_bounds(top) && top + 1 > m_rct_distribution_start + m_rct_distribution.size())
+		{
+			m_rct_distribution_start = start_height;
+			m_rct_distribution.assign(distribution.begin(), distribution.begin() + (top - start_height + 1));
+			m_rct_distribution_top = m_blockchain[top];
+		}
+	}
 	return true;
 }
 //----------------------------------------------------------------------------------------------------
+void wallet2::clear_output_distribution_cache()
+{
+	m_rct_distribution_start = 0;
+	m_rct_distribution.clear();
+	m_rct_distribution_top = crypto::null_hash;
+}
+//----------------------------------------------------------------------------------------------------
 void wallet2::detach_blockchain(uint64_t height)
 {
 	LOG_PRINT_L0("Detaching blockchain on height " << height);
@@ -2439,26 +2733,49 @@ void wallet2::detach_blockchain(uint64_t height)
 		THROW_WALLET_EXCEPTION_IF(it_pk == m_pub_keys.end(), error::wallet_internal_error, "public key not found");
 		m_pub_keys.erase(it_pk);
 	}
+	for(size_t i = i_start; i != m_transfers.size(); i++)
+		unindex_transfer(i);
 	m_transfers.erase(it, m_transfers.end());
 
 	size_t blocks_detached = m_blockchain.size() - height;
 	m_blockchain.crop(height);
 	m_local_bc_height -= blocks_detached;
 
-	for(auto it = m_payments.begin(); it != m_payments.end();)
+	// payments and outgoing txs are found by height, not by scanning them all
+	std::vector<const payment_container::value_type *> detached_payments;
+	for(auto it = m_payments_by_height.lower_bound(height); it != m_payments_by_height.end(); ++it)
+		detached_payments.push_back(it->second);
+	for(const auto *payment : detached_payments)
 	{
-		if(height <= it->second.m_block_height)
-			it = m_payments.erase(it);
-		else
-			++it;
+		auto range = m_payments.equal_range(payment->first);
+		for(auto i = range.first; i != range.second; ++i)
+		{
+			if(&*i == payment)
+			{
+				unindex_payment(*i);
+				m_payments.erase(i);
+				break;
+			}
+		}
+	}
+
+	std::vector<crypto::hash> detached_txs;
+	for(auto it = m_confirmed_txs_by_height.lower_bound(height); it != m_confirmed_txs_by_height.end(); ++it)
+		detached_txs.push_back(it->second->first);
+	for(const crypto::hash &txid : detached_txs)
+	{
+		auto i = m_confirmed_txs.find(txid);
+		unindex_confirmed_tx(*i);
+		m_confirmed_txs.erase(i);
 	}
 
-	for(auto it = m_confirmed_txs.begin(); it != m_confirmed_txs.end();)
+	// a spend confirmed at or above the split may have been in one of the detached blocks
+	for(auto i = m_confirmed_spent_key_images.begin(); i != m_confirmed_spent_key_images.end();)
 	{
-		if(height <= it->second.m_block_height)
-			it = m_confirmed_txs.erase(it);
+		if(i->second >= height)
+			i = m_confirmed_spent_key_images.erase(i);
 		else
-			++it;
+			++i;
 	}
 
 	LOG_PRINT_L0("Detached blockchain on height " << height << ", transfers detached " << transfers_detached << ", blocks detached " << blocks_detached);
@@ -2475,7 +2792,13 @@ bool wallet2::clear()
 	m_blockchain.clear();
 	m_transfers.clear();
 	m_key_images.clear();
+	m_confirmed_spent_key_images.clear();
 	m_pub_keys.clear();
+	m_unspent_balances.clear();
+	m_transfers_by_unlock_height.clear();
+	m_payments_by_height.clear();
+	m_confirmed_txs_by_height.clear();
+	reset_transfer_events();
 	m_unconfirmed_txs.clear();
 	m_payments.clear();
 	m_tx_keys.clear();
@@ -2488,6 +2811,7 @@ bool wallet2::clear()
 	m_local_bc_height = 1;
 	m_subaddresses.clear();
 	m_subaddress_labels.clear();
+	clear_output_distribution_cache();
 	return true;
 }
 
@@ -3928,6 +4252,7 @@ void wallet2::load(const std::string &wallet_, const epee::wipeable_string &pass
 		add_subaddress_account(tr("Primary account"));
 
 	m_local_bc_height = m_blockchain.size();
+	rebuild_indices();
 
 	try
 	{
@@ -4128,16 +4453,11 @@ uint64_t wallet2::unlocked_balance(uint32_t index_major) const
 std::map<uint32_t, uint64_t> wallet2::balance_per_subaddress(uint32_t index_major) const
 {
 	std::map<uint32_t, uint64_t> amount_per_subaddr;
-	for(const auto &td : m_transfers)
+	auto balances = m_unspent_balances.find(index_major);
+	if(balances != m_unspent_balances.end())
 	{
-		if(td.m_subaddr_index.major == index_major && !td.m_spent)
-		{
-			auto found = amount_per_subaddr.find(td.m_subaddr_index.minor);
-			if(found == amount_per_subaddr.end())
-				amount_per_subaddr[td.m_subaddr_index.minor] = td.amount();
-			else
-				found->second += td.amount();
-		}
+		for(const auto &balance : balances->second)
+			amount_per_subaddr[balance.first] = balance.second.amount;
 	}
 	for(const auto &utx : m_unconfirmed_txs)
 	{
@@ -4157,17 +4477,32 @@ std::map<uint32_t, uint64_t> wallet2::balance_per_subaddress(uint32_t index_majo
 std::map<uint32_t, uint64_t> wallet2::unlocked_balance_per_subaddress(uint32_t index_major) const
 {
 	std::map<uint32_t, uint64_t> amount_per_subaddr;
-	for(const transfer_details &td : m_transfers)
+	auto balances = m_unspent_balances.find(index_major);
+	if(balances == m_unspent_balances.end())
+		return amount_per_subaddr;
+
+	// take away what is still locked, only the transfers past the current
+	// height need to be looked at
+	std::map<uint32_t, subaddress_balance> locked;
+	for(auto it = m_transfers_by_unlock_height.upper_bound(std::make_pair((uint64_t)m_local_bc_height, std::numeric_limits<size_t>::max())); it != m_transfers_by_unlock_height.end(); ++it)
 	{
-		if(td.m_subaddr_index.major == index_major && !td.m_spent && is_transfer_unlocked(td))
+		const transfer_details &td = m_transfers[it->second];
+		if(td.m_subaddr_index.major == index_major && !td.m_spent)
 		{
-			auto found = amount_per_subaddr.find(td.m_subaddr_index.minor);
-			if(found == amount_per_subaddr.end())
-				amount_per_subaddr[td.m_subaddr_index.minor] = td.amount();
-			else
-				found->second += td.amount();
+			subaddress_balance &balance = locked[td.m_subaddr_index.minor];
+			balance.amount += td.amount();
+			++balance.count;
 		}
 	}
+
+	for(const auto &balance : balances->second)
+	{
+		auto found = locked.find(balance.first);
+		if(found == locked.end())
+			amount_per_subaddr[balance.first] = balance.second.amount;
+		else if(found->second.count < balance.second.count)
+			amount_per_subaddr[balance.first] = balance.second.amount - found->second.amount;
+	}
 	return amount_per_subaddr;
 }
 //----------------------------------------------------------------------------------------------------
@@ -4207,10 +4542,12 @@ void wallet2::get_payments(const crypto::uniform_payment_id &payment_id, std::li
 //----------------------------------------------------------------------------------------------------
 void wallet2::get_payments(std::list<std::pair<crypto::hash, wallet2::payment_details>> &payments, uint64_t min_height, uint64_t max_height, const boost::optional<uint32_t> &subaddr_account, const std::set<uint32_t> &subaddr_indices) const
 {
-	auto range = std::make_pair(m_payments.begin(), m_payments.end());
-	std::for_each(range.first, range.second, [&payments, &min_height, &max_height, &subaddr_account, &subaddr_indices](const payment_container::value_type &x) {
-		if(min_height < x.second.m_block_height && max_height >= x.second.m_block_height &&
-		   (!subaddr_account || *subaddr_account == x.second.m_subaddr_index.major) &&
+	if(min_height >= max_height)
+		return;
+	auto range = std::make_pair(m_payments_by_height.upper_bound(min_height), m_payments_by_height.upper_bound(max_height));
+	std::for_each(range.first, range.second, [&payments, &subaddr_account, &subaddr_indices](const std::pair<const uint64_t, const payment_container::value_type *> &i) {
+		const payment_container::value_type &x = *i.second;
+		if((!subaddr_account || *subaddr_account == x.second.m_subaddr_index.major) &&
 		   (subaddr_indices.empty() || subaddr_indices.count(x.second.m_subaddr_index.minor) == 1))
 		{
 			payments.push_back(x);
@@ -4221,10 +4558,12 @@ void wallet2::get_payments(std::list<std::pair<crypto::hash, wallet2::payment_de
 void wallet2::get_payments_out(std::list<std::pair<crypto::hash, wallet2::confirmed_transfer_details>> &confirmed_payments,
 							   uint64_t min_height, uint64_t max_height, const boost::optional<uint32_t> &subaddr_account, const std::set<uint32_t> &subaddr_indices) const
 {
-	for(auto i = m_confirmed_txs.begin(); i != m_confirmed_txs.end(); ++i)
+	if(min_height >= max_height)
+		return;
+	auto end = m_confirmed_txs_by_height.upper_bound(max_height);
+	for(auto it = m_confirmed_txs_by_height.upper_bound(min_height); it != end; ++it)
 	{
-		if(i->second.m_block_height <= min_height || i->second.m_block_height > max_height)
-			continue;
+		const auto *i = it->second;
 		if(subaddr_account && *subaddr_account != i->second.m_subaddr_account)
 			continue;
 		if(!subaddr_indices.empty() && std::count_if(i->second.m_subaddr_indices.begin(), i->second.m_subaddr_indices.end(), [&subaddr_indices](uint32_t index) { return subaddr_indices.count(index) == 1; }) == 0)
@@ -4282,6 +4621,9 @@ void wallet2::rescan_spent()
 		std::copy(daemon_resp.spent_status.begin(), daemon_resp.spent_status.end(), std::back_inserter(spent_status));
 	}
 
+	// the daemon's view replaces whatever spends import_key_images saw confirmed
+	m_confirmed_spent_key_images.clear();
+
 	// update spent status
 	for(size_t i = 0; i < m_transfers.size(); ++i)
 	{
@@ -4310,6 +4652,7 @@ void wallet2::rescan_spent()
 void wallet2::rescan_blockchain(bool refresh)
 {
 	clear();
+	m_confirmed_spent_key_images.clear();
 
 	cryptonote::block genesis;
 	generate_genesis(genesis);
@@ -5412,6 +5755,20 @@ bool wallet2::add_rings(const crypto::chacha_key &key, const cryptonote::transac
 	}
 }
 
+bool wallet2::add_rings(const crypto::chacha_key &key, const std::vector<const cryptonote::transaction_prefix *> &txes)
+{
+	if(!m_ringdb)
+		return false;
+	try
+	{
+		return m_ringdb->add_rings(key, txes);
+	}
+	catch(const std::exception &e)
+	{
+		return false;
+	}
+}
+
 bool wallet2::add_rings(const cryptonote::transaction_prefix &tx)
 {
 	crypto::chacha_key key;
@@ -5456,6 +5813,20 @@ bool wallet2::get_ring(const crypto::chacha_key &key, const crypto::key_image &k
 	}
 }
 
+bool wallet2::get_rings(const crypto::chacha_key &key, const std::vector<crypto::key_image> &key_images, std::vector<std::vector<uint64_t>> &outs)
+{
+	if(!m_ringdb)
+		return false;
+	try
+	{
+		return m_ringdb->get_rings(key, key_images, outs);
+	}
+	catch(const std::exception &e)
+	{
+		return false;
+	}
+}
+
 bool wallet2::get_rings(const crypto::hash &txid, std::vector<std::pair<crypto::key_image, std::vector<uint64_t>>> &outs)
 {
 	for(auto i : m_confirmed_txs)
@@ -5564,6 +5935,9 @@ bool wallet2::find_and_save_rings(bool force)
 		MDEBUG("Scanning " << res.txs.size() << " transactions");
 		THROW_WALLET_EXCEPTION_IF(slice + res.txs.size() > txs_hashes.size(), error::wallet_internal_error, "Unexpected tx array size");
 		auto it = req.txs_hashes.begin();
+		std::vector<cryptonote::transaction> txes(res.txs.size());
+		std::vector<const cryptonote::transaction_prefix *> tx_prefixes;
+		tx_prefixes.reserve(res.txs.size());
 		for(size_t i = 0; i < res.txs.size(); ++i, ++it)
 		{
 			const auto &tx_info = res.txs[i];
@@ -5571,12 +5945,13 @@ bool wallet2::find_and_save_rings(bool force)
 			THROW_WALLET_EXCEPTION_IF(tx_info.tx_hash != *it, error::wallet_internal_error, "Wrong txid received");
 			cryptonote::blobdata bd;
 			THROW_WALLET_EXCEPTION_IF(!epee::string_tools::parse_hexstr_to_binbuff(tx_info.as_hex, bd), error::wallet_internal_error, "failed to parse tx from hexstr");
-			cryptonote::transaction tx;
+			cryptonote::transaction &tx = txes[i];
 			crypto::hash tx_hash, tx_prefix_hash;
 			THROW_WALLET_EXCEPTION_IF(!cryptonote::parse_and_validate_tx_from_blob(bd, tx, tx_hash, tx_prefix_hash), error::wallet_internal_error, "failed to parse tx from blob");
 			THROW_WALLET_EXCEPTION_IF(epee::string_tools::pod_to_hex(tx_hash) != tx_info.tx_hash, error::wallet_internal_error, "txid mismatch");
-			THROW_WALLET_EXCEPTION_IF(!add_rings(key, tx), error::wallet_internal_error, "Failed to save ring");
+			tx_prefixes.push_back(&tx);
 		}
+		THROW_WALLET_EXCEPTION_IF(!add_rings(key, tx_prefixes), error::wallet_internal_error, "Failed to save rings");
 	}
 
 	MINFO("Found and saved rings for " << txs_hashes.size() << " transactions");
@@ -5607,8 +5982,7 @@ bool wallet2::set_blackballed_outputs(const std::vector<crypto::public_key> &out
 		bool ret = true;
 		if(!add)
 			ret &= m_ringdb->clear_blackballs();
-		for(const auto &output : outputs)
-			ret &= m_ringdb->blackball(output);
+		ret &= m_ringdb->blackball(outputs);
 		return ret;
 	}
 	catch(const std::exception &e)
@@ -5661,7 +6035,214 @@ bool wallet2::tx_add_fake_output(std::vector<std::vector<tools::wallet2::get_out
 	return true;
 }
 
+void wallet2::get_outs_context(outs_context &ctx, const std::vector<size_t> &transfers)
+{
+	ctx.segregation_fork_height = get_segregation_fork_height();
+	// check whether we're shortly after the fork
+	uint64_t height;
+	boost::optional<std::string> result = m_node_rpc_proxy.get_height(height);
+	throw_on_rpc_response_error(result, "get_info");
+	ctx.is_shortly_after_segregation_fork = height >= ctx.segregation_fork_height && height < ctx.segregation_fork_height + SEGREGATION_FORK_VICINITY;
+	ctx.is_after_segregation_fork = height >= ctx.segregation_fork_height;
+
+	std::vector<uint64_t> amounts;
+	for(size_t idx : transfers)
+		amounts.push_back(m_transfers[idx].is_rct() ? 0 : m_transfers[idx].amount());
+	std::sort(amounts.begin(), amounts.end());
+	amounts.erase(std::unique(amounts.begin(), amounts.end()), amounts.end());
+
+	// get histogram for the amounts we need
+	cryptonote::COMMAND_RPC_GET_OUTPUT_HISTOGRAM::request req_t = AUTO_VAL_INIT(req_t);
+	cryptonote::COMMAND_RPC_GET_OUTPUT_HISTOGRAM::response resp_t = AUTO_VAL_INIT(resp_t);
+	req_t.amounts = amounts;
+	req_t.unlocked = true;
+	req_t.recent_cutoff = time(NULL) - RECENT_OUTPUT_ZONE;
+	m_daemon_rpc_mutex.lock();
+	bool r = net_utils::invoke_http_json_rpc("/json_rpc", "get_output_histogram", req_t, resp_t, m_http_client, rpc_timeout);
+	m_daemon_rpc_mutex.unlock();
+	THROW_WALLET_EXCEPTION_IF(!r, error::no_connection_to_daemon, "transfer_selected");
+	THROW_WALLET_EXCEPTION_IF(resp_t.status == CORE_RPC_STATUS_BUSY, error::daemon_busy, "get_output_histogram");
+	THROW_WALLET_EXCEPTION_IF(resp_t.status != CORE_RPC_STATUS_OK, error::get_histogram_error, resp_t.status);
+	ctx.histogram = std::move(resp_t.histogram);
+
+	// if we want to segregate fake outs pre or post fork, get distribution
+	ctx.segregation_limit.clear();
+	if(!ctx.is_after_segregation_fork || !(m_segregate_pre_fork_outputs || m_key_reuse_mitigation2))
+		return;
+
+	THROW_WALLET_EXCEPTION_IF(ctx.segregation_fork_height <= RECENT_OUTPUT_BLOCKS, error::wallet_internal_error, "Fork height too low");
+	auto set_segregation_limit = [&ctx](uint64_t amount, uint64_t start_height, const std::vector<uint64_t> &distribution) {
+		const uint64_t segregation_fork_height = ctx.segregation_fork_height;
+		THROW_WALLET_EXCEPTION_IF(start_height > segregation_fork_height, error::get_output_distribution, "Distribution start_height too high");
+		THROW_WALLET_EXCEPTION_IF(segregation_fork_height - start_height >= distribution.size(), error::get_output_distribution, "Distribution size too small");
+		THROW_WALLET_EXCEPTION_IF(segregation_fork_height - RECENT_OUTPUT_BLOCKS - start_height >= distribution.size(), error::get_output_distribution, "Distribution size too small");
+		THROW_WALLET_EXCEPTION_IF(segregation_fork_height - RECENT_OUTPUT_BLOCKS < start_height, error::get_output_distribution, "Bad start height");
+		uint64_t till_fork = distribution[segregation_fork_height - start_height];
+		uint64_t recent = till_fork - distribution[segregation_fork_height - RECENT_OUTPUT_BLOCKS - start_height];
+		ctx.segregation_limit[amount] = std::make_pair(till_fork, recent);
+	};
+
+	// rct outputs come from the local distribution cache, only pre rct amounts need asking for
+	uint64_t rct_start_height;
+	std::vector<uint64_t> rct_distribution;
+	if(!amounts.empty() && amounts.front() == 0 && get_output_distribution(rct_start_height, rct_distribution) &&
+	   rct_start_height <= ctx.segregation_fork_height - RECENT_OUTPUT_BLOCKS && ctx.segregation_fork_height - rct_start_height < rct_distribution.size())
+	{
+		set_segregation_limit(0, rct_start_height, rct_distribution);
+		amounts.erase(amounts.begin());
+	}
+	if(amounts.empty())
+		return;
+
+	cryptonote::COMMAND_RPC_GET_OUTPUT_DISTRIBUTION::request req_d = AUTO_VAL_INIT(req_d);
+	cryptonote::COMMAND_RPC_GET_OUTPUT_DISTRIBUTION::response resp_d = AUTO_VAL_INIT(resp_d);
+	req_d.amounts = amounts;
+	req_d.from_height = std::max<uint64_t>(ctx.segregation_fork_height, RECENT_OUTPUT_BLOCKS) - RECENT_OUTPUT_BLOCKS;
+	req_d.to_height = ctx.segregation_fork_height + 1;
+	req_d.cumulative = true;
+	m_daemon_rpc_mutex.lock();
+	r = net_utils::invoke_http_json_rpc("/json_rpc", "get_output_distribution", req_d, resp_d, m_http_client, rpc_timeout * 1000);
+	m_daemon_rpc_mutex.unlock();
+	THROW_WALLET_EXCEPTION_IF(!r, error::no_connection_to_daemon, "transfer_selected");
+	THROW_WALLET_EXCEPTION_IF(resp_d.status == CORE_RPC_STATUS_BUSY, error::daemon_busy, "get_output_distribution");
+	THROW_WALLET_EXCEPTION_IF(resp_d.status != CORE_RPC_STATUS_OK, error::get_output_distribution, resp_d.status);
+
+	// check we got all data
+	for(uint64_t amount : amounts)
+	{
+		bool found = false;
+		for(const auto &d : resp_d.distributions)
+		{
+			if(d.amount == amount)
+			{
+				set_segregation_limit(amount, d.start_height, d.distribution);
+				found = true;
+				break;
+			}
+		}
+		THROW_WALLET_EXCEPTION_IF(!found, error::get_output_distribution, "Requested amount not found in response");
+	}
+}
+//----------------------------------------------------------------------------------------------------
 void wallet2::get_outs(std::vector<std::vector<tools::wallet2::get_outs_entry>> &outs, const std::vector<size_t> &selected_transfers, size_t fake_outputs_count)
+{
+	outs_context ctx;
+	if(fake_outputs_count > 0)
+		get_outs_context(ctx, selected_transfers);
+	get_outs(outs, selected_transfers, fake_outputs_count, ctx);
+}
+//----------------------------------------------------------------------------------------------------
+// The number of outputs get_outs asks the daemon for to pick one input's ring from
+static size_t get_outs_requested_count(const tools::wallet2::transfer_details &td, size_t fake_outputs_count)
+{
+	// we ask for more, to have spares if some outputs are still locked
+	size_t count = (size_t)((fake_outputs_count + 1) * 1.5 + 1);
+	// request more for rct in base recent (locked) coinbases are picked, since they're locked for longer
+	if(td.is_rct())
+		count += CRYPTONOTE_MINED_MONEY_UNLOCK_WINDOW - CRYPTONOTE_DEFAULT_TX_SPENDABLE_AGE;
+	return count;
+}
+//----------------------------------------------------------------------------------------------------
+uint64_t wallet2::get_ring_output_count(const transfer_details &td, const outs_context &ctx) const
+{
+	// how many outputs of the amount a ring for td can pick from, no ring member is past that
+	const uint64_t amount = td.is_rct() ? 0 : td.amount();
+	uint64_t num_outs = td.m_global_output_index + 1;
+	for(const auto &he : ctx.histogram)
+	{
+		if(he.amount == amount)
+		{
+			num_outs = std::max(num_outs, he.total_instances);
+			break;
+		}
+	}
+	return num_outs;
+}
+//----------------------------------------------------------------------------------------------------
+size_t wallet2::estimate_tx_size_upper_bound(const std::vector<size_t> &selected_transfers, const std::vector<cryptonote::tx_destination_entry> &dsts, size_t fake_outputs_count, uint64_t unlock_time, bool bulletproof, const outs_context &ctx) const
+{
+	// The largest a transaction spending selected_transfers to dsts can encode to, whatever
+	// rings and change it gets, so that a fee paid for this size is never short.
+	const size_t n_inputs = selected_transfers.size();
+	const size_t n_outputs = dsts.size() + 1; // and change
+	const bool to_subaddress = std::any_of(dsts.begin(), dsts.end(), [](const cryptonote::tx_destination_entry &d) { return d.is_subaddress; });
+
+	size_t size = 0;
+
+	// version, unlock time, vin and vout counts
+	size += 1 + varint_size(unlock_time) + varint_size(n_inputs) + varint_size(n_outputs);
+
+	// vin, every relative offset is below the number of outputs the ring picks from
+	for(size_t idx : selected_transfers)
+	{
+		const transfer_details &td = m_transfers[idx];
+		const size_t offset_size = fake_outputs_count > 0 ? varint_size(get_ring_output_count(td, ctx)) : varint_size(td.m_global_output_index);
+		size += 1 + varint_size(td.is_rct() ? 0 : td.amount()) + varint_size(fake_outputs_count + 1) + (fake_outputs_count + 1) * offset_size + 32;
+	}
+
+	// vout, rct amounts are 0
+	size += n_outputs * (1 + 1 + 32);
+
+	// extra, tx pubkey, a payment id (a uniform one is longer than a legacy nonce) and
+	// a pubkey per output when sending to subaddresses
+	size_t extra_size = 1 + 32 + 1 + sizeof(crypto::uniform_payment_id);
+	if(to_subaddress)
+		extra_size += 1 + varint_size(n_outputs) + 32 * n_outputs;
+	size += varint_size(extra_size) + extra_size;
+
+	// rct base, type, fee, ecdhInfo, outPk
+	size += 1 + varint_size(std::numeric_limits<uint64_t>::max()) + n_outputs * (64 + 32);
+
+	// range proofs, one bulletproof aggregated over all outputs
+	if(bulletproof)
+	{
+		size_t log_m = 0;
+		while(((size_t)1 << log_m) < n_outputs)
+			++log_m;
+		const size_t lr_size = 6 + log_m;
+		size += 4 + 9 * 32 + 2 * (varint_size(lr_size) + lr_size * 32);
+	}
+	else
+		size += (2 * 64 * 32 + 32 + 64 * 32) * n_outputs;
+
+	// MGs and pseudoOuts
+	size += n_inputs * ((fake_outputs_count + 1) * 2 * 32 + 32) + 32 * n_inputs;
+
+	return size;
+}
+//----------------------------------------------------------------------------------------------------
+void wallet2::get_placeholder_outs(std::vector<std::vector<tools::wallet2::get_outs_entry>> &outs, const std::vector<size_t> &selected_transfers, size_t fake_outputs_count, const outs_context &ctx) const
+{
+	// Rings of the right size for sizing a transaction before its real ring members are
+	// known. Real members are all below the output count, so no relative offset of a real
+	// ring encodes longer than that count does. The placeholder offsets are made at least
+	// that long, the real transaction can then only come out as large or smaller. The
+	// members don't have to exist, and the keys are the real output's own.
+	outs.clear();
+	for(size_t idx : selected_transfers)
+	{
+		const transfer_details &td = m_transfers[idx];
+		const rct::key mask = td.is_rct() ? rct::commit(td.amount(), td.m_mask) : rct::zeroCommit(td.amount());
+		const crypto::public_key key = td.get_public_key();
+
+		// the real output goes first, its absolute index may encode shorter than a real
+		// first member would, the gaps after it make up for that
+		const size_t offset_size = varint_size(get_ring_output_count(td, ctx));
+		size_t shortfall = offset_size - std::min(offset_size, varint_size(td.m_global_output_index));
+		uint64_t index = td.m_global_output_index;
+		outs.push_back(std::vector<get_outs_entry>());
+		outs.back().push_back(std::make_tuple(index, key, mask));
+		while(outs.back().size() < fake_outputs_count + 1)
+		{
+			const size_t gap_size = std::max(offset_size, std::min<size_t>(offset_size + shortfall, 8));
+			shortfall -= gap_size - offset_size;
+			index += (uint64_t)1 << (7 * (gap_size - 1)); // the smallest gap that encodes in gap_size bytes
+			outs.back().push_back(std::make_tuple(index, key, mask));
+		}
+	}
+}
+//----------------------------------------------------------------------------------------------------
+void wallet2::get_outs(std::vector<std::vector<tools::wallet2::get_outs_entry>> &outs, const std::vector<size_t> &selected_transfers, size_t fake_outputs_count, const outs_context &ctx)
 {
 	LOG_PRINT_L2("fake_outputs_count: " << fake_outputs_count);
 	outs.clear();
@@ -5671,80 +6252,29 @@ void wallet2::get_outs(std::vector<std::vector<tools::wallet2::get_outs_entry>>
 
 	if(fake_outputs_count > 0)
 	{
-		uint64_t segregation_fork_height = get_segregation_fork_height();
-		// check whether we're shortly after the fork
-		uint64_t height;
-		boost::optional<std::string> result = m_node_rpc_proxy.get_height(height);
-		throw_on_rpc_response_error(result, "get_info");
-		bool is_shortly_after_segregation_fork = height >= segregation_fork_height && height < segregation_fork_height + SEGREGATION_FORK_VICINITY;
-		bool is_after_segregation_fork = height >= segregation_fork_height;
-
-		// get histogram for the amounts we need
-		cryptonote::COMMAND_RPC_GET_OUTPUT_HISTOGRAM::request req_t = AUTO_VAL_INIT(req_t);
-		cryptonote::COMMAND_RPC_GET_OUTPUT_HISTOGRAM::response resp_t = AUTO_VAL_INIT(resp_t);
-		m_daemon_rpc_mutex.lock();
+		// read the known rings for all selected transfers in one ringdb transaction
+		std::unordered_map<crypto::key_image, std::vector<uint64_t>> known_rings;
+		std::vector<crypto::key_image> key_images;
 		for(size_t idx : selected_transfers)
-			req_t.amounts.push_back(m_transfers[idx].is_rct() ? 0 : m_transfers[idx].amount());
-		std::sort(req_t.amounts.begin(), req_t.amounts.end());
-		auto end = std::unique(req_t.amounts.begin(), req_t.amounts.end());
-		req_t.amounts.resize(std::distance(req_t.amounts.begin(), end));
-		req_t.unlocked = true;
-		req_t.recent_cutoff = time(NULL) - RECENT_OUTPUT_ZONE;
-		bool r = net_utils::invoke_http_json_rpc("/json_rpc", "get_output_histogram", req_t, resp_t, m_http_client, rpc_timeout);
-		m_daemon_rpc_mutex.unlock();
-		THROW_WALLET_EXCEPTION_IF(!r, error::no_connection_to_daemon, "transfer_selected");
-		THROW_WALLET_EXCEPTION_IF(resp_t.status == CORE_RPC_STATUS_BUSY, error::daemon_busy, "get_output_histogram");
-		THROW_WALLET_EXCEPTION_IF(resp_t.status != CORE_RPC_STATUS_OK, error::get_histogram_error, resp_t.status);
-
-		// if we want to segregate fake outs pre or post fork, get distribution
-		std::unordered_map<uint64_t, std::pair<uint64_t, uint64_t>> segregation_limit;
-		if(is_after_segregation_fork && (m_segregate_pre_fork_outputs || m_key_reuse_mitigation2))
-		{
-			cryptonote::COMMAND_RPC_GET_OUTPUT_DISTRIBUTION::request req_t = AUTO_VAL_INIT(req_t);
-			cryptonote::COMMAND_RPC_GET_OUTPUT_DISTRIBUTION::response resp_t = AUTO_VAL_INIT(resp_t);
-			for(size_t idx : selected_transfers)
-				req_t.amounts.push_back(m_transfers[idx].is_rct() ? 0 : m_transfers[idx].amount());
-			std::sort(req_t.amounts.begin(), req_t.amounts.end());
-			auto end = std::unique(req_t.amounts.begin(), req_t.amounts.end());
-			req_t.amounts.resize(std::distance(req_t.amounts.begin(), end));
-			req_t.from_height = std::max<uint64_t>(segregation_fork_height, RECENT_OUTPUT_BLOCKS) - RECENT_OUTPUT_BLOCKS;
-			req_t.to_height = segregation_fork_height + 1;
-			req_t.cumulative = true;
-			m_daemon_rpc_mutex.lock();
-			bool r = net_utils::invoke_http_json_rpc("/json_rpc", "get_output_distribution", req_t, resp_t, m_http_client, rpc_timeout * 1000);
-			m_daemon_rpc_mutex.unlock();
-			THROW_WALLET_EXCEPTION_IF(!r, error::no_connection_to_daemon, "transfer_selected");
-			THROW_WALLET_EXCEPTION_IF(resp_t.status == CORE_RPC_STATUS_BUSY, error::daemon_busy, "get_output_distribution");
-			THROW_WALLET_EXCEPTION_IF(resp_t.status != CORE_RPC_STATUS_OK, error::get_output_distribution, resp_t.status);
-
-			// check we got all data
-			for(size_t idx : selected_transfers)
-			{
-				const uint64_t amount = m_transfers[idx].is_rct() ? 0 : m_transfers[idx].amount();
-				bool found = false;
-				for(const auto &d : resp_t.distributions)
-				{
-					if(d.amount == amount)
-					{
-						THROW_WALLET_EXCEPTION_IF(d.start_height > segregation_fork_height, error::get_output_distribution, "Distribution start_height too high");
-						THROW_WALLET_EXCEPTION_IF(segregation_fork_height - d.start_height >= d.distribution.size(), error::get_output_distribution, "Distribution size too small");
-						THROW_WALLET_EXCEPTION_IF(segregation_fork_height - RECENT_OUTPUT_BLOCKS - d.start_height >= d.distribution.size(), error::get_output_distribution, "Distribution size too small");
-						THROW_WALLET_EXCEPTION_IF(segregation_fork_height <= RECENT_OUTPUT_BLOCKS, error::wallet_internal_error, "Fork height too low");
-						THROW_WALLET_EXCEPTION_IF(segregation_fork_height - RECENT_OUTPUT_BLOCKS < d.start_height, error::get_output_distribution, "Bad start height");
-						uint64_t till_fork = d.distribution[segregation_fork_height - d.start_height];
-						uint64_t recent = till_fork - d.distribution[segregation_fork_height - RECENT_OUTPUT_BLOCKS - d.start_height];
-						segregation_limit[amount] = std::make_pair(till_fork, recent);
-						found = true;
-						break;
-					}
-				}
-				THROW_WALLET_EXCEPTION_IF(!found, error::get_output_distribution, "Requested amount not found in response");
-			}
+		{
+			const transfer_details &td = m_transfers[idx];
+			if(td.m_key_image_known && !td.m_key_image_partial)
+				key_images.push_back(td.m_key_image);
 		}
+		std::vector<std::vector<uint64_t>> rings;
+		if(!key_images.empty() && get_rings(key, key_images, rings))
+		{
+			for(size_t i = 0; i < key_images.size(); ++i)
+				if(!rings[i].empty())
+					known_rings[key_images[i]] = std::move(rings[i]);
+		}
+
+		const uint64_t segregation_fork_height = ctx.segregation_fork_height;
+		const bool is_shortly_after_segregation_fork = ctx.is_shortly_after_segregation_fork;
+		const bool is_after_segregation_fork = ctx.is_after_segregation_fork;
+		std::unordered_map<uint64_t, std::pair<uint64_t, uint64_t>> segregation_limit = ctx.segregation_limit;
+		bool r;
 
-		// we ask for more, to have spares if some outputs are still locked
-		size_t base_requested_outputs_count = (size_t)((fake_outputs_count + 1) * 1.5 + 1);
-		LOG_PRINT_L2("base_requested_outputs_count: " << base_requested_outputs_count);
 
 		// generate output indices to request
 		COMMAND_RPC_GET_OUTPUTS_BIN::request req = AUTO_VAL_INIT(req);
@@ -5757,8 +6287,7 @@ void wallet2::get_outs(std::vector<std::vector<tools::wallet2::get_outs_entry>>
 			const transfer_details &td = m_transfers[idx];
 			const uint64_t amount = td.is_rct() ? 0 : td.amount();
 			std::unordered_set<uint64_t> seen_indices;
-			// request more for rct in base recent (locked) coinbases are picked, since they're locked for longer
-			size_t requested_outputs_count = base_requested_outputs_count + (td.is_rct() ? CRYPTONOTE_MINED_MONEY_UNLOCK_WINDOW - CRYPTONOTE_DEFAULT_TX_SPENDABLE_AGE : 0);
+			size_t requested_outputs_count = get_outs_requested_count(td, fake_outputs_count);
 			size_t start = req.outputs.size();
 
 			const bool output_is_pre_fork = td.m_block_height < segregation_fork_height;
@@ -5776,7 +6305,7 @@ void wallet2::get_outs(std::vector<std::vector<tools::wallet2::get_outs_entry>>
 			{
 				// if there are just enough outputs to mix with, use all of them.
 				// Eventually this should become impossible.
-				for(const auto &he : resp_t.histogram)
+				for(const auto &he : ctx.histogram)
 				{
 					if(he.amount == amount)
 					{
@@ -5843,9 +6372,10 @@ void wallet2::get_outs(std::vector<std::vector<tools::wallet2::get_outs_entry>>
 			bool existing_ring_found = false;
 			if(td.m_key_image_known && !td.m_key_image_partial)
 			{
-				std::vector<uint64_t> ring;
-				if(get_ring(key, td.m_key_image, ring))
+				const auto known_ring = known_rings.find(td.m_key_image);
+				if(known_ring != known_rings.end())
 				{
+					const std::vector<uint64_t> &ring = known_ring->second;
 					MINFO("This output has a known ring, reusing (size " << ring.size() << ")");
 					THROW_WALLET_EXCEPTION_IF(ring.size() > fake_outputs_count + 1, error::wallet_internal_error,
 											  "An output in this transaction was previously spent on another chain with ring size " +
@@ -5992,7 +6522,7 @@ void wallet2::get_outs(std::vector<std::vector<tools::wallet2::get_outs_entry>>
 		for(size_t idx : selected_transfers)
 		{
 			const transfer_details &td = m_transfers[idx];
-			size_t requested_outputs_count = base_requested_outputs_count + (td.is_rct() ? CRYPTONOTE_MINED_MONEY_UNLOCK_WINDOW - CRYPTONOTE_DEFAULT_TX_SPENDABLE_AGE : 0);
+			size_t requested_outputs_count = get_outs_requested_count(td, fake_outputs_count);
 			outs.push_back(std::vector<get_outs_entry>());
 			outs.back().reserve(fake_outputs_count + 1);
 			const rct::key mask = td.is_rct() ? rct::commit(td.amount(), td.m_mask) : rct::zeroCommit(td.amount());
@@ -6003,7 +6533,7 @@ void wallet2::get_outs(std::vector<std::vector<tools::wallet2::get_outs_entry>>
 			if(is_after_segregation_fork && m_segregate_pre_fork_outputs && output_is_pre_fork)
 				num_outs = segregation_limit[amount].first;
 			else
-				for(const auto &he : resp_t.histogram)
+				for(const auto &he : ctx.histogram)
 				{
 					if(he.amount == amount)
 					{
@@ -6036,9 +6566,10 @@ void wallet2::get_outs(std::vector<std::vector<tools::wallet2::get_outs_entry>>
 			bool existing_ring_found = false;
 			if(td.m_key_image_known && !td.m_key_image_partial)
 			{
-				std::vector<uint64_t> ring;
-				if(get_ring(key, td.m_key_image, ring))
+				const auto known_ring = known_rings.find(td.m_key_image);
+				if(known_ring != known_rings.end())
 				{
+					const std::vector<uint64_t> &ring = known_ring->second;
 					for(uint64_t out : ring)
 					{
 						if(out < num_outs)
@@ -6537,7 +7068,7 @@ static uint32_t get_count_above(const std::vector<wallet2::transfer_details> &tr
 // This system allows for sending (almost) the entire balance, since it does
 // not generate spurious change in all txes, thus decreasing the instantaneous
 // usable balance.
-std::vector<wallet2::pending_tx> wallet2::create_transactions_2(std::vector<cryptonote::tx_destination_entry> dsts, const size_t fake_outs_count, const uint64_t unlock_time, uint32_t priority, const crypto::uniform_payment_id* payment_id, uint32_t subaddr_account, std::set<uint32_t> subaddr_indices, bool trusted_daemon)
+std::vector<wallet2::pending_tx> wallet2::create_transactions_2(std::vector<cryptonote::tx_destination_entry> dsts, const size_t fake_outs_count, const uint64_t unlock_time, uint32_t priority, const crypto::uniform_payment_id* payment_id, uint32_t subaddr_account, std::set<uint32_t> subaddr_indices, bool trusted_daemon, bool payout)
 {
 	//ensure device is let in NONE mode in any case
 	hw::device &hwdev = m_account.get_device();
@@ -6693,6 +7224,20 @@ std::vector<wallet2::pending_tx> wallet2::create_transactions_2(std::vector<cryp
 	if(unused_dust_indices_per_subaddr.empty() && unused_transfers_indices_per_subaddr.empty())
 		return std::vector<wallet2::pending_tx>();
 
+	// the daemon is asked once about the amounts of every output we may spend, and rings
+	// are picked for all transactions together once we know which outputs they spend
+	outs_context outs_ctx;
+	if(fake_outs_count > 0)
+	{
+		std::vector<size_t> candidates;
+		candidates.reserve(num_nondust_outputs + num_dust_outputs);
+		for(const auto &i : unused_transfers_indices_per_subaddr)
+			candidates.insert(candidates.end(), i.second.begin(), i.second.end());
+		for(const auto &i : unused_dust_indices_per_subaddr)
+			candidates.insert(candidates.end(), i.second.begin(), i.second.end());
+		get_outs_context(outs_ctx, candidates);
+	}
+
 	// if empty, put dummy entry so that the front can be referenced later in the loop
 	if(unused_dust_indices_per_subaddr.empty())
 		unused_dust_indices_per_subaddr.push_back({});
@@ -6884,7 +7429,9 @@ std::vector<wallet2::pending_tx> wallet2::create_transactions_2(std::vector<cryp
 			cryptonote::transaction test_tx;
 			pending_tx test_ptx;
 
-			const size_t estimated_tx_size = estimate_rct_tx_size(tx.selected_transfers.size(), fake_outs_count, tx.dsts.size(), bulletproof);
+			// a payout transaction is only built at the end, with the fee it is given here, so
+			// it is sized for the largest it can come out as
+			const size_t estimated_tx_size = payout ? estimate_tx_size_upper_bound(tx.selected_transfers, tx.dsts, fake_outs_count, unlock_time, bulletproof, outs_ctx) : estimate_rct_tx_size(tx.selected_transfers.size(), fake_outs_count, tx.dsts.size(), bulletproof);
 			needed_fee = calculate_fee(fake_outs_count+1, estimated_tx_size, fee_multiplier);
 
 			uint64_t inputs = 0, outputs = needed_fee;
@@ -6900,13 +7447,28 @@ std::vector<wallet2::pending_tx> wallet2::create_transactions_2(std::vector<cryp
 				goto skip_tx;
 			}
 
-			LOG_PRINT_L2("Trying to create a tx now, with " << tx.dsts.size() << " outputs and " << tx.selected_transfers.size() << " inputs");
+			size_t tx_size;
+			if(payout)
+			{
+				// the upper bound is all we go by, the transaction is built with the others at the end
+				LOG_PRINT_L2("Planning a tx with " << tx.dsts.size() << " outputs and " << tx.selected_transfers.size() << " inputs");
+				tx_size = estimated_tx_size;
+				test_ptx.fee = needed_fee;
+				test_ptx.change_dts.amount = inputs - outputs;
+				available_for_fee = needed_fee + test_ptx.change_dts.amount;
+			}
+			else
+			{
+				LOG_PRINT_L2("Trying to create a tx now, with " << tx.dsts.size() << " outputs and " << tx.selected_transfers.size() << " inputs");
 
-			transfer_selected_rct(tx.dsts, tx.selected_transfers, fake_outs_count, outs, unlock_time, needed_fee, payment_id, test_tx, test_ptx, bulletproof, uniform_pid);
-			auto txBlob = t_serializable_object_to_blob(test_ptx.tx);
-			needed_fee = calculate_fee(fake_outs_count+1, txBlob.size(), fee_multiplier);
-			available_for_fee = test_ptx.fee + test_ptx.change_dts.amount + (!test_ptx.dust_added_to_fee ? test_ptx.dust : 0);
-			LOG_PRINT_L2("Made a " << get_size_string(txBlob) << " tx, with " << print_money(available_for_fee) << " available for fee (" << print_money(needed_fee) << " needed)");
+				if(outs.empty() && fake_outs_count > 0)
+					get_placeholder_outs(outs, tx.selected_transfers, fake_outs_count, outs_ctx);
+				transfer_selected_rct(tx.dsts, tx.selected_transfers, fake_outs_count, outs, unlock_time, needed_fee, payment_id, test_tx, test_ptx, bulletproof, uniform_pid);
+				tx_size = t_serializable_object_to_blob(test_ptx.tx).size();
+				needed_fee = calculate_fee(fake_outs_count+1, tx_size, fee_multiplier);
+				available_for_fee = test_ptx.fee + test_ptx.change_dts.amount + (!test_ptx.dust_added_to_fee ? test_ptx.dust : 0);
+			}
+			LOG_PRINT_L2("Made a " << get_size_string(tx_size) << " tx, with " << print_money(available_for_fee) << " available for fee (" << print_money(needed_fee) << " needed)");
 
 			if(needed_fee > available_for_fee && !dsts.empty() && dsts[0].amount > 0)
 			{
@@ -6939,17 +7501,16 @@ std::vector<wallet2::pending_tx> wallet2::create_transactions_2(std::vector<cryp
 				while(needed_fee > test_ptx.fee)
 				{
 					transfer_selected_rct(tx.dsts, tx.selected_transfers, fake_outs_count, outs, unlock_time, needed_fee, payment_id, test_tx, test_ptx, bulletproof, uniform_pid);
-					txBlob = t_serializable_object_to_blob(test_ptx.tx);
-					needed_fee = calculate_fee(fake_outs_count+1, txBlob.size(), fee_multiplier);
-					LOG_PRINT_L2("Made an attempt at a  final " << get_size_string(txBlob) << " tx, with " << print_money(test_ptx.fee) << " fee  and " << print_money(test_ptx.change_dts.amount) << " change");
+					tx_size = t_serializable_object_to_blob(test_ptx.tx).size();
+					needed_fee = calculate_fee(fake_outs_count+1, tx_size, fee_multiplier);
+					LOG_PRINT_L2("Made an attempt at a  final " << get_size_string(tx_size) << " tx, with " << print_money(test_ptx.fee) << " fee  and " << print_money(test_ptx.change_dts.amount) << " change");
 				}
 
-				LOG_PRINT_L2("Made a final " << get_size_string(txBlob) << " tx, with " << print_money(test_ptx.fee) << " fee  and " << print_money(test_ptx.change_dts.amount) << " change");
+				LOG_PRINT_L2("Made a final " << get_size_string(tx_size) << " tx, with " << print_money(test_ptx.fee) << " fee  and " << print_money(test_ptx.change_dts.amount) << " change");
 
 				tx.tx = test_tx;
 				tx.ptx = test_ptx;
-				tx.bytes = txBlob.size();
-				tx.outs = outs;
+				tx.bytes = tx_size;
 				tx.fee = needed_fee;
 				accumulated_fee += test_ptx.fee;
 				accumulated_change += test_ptx.change_dts.amount;
@@ -6989,10 +7550,56 @@ std::vector<wallet2::pending_tx> wallet2::create_transactions_2(std::vector<cryp
 
 	LOG_PRINT_L1("Done creating " << txes.size() << " transactions, " << print_money(accumulated_fee) << " total fee, " << print_money(accumulated_change) << " total change");
 
-	hwdev.set_mode(hw::device::TRANSACTION_CREATE_REAL);
-	for(std::vector<TX>::iterator i = txes.begin(); i != txes.end(); ++i)
+	// pick the real rings for the inputs of as many transactions per request as a
+	// restricted daemon will serve, a transaction is only split if it is too large alone
 	{
-		TX &tx = *i;
+		std::vector<size_t> chunk_transfers;
+		size_t chunk_requested = 0;
+		std::vector<std::vector<tools::wallet2::get_outs_entry>> all_outs;
+		auto flush_chunk = [&]() {
+			if(chunk_transfers.empty())
+				return;
+			std::vector<std::vector<tools::wallet2::get_outs_entry>> chunk_outs;
+			get_outs(chunk_outs, chunk_transfers, fake_outs_count, outs_ctx);
+			THROW_WALLET_EXCEPTION_IF(chunk_outs.size() != chunk_transfers.size(), error::wallet_internal_error, "Unexpected number of rings");
+			all_outs.insert(all_outs.end(), std::make_move_iterator(chunk_outs.begin()), std::make_move_iterator(chunk_outs.end()));
+			chunk_transfers.clear();
+			chunk_requested = 0;
+		};
+		for(const TX &tx : txes)
+		{
+			size_t tx_requested = 0;
+			for(size_t idx : tx.selected_transfers)
+				tx_requested += get_outs_requested_count(m_transfers[idx], fake_outs_count);
+			if(chunk_requested + tx_requested > GET_OUTS_MAX_REQUESTED)
+				flush_chunk();
+			for(size_t idx : tx.selected_transfers)
+			{
+				const size_t requested = get_outs_requested_count(m_transfers[idx], fake_outs_count);
+				if(chunk_requested + requested > GET_OUTS_MAX_REQUESTED)
+					flush_chunk();
+				chunk_transfers.push_back(idx);
+				chunk_requested += requested;
+			}
+		}
+		flush_chunk();
+
+		auto it = all_outs.begin();
+		for(TX &tx : txes)
+		{
+			tx.outs.assign(std::make_move_iterator(it), std::make_move_iterator(it + tx.selected_transfers.size()));
+			it += tx.selected_transfers.size();
+		}
+	}
+
+	// the transactions don't depend on each other, so with the keys in memory they are built
+	// and signed in parallel, a device or the multisig bookkeeping takes them one at a time
+	hwdev.set_mode(hw::device::TRANSACTION_CREATE_REAL);
+	const bool parallel = !m_key_on_device && !m_multisig && txes.size() > 1;
+	tools::threadpool &tpool = tools::threadpool::getInstance();
+	tools::threadpool::waiter waiter;
+	std::vector<std::exception_ptr> errors(txes.size());
+	auto build_tx = [&](TX &tx) {
 		cryptonote::transaction test_tx;
 		pending_tx test_ptx;
 		transfer_selected_rct(tx.dsts,				 /* NOMOD std::vector<cryptonote::tx_destination_entry> dsts,*/
@@ -7007,10 +7614,36 @@ std::vector<wallet2::pending_tx> wallet2::create_transactions_2(std::vector<cryp
 							  bulletproof,
 							  uniform_pid);
 		auto txBlob = t_serializable_object_to_blob(test_ptx.tx);
+		// the placeholder rings and the payout upper bound are at least as long as any real
+		// transaction, so the fee it was sized with covers it
+		const uint64_t needed_fee = calculate_fee(fake_outs_count + 1, txBlob.size(), fee_multiplier);
+		THROW_WALLET_EXCEPTION_IF(needed_fee > test_ptx.fee, error::wallet_internal_error,
+								  "Final tx is " + get_size_string(txBlob) + ", larger than it was sized at");
 		tx.tx = test_tx;
 		tx.ptx = test_ptx;
 		tx.bytes = txBlob.size();
+	};
+	for(size_t n = 0; n < txes.size(); ++n)
+	{
+		auto build = [&, n] {
+			try
+			{
+				build_tx(txes[n]);
+			}
+			catch(...)
+			{
+				errors[n] = std::current_exception();
+			}
+		};
+		if(parallel)
+			tpool.submit(&waiter, build);
+		else
+			build();
 	}
+	waiter.wait();
+	for(const std::exception_ptr &e : errors)
+		if(e)
+			std::rethrow_exception(e);
 
 	std::vector<wallet2::pending_tx> ptx_vector;
 	for(std::vector<TX>::iterator i = txes.begin(); i != txes.end(); ++i)
@@ -8616,6 +9249,7 @@ uint64_t wallet2::import_key_images(const std::vector<std::pair<crypto::key_imag
 
 	THROW_WALLET_EXCEPTION_IF(signed_key_images.size() > m_transfers.size(), error::wallet_internal_error,
 							  "The blockchain is out of date compared to the signed key images");
+	std::vector<size_t> queried; // transfers whose key images we ask the daemon about
 
 	if(signed_key_images.empty())
 	{
@@ -8645,7 +9279,12 @@ uint64_t wallet2::import_key_images(const std::vector<std::pair<crypto::key_imag
 		THROW_WALLET_EXCEPTION_IF(!crypto::check_ring_signature((const crypto::hash &)key_image, key_image, pkeys, &signature),
 								  error::wallet_internal_error, "Signature check failed: input " + boost::lexical_cast<std::string>(n) + "/" + boost::lexical_cast<std::string>(signed_key_images.size()) + ", key image " + epee::string_tools::pod_to_hex(key_image) + ", signature " + epee::string_tools::pod_to_hex(signature) + ", pubkey " + epee::string_tools::pod_to_hex(*pkeys[0]));
 
+		// a spend we already saw confirmed in a block can't be undone short of a reorg,
+		// which drops it from m_confirmed_spent_key_images, so only ask about the others
+		if(td.m_spent && td.m_key_image_known && !td.m_key_image_partial && td.m_key_image == key_image && m_confirmed_spent_key_images.count(key_image) > 0)
+			continue;
 		req.key_images.push_back(epee::string_tools::pod_to_hex(key_image));
+		queried.push_back(n);
 	}
 
 	for(size_t n = 0; n < signed_key_images.size(); ++n)
@@ -8661,19 +9300,27 @@ uint64_t wallet2::import_key_images(const std::vector<std::pair<crypto::key_imag
 	if(!check_spent)
 		return m_transfers[signed_key_images.size() - 1].m_block_height;
 
-	m_daemon_rpc_mutex.lock();
-	bool r = epee::net_utils::invoke_http_json("/is_key_image_spent", req, daemon_resp, m_http_client, rpc_timeout);
-	m_daemon_rpc_mutex.unlock();
-	THROW_WALLET_EXCEPTION_IF(!r, error::no_connection_to_daemon, "is_key_image_spent");
-	THROW_WALLET_EXCEPTION_IF(daemon_resp.status == CORE_RPC_STATUS_BUSY, error::daemon_busy, "is_key_image_spent");
-	THROW_WALLET_EXCEPTION_IF(daemon_resp.status != CORE_RPC_STATUS_OK, error::is_key_image_spent_error, daemon_resp.status);
-	THROW_WALLET_EXCEPTION_IF(daemon_resp.spent_status.size() != signed_key_images.size(), error::wallet_internal_error,
+	MDEBUG("Checking " << queried.size() << "/" << signed_key_images.size() << " key images, the rest are known spent");
+	bool r;
+	if(!queried.empty())
+	{
+		m_daemon_rpc_mutex.lock();
+		r = epee::net_utils::invoke_http_json("/is_key_image_spent", req, daemon_resp, m_http_client, rpc_timeout);
+		m_daemon_rpc_mutex.unlock();
+		THROW_WALLET_EXCEPTION_IF(!r, error::no_connection_to_daemon, "is_key_image_spent");
+		THROW_WALLET_EXCEPTION_IF(daemon_resp.status == CORE_RPC_STATUS_BUSY, error::daemon_busy, "is_key_image_spent");
+		THROW_WALLET_EXCEPTION_IF(daemon_resp.status != CORE_RPC_STATUS_OK, error::is_key_image_spent_error, daemon_resp.status);
+	}
+	THROW_WALLET_EXCEPTION_IF(daemon_resp.spent_status.size() != queried.size(), error::wallet_internal_error,
 								"daemon returned wrong response for is_key_image_spent, wrong amounts count = " +
-									std::to_string(daemon_resp.spent_status.size()) + ", expected " + std::to_string(signed_key_images.size()));
-	for(size_t n = 0; n < daemon_resp.spent_status.size(); ++n)
+									std::to_string(daemon_resp.spent_status.size()) + ", expected " + std::to_string(queried.size()));
+	for(size_t q = 0; q < queried.size(); ++q)
 	{
+		const size_t n = queried[q];
 		transfer_details &td = m_transfers[n];
-		td.m_spent = daemon_resp.spent_status[n] != COMMAND_RPC_IS_KEY_IMAGE_SPENT::UNSPENT;
+		unindex_transfer(n);
+		td.m_spent = daemon_resp.spent_status[q] != COMMAND_RPC_IS_KEY_IMAGE_SPENT::UNSPENT;
+		index_transfer(n);
 	}
 
 	std::unordered_set<crypto::hash> spent_txids; // For each spent key image, search for a tx in m_transfers that uses it as input.
@@ -8702,9 +9349,14 @@ uint64_t wallet2::import_key_images(const std::vector<std::pair<crypto::key_imag
 			unspent += amount;
 
 		LOG_PRINT_L2("Transfer " << i << ": " << print_money(amount) << " (" << td.m_global_output_index << "): "
-								 << (td.m_spent ? "spent" : "unspent") << " (key image " << req.key_images[i] << ")");
+								 << (td.m_spent ? "spent" : "unspent") << " (key image " << td.m_key_image << ")");
+	}
 
-		if(daemon_resp.spent_status[i] == COMMAND_RPC_IS_KEY_IMAGE_SPENT::SPENT_IN_BLOCKCHAIN)
+	// the outgoing txes of spends confirmed before were already recorded then
+	for(size_t q = 0; q < queried.size(); ++q)
+	{
+		const size_t i = queried[q];
+		if(daemon_resp.spent_status[q] == COMMAND_RPC_IS_KEY_IMAGE_SPENT::SPENT_IN_BLOCKCHAIN)
 		{
 			auto v = out_kimg_map.find(m_transfers[i].m_key_image);
 			if(v != out_kimg_map.end())
@@ -8723,11 +9375,14 @@ uint64_t wallet2::import_key_images(const std::vector<std::pair<crypto::key_imag
 	gettxs_req.prune = false;
 	for(const crypto::hash &spent_txid : spent_txids)
 		gettxs_req.txs_hashes.push_back(epee::string_tools::pod_to_hex(spent_txid));
-	m_daemon_rpc_mutex.lock();
-	r = epee::net_utils::invoke_http_json("/gettransactions", gettxs_req, gettxs_res, m_http_client, rpc_timeout);
-	m_daemon_rpc_mutex.unlock();
-	THROW_WALLET_EXCEPTION_IF(!r, error::no_connection_to_daemon, "gettransactions");
-	THROW_WALLET_EXCEPTION_IF(gettxs_res.status == CORE_RPC_STATUS_BUSY, error::daemon_busy, "gettransactions");
+	if(!spent_txids.empty())
+	{
+		m_daemon_rpc_mutex.lock();
+		r = epee::net_utils::invoke_http_json("/gettransactions", gettxs_req, gettxs_res, m_http_client, rpc_timeout);
+		m_daemon_rpc_mutex.unlock();
+		THROW_WALLET_EXCEPTION_IF(!r, error::no_connection_to_daemon, "gettransactions");
+		THROW_WALLET_EXCEPTION_IF(gettxs_res.status == CORE_RPC_STATUS_BUSY, error::daemon_busy, "gettransactions");
+	}
 	THROW_WALLET_EXCEPTION_IF(gettxs_res.txs.size() != spent_txids.size(), error::wallet_internal_error,
 								"daemon returned wrong response for gettransactions, wrong count = " + std::to_string(gettxs_res.txs.size()) + ", expected " + std::to_string(spent_txids.size()));
 
@@ -8820,6 +9475,7 @@ uint64_t wallet2::import_key_images(const std::vector<std::pair<crypto::key_imag
 		{
 			if(j->second.m_tx_hash == *spent_txid)
 			{
+				unindex_payment(*j);
 				m_payments.erase(j);
 				break;
 			}
@@ -8839,7 +9495,18 @@ uint64_t wallet2::import_key_images(const std::vector<std::pair<crypto::key_imag
 
 		crypto::hash spent_txid = crypto::null_hash; // spent txid is unknown
 		memcpy(&spent_txid, &n, sizeof(uint64_t));
-		m_confirmed_txs.insert(std::make_pair(spent_txid, pd));
+		auto entry = m_confirmed_txs.insert(std::make_pair(spent_txid, pd));
+		if(entry.second)
+			index_confirmed_tx(*entry.first);
+	}
+
+	// the daemon's height bounds the spending block from above, detaching anything at or
+	// below it forgets the spend again, a daemon that doesn't tell leaves them to be asked
+	if(daemon_resp.height > 0)
+	{
+		for(size_t q = 0; q < queried.size(); ++q)
+			if(daemon_resp.spent_status[q] == COMMAND_RPC_IS_KEY_IMAGE_SPENT::SPENT_IN_BLOCKCHAIN)
+				m_confirmed_spent_key_images[m_transfers[queried[q]].m_key_image] = daemon_resp.height;
 	}
 
 	return m_transfers[signed_key_images.size() - 1].m_block_height;
@@ -8855,18 +9522,25 @@ wallet2::payment_container wallet2::export_payments() const
 }
 void wallet2::import_payments(const payment_container &payments)
 {
+	for(auto const &p : m_payments)
+		unindex_payment(p);
 	m_payments.clear();
 	for(auto const &p : payments)
 	{
-		m_payments.emplace(p);
+		auto it = m_payments.emplace(p);
+		index_payment(*it);
 	}
 }
 void wallet2::import_payments_out(const std::list<std::pair<crypto::hash, wallet2::confirmed_transfer_details>> &confirmed_payments)
 {
+	for(auto const &p : m_confirmed_txs)
+		unindex_confirmed_tx(p);
 	m_confirmed_txs.clear();
 	for(auto const &p : confirmed_payments)
 	{
-		m_confirmed_txs.emplace(p);
+		auto entry = m_confirmed_txs.emplace(p);
+		if(entry.second)
+			index_confirmed_tx(*entry.first);
 	}
 }
 
@@ -8920,6 +9594,8 @@ std::vector<tools::wallet2::transfer_details> wallet2::export_outputs() const
 size_t wallet2::import_outputs(const std::vector<tools::wallet2::transfer_details> &outputs)
 {
 	m_transfers.clear();
+	m_unspent_balances.clear();
+	m_transfers_by_unlock_height.clear();
 	m_transfers.reserve(outputs.size());
 	for(size_t i = 0; i < outputs.size(); ++i)
 	{
@@ -8944,6 +9620,7 @@ size_t wallet2::import_outputs(const std::vector<tools::wallet2::transfer_detail
 		m_key_images[td.m_key_image] = m_transfers.size();
 		m_pub_keys[td.get_public_key()] = m_transfers.size();
 		m_transfers.push_back(td);
+		index_transfer(m_transfers.size() - 1);
 	}
 
 	return m_transfers.size();
@@ -23,6 +23,8 @@
 #include <memory>
 
 #include <atomic>
+#include <deque>
+#include <functional>
 #include <boost/archive/basic_archive.hpp>
 #include <boost/program_options/options_description.hpp>
 #include <boost/program_options/variables_map.hpp>
@@ -54,10 +56,12 @@
 //#define RYO_DEFAULT_LOG_CATEGORY "wallet.wallet2"
 
 class Serialization_portability_wallet_Test;
+class wallet_scanner_test;
 
 namespace tools
 {
 class ringdb;
+class wallet_scanner;
 
 class i_wallet2_callback
 {
@@ -134,6 +138,8 @@ class hashchain
 class wallet2
 {
 	friend class ::Serialization_portability_wallet_Test;
+	friend class wallet_scanner;
+	friend class ::wallet_scanner_test;
 
   public:
 	static constexpr const std::chrono::seconds rpc_timeout = std::chrono::minutes(3) + std::chrono::seconds(30);
@@ -156,8 +162,9 @@ class wallet2
 	static std::unique_ptr<wallet2> make_from_json(const boost::program_options::variables_map &vm, const std::string &json_file, const std::function<boost::optional<password_container>(const char *, bool)> &password_prompter);
 
 	//! Uses stdin and stdout. Returns a wallet2 and password for `wallet_file` if no errors.
+	//! Without `ringdb` the shared ring database is not opened, for wallets that never spend.
 	static std::pair<std::unique_ptr<wallet2>, password_container>
-	make_from_file(const boost::program_options::variables_map &vm, const std::string &wallet_file, const std::function<boost::optional<password_container>(const char *, bool)> &password_prompter);
+	make_from_file(const boost::program_options::variables_map &vm, const std::string &wallet_file, const std::function<boost::optional<password_container>(const char *, bool)> &password_prompter, bool ringdb = true);
 
 	//! Uses stdin and stdout. Returns a wallet2 and password for wallet with no file if no errors.
 	static std::pair<std::unique_ptr<wallet2>, password_container> make_new(const boost::program_options::variables_map &vm, const std::function<boost::optional<password_container>(const char *, bool)> &password_prompter);
@@ -342,6 +349,20 @@ class wallet2
 
 	typedef std::vector<transfer_details> transfer_container;
 	typedef std::unordered_multimap<crypto::hash, payment_details> payment_container;
+	typedef std::unordered_map<crypto::hash, confirmed_transfer_details> confirmed_transfer_container;
+
+	/*!
+	 * \brief An incoming payment or outgoing tx that was added to, or removed
+	 *        from, the confirmed history, numbered in the order it happened
+	 */
+	struct transfer_event
+	{
+		uint64_t seq;
+		bool removed;
+		const payment_container::value_type *payment;		//!< the incoming payment, or null
+		const confirmed_transfer_container::value_type *tx; //!< the outgoing tx, or null
+		std::shared_ptr<const void> removed_entry;			//!< keeps the entry a removal refers to
+	};
 
 	struct multisig_sig
 	{
@@ -681,7 +702,9 @@ class wallet2
 	// load unsigned_tx_set from file.
 	bool load_unsigned_tx(const std::string &unsigned_filename, unsigned_tx_set &exported_txs) const;
 	bool load_tx(const std::string &signed_filename, std::vector<tools::wallet2::pending_tx> &ptx, std::function<bool(const signed_tx_set &)> accept_func = NULL);
-	std::vector<wallet2::pending_tx> create_transactions_2(std::vector<cryptonote::tx_destination_entry> dsts, const size_t fake_outs_count, const uint64_t unlock_time, uint32_t priority, const crypto::uniform_payment_id* payment_id, uint32_t subaddr_account, std::set<uint32_t> subaddr_indices, bool trusted_daemon); // pass subaddr_indices by value on purpose
+	// payout plans every transaction from size estimates instead of building each one to check its fee,
+	// for sends to many destinations where the fee is a small part of what is paid
+	std::vector<wallet2::pending_tx> create_transactions_2(std::vector<cryptonote::tx_destination_entry> dsts, const size_t fake_outs_count, const uint64_t unlock_time, uint32_t priority, const crypto::uniform_payment_id* payment_id, uint32_t subaddr_account, std::set<uint32_t> subaddr_indices, bool trusted_daemon, bool payout = false); // pass subaddr_indices by value on purpose
 	std::vector<wallet2::pending_tx> create_transactions_all(uint64_t below, const cryptonote::account_public_address &address, bool is_subaddress, const size_t fake_outs_count, const uint64_t unlock_time, uint32_t priority, const crypto::uniform_payment_id* payment_id, uint32_t subaddr_account, std::set<uint32_t> subaddr_indices, bool trusted_daemon);
 	std::vector<wallet2::pending_tx> create_transactions_single(const crypto::key_image &ki, const cryptonote::account_public_address &address, bool is_subaddress, const size_t fake_outs_count, const uint64_t unlock_time, uint32_t priority, const crypto::uniform_payment_id* payment_id, bool trusted_daemon);
 	std::vector<wallet2::pending_tx> create_transactions_from(const cryptonote::account_public_address &address, bool is_subaddress, std::vector<size_t> unused_transfers_indices, std::vector<size_t> unused_dust_indices, const size_t fake_outs_count, const uint64_t unlock_time, uint32_t priority, const crypto::uniform_payment_id* payment_id, bool trusted_daemon);
@@ -699,6 +722,19 @@ class wallet2
 	void get_unconfirmed_payments_out(std::list<std::pair<crypto::hash, wallet2::unconfirmed_transfer_details>> &unconfirmed_payments, const boost::optional<uint32_t> &subaddr_account = boost::none, const std::set<uint32_t> &subaddr_indices = {}) const;
 	void get_unconfirmed_payments(std::list<std::pair<crypto::hash, wallet2::pool_payment_details>> &unconfirmed_payments, const boost::optional<uint32_t> &subaddr_account = boost::none, const std::set<uint32_t> &subaddr_indices = {}) const;
 
+	/*!
+	 * \brief Gets the changes to the confirmed history after a cursor
+	 * \param cursor       cursor of the last event already seen, 0 for the whole history
+	 * \param max_count    most events to return, 0 for no limit
+	 * \param filter       only events it accepts are returned, may be empty
+	 * \param events       return-by-reference the events, oldest first
+	 * \param next_cursor  return-by-reference the cursor to continue from
+	 * \return false if the cursor is from another log, such as one from before the wallet
+	 *         was loaded, the whole history is returned then
+	 */
+	bool get_transfer_events(uint64_t cursor, size_t max_count, const std::function<bool(const transfer_event &)> &filter, std::vector<transfer_event> &events, uint64_t &next_cursor) const;
+	uint64_t get_transfer_events_cursor() const;
+
 	uint64_t get_blockchain_current_height() const { return m_local_bc_height; }
 	void rescan_spent();
 	void rescan_blockchain(bool refresh = true);
@@ -805,6 +841,17 @@ class wallet2
 		if(ver < 24)
 			return;
 		a &m_ring_history_saved;
+		if(ver < 25)
+			return;
+		a &m_transfer_event_seq;
+		if(ver < 26)
+			return;
+		a &m_rct_distribution_start;
+		a &m_rct_distribution;
+		a &m_rct_distribution_top;
+		if(ver < 27)
+			return;
+		a &m_confirmed_spent_key_images;
 	}
 
 	/*!
@@ -1047,6 +1094,16 @@ class wallet2
 	bool is_output_blackballed(const crypto::public_key &output) const;
 
   private:
+	// A block from getblocks.bin with its transactions already parsed, so a batch
+	// can be deserialized once and handed to any number of wallets. The transactions
+	// of a block no wallet scans are left unparsed, txes is empty then.
+	struct parsed_block
+	{
+		crypto::hash hash;
+		cryptonote::block block;
+		std::vector<cryptonote::transaction> txes;
+	};
+
 	/*!
      * \brief  Stores wallet information to wallet file.
      * \param  keys_file_name Name of wallet file
@@ -1062,7 +1119,7 @@ class wallet2
      */
 	bool load_keys(const std::string &keys_file_name, const epee::wipeable_string &password);
 	void process_new_transaction(const crypto::hash &txid, const cryptonote::transaction &tx, const std::vector<uint64_t> &o_indices, uint64_t height, uint64_t ts, bool miner_tx, bool pool, bool double_spend_seen);
-	void process_new_blockchain_entry(const cryptonote::block &b, const cryptonote::block_complete_entry &bche, const crypto::hash &bl_id, uint64_t height, const cryptonote::COMMAND_RPC_GET_BLOCKS_FAST::block_output_indices &o_indices);
+	void process_new_blockchain_entry(const parsed_block &pb, uint64_t height, const cryptonote::COMMAND_RPC_GET_BLOCKS_FAST::block_output_indices &o_indices);
 	void detach_blockchain(uint64_t height);
 	void get_short_chain_history(std::list<crypto::hash> &ids) const;
 	bool is_tx_spendtime_unlocked(uint64_t unlock_time, uint64_t block_height) const;
@@ -1072,6 +1129,9 @@ class wallet2
 	void fast_refresh(uint64_t stop_height, uint64_t &blocks_start_height, std::list<crypto::hash> &short_chain_history);
 	void pull_next_blocks(uint64_t start_height, uint64_t &blocks_start_height, std::list<crypto::hash> &short_chain_history, const std::list<cryptonote::block_complete_entry> &prev_blocks, std::list<cryptonote::block_complete_entry> &blocks, std::vector<cryptonote::COMMAND_RPC_GET_BLOCKS_FAST::block_output_indices> &o_indices, bool &error);
 	void process_blocks(uint64_t start_height, const std::list<cryptonote::block_complete_entry> &blocks, const std::vector<cryptonote::COMMAND_RPC_GET_BLOCKS_FAST::block_output_indices> &o_indices, uint64_t &blocks_added);
+	void process_parsed_blocks(uint64_t start_height, const std::vector<parsed_block> &blocks, const std::vector<cryptonote::COMMAND_RPC_GET_BLOCKS_FAST::block_output_indices> &o_indices, uint64_t &blocks_added);
+	static void parse_blocks(uint64_t start_height, const std::list<cryptonote::block_complete_entry> &blocks, const std::function<bool(uint64_t, const cryptonote::block &)> &wants_txes, std::vector<parsed_block> &parsed);
+	bool wants_block_txes(uint64_t height, const cryptonote::block &b) const;
 	uint64_t select_transfers(uint64_t needed_money, std::vector<size_t> unused_transfers_indices, std::vector<size_t> &selected_transfers, bool trusted_daemon) const;
 	bool prepare_file_names(const std::string &file_path);
 	void process_unconfirmed(const crypto::hash &txid, const cryptonote::transaction &tx, uint64_t height);
@@ -1083,31 +1143,62 @@ class wallet2
 	crypto::hash get_payment_id(const pending_tx &ptx) const;
 	void check_acc_out_precomp_once(const cryptonote::tx_out &o, const crypto::key_derivation &derivation, const std::vector<crypto::key_derivation> &additional_derivations, size_t i, tx_scan_info_t &tx_scan_info, bool &already_seen) const;
 	void check_acc_out_precomp(const cryptonote::tx_out &o, const crypto::key_derivation &derivation, const std::vector<crypto::key_derivation> &additional_derivations, size_t i, tx_scan_info_t &tx_scan_info) const;
-	void parse_block_round(const cryptonote::blobdata &blob, cryptonote::block &bl, crypto::hash &bl_id, bool &error) const;
+	static void parse_block_round(const cryptonote::block_complete_entry &bche, uint64_t height, const std::function<bool(uint64_t, const cryptonote::block &)> &wants_txes, parsed_block &pb, bool &error);
 	uint64_t get_upper_transaction_size_limit() const;
 	std::vector<uint64_t> get_unspent_amounts_vector() const;
 	float get_output_relatedness(const transfer_details &td0, const transfer_details &td1) const;
 	std::vector<size_t> pick_preferred_rct_inputs(uint64_t needed_money, uint32_t subaddr_account, const std::set<uint32_t> &subaddr_indices) const;
 	void set_spent(size_t idx, uint64_t height);
 	void set_unspent(size_t idx);
+	uint64_t get_transfer_unlock_height(const transfer_details &td) const;
+	void index_transfer(size_t idx);
+	void unindex_transfer(size_t idx);
+	void index_confirmed_tx(const confirmed_transfer_container::value_type &tx);
+	void unindex_confirmed_tx(const confirmed_transfer_container::value_type &tx);
+	void index_payment(const payment_container::value_type &payment);
+	void unindex_payment(const payment_container::value_type &payment);
+	void add_transfer_event(const payment_container::value_type *payment, const confirmed_transfer_container::value_type *tx);
+	void remove_transfer_event(const void *entry, const std::shared_ptr<const void> &copy, const payment_container::value_type *payment, const confirmed_transfer_container::value_type *tx);
+	void reset_transfer_events();
+	void relog_transfer_events();
+	void trim_transfer_events();
+	void rebuild_indices();
+	// what picking fake outputs needs from the daemon, fetched once per batch of transactions
+	struct outs_context
+	{
+		uint64_t segregation_fork_height = 0;
+		bool is_after_segregation_fork = false;
+		bool is_shortly_after_segregation_fork = false;
+		std::vector<cryptonote::COMMAND_RPC_GET_OUTPUT_HISTOGRAM::entry> histogram;
+		std::unordered_map<uint64_t, std::pair<uint64_t, uint64_t>> segregation_limit;
+	};
+	void get_outs_context(outs_context &ctx, const std::vector<size_t> &transfers);
 	void get_outs(std::vector<std::vector<get_outs_entry>> &outs, const std::vector<size_t> &selected_transfers, size_t fake_outputs_count);
+	void get_outs(std::vector<std::vector<get_outs_entry>> &outs, const std::vector<size_t> &selected_transfers, size_t fake_outputs_count, const outs_context &ctx);
+	uint64_t get_ring_output_count(const transfer_details &td, const outs_context &ctx) const;
+	size_t estimate_tx_size_upper_bound(const std::vector<size_t> &selected_transfers, const std::vector<cryptonote::tx_destination_entry> &dsts, size_t fake_outputs_count, uint64_t unlock_time, bool bulletproof, const outs_context &ctx) const;
+	void get_placeholder_outs(std::vector<std::vector<get_outs_entry>> &outs, const std::vector<size_t> &selected_transfers, size_t fake_outputs_count, const outs_context &ctx) const;
 	bool tx_add_fake_output(std::vector<std::vector<tools::wallet2::get_outs_entry>> &outs, uint64_t global_index, const crypto::public_key &tx_public_key, const rct::key &mask, uint64_t real_index, bool unlocked) const;
 	crypto::public_key get_tx_pub_key_from_received_outs(const tools::wallet2::transfer_details &td) const;
 	bool should_pick_a_second_output(bool use_rct, size_t n_transfers, const std::vector<size_t> &unused_transfers_indices, const std::vector<size_t> &unused_dust_indices) const;
 	std::vector<size_t> get_only_rct(const std::vector<size_t> &unused_dust_indices, const std::vector<size_t> &unused_transfers_indices) const;
 	void scan_output(const cryptonote::transaction &tx, const crypto::public_key &tx_pub_key, size_t i, tx_scan_info_t &tx_scan_info, int &num_vouts_received, std::unordered_map<cryptonote::subaddress_index, uint64_t> &tx_money_got_in_outs, std::vector<size_t> &outs) const;
 	void trim_hashchain();
+	bool update_pool_hashes();
 	crypto::key_image get_multisig_composite_key_image(size_t n) const;
 	rct::multisig_kLRki get_multisig_composite_kLRki(size_t n, const crypto::public_key &ignore, std::unordered_set<rct::key> &used_L, std::unordered_set<rct::key> &new_used_L) const;
 	rct::multisig_kLRki get_multisig_kLRki(size_t n, const rct::key &k) const;
 	rct::key get_multisig_k(size_t idx, const std::unordered_set<rct::key> &used_L) const;
 	void update_multisig_rescan_info(const std::vector<std::vector<rct::key>> &multisig_k, const std::vector<std::vector<tools::wallet2::multisig_info>> &info, size_t n);
 	bool add_rings(const crypto::chacha_key &key, const cryptonote::transaction_prefix &tx);
+	bool add_rings(const crypto::chacha_key &key, const std::vector<const cryptonote::transaction_prefix *> &txes);
 	bool add_rings(const cryptonote::transaction_prefix &tx);
 	bool remove_rings(const cryptonote::transaction_prefix &tx);
 	bool get_ring(const crypto::chacha_key &key, const crypto::key_image &key_image, std::vector<uint64_t> &outs);
+	bool get_rings(const crypto::chacha_key &key, const std::vector<crypto::key_image> &key_images, std::vector<std::vector<uint64_t>> &outs);
 
 	bool get_output_distribution(uint64_t &start_height, std::vector<uint64_t> &distribution);
+	void clear_output_distribution_cache();
 
 	uint64_t get_segregation_fork_height() const;
 
@@ -1120,7 +1211,7 @@ class wallet2
 	hashchain m_blockchain;
 	std::atomic<uint64_t> m_local_bc_height; //temporary workaround
 	std::unordered_map<crypto::hash, unconfirmed_transfer_details> m_unconfirmed_txs;
-	std::unordered_map<crypto::hash, confirmed_transfer_details> m_confirmed_txs;
+	confirmed_transfer_container m_confirmed_txs;
 	std::unordered_multimap<crypto::hash, pool_payment_details> m_unconfirmed_payments;
 	std::unordered_map<crypto::hash, crypto::secret_key> m_tx_keys;
 	cryptonote::checkpoints m_checkpoints;
@@ -1129,7 +1220,37 @@ class wallet2
 	transfer_container m_transfers;
 	payment_container m_payments;
 	std::unordered_map<crypto::key_image, size_t> m_key_images;
+	std::unordered_map<crypto::key_image, uint64_t> m_confirmed_spent_key_images; // imported key image -> daemon height when it saw it spent in a block, above the spending block
 	std::unordered_map<crypto::public_key, size_t> m_pub_keys;
+
+	// indices over m_transfers, m_payments and m_confirmed_txs, kept up to date
+	// as they change and rebuilt when they are loaded
+	struct subaddress_balance
+	{
+		uint64_t amount;
+		size_t count;
+	};
+	std::map<uint32_t, std::map<uint32_t, subaddress_balance>> m_unspent_balances; // major -> minor -> unspent transfers
+	std::set<std::pair<uint64_t, size_t>> m_transfers_by_unlock_height; // unlock height, transfer index
+	std::multimap<uint64_t, const payment_container::value_type *> m_payments_by_height;
+	std::multimap<uint64_t, const confirmed_transfer_container::value_type *> m_confirmed_txs_by_height;
+
+	// append-only log of changes to m_payments and m_confirmed_txs. Only the
+	// last sequence number is stored, the log is rebuilt from the current
+	// entries on load, numbered after a gap and under a new random epoch, so
+	// cursors from before, even ones past the stored number, can be told apart.
+	std::deque<transfer_event> m_transfer_events;
+	std::unordered_map<const void *, uint64_t> m_transfer_event_seqs; // entry -> seq of the event that added it
+	uint64_t m_transfer_events_start = 1;
+	uint64_t m_transfer_event_seq = 0;
+	uint64_t m_transfer_events_epoch = 0; // part of every cursor handed out, not stored
+
+	// cumulative rct output distribution from the daemon, up to m_rct_distribution_top,
+	// extended on use and dropped if that block leaves our chain
+	uint64_t m_rct_distribution_start = 0;
+	std::vector<uint64_t> m_rct_distribution;
+	crypto::hash m_rct_distribution_top = crypto::null_hash;
+
 	cryptonote::account_public_address m_account_public_address;
 	std::unordered_map<crypto::public_key, cryptonote::subaddress_index> m_subaddresses;
 	std::vector<std::vector<std::string>> m_subaddress_labels;
@@ -1183,6 +1304,9 @@ class wallet2
 	bool m_is_initialized;
 	NodeRPCProxy m_node_rpc_proxy;
 	std::unordered_set<crypto::hash> m_scanned_pool_txs[2];
+	// the daemon's pool as of m_pool_revision, kept up to date from its changes
+	std::unordered_set<crypto::hash> m_pool_hashes;
+	uint64_t m_pool_revision = 0;
 	size_t m_subaddress_lookahead_major, m_subaddress_lookahead_minor;
 
 #if 0
@@ -1204,7 +1328,7 @@ class wallet2
 	std::unique_ptr<ringdb> m_ringdb;
 };
 }
-BOOST_CLASS_VERSION(tools::wallet2, 24)
+BOOST_CLASS_VERSION(tools::wallet2, 27)
 BOOST_CLASS_VERSION(tools::wallet2::transfer_details, 9)
 BOOST_CLASS_VERSION(tools::wallet2::multisig_info, 1)
 BOOST_CLASS_VERSION(tools::wallet2::multisig_info::LR, 0)
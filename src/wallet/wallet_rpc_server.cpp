@@ -55,6 +55,27 @@ const command_line::arg_descriptor<bool> arg_prompt_for_password = {"prompt-for-
 
 constexpr const char default_rpc_username[] = "ombre";
 
+// handlers that can be answered from wallet_rpc_server::wallet_view
+const std::set<std::string> view_methods = {"get_balance", "getbalance", "get_address", "getaddress", "get_height", "getheight", "get_transfers"};
+
+std::string get_json_rpc_method(const epee::net_utils::http::http_request_info &query_info)
+{
+	std::string method;
+	if(query_info.m_URI != "/json_rpc")
+		return method;
+	epee::serialization::portable_storage ps;
+	if(ps.load_from_json(query_info.m_body))
+		ps.get_value("method", method, nullptr);
+	return method;
+}
+
+// the same wallet, whatever the path, if the keys files are the same file
+bool is_same_wallet_file(const std::string &a, const std::string &b)
+{
+	boost::system::error_code ec;
+	return boost::filesystem::equivalent(a + ".keys", b + ".keys", ec) && !ec;
+}
+
 boost::optional<tools::password_container> password_prompter(const char *prompt, bool verify)
 {
 	auto pwd_container = tools::password_container::prompt(verify, prompt);
@@ -74,12 +95,23 @@ const char *wallet_rpc_server::tr(const char *str)
 }
 
 //------------------------------------------------------------------------------------------------------------------------------
-wallet_rpc_server::wallet_rpc_server(cryptonote::network_type nettype) : m_wallet(nullptr), rpc_login_file(), m_stop(false), m_trusted_daemon(false), m_vm(NULL), m_nettype(nettype)
+wallet_rpc_server::wallet_rpc_server(cryptonote::network_type nettype) : m_wallet(nullptr), m_view_dirty(true), rpc_login_file(), m_stop(false), m_trusted_daemon(false), m_vm(NULL), m_nettype(nettype)
 {
 }
 //------------------------------------------------------------------------------------------------------------------------------
 wallet_rpc_server::~wallet_rpc_server()
 {
+	for(auto &w : m_scan_wallets)
+	{
+		try
+		{
+			w.second->store();
+		}
+		catch(const std::exception &e)
+		{
+			LOG_ERROR("Failed to store scan wallet " << w.first << ": " << e.what());
+		}
+	}
 	stop_wallet_backend();
 }
 //------------------------------------------------------------------------------------------------------------------------------
@@ -87,15 +119,33 @@ bool wallet_rpc_server::run()
 {
 	m_stop = false;
 	m_net_server.add_idle_handler([this]() {
+		boost::unique_lock<boost::mutex> lock(m_wallet_mutex);
 		try
 		{
-			if(m_wallet)
-				m_wallet->refresh();
+			// readers are answered from the view for as long as the refresh runs
+			publish_view();
+			if(m_scan_wallets.empty())
+			{
+				if(m_wallet)
+					m_wallet->refresh();
+			}
+			else
+			{
+				wallet_scanner scanner;
+				uint64_t blocks_fetched;
+				if(m_wallet)
+					scanner.add_wallet(m_wallet);
+				for(auto &w : m_scan_wallets)
+					scanner.add_wallet(w.second.get());
+				scanner.refresh(blocks_fetched);
+			}
 		}
 		catch(const std::exception &ex)
 		{
 			LOG_ERROR("Exception at while refreshing, what=" << ex.what());
 		}
+		if(!view_is_current())
+			m_view_dirty.store(true, std::memory_order_release);
 		return true;
 	},
 								  20000);
@@ -109,8 +159,248 @@ bool wallet_rpc_server::run()
 	},
 								  500);
 
-	//DO NOT START THIS SERVER IN MORE THEN 1 THREADS WITHOUT REFACTORING
-	return epee::http_server_impl_base<wallet_rpc_server, connection_context>::run(1, true);
+	// wallet access is serialised by m_wallet_mutex, the extra threads are there so the
+	// view handlers keep answering while the auto refresh or a long request holds it
+	return epee::http_server_impl_base<wallet_rpc_server, connection_context>::run(std::max(2u, tools::get_max_concurrency()), true);
+}
+//------------------------------------------------------------------------------------------------------------------------------
+bool wallet_rpc_server::handle_http_request(const epee::net_utils::http::http_request_info &query_info, epee::net_utils::http::http_response_info &response, connection_context &m_conn_context)
+{
+	LOG_PRINT_L2("HTTP [" << m_conn_context.m_remote_address.host_str() << "] " << query_info.m_http_method_str << " " << query_info.m_URI);
+	response.m_response_code = 200;
+	response.m_response_comment = "Ok";
+
+	// wallet2 is not thread safe, everything but the view handlers runs under the
+	// wallet lock and may have changed what the view shows
+	const std::string method = get_json_rpc_method(query_info);
+	const bool view_method = view_methods.count(method) == 1;
+	boost::unique_lock<boost::mutex> lock(m_wallet_mutex, boost::defer_lock);
+	if(!view_method)
+		lock.lock();
+
+	if(!handle_http_request_map(query_info, response, m_conn_context))
+	{
+		response.m_response_code = 404;
+		response.m_response_comment = "Not found";
+	}
+
+	if(!view_method && method != "store")
+		m_view_dirty.store(true, std::memory_order_release);
+	return true;
+}
+//------------------------------------------------------------------------------------------------------------------------------
+std::shared_ptr<const wallet_rpc_server::wallet_view> wallet_rpc_server::get_view() const
+{
+	if(m_view_dirty.load(std::memory_order_acquire))
+		return nullptr;
+	return std::atomic_load(&m_view);
+}
+//------------------------------------------------------------------------------------------------------------------------------
+void wallet_rpc_server::reset_view()
+{
+	m_view_dirty.store(true, std::memory_order_release);
+	std::atomic_store(&m_view, std::shared_ptr<const wallet_view>());
+}
+//------------------------------------------------------------------------------------------------------------------------------
+bool wallet_rpc_server::view_is_current() const
+{
+	std::shared_ptr<const wallet_view> view = std::atomic_load(&m_view);
+	if(!view || !m_wallet)
+		return false;
+	if(view->height != m_wallet->get_blockchain_current_height() || view->cursor != m_wallet->get_transfer_events_cursor())
+		return false;
+
+	std::list<std::pair<crypto::hash, tools::wallet2::unconfirmed_transfer_details>> upayments;
+	m_wallet->get_unconfirmed_payments_out(upayments);
+	size_t failed = std::count_if(upayments.begin(), upayments.end(), [](const std::pair<crypto::hash, tools::wallet2::unconfirmed_transfer_details> &i) {
+		return i.second.m_state == tools::wallet2::unconfirmed_transfer_details::failed;
+	});
+	return upayments.size() == view->unconfirmed.size() && failed == view->unconfirmed_failed;
+}
+//------------------------------------------------------------------------------------------------------------------------------
+void wallet_rpc_server::publish_view()
+{
+	if(!m_wallet || !m_view_dirty.load(std::memory_order_acquire))
+		return;
+
+	std::shared_ptr<wallet_view> view = std::make_shared<wallet_view>();
+	view->restricted = m_wallet->restricted();
+	view->height = m_wallet->get_blockchain_current_height();
+	view->cursor = m_wallet->get_transfer_events_cursor();
+
+	const bool multisig_import_needed = m_wallet->multisig() && m_wallet->has_multisig_partial_key_images();
+	view->accounts.resize(m_wallet->get_num_subaddress_accounts());
+	for(uint32_t major = 0; major < view->accounts.size(); ++major)
+	{
+		wallet_view::account &account = view->accounts[major];
+		account.balance.balance = m_wallet->balance(major);
+		account.balance.unlocked_balance = m_wallet->unlocked_balance(major);
+		account.balance.multisig_import_needed = multisig_import_needed;
+		std::map<uint32_t, uint64_t> balance_per_subaddress = m_wallet->balance_per_subaddress(major);
+		std::map<uint32_t, uint64_t> unlocked_balance_per_subaddress = m_wallet->unlocked_balance_per_subaddress(major);
+		for(const auto &i : balance_per_subaddress)
+		{
+			wallet_rpc::COMMAND_RPC_GET_BALANCE::per_subaddress_info info;
+			const cryptonote::subaddress_index index = {major, i.first};
+			info.address_index = i.first;
+			info.address = m_wallet->get_subaddress_as_str(index);
+			info.balance = i.second;
+			info.unlocked_balance = unlocked_balance_per_subaddress[i.first];
+			info.label = m_wallet->get_subaddress_label(index);
+			info.num_unspent_outputs = 0;
+			account.balance.per_subaddress.push_back(info);
+		}
+
+		account.addresses.resize(m_wallet->get_num_subaddresses(major));
+		for(uint32_t minor = 0; minor < account.addresses.size(); ++minor)
+		{
+			wallet_rpc::COMMAND_RPC_GET_ADDRESS::address_info &info = account.addresses[minor];
+			const cryptonote::subaddress_index index = {major, minor};
+			info.address = m_wallet->get_subaddress_as_str(index);
+			info.label = m_wallet->get_subaddress_label(index);
+			info.address_index = minor;
+			info.used = false;
+		}
+	}
+
+	for(size_t i = 0; i < m_wallet->get_num_transfer_details(); ++i)
+	{
+		const tools::wallet2::transfer_details &td = m_wallet->get_transfer_details(i);
+		if(td.m_subaddr_index.major >= view->accounts.size())
+			continue;
+		wallet_view::account &account = view->accounts[td.m_subaddr_index.major];
+		if(td.m_subaddr_index.minor < account.addresses.size())
+			account.addresses[td.m_subaddr_index.minor].used = true;
+		if(td.m_spent)
+			continue;
+		auto &per_subaddress = account.balance.per_subaddress;
+		auto it = std::lower_bound(per_subaddress.begin(), per_subaddress.end(), td.m_subaddr_index.minor, [](const wallet_rpc::COMMAND_RPC_GET_BALANCE::per_subaddress_info &info, uint32_t minor) {
+			return info.address_index < minor;
+		});
+		if(it != per_subaddress.end() && it->address_index == td.m_subaddr_index.minor)
+			++it->num_unspent_outputs;
+	}
+
+	std::list<std::pair<crypto::hash, tools::wallet2::payment_details>> payments;
+	m_wallet->get_payments(payments, 0, cryptonote::common_config::CRYPTONOTE_MAX_BLOCK_NUMBER);
+	for(const auto &i : payments)
+	{
+		view->in.push_back(wallet_view::transfer());
+		fill_transfer_entry(view->in.back().entry, i.second.m_tx_hash, i.first, i.second);
+	}
+
+	std::list<std::pair<crypto::hash, tools::wallet2::confirmed_transfer_details>> payments_out;
+	m_wallet->get_payments_out(payments_out, 0, cryptonote::common_config::CRYPTONOTE_MAX_BLOCK_NUMBER);
+	for(const auto &i : payments_out)
+	{
+		view->out.push_back(wallet_view::transfer());
+		fill_transfer_entry(view->out.back().entry, i.first, i.second);
+		view->out.back().subaddr_indices = i.second.m_subaddr_indices;
+	}
+
+	std::list<std::pair<crypto::hash, tools::wallet2::unconfirmed_transfer_details>> upayments;
+	m_wallet->get_unconfirmed_payments_out(upayments);
+	view->unconfirmed_failed = 0;
+	for(const auto &i : upayments)
+	{
+		view->unconfirmed.push_back(wallet_view::transfer());
+		fill_transfer_entry(view->unconfirmed.back().entry, i.first, i.second);
+		view->unconfirmed.back().subaddr_indices = i.second.m_subaddr_indices;
+		if(i.second.m_state == tools::wallet2::unconfirmed_transfer_details::failed)
+			++view->unconfirmed_failed;
+	}
+
+	std::atomic_store(&m_view, std::shared_ptr<const wallet_view>(std::move(view)));
+	m_view_dirty.store(false, std::memory_order_release);
+}
+//------------------------------------------------------------------------------------------------------------------------------
+bool wallet_rpc_server::get_balance_from_view(const wallet_view &view, const wallet_rpc::COMMAND_RPC_GET_BALANCE::request &req, wallet_rpc::COMMAND_RPC_GET_BALANCE::response &res)
+{
+	if(req.account_index >= view.accounts.size())
+		return false;
+	res = view.accounts[req.account_index].balance;
+	return true;
+}
+//------------------------------------------------------------------------------------------------------------------------------
+bool wallet_rpc_server::get_address_from_view(const wallet_view &view, const wallet_rpc::COMMAND_RPC_GET_ADDRESS::request &req, wallet_rpc::COMMAND_RPC_GET_ADDRESS::response &res)
+{
+	if(req.account_index >= view.accounts.size())
+		return false;
+	const std::vector<wallet_rpc::COMMAND_RPC_GET_ADDRESS::address_info> &addresses = view.accounts[req.account_index].addresses;
+	if(addresses.empty())
+		return false;
+	for(uint32_t i : req.address_index)
+	{
+		if(i >= addresses.size())
+			return false;
+	}
+
+	if(req.address_index.empty())
+	{
+		res.addresses = addresses;
+	}
+	else
+	{
+		res.addresses.clear();
+		for(uint32_t i : req.address_index)
+			res.addresses.push_back(addresses[i]);
+	}
+	res.address = addresses[0].address;
+	return true;
+}
+//------------------------------------------------------------------------------------------------------------------------------
+bool wallet_rpc_server::get_transfers_from_view(const wallet_view &view, const wallet_rpc::COMMAND_RPC_GET_TRANSFERS::request &req, wallet_rpc::COMMAND_RPC_GET_TRANSFERS::response &res)
+{
+	// the event log and the pool both need the live wallet
+	if(view.restricted || req.cursor || req.limit || req.pool)
+		return false;
+
+	uint64_t min_height = 0, max_height = cryptonote::common_config::CRYPTONOTE_MAX_BLOCK_NUMBER;
+	if(req.filter_by_height)
+	{
+		min_height = req.min_height;
+		max_height = req.max_height <= max_height ? req.max_height : max_height;
+	}
+
+	auto in_subaddr = [&req](const cryptonote::subaddress_index &index) {
+		return req.account_index == index.major && (req.subaddr_indices.empty() || req.subaddr_indices.count(index.minor) == 1);
+	};
+	auto out_subaddr = [&req](const wallet_view::transfer &t) {
+		return req.account_index == t.entry.subaddr_index.major &&
+			   (req.subaddr_indices.empty() || std::count_if(t.subaddr_indices.begin(), t.subaddr_indices.end(), [&req](uint32_t index) { return req.subaddr_indices.count(index) == 1; }) != 0);
+	};
+
+	res.reset = false;
+	res.cursor = view.cursor;
+	if(req.in && min_height < max_height)
+	{
+		for(const auto &t : view.in)
+		{
+			if(min_height < t.entry.height && max_height >= t.entry.height && in_subaddr(t.entry.subaddr_index))
+				res.in.push_back(t.entry);
+		}
+	}
+
+	if(req.out && min_height < max_height)
+	{
+		for(const auto &t : view.out)
+		{
+			if(min_height < t.entry.height && max_height >= t.entry.height && out_subaddr(t))
+				res.out.push_back(t.entry);
+		}
+	}
+
+	if(req.pending || req.failed)
+	{
+		for(const auto &t : view.unconfirmed)
+		{
+			bool is_failed = t.entry.type == "failed";
+			if(!((req.failed && is_failed) || (!is_failed && req.pending)) || !out_subaddr(t))
+				continue;
+			(is_failed ? res.failed : res.pending).push_back(t.entry);
+		}
+	}
+	return true;
 }
 //------------------------------------------------------------------------------------------------------------------------------
 bool wallet_rpc_server::init(const boost::program_options::variables_map *vm)
@@ -304,6 +594,15 @@ void wallet_rpc_server::fill_transfer_entry(tools::wallet_rpc::transfer_entry &e
 //------------------------------------------------------------------------------------------------------------------------------
 bool wallet_rpc_server::on_getbalance(const wallet_rpc::COMMAND_RPC_GET_BALANCE::request &req, wallet_rpc::COMMAND_RPC_GET_BALANCE::response &res, epee::json_rpc::error &er)
 {
+	boost::unique_lock<boost::mutex> lock(m_wallet_mutex, boost::try_to_lock);
+	if(!lock.owns_lock())
+	{
+		std::shared_ptr<const wallet_view> view = get_view();
+		if(view && get_balance_from_view(*view, req, res))
+			return true;
+		lock.lock();
+	}
+
 	if(!m_wallet)
 		return not_open(er);
 	try
@@ -338,6 +637,15 @@ bool wallet_rpc_server::on_getbalance(const wallet_rpc::COMMAND_RPC_GET_BALANCE:
 //------------------------------------------------------------------------------------------------------------------------------
 bool wallet_rpc_server::on_getaddress(const wallet_rpc::COMMAND_RPC_GET_ADDRESS::request &req, wallet_rpc::COMMAND_RPC_GET_ADDRESS::response &res, epee::json_rpc::error &er)
 {
+	boost::unique_lock<boost::mutex> lock(m_wallet_mutex, boost::try_to_lock);
+	if(!lock.owns_lock())
+	{
+		std::shared_ptr<const wallet_view> view = get_view();
+		if(view && get_address_from_view(*view, req, res))
+			return true;
+		lock.lock();
+	}
+
 	if(!m_wallet)
 		return not_open(er);
 	try
@@ -545,6 +853,18 @@ bool wallet_rpc_server::on_set_account_tag_description(const wallet_rpc::COMMAND
 //------------------------------------------------------------------------------------------------------------------------------
 bool wallet_rpc_server::on_getheight(const wallet_rpc::COMMAND_RPC_GET_HEIGHT::request &req, wallet_rpc::COMMAND_RPC_GET_HEIGHT::response &res, epee::json_rpc::error &er)
 {
+	boost::unique_lock<boost::mutex> lock(m_wallet_mutex, boost::try_to_lock);
+	if(!lock.owns_lock())
+	{
+		std::shared_ptr<const wallet_view> view = get_view();
+		if(view)
+		{
+			res.height = view->height;
+			return true;
+		}
+		lock.lock();
+	}
+
 	if(!m_wallet)
 		return not_open(er);
 	try
@@ -818,7 +1138,7 @@ bool wallet_rpc_server::on_transfer_split(const wallet_rpc::COMMAND_RPC_TRANSFER
 		LOG_PRINT_L2("on_transfer_split calling create_transactions_2");
 		
 		std::vector<wallet2::pending_tx> ptx_vector = 
-			m_wallet->create_transactions_2(dsts, mixin, req.unlock_time, priority, check_pid(pid), req.account_index, req.subaddr_indices, m_trusted_daemon);
+			m_wallet->create_transactions_2(dsts, mixin, req.unlock_time, priority, check_pid(pid), req.account_index, req.subaddr_indices, m_trusted_daemon, req.payout);
 		
 		LOG_PRINT_L2("on_transfer_split called create_transactions_2");
 
@@ -1089,6 +1409,7 @@ bool wallet_rpc_server::on_store(const wallet_rpc::COMMAND_RPC_STORE::request &r
 
 	try
 	{
+		publish_view();
 		m_wallet->store();
 	}
 	catch(const std::exception &e)
@@ -1745,6 +2066,15 @@ bool wallet_rpc_server::on_check_reserve_proof(const wallet_rpc::COMMAND_RPC_CHE
 //------------------------------------------------------------------------------------------------------------------------------
 bool wallet_rpc_server::on_get_transfers(const wallet_rpc::COMMAND_RPC_GET_TRANSFERS::request &req, wallet_rpc::COMMAND_RPC_GET_TRANSFERS::response &res, epee::json_rpc::error &er)
 {
+	boost::unique_lock<boost::mutex> lock(m_wallet_mutex, boost::try_to_lock);
+	if(!lock.owns_lock())
+	{
+		std::shared_ptr<const wallet_view> view = get_view();
+		if(view && get_transfers_from_view(*view, req, res))
+			return true;
+		lock.lock();
+	}
+
 	if(!m_wallet)
 		return not_open(er);
 	if(m_wallet->restricted())
@@ -1761,7 +2091,42 @@ bool wallet_rpc_server::on_get_transfers(const wallet_rpc::COMMAND_RPC_GET_TRANS
 		max_height = req.max_height <= max_height ? req.max_height : max_height;
 	}
 
-	if(req.in)
+	res.reset = false;
+	if(req.cursor || req.limit)
+	{
+		// only what changed since the cursor, from the wallet's event log
+		auto filter = [&](const tools::wallet2::transfer_event &e) {
+			if(e.payment)
+			{
+				const tools::wallet2::payment_details &pd = e.payment->second;
+				return req.in && min_height < pd.m_block_height && max_height >= pd.m_block_height &&
+					   req.account_index == pd.m_subaddr_index.major &&
+					   (req.subaddr_indices.empty() || req.subaddr_indices.count(pd.m_subaddr_index.minor) == 1);
+			}
+			const tools::wallet2::confirmed_transfer_details &pd = e.tx->second;
+			return req.out && min_height < pd.m_block_height && max_height >= pd.m_block_height &&
+				   req.account_index == pd.m_subaddr_account &&
+				   (req.subaddr_indices.empty() || std::count_if(pd.m_subaddr_indices.begin(), pd.m_subaddr_indices.end(), [&req](uint32_t index) { return req.subaddr_indices.count(index) == 1; }) != 0);
+		};
+
+		std::vector<tools::wallet2::transfer_event> events;
+		res.reset = !m_wallet->get_transfer_events(req.cursor, req.limit, filter, events, res.cursor);
+		for(const auto &e : events)
+		{
+			std::list<wallet_rpc::transfer_entry> &entries = e.removed ? res.removed : e.payment ? res.in : res.out;
+			entries.push_back(wallet_rpc::transfer_entry());
+			if(e.payment)
+				fill_transfer_entry(entries.back(), e.payment->second.m_tx_hash, e.payment->first, e.payment->second);
+			else
+				fill_transfer_entry(entries.back(), e.tx->first, e.tx->second);
+		}
+	}
+	else
+	{
+		res.cursor = m_wallet->get_transfer_events_cursor();
+	}
+
+	if(req.in && !req.cursor && !req.limit)
 	{
 		std::list<std::pair<crypto::hash, tools::wallet2::payment_details>> payments;
 		m_wallet->get_payments(payments, min_height, max_height, req.account_index, req.subaddr_indices);
@@ -1772,7 +2137,7 @@ bool wallet_rpc_server::on_get_transfers(const wallet_rpc::COMMAND_RPC_GET_TRANS
 		}
 	}
 
-	if(req.out)
+	if(req.out && !req.cursor && !req.limit)
 	{
 		std::list<std::pair<crypto::hash, tools::wallet2::confirmed_transfer_details>> payments;
 		m_wallet->get_payments_out(payments, min_height, max_height, req.account_index, req.subaddr_indices);
@@ -2404,6 +2769,13 @@ bool wallet_rpc_server::on_open_wallet(const wallet_rpc::COMMAND_RPC_OPEN_WALLET
 		return false;
 
 	std::string wallet_file = m_wallet_dir + "/" + req.filename;
+	if(is_scan_wallet_file(wallet_file))
+	{
+		er.code = WALLET_RPC_ERROR_CODE_UNKNOWN_ERROR;
+		er.message = "Wallet is being scanned, remove it from the scan wallets first";
+		return false;
+	}
+
 	boost::program_options::variables_map vm = wallet_password_helper(req.password.c_str());
 	std::unique_ptr<tools::wallet2> wal = nullptr;
 
@@ -2449,6 +2821,95 @@ bool wallet_rpc_server::on_close_wallet(const wallet_rpc::COMMAND_RPC_CLOSE_WALL
 	return true;
 }
 //------------------------------------------------------------------------------------------------------------------------------
+bool wallet_rpc_server::on_add_scan_wallet(const wallet_rpc::COMMAND_RPC_ADD_SCAN_WALLET::request &req, wallet_rpc::COMMAND_RPC_ADD_SCAN_WALLET::response &res, epee::json_rpc::error &er)
+{
+	if(!wallet_path_helper(req.filename, er))
+		return false;
+
+	std::string wallet_file = m_wallet_dir + "/" + req.filename;
+	if(m_scan_wallets.find(req.filename) != m_scan_wallets.end() || is_scan_wallet_file(wallet_file))
+	{
+		er.code = WALLET_RPC_ERROR_CODE_UNKNOWN_ERROR;
+		er.message = "Wallet is already being scanned";
+		return false;
+	}
+	if(m_wallet && is_same_wallet_file(wallet_file, m_wallet->get_wallet_file()))
+	{
+		er.code = WALLET_RPC_ERROR_CODE_UNKNOWN_ERROR;
+		er.message = "Wallet is the open wallet, it is scanned already";
+		return false;
+	}
+
+	boost::program_options::variables_map vm = wallet_password_helper(req.password.c_str());
+
+	try
+	{
+		// scan wallets never spend, so they keep out of the ring database the open
+		// wallet holds, a second handle on it in this process would break its locking
+		std::unique_ptr<tools::wallet2> wal = tools::wallet2::make_from_file(vm, wallet_file, nullptr, false).first;
+		if(!wal)
+		{
+			er.code = WALLET_RPC_ERROR_CODE_UNKNOWN_ERROR;
+			er.message = "Failed to open wallet";
+			return false;
+		}
+
+		res.address = wal->get_address_as_str();
+		m_scan_wallets.emplace(req.filename, std::move(wal));
+	}
+	catch(const std::exception &e)
+	{
+		handle_rpc_exception(std::current_exception(), er, WALLET_RPC_ERROR_CODE_UNKNOWN_ERROR);
+		return false;
+	}
+	return true;
+}
+//------------------------------------------------------------------------------------------------------------------------------
+bool wallet_rpc_server::is_scan_wallet_file(const std::string &wallet_file) const
+{
+	return std::any_of(m_scan_wallets.begin(), m_scan_wallets.end(), [&wallet_file](const std::pair<const std::string, std::unique_ptr<wallet2>> &w) {
+		return is_same_wallet_file(wallet_file, w.second->get_wallet_file());
+	});
+}
+//------------------------------------------------------------------------------------------------------------------------------
+bool wallet_rpc_server::on_remove_scan_wallet(const wallet_rpc::COMMAND_RPC_REMOVE_SCAN_WALLET::request &req, wallet_rpc::COMMAND_RPC_REMOVE_SCAN_WALLET::response &res, epee::json_rpc::error &er)
+{
+	auto it = m_scan_wallets.find(req.filename);
+	if(it == m_scan_wallets.end())
+	{
+		er.code = WALLET_RPC_ERROR_CODE_UNKNOWN_ERROR;
+		er.message = "Wallet is not being scanned";
+		return false;
+	}
+
+	try
+	{
+		it->second->store();
+		m_scan_wallets.erase(it);
+	}
+	catch(const std::exception &e)
+	{
+		handle_rpc_exception(std::current_exception(), er, WALLET_RPC_ERROR_CODE_UNKNOWN_ERROR);
+		return false;
+	}
+	return true;
+}
+//------------------------------------------------------------------------------------------------------------------------------
+bool wallet_rpc_server::on_get_scan_wallets(const wallet_rpc::COMMAND_RPC_GET_SCAN_WALLETS::request &req, wallet_rpc::COMMAND_RPC_GET_SCAN_WALLETS::response &res, epee::json_rpc::error &er)
+{
+	for(const auto &w : m_scan_wallets)
+	{
+		wallet_rpc::COMMAND_RPC_GET_SCAN_WALLETS::scan_wallet_info info;
+		info.filename = w.first;
+		info.address = w.second->get_address_as_str();
+		info.height = w.second->get_blockchain_current_height();
+		info.balance = w.second->balance_all();
+		info.unlocked_balance = w.second->unlocked_balance_all();
+		res.wallets.push_back(std::move(info));
+	}
+	return true;
+}
+//------------------------------------------------------------------------------------------------------------------------------
 bool wallet_rpc_server::on_change_wallet_password(const wallet_rpc::COMMAND_RPC_CHANGE_WALLET_PASSWORD::request& req, wallet_rpc::COMMAND_RPC_CHANGE_WALLET_PASSWORD::response& res, epee::json_rpc::error& er)
 {
 	if(!m_wallet)
@@ -24,9 +24,14 @@
 #include "net/http_server_impl_base.h"
 #include "wallet2.h"
 #include "wallet_rpc_server_commands_defs.h"
+#include "wallet_scanner.h"
 #include "cryptonote_config.h"
+#include <atomic>
 #include <boost/program_options/options_description.hpp>
 #include <boost/program_options/variables_map.hpp>
+#include <boost/thread/mutex.hpp>
+#include <map>
+#include <memory>
 #include <string>
 
 //#undef RYO_DEFAULT_LOG_CATEGORY
@@ -52,6 +57,7 @@ class wallet_rpc_server : public epee::http_server_impl_base<wallet_rpc_server>
 
 	inline void stop_wallet_backend() 
 	{ 
+		reset_view();
 		if(m_wallet == nullptr) return;
 		m_wallet->store();
 		delete m_wallet;
@@ -65,7 +71,33 @@ class wallet_rpc_server : public epee::http_server_impl_base<wallet_rpc_server>
 	};
 
   private:
-	CHAIN_HTTP_TO_MAP2(connection_context); //forward http requests to uri map
+	// Answers for the read-only handlers, built from the wallet while holding
+	// m_wallet_mutex and then only ever read, so those handlers can be served
+	// from it while a refresh or store has the wallet
+	struct wallet_view
+	{
+		struct account
+		{
+			wallet_rpc::COMMAND_RPC_GET_BALANCE::response balance;
+			std::vector<wallet_rpc::COMMAND_RPC_GET_ADDRESS::address_info> addresses;
+		};
+		struct transfer
+		{
+			wallet_rpc::transfer_entry entry;
+			std::set<uint32_t> subaddr_indices;
+		};
+
+		bool restricted;
+		uint64_t height;
+		uint64_t cursor;
+		size_t unconfirmed_failed;
+		std::vector<account> accounts;
+		std::vector<transfer> in;
+		std::vector<transfer> out;
+		std::vector<transfer> unconfirmed;
+	};
+
+	bool handle_http_request(const epee::net_utils::http::http_request_info &query_info, epee::net_utils::http::http_response_info &response, connection_context &m_conn_context);
 
 	BEGIN_URI_MAP2()
 	BEGIN_JSON_RPC_MAP("/json_rpc")
@@ -131,6 +163,9 @@ class wallet_rpc_server : public epee::http_server_impl_base<wallet_rpc_server>
 	MAP_JON_RPC_WE("open_wallet", on_open_wallet, wallet_rpc::COMMAND_RPC_OPEN_WALLET)
 	MAP_JON_RPC_WE("change_wallet_password", on_change_wallet_password, wallet_rpc::COMMAND_RPC_CHANGE_WALLET_PASSWORD)
 	MAP_JON_RPC_WE("close_wallet", on_close_wallet, wallet_rpc::COMMAND_RPC_CLOSE_WALLET)
+	MAP_JON_RPC_WE("add_scan_wallet", on_add_scan_wallet, wallet_rpc::COMMAND_RPC_ADD_SCAN_WALLET)
+	MAP_JON_RPC_WE("remove_scan_wallet", on_remove_scan_wallet, wallet_rpc::COMMAND_RPC_REMOVE_SCAN_WALLET)
+	MAP_JON_RPC_WE("get_scan_wallets", on_get_scan_wallets, wallet_rpc::COMMAND_RPC_GET_SCAN_WALLETS)
 	MAP_JON_RPC_WE("is_multisig", on_is_multisig, wallet_rpc::COMMAND_RPC_IS_MULTISIG)
 	MAP_JON_RPC_WE("prepare_multisig", on_prepare_multisig, wallet_rpc::COMMAND_RPC_PREPARE_MULTISIG)
 	MAP_JON_RPC_WE("make_multisig", on_make_multisig, wallet_rpc::COMMAND_RPC_MAKE_MULTISIG)
@@ -202,6 +237,9 @@ class wallet_rpc_server : public epee::http_server_impl_base<wallet_rpc_server>
 	bool on_open_wallet(const wallet_rpc::COMMAND_RPC_OPEN_WALLET::request &req, wallet_rpc::COMMAND_RPC_OPEN_WALLET::response &res, epee::json_rpc::error &er);
 	bool on_change_wallet_password(const wallet_rpc::COMMAND_RPC_CHANGE_WALLET_PASSWORD::request& req, wallet_rpc::COMMAND_RPC_CHANGE_WALLET_PASSWORD::response& res, epee::json_rpc::error& er);
 	bool on_close_wallet(const wallet_rpc::COMMAND_RPC_CLOSE_WALLET::request &req, wallet_rpc::COMMAND_RPC_CLOSE_WALLET::response &res, epee::json_rpc::error &er);
+	bool on_add_scan_wallet(const wallet_rpc::COMMAND_RPC_ADD_SCAN_WALLET::request &req, wallet_rpc::COMMAND_RPC_ADD_SCAN_WALLET::response &res, epee::json_rpc::error &er);
+	bool on_remove_scan_wallet(const wallet_rpc::COMMAND_RPC_REMOVE_SCAN_WALLET::request &req, wallet_rpc::COMMAND_RPC_REMOVE_SCAN_WALLET::response &res, epee::json_rpc::error &er);
+	bool on_get_scan_wallets(const wallet_rpc::COMMAND_RPC_GET_SCAN_WALLETS::request &req, wallet_rpc::COMMAND_RPC_GET_SCAN_WALLETS::response &res, epee::json_rpc::error &er);
 	bool on_is_multisig(const wallet_rpc::COMMAND_RPC_IS_MULTISIG::request &req, wallet_rpc::COMMAND_RPC_IS_MULTISIG::response &res, epee::json_rpc::error &er);
 	bool on_prepare_multisig(const wallet_rpc::COMMAND_RPC_PREPARE_MULTISIG::request &req, wallet_rpc::COMMAND_RPC_PREPARE_MULTISIG::response &res, epee::json_rpc::error &er);
 	bool on_make_multisig(const wallet_rpc::COMMAND_RPC_MAKE_MULTISIG::request &req, wallet_rpc::COMMAND_RPC_MAKE_MULTISIG::response &res, epee::json_rpc::error &er);
@@ -227,10 +265,24 @@ class wallet_rpc_server : public epee::http_server_impl_base<wallet_rpc_server>
 					   bool get_tx_key, Ts &tx_key, Tu &amount, Tu &fee, std::string &multisig_txset, bool do_not_relay,
 					   Ts &tx_hash, bool get_tx_hex, Ts &tx_blob, bool get_tx_metadata, Ts &tx_metadata, epee::json_rpc::error &er);
 
+	std::shared_ptr<const wallet_view> get_view() const;
+	void publish_view();
+	void reset_view();
+	bool view_is_current() const;
+	static bool get_balance_from_view(const wallet_view &view, const wallet_rpc::COMMAND_RPC_GET_BALANCE::request &req, wallet_rpc::COMMAND_RPC_GET_BALANCE::response &res);
+	static bool get_address_from_view(const wallet_view &view, const wallet_rpc::COMMAND_RPC_GET_ADDRESS::request &req, wallet_rpc::COMMAND_RPC_GET_ADDRESS::response &res);
+	static bool get_transfers_from_view(const wallet_view &view, const wallet_rpc::COMMAND_RPC_GET_TRANSFERS::request &req, wallet_rpc::COMMAND_RPC_GET_TRANSFERS::response &res);
+
 	boost::program_options::variables_map wallet_password_helper(const char* rpc_pwd);
 	bool wallet_path_helper(const std::string& filename, epee::json_rpc::error &er);
+	bool is_scan_wallet_file(const std::string &wallet_file) const;
 
 	wallet2 *m_wallet;
+	boost::mutex m_wallet_mutex;
+	std::shared_ptr<const wallet_view> m_view;
+	std::atomic<bool> m_view_dirty;
+	// view wallets refreshed together with m_wallet through one wallet_scanner pass
+	std::map<std::string, std::unique_ptr<wallet2>> m_scan_wallets;
 	std::string m_wallet_dir;
 	tools::private_file rpc_login_file;
 	std::atomic<bool> m_stop;
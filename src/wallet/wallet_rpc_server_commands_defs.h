@@ -439,6 +439,7 @@ struct COMMAND_RPC_TRANSFER_SPLIT
 		bool do_not_relay;
 		bool get_tx_hex;
 		bool get_tx_metadata;
+		bool payout;
 
 		BEGIN_KV_SERIALIZE_MAP()
 		KV_SERIALIZE(destinations)
@@ -453,6 +454,7 @@ struct COMMAND_RPC_TRANSFER_SPLIT
 		KV_SERIALIZE_OPT(do_not_relay, false)
 		KV_SERIALIZE_OPT(get_tx_hex, false)
 		KV_SERIALIZE_OPT(get_tx_metadata, false)
+		KV_SERIALIZE_OPT(payout, false)
 		END_KV_SERIALIZE_MAP()
 	};
 
@@ -1207,6 +1209,11 @@ struct COMMAND_RPC_GET_TRANSFERS
 		uint32_t account_index;
 		std::set<uint32_t> subaddr_indices;
 
+		// in and out entries added or removed after this cursor only, in the
+		// order they happened, at most limit of them (0 for no limit)
+		uint64_t cursor;
+		uint32_t limit;
+
 		BEGIN_KV_SERIALIZE_MAP()
 		KV_SERIALIZE(in);
 		KV_SERIALIZE(out);
@@ -1218,6 +1225,8 @@ struct COMMAND_RPC_GET_TRANSFERS
 		KV_SERIALIZE_OPT(max_height, cryptonote::common_config::CRYPTONOTE_MAX_BLOCK_NUMBER);
 		KV_SERIALIZE(account_index);
 		KV_SERIALIZE(subaddr_indices);
+		KV_SERIALIZE_OPT(cursor, (uint64_t)0);
+		KV_SERIALIZE_OPT(limit, (uint32_t)0);
 		END_KV_SERIALIZE_MAP()
 	};
 
@@ -1228,6 +1237,9 @@ struct COMMAND_RPC_GET_TRANSFERS
 		std::list<transfer_entry> pending;
 		std::list<transfer_entry> failed;
 		std::list<transfer_entry> pool;
+		std::list<transfer_entry> removed; // in and out entries undone by a reorg since the cursor
+		uint64_t cursor;				   // pass this next time to get what changed since
+		bool reset;						   // the cursor was from another log, e.g. before the wallet was loaded, everything was returned
 
 		BEGIN_KV_SERIALIZE_MAP()
 		KV_SERIALIZE(in);
@@ -1235,6 +1247,9 @@ struct COMMAND_RPC_GET_TRANSFERS
 		KV_SERIALIZE(pending);
 		KV_SERIALIZE(failed);
 		KV_SERIALIZE(pool);
+		KV_SERIALIZE(removed);
+		KV_SERIALIZE(cursor);
+		KV_SERIALIZE(reset);
 		END_KV_SERIALIZE_MAP()
 	};
 };
@@ -1678,6 +1693,80 @@ struct COMMAND_RPC_CLOSE_WALLET
 	};
 };
 
+struct COMMAND_RPC_ADD_SCAN_WALLET
+{
+	struct request
+	{
+		std::string filename;
+		std::string password;
+
+		BEGIN_KV_SERIALIZE_MAP()
+		KV_SERIALIZE(filename)
+		KV_SERIALIZE(password)
+		END_KV_SERIALIZE_MAP()
+	};
+	struct response
+	{
+		std::string address;
+
+		BEGIN_KV_SERIALIZE_MAP()
+		KV_SERIALIZE(address)
+		END_KV_SERIALIZE_MAP()
+	};
+};
+
+struct COMMAND_RPC_REMOVE_SCAN_WALLET
+{
+	struct request
+	{
+		std::string filename;
+
+		BEGIN_KV_SERIALIZE_MAP()
+		KV_SERIALIZE(filename)
+		END_KV_SERIALIZE_MAP()
+	};
+	struct response
+	{
+		BEGIN_KV_SERIALIZE_MAP()
+		END_KV_SERIALIZE_MAP()
+	};
+};
+
+struct COMMAND_RPC_GET_SCAN_WALLETS
+{
+	struct request
+	{
+		BEGIN_KV_SERIALIZE_MAP()
+		END_KV_SERIALIZE_MAP()
+	};
+
+	struct scan_wallet_info
+	{
+		std::string filename;
+		std::string address;
+		uint64_t height;
+		uint64_t balance;
+		uint64_t unlocked_balance;
+
+		BEGIN_KV_SERIALIZE_MAP()
+		KV_SERIALIZE(filename)
+		KV_SERIALIZE(address)
+		KV_SERIALIZE(height)
+		KV_SERIALIZE(balance)
+		KV_SERIALIZE(unlocked_balance)
+		END_KV_SERIALIZE_MAP()
+	};
+
+	struct response
+	{
+		std::vector<scan_wallet_info> wallets;
+
+		BEGIN_KV_SERIALIZE_MAP()
+		KV_SERIALIZE(wallets)
+		END_KV_SERIALIZE_MAP()
+	};
+};
+
 struct COMMAND_RPC_IS_MULTISIG
 {
 	struct request
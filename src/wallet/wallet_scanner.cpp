@@ -0,0 +1,179 @@
+// Copyright (c) 2018, Ryo Currency Project
+// Portions copyright (c) 2014-2018, The Monero Project
+//
+// Portions of this file are available under BSD-3 license. Please see ORIGINAL-LICENSE for details
+// All rights reserved.
+//
+// ombre changes to this code are in public domain. Please note, other licences may apply to the file.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "wallet_scanner.h"
+#include "common/threadpool.h"
+
+#include <algorithm>
+
+#undef RYO_DEFAULT_LOG_CATEGORY
+#define RYO_DEFAULT_LOG_CATEGORY "wallet.scanner"
+
+namespace tools
+{
+//----------------------------------------------------------------------------------------------------
+void wallet_scanner::add_wallet(wallet2 *wallet)
+{
+	if(std::find(m_wallets.begin(), m_wallets.end(), wallet) == m_wallets.end())
+		m_wallets.push_back(wallet);
+}
+//----------------------------------------------------------------------------------------------------
+void wallet_scanner::remove_wallet(wallet2 *wallet)
+{
+	m_wallets.erase(std::remove(m_wallets.begin(), m_wallets.end(), wallet), m_wallets.end());
+}
+//----------------------------------------------------------------------------------------------------
+void wallet_scanner::stop()
+{
+	m_run.store(false, std::memory_order_relaxed);
+	for(wallet2 *wallet : m_wallets)
+		wallet->stop();
+}
+//----------------------------------------------------------------------------------------------------
+void wallet_scanner::refresh_alone(wallet2 *wallet)
+{
+	try
+	{
+		wallet->refresh();
+	}
+	catch(const std::exception &e)
+	{
+		LOG_ERROR("Failed to refresh wallet " << wallet->get_address_as_str() << ": " << e.what());
+	}
+}
+//----------------------------------------------------------------------------------------------------
+void wallet_scanner::refresh(uint64_t &blocks_fetched)
+{
+	blocks_fetched = 0;
+	if(m_wallets.empty())
+		return;
+
+	tools::threadpool &tpool = tools::threadpool::getInstance();
+	std::vector<wallet2 *> wallets = m_wallets;
+	std::vector<wallet2 *> stragglers;
+	m_run.store(true, std::memory_order_relaxed);
+
+	// restore heights are per wallet, skip ahead on hashes alone like wallet2::refresh does
+	for(wallet2 *wallet : wallets)
+	{
+		wallet->m_run.store(true, std::memory_order_relaxed);
+		if(wallet->m_explicit_refresh_from_block_height && wallet->m_refresh_from_block_height > wallet->m_blockchain.size())
+		{
+			std::list<crypto::hash> short_chain_history;
+			uint64_t blocks_start_height;
+			wallet->get_short_chain_history(short_chain_history);
+			wallet->fast_refresh(wallet->m_refresh_from_block_height, blocks_start_height, short_chain_history);
+		}
+	}
+
+	size_t try_count = 0;
+	while(m_run.load(std::memory_order_relaxed) && !wallets.empty())
+	{
+		// the wallet furthest behind drives the stream, everyone else is at or past
+		// the start of its batch and simply skips the blocks it already has
+		wallet2 *lead = *std::min_element(wallets.begin(), wallets.end(), [](const wallet2 *a, const wallet2 *b) {
+			return a->m_blockchain.size() < b->m_blockchain.size();
+		});
+
+		std::list<crypto::hash> short_chain_history;
+		uint64_t blocks_start_height;
+		std::list<cryptonote::block_complete_entry> blocks;
+		std::vector<cryptonote::COMMAND_RPC_GET_BLOCKS_FAST::block_output_indices> o_indices;
+		std::vector<wallet2::parsed_block> parsed;
+		try
+		{
+			lead->get_short_chain_history(short_chain_history);
+			lead->pull_blocks(0, blocks_start_height, short_chain_history, blocks, o_indices);
+			// transactions are parsed for the blocks any of the wallets scans
+			wallet2::parse_blocks(blocks_start_height, blocks, [&wallets](uint64_t height, const cryptonote::block &b) {
+				return std::any_of(wallets.begin(), wallets.end(), [&](const wallet2 *wallet) { return wallet->wants_block_txes(height, b); });
+			}, parsed);
+		}
+		catch(const std::exception &)
+		{
+			if(try_count < 3)
+			{
+				LOG_PRINT_L1("Another try pull_blocks (try_count=" << try_count << ")...");
+				++try_count;
+				continue;
+			}
+			LOG_ERROR("pull_blocks failed, try_count=" << try_count);
+			throw;
+		}
+		if(parsed.empty())
+			break;
+
+		std::vector<uint64_t> added(wallets.size(), 0);
+		std::deque<bool> failed(wallets.size(), false);
+		tools::threadpool::waiter waiter;
+		for(size_t i = 0; i < wallets.size(); ++i)
+		{
+			tpool.submit(&waiter, [&, i] {
+				try
+				{
+					wallets[i]->process_parsed_blocks(blocks_start_height, parsed, o_indices, added[i]);
+				}
+				catch(const std::exception &e)
+				{
+					MDEBUG("Shared scan failed for a wallet at height " << blocks_start_height << ": " << e.what());
+					failed[i] = true;
+				}
+			});
+		}
+		waiter.wait();
+
+		uint64_t round_added = 0;
+		for(size_t i = wallets.size(); i-- > 0;)
+		{
+			round_added = std::max(round_added, added[i]);
+			if(failed[i])
+			{
+				stragglers.push_back(wallets[i]);
+				wallets.erase(wallets.begin() + i);
+			}
+		}
+		blocks_fetched += round_added;
+		if(round_added == 0)
+			break;
+	}
+
+	for(wallet2 *wallet : stragglers)
+		refresh_alone(wallet);
+
+	// pool state is per wallet anyway, but each has its own daemon connection
+	tools::threadpool::waiter waiter;
+	for(wallet2 *wallet : wallets)
+	{
+		tpool.submit(&waiter, [wallet] {
+			wallet->m_node_rpc_proxy.set_height(wallet->m_blockchain.size());
+			try
+			{
+				if(wallet->m_run.load(std::memory_order_relaxed))
+					wallet->update_pool_state(true);
+			}
+			catch(...)
+			{
+				LOG_PRINT_L1("Failed to check pending transactions");
+			}
+		});
+	}
+	waiter.wait();
+
+	LOG_PRINT_L1("Scan done for " << m_wallets.size() << " wallets, blocks received: " << blocks_fetched);
+}
+}
@@ -0,0 +1,61 @@
+// Copyright (c) 2018, Ryo Currency Project
+// Portions copyright (c) 2014-2018, The Monero Project
+//
+// Portions of this file are available under BSD-3 license. Please see ORIGINAL-LICENSE for details
+// All rights reserved.
+//
+// ombre changes to this code are in public domain. Please note, other licences may apply to the file.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include "wallet2.h"
+
+namespace tools
+{
+/*!
+ * \brief Refreshes a set of wallets against one daemon with a single block stream.
+ *
+ * Each batch from getblocks.bin is fetched and deserialized once and then handed to
+ * every registered wallet in parallel, so scanning N wallets costs one download and
+ * one parse of the chain plus N key derivations per transaction. The wallets keep
+ * their own state; the scanner only borrows them for the duration of refresh().
+ */
+class wallet_scanner
+{
+  public:
+	wallet_scanner() : m_run(true) {}
+
+	void add_wallet(wallet2 *wallet);
+	void remove_wallet(wallet2 *wallet);
+	size_t size() const { return m_wallets.size(); }
+
+	/*!
+     * \brief Brings every registered wallet up to the daemon's top block.
+     * \param blocks_fetched number of new blocks seen by the furthest behind wallet
+     *
+     * A wallet whose local chain cannot follow the shared stream, e.g. one that
+     * is on a fork deeper than the batch, is refreshed on its own afterwards.
+     */
+	void refresh(uint64_t &blocks_fetched);
+	void stop();
+
+  private:
+	void refresh_alone(wallet2 *wallet);
+
+	std::vector<wallet2 *> m_wallets;
+	std::atomic<bool> m_run;
+};
+}
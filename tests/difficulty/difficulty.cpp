@@ -29,6 +29,7 @@
 // Parts of this file are originally copyright (c) 2012-2013 The Cryptonote developers
 
 #include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <fstream>
@@ -41,51 +42,95 @@
 using namespace std;
 
 #define DEFAULT_TEST_DIFFICULTY_TARGET 240
+#define BENCHMARK_ROUNDS 100
 
+// Checks difficulty_window against next_difficulty_v1 on every window of
+// the data, moving it forward block by block and rolling each step back
+// and forth once, then times both on the same walk over the data.
 int main(int argc, char *argv[])
 {
+	using namespace cryptonote;
 	if(argc != 2)
 	{
 		cerr << "Wrong arguments" << endl;
 		return 1;
 	}
-	/*vector<uint64_t> timestamps, cumulative_difficulties;
+	vector<uint64_t> timestamps, cumulative_difficulties;
 	fstream data(argv[1], fstream::in);
 	data.exceptions(fstream::badbit);
 	data.clear(data.rdstate());
 	uint64_t timestamp, difficulty, cumulative_difficulty = 0;
-	size_t n = 0;
 	while(data >> timestamp >> difficulty)
 	{
-		using namespace cryptonote;
-		size_t begin, end;
-		if(n < common_config::DIFFICULTY_WINDOW_V1 + common_config::DIFFICULTY_LAG_V1)
+		timestamps.push_back(timestamp);
+		cumulative_difficulties.push_back(cumulative_difficulty += difficulty);
+	}
+	if(!data.eof())
+	{
+		data.clear(fstream::badbit);
+	}
+
+	const size_t window_size = common_config::DIFFICULTY_BLOCKS_COUNT_V2;
+	difficulty_window window(window_size, DEFAULT_TEST_DIFFICULTY_TARGET);
+	for(size_t n = 0; n < timestamps.size(); ++n)
+	{
+		size_t begin = n + 1 - min(n + 1, window_size);
+		difficulty_type expected = next_difficulty_v1(
+			vector<uint64_t>(timestamps.begin() + begin, timestamps.begin() + n + 1),
+			vector<uint64_t>(cumulative_difficulties.begin() + begin, cumulative_difficulties.begin() + n + 1),
+			DEFAULT_TEST_DIFFICULTY_TARGET);
+
+		window.push_back(timestamps[n], cumulative_difficulties[n]);
+		if(window.next_difficulty() != expected)
 		{
-			begin = 0;
-			end = min(n, (size_t)common_config::DIFFICULTY_WINDOW_V1);
+			cerr << "Wrong difficulty after block " << n << endl
+				 << "Expected: " << expected << endl
+				 << "Found: " << window.next_difficulty() << endl;
+			return 1;
 		}
-		else
+
+		window.pop_back();
+		if(begin > 0)
+			window.push_front(timestamps[begin - 1], cumulative_difficulties[begin - 1]);
+		window.push_back(timestamps[n], cumulative_difficulties[n]);
+		if(window.next_difficulty() != expected)
 		{
-			end = n - common_config::DIFFICULTY_LAG_V1;
-			begin = end - common_config::DIFFICULTY_WINDOW_V1;
+			cerr << "Wrong difficulty after rolling back block " << n << endl
+				 << "Expected: " << expected << endl
+				 << "Found: " << window.next_difficulty() << endl;
+			return 1;
 		}
-		uint64_t res = next_difficulty_v3(
-			vector<uint64_t>(timestamps.begin() + begin, timestamps.begin() + end),
-			vector<uint64_t>(cumulative_difficulties.begin() + begin, cumulative_difficulties.begin() + end));
-		if(res != difficulty)
+	}
+
+	difficulty_type sum = 0;
+	auto start = chrono::steady_clock::now();
+	for(size_t round = 0; round < BENCHMARK_ROUNDS; ++round)
+	{
+		for(size_t n = 0; n < timestamps.size(); ++n)
 		{
-			cerr << "Wrong difficulty for block " << n << endl
-				 << "Expected: " << difficulty << endl
-				 << "Found: " << res << endl;
-			return 1;
+			size_t begin = n + 1 - min(n + 1, window_size);
+			sum += next_difficulty_v1(
+				vector<uint64_t>(timestamps.begin() + begin, timestamps.begin() + n + 1),
+				vector<uint64_t>(cumulative_difficulties.begin() + begin, cumulative_difficulties.begin() + n + 1),
+				DEFAULT_TEST_DIFFICULTY_TARGET);
 		}
-		timestamps.push_back(timestamp);
-		cumulative_difficulties.push_back(cumulative_difficulty += difficulty);
-		++n;
 	}
-	if(!data.eof())
+	auto full = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count();
+
+	start = chrono::steady_clock::now();
+	for(size_t round = 0; round < BENCHMARK_ROUNDS; ++round)
 	{
-		data.clear(fstream::badbit);
-	}*/
-	return 0;
+		window.clear();
+		for(size_t n = 0; n < timestamps.size(); ++n)
+		{
+			window.push_back(timestamps[n], cumulative_difficulties[n]);
+			sum -= window.next_difficulty();
+		}
+	}
+	auto incremental = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count();
+
+	size_t steps = BENCHMARK_ROUNDS * timestamps.size();
+	cout << "next_difficulty_v1: " << full / steps << " ns/block" << endl
+		 << "difficulty_window:  " << incremental / steps << " ns/block" << endl;
+	return sum == 0 ? 0 : 1;
 }
@@ -28,7 +28,9 @@
 //
 // Parts of this file are originally copyright (c) 2012-2013 The Cryptonote developers
 
+#include <algorithm>
 #include <cstddef>
+#include <cstring>
 #include <fstream>
 #include <iomanip>
 #include <ios>
@@ -37,6 +39,7 @@
 #include "../io.h"
 #include "crypto/pow_hash/cn_slow_hash.hpp"
 #include "crypto/hash.h"
+#include "crypto/keccak.h"
 #include "crypto/pow_hash/aux_hash.h"
 #include "warnings.h"
 
@@ -55,6 +58,42 @@ static void hash_tree(const void *data, size_t length, char *hash)
 	}
 	tree_hash((const char(*)[crypto::HASH_SIZE])data, length >> 5, hash);
 }
+static void cn_fast_hash_lanes(const void *data, size_t length, char *hash)
+{
+	// nine inputs, each a different length prefix of the data, go through
+	// every lane width the CPU can run (9 = 8 + 1, 4 + 4 + 1, 2 + 2 + 2 + 2 + 1)
+	// and each hash has to match the scalar one
+	const size_t n = 9;
+	const uint8_t *in[n];
+	size_t len[n];
+	chash out[n];
+	uint8_t *outp[n];
+	for(size_t i = 0; i < n; i++)
+	{
+		in[i] = (const uint8_t *)data;
+		len[i] = length - std::min(i, length);
+		outp[i] = (uint8_t *)&out[i];
+	}
+	for(size_t lanes = 1; lanes <= keccak_max_lanes(); lanes *= 2)
+	{
+		memset(out, 0, sizeof(out));
+		keccak_multi_lanes(in, len, outp, n, HASH_SIZE, lanes);
+		for(size_t i = 1; i < n; i++)
+		{
+			if(out[i] != cn_fast_hash(data, len[i]))
+				throw ios_base::failure("Lane mismatch in keccak_multi_lanes with " + std::to_string(lanes) + " lanes");
+		}
+	}
+
+	// and through the dispatching entry point
+	cn_fast_hash_multi((const void *const *)in, len, (char *const *)outp, n);
+	for(size_t i = 1; i < n; i++)
+	{
+		if(out[i] != cn_fast_hash(data, len[i]))
+			throw ios_base::failure("Lane mismatch in cn_fast_hash_multi");
+	}
+	memcpy(hash, &out[0], HASH_SIZE);
+}
 static void cn_pow_hash_original(const void *data, size_t length, char *hash)
 {
 	cn_pow_hash_v2 ctx;
@@ -108,6 +147,7 @@ struct hash_func
 	hash_f &f;
 } hashes[] = {
 	{"fast", cn_fast_hash},
+	{"fast-multi", cn_fast_hash_lanes},
 	{"pow-original", cn_pow_hash_original},
 	{"tree", hash_tree},
 	{"extra-blake", hash_extra_blake},
@@ -40,9 +40,16 @@ enum test_op
 	op_sc_mul,
 	op_ge_add_raw,
 	op_ge_add_p3_p3,
+	op_ge_p1p1_to_p3,
+	op_ge_p3_is_point_at_infinity,
+	op_ge_p3_is_point_at_infinity_identity,
+	op_fe_add,
+	op_fe_tobytes,
 	op_zeroCommitCached,
 	ops_fast,
 
+	op_ge_p3_tobytes,
+
 	op_addKeys,
 	op_scalarmultBase,
 	op_scalarmultKey,
@@ -76,6 +83,10 @@ class test_crypto_ops
 		if(ge_frombytes_vartime(&p3_1, point1.bytes) != 0)
 			return false;
 		ge_p3_to_cached(&cached, &p3_0);
+		ge_add(&p1p1, &p3_1, &cached);
+		// the identity as the multiexp loops meet it, with unreduced limbs
+		ge_sub(&p1p1_identity, &p3_0, &cached);
+		ge_p1p1_to_p3(&identity, &p1p1_identity);
 		rct::precomp(precomp0, point0);
 		rct::precomp(precomp1, point1);
 		return true;
@@ -87,6 +98,8 @@ class test_crypto_ops
 		ge_cached tmp_cached;
 		ge_p1p1 tmp_p1p1;
 		ge_p2 tmp_p2;
+		ge_p3 tmp_p3;
+		fe tmp_fe;
 		ge_dsmp dsmp;
 		switch(op)
 		{
@@ -109,6 +122,26 @@ class test_crypto_ops
 		case op_ge_add_raw:
 			ge_add(&tmp_p1p1, &p3_1, &cached);
 			break;
+		case op_ge_p1p1_to_p3:
+			ge_p1p1_to_p3(&tmp_p3, &p1p1);
+			break;
+		case op_ge_p3_is_point_at_infinity:
+			if(ge_p3_is_point_at_infinity(&p3_0))
+				return false;
+			break;
+		case op_ge_p3_is_point_at_infinity_identity:
+			if(!ge_p3_is_point_at_infinity(&identity))
+				return false;
+			break;
+		case op_fe_add:
+			fe_add(tmp_fe, p3_0.X, p3_1.Y);
+			break;
+		case op_fe_tobytes:
+			fe_tobytes(key.bytes, p3_0.X);
+			break;
+		case op_ge_p3_tobytes:
+			ge_p3_tobytes(key.bytes, &p3_0);
+			break;
 		case op_addKeys:
 			rct::addKeys(key, point0, point1);
 			break;
@@ -166,7 +199,8 @@ class test_crypto_ops
   private:
 	rct::key scalar0, scalar1;
 	rct::key point0, point1;
-	ge_p3 p3_0, p3_1;
+	ge_p3 p3_0, p3_1, identity;
+	ge_p1p1 p1p1, p1p1_identity;
 	ge_cached cached;
 	ge_dsmp precomp0, precomp1;
 };
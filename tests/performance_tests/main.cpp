@@ -206,6 +206,12 @@ int main(int argc, char **argv)
 	TEST_PERFORMANCE1(filter, p, test_crypto_ops, op_sc_mul);
 	TEST_PERFORMANCE1(filter, p, test_crypto_ops, op_ge_add_raw);
 	TEST_PERFORMANCE1(filter, p, test_crypto_ops, op_ge_add_p3_p3);
+	TEST_PERFORMANCE1(filter, p, test_crypto_ops, op_ge_p1p1_to_p3);
+	TEST_PERFORMANCE1(filter, p, test_crypto_ops, op_ge_p3_is_point_at_infinity);
+	TEST_PERFORMANCE1(filter, p, test_crypto_ops, op_ge_p3_is_point_at_infinity_identity);
+	TEST_PERFORMANCE1(filter, p, test_crypto_ops, op_ge_p3_tobytes);
+	TEST_PERFORMANCE1(filter, p, test_crypto_ops, op_fe_add);
+	TEST_PERFORMANCE1(filter, p, test_crypto_ops, op_fe_tobytes);
 	TEST_PERFORMANCE1(filter, p, test_crypto_ops, op_addKeys);
 	TEST_PERFORMANCE1(filter, p, test_crypto_ops, op_scalarmultBase);
 	TEST_PERFORMANCE1(filter, p, test_crypto_ops, op_scalarmultKey);
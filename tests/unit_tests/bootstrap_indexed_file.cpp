@@ -0,0 +1,171 @@
+// Copyright (c) 2014-2018, The Monero Project
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// FIXME: move this into a full wallet2 unit test suite, if possible
+
+#include "gtest/gtest.h"
+#include <boost/filesystem.hpp>
+
+#include "blockchain_utilities/bootstrap_indexed_file.h"
+#include "cryptonote_basic/cryptonote_format_utils.h"
+
+namespace
+{
+bootstrap::block_package make_block(uint64_t height, uint32_t nonce)
+{
+	bootstrap::block_package bp;
+	bp.block.major_version = 1;
+	bp.block.minor_version = 0;
+	bp.block.timestamp = 1500000000 + height * 120;
+	bp.block.prev_id = crypto::null_hash;
+	bp.block.nonce = nonce;
+	bp.block.miner_tx.version = 1;
+	bp.block.miner_tx.unlock_time = height + 60;
+	cryptonote::txin_gen in;
+	in.height = height;
+	bp.block.miner_tx.vin.push_back(in);
+	bp.block_size = 100 + height;
+	bp.cumulative_difficulty = height + 1;
+	bp.coins_generated = height * 1000;
+	return bp;
+}
+
+// a chain of the given height, with block fork_height on mined with another nonce
+std::function<bool(uint64_t, bootstrap::block_package &)> make_chain(uint64_t height, uint64_t fork_height = (uint64_t)-1)
+{
+	return [height, fork_height](uint64_t h, bootstrap::block_package &bp) {
+		if(h >= height)
+			return false;
+		bp = make_block(h, h >= fork_height ? 2 * h + 1 : 2 * h);
+		return true;
+	};
+}
+
+// reads every block of the file back and compares them with the chain
+void check_file(const boost::filesystem::path &path, uint64_t height, const std::function<bool(uint64_t, bootstrap::block_package &)> &chain)
+{
+	BootstrapIndexedFile reader;
+	ASSERT_TRUE(reader.open_reader(path.string()));
+	ASSERT_EQ(0, reader.first_height());
+	ASSERT_EQ(height, reader.block_count());
+
+	uint64_t next = 0;
+	std::string stored;
+	uint32_t raw_size;
+	int ret;
+	while((ret = reader.read_chunk(stored, raw_size)) == 0)
+	{
+		std::vector<bootstrap::block_package> blocks;
+		ASSERT_TRUE(reader.decode_chunk(stored, raw_size, blocks));
+		for(const bootstrap::block_package &bp : blocks)
+		{
+			bootstrap::block_package expected;
+			ASSERT_TRUE(chain(next, expected));
+			ASSERT_EQ(cryptonote::get_block_hash(expected.block), cryptonote::get_block_hash(bp.block));
+			ASSERT_EQ(expected.block_size, bp.block_size);
+			ASSERT_EQ(expected.coins_generated, bp.coins_generated);
+			++next;
+		}
+	}
+	ASSERT_EQ(1, ret);
+	ASSERT_EQ(height, next);
+}
+}
+
+class BootstrapIndexedFileTest : public ::testing::Test
+{
+  protected:
+	virtual void SetUp()
+	{
+		dir = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+		path = dir / "blockchain.raw";
+	}
+
+	virtual void TearDown()
+	{
+		boost::system::error_code ec;
+		boost::filesystem::remove_all(dir, ec);
+	}
+
+	boost::filesystem::path dir;
+	boost::filesystem::path path;
+};
+
+TEST_F(BootstrapIndexedFileTest, write_append_read)
+{
+	const auto chain = make_chain(25);
+	ASSERT_TRUE(BootstrapIndexedFile().store_blocks(path, 0, 9, bootstrap::compression_none, 4, chain));
+	check_file(path, 10, chain);
+
+	// appending starts after the file's last block, whatever block_start says
+	ASSERT_TRUE(BootstrapIndexedFile().store_blocks(path, 0, 24, bootstrap::compression_none, 4, chain));
+	check_file(path, 25, chain);
+	ASSERT_FALSE(boost::filesystem::exists(path.string() + ".tmp"));
+
+	BootstrapIndexedFile reader;
+	ASSERT_TRUE(reader.open_reader(path.string()));
+	uint64_t chunk_height;
+	ASSERT_TRUE(reader.seek_to_height(13, chunk_height));
+	ASSERT_EQ(10, chunk_height);
+	ASSERT_TRUE(reader.seek_to_height(9, chunk_height));
+	ASSERT_EQ(8, chunk_height);
+	ASSERT_FALSE(reader.seek_to_height(25, chunk_height));
+}
+
+TEST_F(BootstrapIndexedFileTest, append_needs_same_chain)
+{
+	const auto chain = make_chain(10);
+	ASSERT_TRUE(BootstrapIndexedFile().store_blocks(path, 0, 9, bootstrap::compression_none, 4, chain));
+
+	// the file's last block was reorganized away, the file is left as it was
+	ASSERT_FALSE(BootstrapIndexedFile().store_blocks(path, 0, 14, bootstrap::compression_none, 4, make_chain(15, 9)));
+	check_file(path, 10, chain);
+	ASSERT_FALSE(boost::filesystem::exists(path.string() + ".tmp"));
+
+	// a fork above the file's top is fine
+	const auto fork = make_chain(15, 10);
+	ASSERT_TRUE(BootstrapIndexedFile().store_blocks(path, 0, 14, bootstrap::compression_none, 4, fork));
+	check_file(path, 15, fork);
+}
+
+TEST_F(BootstrapIndexedFileTest, bad_index_bounds)
+{
+	ASSERT_TRUE(BootstrapIndexedFile().store_blocks(path, 0, 9, bootstrap::compression_none, 4, make_chain(10)));
+	const uint64_t size = boost::filesystem::file_size(path);
+
+	// footer: index offset (8), index size (4), magic (4)
+	std::fstream file(path.string(), std::ios_base::binary | std::ios_base::in | std::ios_base::out);
+	const uint32_t huge_size = 0xfffffff0;
+	file.seekp(size - 8);
+	file.write((const char *)&huge_size, sizeof(huge_size));
+	file.close();
+	ASSERT_FALSE(BootstrapIndexedFile().open_reader(path.string()));
+
+	boost::filesystem::resize_file(path, 8);
+	ASSERT_FALSE(BootstrapIndexedFile().open_reader(path.string()));
+}
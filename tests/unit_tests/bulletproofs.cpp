@@ -78,6 +78,19 @@ TEST(bulletproofs, valid_multi_random)
 	}
 }
 
+TEST(bulletproofs, valid_max_outputs)
+{
+	std::vector<uint64_t> amounts;
+	rct::keyV gamma;
+	for(size_t i = 0; i < cryptonote::common_config::BULLETPROOF_MAX_OUTPUTS; ++i)
+	{
+		amounts.push_back(i & 1 ? crypto::rand<uint64_t>() : 0xffffffffffffffff - i);
+		gamma.push_back(rct::skGen());
+	}
+	rct::Bulletproof proof = bulletproof_PROVE(amounts, gamma);
+	ASSERT_TRUE(rct::bulletproof_VERIFY(proof));
+}
+
 TEST(bulletproofs, multi_splitting)
 {
 	rct::ctkeyV sc, pc;
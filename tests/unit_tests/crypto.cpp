@@ -35,6 +35,10 @@
 
 #include "cryptonote_basic/cryptonote_basic_impl.h"
 
+extern "C" {
+#include "crypto/crypto-ops.h"
+}
+
 namespace
 {
 static constexpr const std::uint8_t source[] = {
@@ -96,3 +100,38 @@ TEST(Crypto, verify_32)
 		}
 	}
 }
+
+TEST(Crypto, point_at_infinity)
+{
+	// P - P, the way bulletproof verification gets to the identity
+	static const unsigned char scalar[32] = {7, 1, 2, 3};
+	ge_p3 p, r;
+	ge_cached cached;
+	ge_p1p1 p1;
+	ge_scalarmult_base(&p, scalar);
+	ASSERT_FALSE(ge_p3_is_point_at_infinity(&p));
+	ge_p3_to_cached(&cached, &p);
+	ge_sub(&p1, &p, &cached);
+	ge_p1p1_to_p3(&r, &p1);
+	ASSERT_TRUE(ge_p3_is_point_at_infinity(&r));
+
+	ASSERT_TRUE(ge_p3_is_point_at_infinity(&ge_p3_identity));
+	ASSERT_FALSE(ge_p3_is_point_at_infinity(&ge_p3_H));
+
+#if CRYPTO_OPS_FE64
+	// the identity with X, T and Z not reduced: p added to every limb
+	static const uint64_t p_limbs[5] = {0x7ffffffffffedULL, 0x7ffffffffffffULL, 0x7ffffffffffffULL, 0x7ffffffffffffULL, 0x7ffffffffffffULL};
+	ge_p3 q = ge_p3_identity;
+	for(int n = 0; n < 5; ++n)
+	{
+		q.X[n] += p_limbs[n];
+		q.T[n] += p_limbs[n];
+		q.Z[n] += p_limbs[n];
+	}
+	ASSERT_TRUE(ge_p3_is_point_at_infinity(&q));
+
+	// and X = p + 1 is not zero
+	q.X[0] += 1;
+	ASSERT_FALSE(ge_p3_is_point_at_infinity(&q));
+#endif
+}
@@ -1115,6 +1115,20 @@ TEST(ringct, H)
 	ASSERT_EQ(memcmp(&p3, &ge_p3_H, sizeof(ge_p3)), 0);
 }
 
+TEST(ringct, scalarmultH)
+{
+	ASSERT_EQ(rct::scalarmultH(rct::zero()), rct::identity());
+	ASSERT_EQ(rct::scalarmultH(rct::identity()), rct::H);
+	for(int n = 0; n < 64; ++n)
+	{
+		const rct::key a = rct::skGen(), b = rct::skGen();
+		ASSERT_EQ(rct::scalarmultH(a), rct::scalarmultKey(rct::H, a));
+		rct::key aGbH;
+		rct::addKeys_aGbH(aGbH, a, b);
+		ASSERT_EQ(aGbH, rct::addKeys(rct::scalarmultBase(a), rct::scalarmultKey(rct::H, b)));
+	}
+}
+
 TEST(ringct, mul8)
 {
 	ASSERT_EQ(rct::scalarmult8(rct::identity()), rct::identity());
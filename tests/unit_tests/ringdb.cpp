@@ -0,0 +1,165 @@
+// Copyright (c) 2014-2018, The Monero Project
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// FIXME: move this into a full wallet2 unit test suite, if possible
+
+#include "gtest/gtest.h"
+#include <boost/filesystem.hpp>
+
+#include "crypto/chacha.h"
+#include "crypto/crypto.h"
+#include "cryptonote_basic/cryptonote_format_utils.h"
+#include "wallet/ringdb.h"
+
+static crypto::chacha_key make_key()
+{
+	crypto::chacha_key key;
+	crypto::generate_chacha_key(std::string("ringdb test key"), key);
+	return key;
+}
+
+class RingDB : public ::testing::Test
+{
+  protected:
+	virtual void SetUp()
+	{
+		dir = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+		db.reset(new tools::ringdb(dir.string(), "genesis"));
+	}
+
+	virtual void TearDown()
+	{
+		db.reset();
+		boost::system::error_code ec;
+		boost::filesystem::remove_all(dir, ec);
+	}
+
+	boost::filesystem::path dir;
+	std::unique_ptr<tools::ringdb> db;
+	const crypto::chacha_key key = make_key();
+};
+
+TEST_F(RingDB, set_get_rings)
+{
+	const crypto::key_image ki0 = crypto::rand<crypto::key_image>();
+	const crypto::key_image ki1 = crypto::rand<crypto::key_image>();
+	const crypto::key_image missing = crypto::rand<crypto::key_image>();
+	const std::vector<uint64_t> ring0 = {3, 17, 1000, 123456};
+	const std::vector<uint64_t> ring1 = {0, 1, 2};
+	const std::vector<uint64_t> ring2 = {4, 40, 400};
+
+	ASSERT_TRUE(db->set_rings(key, {{ki0, ring0}, {ki1, ring1}}, false));
+
+	std::vector<std::vector<uint64_t>> rings;
+	ASSERT_TRUE(db->get_rings(key, {ki1, missing, ki0}, rings));
+	ASSERT_EQ(3, rings.size());
+	ASSERT_EQ(ring1, rings[0]);
+	ASSERT_TRUE(rings[1].empty());
+	ASSERT_EQ(ring0, rings[2]);
+
+	std::vector<uint64_t> ring;
+	ASSERT_TRUE(db->get_ring(key, ki0, ring));
+	ASSERT_EQ(ring0, ring);
+	ASSERT_FALSE(db->get_ring(key, missing, ring));
+
+	// a stored ring is replaced, relative offsets are taken as they are
+	ASSERT_TRUE(db->set_rings(key, {{ki1, cryptonote::absolute_output_offsets_to_relative(ring2)}}, true));
+	ASSERT_TRUE(db->get_ring(key, ki1, ring));
+	ASSERT_EQ(ring2, ring);
+
+	// the rings can only be found with the key they were stored with
+	crypto::chacha_key other_key;
+	crypto::generate_chacha_key(std::string("another ringdb test key"), other_key);
+	ASSERT_TRUE(db->get_rings(other_key, {ki0, ki1}, rings));
+	ASSERT_TRUE(rings[0].empty());
+	ASSERT_TRUE(rings[1].empty());
+}
+
+TEST_F(RingDB, empty_ring)
+{
+	const crypto::key_image ki = crypto::rand<crypto::key_image>();
+	ASSERT_TRUE(db->set_ring(key, ki, std::vector<uint64_t>(), false));
+
+	std::vector<uint64_t> ring;
+	ASSERT_FALSE(db->get_ring(key, ki, ring));
+
+	std::vector<std::vector<uint64_t>> rings;
+	ASSERT_TRUE(db->get_rings(key, {ki}, rings));
+	ASSERT_EQ(1, rings.size());
+	ASSERT_TRUE(rings[0].empty());
+}
+
+TEST_F(RingDB, blackball)
+{
+	std::vector<crypto::public_key> outputs;
+	for(size_t n = 0; n < 100; ++n)
+		outputs.push_back(crypto::rand<crypto::public_key>());
+	const crypto::public_key other = crypto::rand<crypto::public_key>();
+
+	ASSERT_TRUE(db->blackball(outputs));
+	for(const crypto::public_key &output : outputs)
+		ASSERT_TRUE(db->blackballed(output));
+	ASSERT_FALSE(db->blackballed(other));
+
+	// blackballing again is not an error
+	ASSERT_TRUE(db->blackball(outputs[0]));
+	ASSERT_TRUE(db->blackballed(outputs[0]));
+
+	const std::vector<crypto::public_key> half(outputs.begin(), outputs.begin() + outputs.size() / 2);
+	ASSERT_TRUE(db->unblackball(half));
+	for(size_t n = 0; n < outputs.size(); ++n)
+		ASSERT_EQ(n >= half.size(), db->blackballed(outputs[n]));
+
+	ASSERT_TRUE(db->clear_blackballs());
+	for(const crypto::public_key &output : outputs)
+		ASSERT_FALSE(db->blackballed(output));
+}
+
+TEST(RingDBBulk, persists)
+{
+	const boost::filesystem::path dir = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+	const crypto::chacha_key key = make_key();
+	const crypto::key_image ki = crypto::rand<crypto::key_image>();
+	const crypto::public_key output = crypto::rand<crypto::public_key>();
+	const std::vector<uint64_t> ring = {5, 6, 70};
+	{
+		tools::ringdb db(dir.string(), "genesis", true);
+		ASSERT_TRUE(db.set_ring(key, ki, ring, false));
+		ASSERT_TRUE(db.blackball(std::vector<crypto::public_key>(1, output)));
+		db.sync();
+	}
+	{
+		tools::ringdb db(dir.string(), "genesis");
+		std::vector<uint64_t> stored;
+		ASSERT_TRUE(db.get_ring(key, ki, stored));
+		ASSERT_EQ(ring, stored);
+		ASSERT_TRUE(db.blackballed(output));
+	}
+	boost::system::error_code ec;
+	boost::filesystem::remove_all(dir, ec);
+}
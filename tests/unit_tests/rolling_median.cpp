@@ -0,0 +1,119 @@
+// Copyright (c) 2017-2018, The Monero Project
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "common/rolling_median.h"
+#include "misc_language.h"
+#include "gtest/gtest.h"
+#include <random>
+
+namespace
+{
+uint64_t window_median(const std::deque<uint64_t> &values)
+{
+	std::vector<uint64_t> v(values.begin(), values.end());
+	return epee::misc_utils::median(v);
+}
+}
+
+TEST(rolling_median, empty)
+{
+	tools::rolling_median<uint64_t> m(10);
+	ASSERT_TRUE(m.empty());
+	ASSERT_EQ(m.median(), 0);
+}
+
+TEST(rolling_median, odd_even)
+{
+	tools::rolling_median<uint64_t> m(10);
+	m.push_back(5);
+	ASSERT_EQ(m.median(), 5);
+	m.push_back(1);
+	ASSERT_EQ(m.median(), 3);
+	m.push_back(9);
+	ASSERT_EQ(m.median(), 5);
+	m.push_back(9);
+	ASSERT_EQ(m.median(), 7);
+}
+
+TEST(rolling_median, evicts_oldest)
+{
+	tools::rolling_median<uint64_t> m(3);
+	m.push_back(100);
+	m.push_back(1);
+	m.push_back(2);
+	ASSERT_EQ(m.median(), 2);
+	m.push_back(3);
+	ASSERT_EQ(m.size(), 3);
+	ASSERT_EQ(m.front(), 1);
+	ASSERT_EQ(m.median(), 2);
+	m.pop_back();
+	m.push_front(100);
+	ASSERT_EQ(m.front(), 100);
+	ASSERT_EQ(m.median(), 2);
+	m.push_front(7);
+	ASSERT_EQ(m.size(), 3);
+	ASSERT_EQ(m.front(), 100);
+}
+
+TEST(rolling_median, matches_median)
+{
+	std::mt19937 rng(0);
+	const size_t capacity = 60;
+	tools::rolling_median<uint64_t> m(capacity);
+	std::deque<uint64_t> values;
+	std::deque<uint64_t> evicted;
+	for(size_t i = 0; i < 20000; ++i)
+	{
+		const unsigned op = rng() % 4;
+		if(op == 0 && !values.empty())
+		{
+			m.pop_back();
+			values.pop_back();
+			if(!evicted.empty())
+			{
+				m.push_front(evicted.back());
+				values.push_front(evicted.back());
+				evicted.pop_back();
+			}
+		}
+		else
+		{
+			// few distinct values so duplicates get exercised
+			const uint64_t v = rng() % 50;
+			m.push_back(v);
+			values.push_back(v);
+			if(values.size() > capacity)
+			{
+				evicted.push_back(values.front());
+				values.pop_front();
+			}
+		}
+		ASSERT_EQ(m.size(), values.size());
+		ASSERT_EQ(m.median(), values.empty() ? 0 : window_median(values));
+	}
+}
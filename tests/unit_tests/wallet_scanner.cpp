@@ -0,0 +1,237 @@
+// Copyright (c) 2014-2018, The Monero Project
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "gtest/gtest.h"
+
+#include "cryptonote_basic/cryptonote_format_utils.h"
+#include "string_tools.h"
+#include "wallet/wallet2.h"
+#include "wallet/wallet_scanner.h"
+
+// the scanner's shared stream, fed from blocks made up here instead of a daemon
+class wallet_scanner_test : public ::testing::Test
+{
+  protected:
+	typedef tools::wallet2::parsed_block parsed_block;
+	typedef std::function<bool(uint64_t, const cryptonote::block &)> wants_txes_t;
+
+	static void make_wallet(tools::wallet2 &wallet, uint64_t refresh_from_height)
+	{
+		crypto::secret_key spendkey;
+		epee::string_tools::hex_to_pod("ee0085dbecc26a02415b0b7abab1ce0ef2b18a393d35e39ef5720dd5ba058806", spendkey);
+		wallet.init("");
+		wallet.set_subaddress_lookahead(1, 1);
+		wallet.generate_legacy("", "", spendkey);
+		wallet.m_account.set_createtime(0);
+		wallet.explicit_refresh_from_block_height(refresh_from_height > 0);
+		wallet.set_refresh_from_block_height(refresh_from_height);
+	}
+
+	// the wallet's genesis, then blocks with a transaction each, the ones from
+	// fork_height on mined with another nonce
+	static void make_chain(const tools::wallet2 &wallet, uint64_t height, uint64_t fork_height, std::vector<cryptonote::block_complete_entry> &chain)
+	{
+		chain.clear();
+		cryptonote::block genesis;
+		wallet.generate_genesis(genesis);
+		chain.push_back({cryptonote::block_to_blob(genesis), {}});
+
+		for(uint64_t h = 1; h < height; ++h)
+		{
+			cryptonote::transaction tx;
+			tx.version = 1;
+			tx.unlock_time = 0;
+			cryptonote::txin_to_key in;
+			in.amount = 1;
+			in.key_offsets.push_back(h);
+			in.k_image = crypto::key_image();
+			memcpy(&in.k_image, &h, sizeof(h));
+			tx.vin.push_back(in);
+			tx.signatures.resize(1);
+			tx.signatures[0].resize(1);
+
+			cryptonote::block b;
+			b.major_version = 1;
+			b.minor_version = 0;
+			b.timestamp = 1500000000 + h * 120;
+			b.prev_id = crypto::null_hash;
+			b.nonce = h >= fork_height ? 2 * h + 1 : 2 * h;
+			b.miner_tx.version = 1;
+			b.miner_tx.unlock_time = h + 60;
+			cryptonote::txin_gen gen;
+			gen.height = h;
+			b.miner_tx.vin.push_back(gen);
+			b.tx_hashes.push_back(cryptonote::get_transaction_hash(tx));
+			chain.push_back({cryptonote::block_to_blob(b), {cryptonote::tx_to_blob(tx)}});
+		}
+	}
+
+	static void parse(const std::vector<cryptonote::block_complete_entry> &chain, uint64_t start_height, const wants_txes_t &wants_txes, std::vector<parsed_block> &parsed, std::vector<cryptonote::COMMAND_RPC_GET_BLOCKS_FAST::block_output_indices> &o_indices)
+	{
+		std::list<cryptonote::block_complete_entry> blocks(chain.begin() + start_height, chain.end());
+		tools::wallet2::parse_blocks(start_height, blocks, wants_txes, parsed);
+		o_indices.clear();
+		for(const auto &bche : blocks)
+		{
+			o_indices.push_back(cryptonote::COMMAND_RPC_GET_BLOCKS_FAST::block_output_indices());
+			o_indices.back().indices.resize(bche.txs.size() + 1);
+		}
+	}
+
+	static uint64_t process(tools::wallet2 &wallet, uint64_t start_height, const std::vector<parsed_block> &parsed, const std::vector<cryptonote::COMMAND_RPC_GET_BLOCKS_FAST::block_output_indices> &o_indices)
+	{
+		uint64_t added;
+		wallet.process_parsed_blocks(start_height, parsed, o_indices, added);
+		return added;
+	}
+
+	static bool wants_block_txes(const tools::wallet2 &wallet, uint64_t height, const cryptonote::block &b)
+	{
+		return wallet.wants_block_txes(height, b);
+	}
+
+	static const crypto::hash &block_hash(const tools::wallet2 &wallet, uint64_t height)
+	{
+		return wallet.m_blockchain[height];
+	}
+
+	static size_t txes(const parsed_block &pb)
+	{
+		return pb.txes.size();
+	}
+
+	static const crypto::hash &hash(const parsed_block &pb)
+	{
+		return pb.hash;
+	}
+};
+
+TEST_F(wallet_scanner_test, parse_skips_txes_no_wallet_scans)
+{
+	tools::wallet2 wallet;
+	make_wallet(wallet, 4);
+	std::vector<cryptonote::block_complete_entry> chain;
+	make_chain(wallet, 8, (uint64_t)-1, chain);
+
+	std::vector<parsed_block> parsed;
+	std::vector<cryptonote::COMMAND_RPC_GET_BLOCKS_FAST::block_output_indices> o_indices;
+	parse(chain, 0, [&](uint64_t height, const cryptonote::block &b) { return wants_block_txes(wallet, height, b); }, parsed, o_indices);
+	ASSERT_EQ(8, parsed.size());
+	for(uint64_t h = 1; h < 8; ++h)
+	{
+		ASSERT_EQ(h >= 4 ? 1 : 0, txes(parsed[h]));
+		ASSERT_NE(crypto::null_hash, hash(parsed[h]));
+	}
+
+	// the blocks without their transactions are still followed
+	ASSERT_EQ(7, process(wallet, 0, parsed, o_indices));
+	ASSERT_EQ(8, wallet.get_blockchain_current_height());
+	ASSERT_EQ(hash(parsed[7]), block_hash(wallet, 7));
+}
+
+TEST_F(wallet_scanner_test, wallet_needing_skipped_txes_fails)
+{
+	tools::wallet2 wallet;
+	make_wallet(wallet, 0);
+	std::vector<cryptonote::block_complete_entry> chain;
+	make_chain(wallet, 4, (uint64_t)-1, chain);
+
+	std::vector<parsed_block> parsed;
+	std::vector<cryptonote::COMMAND_RPC_GET_BLOCKS_FAST::block_output_indices> o_indices;
+	parse(chain, 0, [](uint64_t height, const cryptonote::block &b) { return false; }, parsed, o_indices);
+	ASSERT_THROW(process(wallet, 0, parsed, o_indices), tools::error::wallet_internal_error);
+}
+
+TEST_F(wallet_scanner_test, one_parse_for_several_wallets)
+{
+	tools::wallet2 early, late;
+	make_wallet(early, 0);
+	make_wallet(late, 6);
+	std::vector<cryptonote::block_complete_entry> chain;
+	make_chain(early, 10, (uint64_t)-1, chain);
+
+	std::vector<parsed_block> parsed;
+	std::vector<cryptonote::COMMAND_RPC_GET_BLOCKS_FAST::block_output_indices> o_indices;
+	parse(chain, 0, [&](uint64_t height, const cryptonote::block &b) { return wants_block_txes(early, height, b) || wants_block_txes(late, height, b); }, parsed, o_indices);
+	for(uint64_t h = 1; h < 10; ++h)
+		ASSERT_EQ(1, txes(parsed[h]));
+
+	ASSERT_EQ(9, process(early, 0, parsed, o_indices));
+	ASSERT_EQ(9, process(late, 0, parsed, o_indices));
+	ASSERT_EQ(10, early.get_blockchain_current_height());
+	ASSERT_EQ(10, late.get_blockchain_current_height());
+	for(uint64_t h = 0; h < 10; ++h)
+		ASSERT_EQ(block_hash(early, h), block_hash(late, h));
+}
+
+TEST_F(wallet_scanner_test, shared_batch_follows_reorg)
+{
+	tools::wallet2 ahead, behind;
+	make_wallet(ahead, 0);
+	make_wallet(behind, 0);
+	std::vector<cryptonote::block_complete_entry> chain, fork;
+	make_chain(ahead, 8, (uint64_t)-1, chain);
+	make_chain(ahead, 10, 5, fork);
+	auto wants_all = [](uint64_t height, const cryptonote::block &b) { return true; };
+
+	std::vector<parsed_block> parsed;
+	std::vector<cryptonote::COMMAND_RPC_GET_BLOCKS_FAST::block_output_indices> o_indices;
+	parse(chain, 0, wants_all, parsed, o_indices);
+	ASSERT_EQ(7, process(ahead, 0, parsed, o_indices));
+	const crypto::hash replaced = block_hash(ahead, 5);
+
+	// the wallet behind drives the batch, the one ahead skips what it has and
+	// detaches the blocks the fork replaces
+	std::vector<cryptonote::block_complete_entry> short_chain(chain.begin(), chain.begin() + 3);
+	parse(short_chain, 0, wants_all, parsed, o_indices);
+	ASSERT_EQ(2, process(behind, 0, parsed, o_indices));
+
+	parse(fork, 2, wants_all, parsed, o_indices);
+	ASSERT_EQ(7, process(behind, 2, parsed, o_indices));
+	process(ahead, 2, parsed, o_indices);
+	ASSERT_EQ(10, ahead.get_blockchain_current_height());
+	ASSERT_EQ(10, behind.get_blockchain_current_height());
+	for(uint64_t h = 0; h < 10; ++h)
+		ASSERT_EQ(block_hash(behind, h), block_hash(ahead, h));
+	ASSERT_NE(replaced, block_hash(ahead, 5));
+	ASSERT_EQ(hash(parsed[5 - 2]), block_hash(ahead, 5));
+}
+
+TEST_F(wallet_scanner_test, wallets_are_registered_once)
+{
+	tools::wallet2 wallet0, wallet1;
+	tools::wallet_scanner scanner;
+	scanner.add_wallet(&wallet0);
+	scanner.add_wallet(&wallet1);
+	scanner.add_wallet(&wallet0);
+	ASSERT_EQ(2, scanner.size());
+	scanner.remove_wallet(&wallet0);
+	ASSERT_EQ(1, scanner.size());
+	scanner.remove_wallet(&wallet0);
+	ASSERT_EQ(1, scanner.size());
+}